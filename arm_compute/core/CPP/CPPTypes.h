@@ -32,6 +32,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -216,6 +217,27 @@ public:
      * @return Vector length if sme2 is enabled, otherwise returns 0.
      */
     uint64_t get_sme2_vector_length_in_bits() const;
+    /** Return the number of NUMA nodes in the system
+     *
+     * @note Systems that do not expose their NUMA topology are reported as a single node.
+     *
+     * @return Number of NUMA nodes
+     */
+    unsigned int get_numa_node_count() const;
+    /** Return the logical CPU ids belonging to a given NUMA node
+     *
+     * @param[in] node NUMA node id
+     *
+     * @return The CPU ids of the node, empty if the node does not exist
+     */
+    std::vector<unsigned int> get_numa_node_cpus(unsigned int node) const;
+    /** Return the NUMA node a given logical CPU belongs to
+     *
+     * @param[in] cpuid Logical CPU id
+     *
+     * @return The NUMA node id, -1 if the CPU is not part of any node
+     */
+    int get_numa_node_of_cpu(unsigned int cpuid) const;
 
 private:
     struct Impl;
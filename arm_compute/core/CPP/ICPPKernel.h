@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, 2025 Arm Limited.
+ * Copyright (c) 2016-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -108,6 +108,21 @@ public:
         return default_mws;
     }
 
+    /** Estimate of the arithmetic operations done by a run of the kernel
+     *
+     * Used by @ref KernelTelemetry to report the throughput of the kernels.
+     *
+     * @param[in] window Region the kernel runs on. (Must be a region of the window returned by window())
+     *
+     * @return Number of arithmetic operations, 0 if the kernel does not provide an estimate.
+     */
+    virtual uint64_t flops_estimate(const Window &window) const
+    {
+        ARM_COMPUTE_UNUSED(window);
+
+        return 0;
+    }
+
     /** Name of the kernel
      *
      * @return Kernel name
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,16 +30,21 @@
 
 #include "arm_compute/core/experimental/Types.h"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
+#include <vector>
 
 namespace arm_compute
 {
 // Forward declaration
 class ITensor;
 
-/** Tensor packing service */
+/** Tensor packing service
+ *
+ * Packs are rebuilt on every run of the operators, so the tensors are stored in a flat array that only moves to the
+ * heap past @ref inline_capacity tensors. Lookups are linear, which is faster than hashing for such small sizes.
+ */
 class ITensorPack
 {
 public:
@@ -58,6 +63,14 @@ public:
         const ITensor *ctensor{nullptr};
     };
 
+public:
+    /** Number of tensors stored without any heap allocation
+     *
+     * Covers the largest packs rebuilt on every run by the floating point operators, e.g. the GEMM pack of
+     * @ref CpuGemmConv2d holding its 4 inputs and outputs, 3 convolution and 3 assembly GEMM workspace tensors.
+     */
+    static constexpr size_t inline_capacity = 10;
+
 public:
     /** Default Constructor */
     ITensorPack() = default;
@@ -114,7 +127,36 @@ public:
     bool empty() const;
 
 private:
-    std::unordered_map<int, PackElement> _pack{}; /**< Container with the packed tensors */
+    /** Find the element stored with the given id
+     *
+     * @param[in] id ID of the tensor to find
+     *
+     * @return The element if it exists else nullptr
+     */
+    PackElement *find(int id);
+    /** Find the element stored with the given id
+     *
+     * @param[in] id ID of the tensor to find
+     *
+     * @return The element if it exists else nullptr
+     */
+    const PackElement *find(int id) const;
+    /** Element at a given position of the pack
+     *
+     * @param[in] idx Position of the element. Must be less than @ref size()
+     *
+     * @return The element at the given position
+     */
+    PackElement &at(size_t idx);
+    /** Store a new element, or replace the one with the same id
+     *
+     * @param[in] element Element to store
+     */
+    void store(const PackElement &element);
+
+    std::array<PackElement, inline_capacity> _inline{};   /**< First packed tensors */
+    std::vector<PackElement>                 _overflow{}; /**< Packed tensors past the inline capacity */
+    size_t                                   _size{0};    /**< Number of packed tensors */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_ITENSORPACK_H
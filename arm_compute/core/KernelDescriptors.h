@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, 2025 Arm Limited.
+ * Copyright (c) 2019-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,19 @@ struct FFTRadixStageKernelInfo
     bool         is_first_stage{false}; /**< Flags if the FFT kernels is the first stage of a decomposed FFT. */
 };
 
+/** Descriptor for FFT real spectrum kernels */
+struct FFTRealSpectrumKernelInfo
+{
+    bool inverse{false}; /**< Merges a spectrum into a packed half-length spectrum when true, splits it otherwise. */
+};
+
+/** Descriptor for FFT Bluestein kernels */
+struct FFTBluesteinKernelInfo
+{
+    unsigned int axis{0};    /**< Axis to perform the kernel on. */
+    float        scale{1.f}; /**< Factor the output is multiplied by. */
+};
+
 class ITensorInfo;
 /** Descriptor used by the GEMM kernels */
 struct GEMMKernelInfo
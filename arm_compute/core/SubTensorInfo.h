@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,17 @@ public:
      * @param[in] extend_parent (Optional) Extend parent with subtensor shape if subtensor indexes out of bounds
      */
     SubTensorInfo(ITensorInfo *parent, TensorShape tensor_shape, Coordinates coords, bool extend_parent = false);
+    /** Constructor of a strided view
+     *
+     * The view aliases every steps[i]-th element of the parent along dimension i, starting from coords.
+     * Its strides are therefore the parent's strides scaled by the steps, so no data has to be copied.
+     *
+     * @param[in] parent       Metadata of parent tensor.
+     * @param[in] tensor_shape Tensor shape. The strided view must fit inside parent's shape.
+     * @param[in] coords       Coordinates of starting element inside parent tensor.
+     * @param[in] steps        Step in elements along each dimension. Dimensions not specified default to 1.
+     */
+    SubTensorInfo(ITensorInfo *parent, TensorShape tensor_shape, Coordinates coords, const Coordinates &steps);
     /** Default destructor */
     ~SubTensorInfo() = default;
     /** Allow instances of this class to be copy constructed */
@@ -73,6 +84,14 @@ public:
     {
         return _coords;
     }
+    /** Returns the steps of the sub-tensor inside the parent tensor
+     *
+     * @return Sub-tensor steps, in elements, along each dimension
+     */
+    Coordinates steps() const
+    {
+        return _steps;
+    }
 
     // Inherited methods overridden:
     std::unique_ptr<ITensorInfo> clone() const override;
@@ -135,11 +154,7 @@ public:
         ARM_COMPUTE_ERROR_ON(_parent == nullptr);
         return get_data_layout_dimension_index(_parent->data_layout(), dimension);
     }
-    const Strides &strides_in_bytes() const override
-    {
-        ARM_COMPUTE_ERROR_ON(_parent == nullptr);
-        return _parent->strides_in_bytes();
-    }
+    const Strides &strides_in_bytes() const override;
     size_t offset_first_element_in_bytes() const override
     {
         ARM_COMPUTE_ERROR_ON(_parent == nullptr);
@@ -270,9 +285,12 @@ private:
     TensorShape     _tensor_shape;
     TensorDimsState _dims_state;
     Coordinates     _coords;
+    Coordinates     _steps;
+    mutable Strides _strides;
     ValidRegion     _valid_region;
     bool            _extend_parent;
     bool            _lock_paddings;
+    bool            _is_strided;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_SUBTENSORINFO_H
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEFUSIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEFUSIONINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CoreTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+/** Operations supported by the elementwise fusion engine */
+enum class ElementwiseFusionOp
+{
+    ADD,          /**< (x + y) */
+    SUB,          /**< (x - y) */
+    MUL,          /**< (x * y) */
+    DIV,          /**< (x / y) */
+    MAX,          /**< Max(x, y) */
+    MIN,          /**< Min(x, y) */
+    SQUARED_DIFF, /**< (x - y)^2 */
+    ACTIVATION,   /**< Activation function described by @ref ElementwiseFusionNode::act_info */
+    ABS,          /**< |x| */
+    NEG,          /**< -x */
+    EXP,          /**< e^x */
+    RSQRT,        /**< 1 / sqrt(x) */
+    CAST          /**< Conversion of x to the type described by @ref ElementwiseFusionNode::data_type */
+};
+
+/** Check whether an elementwise fusion operation takes two operands
+ *
+ * @param[in] op Operation to check
+ *
+ * @return True if the operation is binary
+ */
+inline bool is_binary_op(ElementwiseFusionOp op)
+{
+    return op <= ElementwiseFusionOp::SQUARED_DIFF;
+}
+
+/** Node of an elementwise fusion program
+ *
+ * Operands are value ids: ids in [0, num_inputs) refer to the input tensors of the program
+ * while id (num_inputs + i) refers to the result of the i-th node.
+ */
+struct ElementwiseFusionNode
+{
+    ElementwiseFusionOp op{ElementwiseFusionOp::ADD}; /**< Operation to perform */
+    int                 lhs{-1};                      /**< Value id of the first operand */
+    int                 rhs{-1};                      /**< Value id of the second operand, -1 for unary operations */
+    ActivationLayerInfo act_info{};                   /**< Activation to run for @ref ElementwiseFusionOp::ACTIVATION */
+    DataType            data_type{DataType::UNKNOWN}; /**< Data type to convert to for @ref ElementwiseFusionOp::CAST */
+    QuantizationInfo    qinfo{};                      /**< Quantization used by @ref ElementwiseFusionOp::CAST */
+};
+
+/** Elementwise fusion program
+ *
+ * Describes a small DAG of elementwise operations over broadcast-compatible input tensors.
+ * Nodes are stored in topological order, as each node can only consume the inputs or the results
+ * of the nodes added before it. The result of the last node is written to the destination tensor,
+ * converted or quantized to the destination data type. Intermediate values are F32, and a
+ * @ref ElementwiseFusionOp::CAST node rounds and saturates a value as a conversion to another type would.
+ *
+ * For example, dst = relu((a + b) * c) - a can be described as:
+ * @code{.cpp}
+ * ElementwiseFusionInfo info(3);
+ * const int sum  = info.add_binary(ElementwiseFusionOp::ADD, info.input(0), info.input(1));
+ * const int prod = info.add_binary(ElementwiseFusionOp::MUL, sum, info.input(2));
+ * const int act  = info.add_activation(prod, ActivationLayerInfo(ActivationFunction::RELU));
+ * info.add_binary(ElementwiseFusionOp::SUB, act, info.input(0));
+ * @endcode
+ */
+class ElementwiseFusionInfo
+{
+public:
+    /** Maximum number of values (inputs and intermediate results) a program can hold */
+    static constexpr unsigned int max_values = 16;
+
+    /** Default constructor */
+    ElementwiseFusionInfo() = default;
+    /** Constructor
+     *
+     * @param[in] num_inputs Number of input tensors of the program
+     */
+    explicit ElementwiseFusionInfo(unsigned int num_inputs) : _num_inputs(num_inputs), _nodes()
+    {
+    }
+    /** Value id of an input tensor
+     *
+     * @param[in] idx Index of the input tensor
+     *
+     * @return The value id of the input
+     */
+    int input(unsigned int idx) const
+    {
+        ARM_COMPUTE_ERROR_ON(idx >= _num_inputs);
+        return static_cast<int>(idx);
+    }
+    /** Append a binary operation to the program
+     *
+     * @param[in] op  Binary operation to perform
+     * @param[in] lhs Value id of the first operand
+     * @param[in] rhs Value id of the second operand
+     *
+     * @return The value id of the result
+     */
+    int add_binary(ElementwiseFusionOp op, int lhs, int rhs)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_binary_op(op));
+        return add_node(ElementwiseFusionNode{op, lhs, rhs, ActivationLayerInfo()});
+    }
+    /** Append a unary operation to the program
+     *
+     * @param[in] op  Unary operation to perform
+     * @param[in] src Value id of the operand
+     *
+     * @return The value id of the result
+     */
+    int add_unary(ElementwiseFusionOp op, int src)
+    {
+        ARM_COMPUTE_ERROR_ON(is_binary_op(op));
+        return add_node(ElementwiseFusionNode{op, src, -1, ActivationLayerInfo()});
+    }
+    /** Append an activation to the program
+     *
+     * @param[in] src      Value id of the operand
+     * @param[in] act_info Activation to perform
+     *
+     * @return The value id of the result
+     */
+    int add_activation(int src, const ActivationLayerInfo &act_info)
+    {
+        return add_node(ElementwiseFusionNode{ElementwiseFusionOp::ACTIVATION, src, -1, act_info});
+    }
+    /** Append a conversion to the program
+     *
+     * The operand is converted to @p data_type, quantized with @p qinfo for quantized types, and converted
+     * back to F32, so the nodes consuming the result see the rounding and saturation of the conversion.
+     *
+     * @param[in] src       Value id of the operand
+     * @param[in] data_type Data type to convert to. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32
+     * @param[in] qinfo     (Optional) Quantization information of @p data_type
+     *
+     * @return The value id of the result
+     */
+    int add_cast(int src, DataType data_type, const QuantizationInfo &qinfo = QuantizationInfo())
+    {
+        return add_node(
+            ElementwiseFusionNode{ElementwiseFusionOp::CAST, src, -1, ActivationLayerInfo(), data_type, qinfo});
+    }
+    /** Number of input tensors of the program */
+    unsigned int num_inputs() const
+    {
+        return _num_inputs;
+    }
+    /** Number of values (inputs and intermediate results) of the program */
+    unsigned int num_values() const
+    {
+        return _num_inputs + static_cast<unsigned int>(_nodes.size());
+    }
+    /** Nodes of the program in execution order */
+    const std::vector<ElementwiseFusionNode> &nodes() const
+    {
+        return _nodes;
+    }
+
+private:
+    int add_node(const ElementwiseFusionNode &node)
+    {
+        _nodes.push_back(node);
+        return static_cast<int>(num_values()) - 1;
+    }
+
+    unsigned int                       _num_inputs{0};
+    std::vector<ElementwiseFusionNode> _nodes{};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEFUSIONINFO_H
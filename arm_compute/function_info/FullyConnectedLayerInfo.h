@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,8 @@ struct FullyConnectedLayerInfo
     bool       enable_fast_math{false};                  /**<  Enable fast math computation. */
     /* Other parameters */
     bool fp_mixed_precision{false}; /**<  Use wider accumulators (32 bit instead of 16 for FP16) to improve accuracy. */
+    /* Weights streaming */
+    unsigned int weights_prefetch_distance{0}; /**<  Bytes of weights prefetched ahead of their use, 0 to disable. */
 
     /** Sets the weights trained data layout
      *
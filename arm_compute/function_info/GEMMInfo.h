@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,7 +106,8 @@ public:
           _fixed_format(false),
           _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
           _accumulate(false),
-          _use_fp32_acc(false)
+          _use_fp32_acc(false),
+          _weights_prefetch_distance(0)
     {
     }
     /** Constructor
@@ -162,7 +163,8 @@ public:
           _fixed_format(fixed_format),
           _weight_format(weight_format),
           _accumulate(accumulate),
-          _use_fp32_acc(use_fp32_acc)
+          _use_fp32_acc(use_fp32_acc),
+          _weights_prefetch_distance(0)
     {
     }
     /** Flag which specifies if the matrix A has been reshaped
@@ -378,6 +380,25 @@ public:
     {
         _use_fp32_acc = use_fp32_acc;
     }
+    /** Number of bytes of the reshaped matrix B prefetched ahead of the computation
+     *
+     * @return The prefetch distance in bytes, 0 if the prefetching is left to the hardware
+     */
+    unsigned int weights_prefetch_distance() const
+    {
+        return _weights_prefetch_distance;
+    }
+    /** Set the number of bytes of the reshaped matrix B to prefetch ahead of the computation
+     *
+     * Only used when matrix A has a single row, where the weights are read once per run and the speed is bound by the
+     * memory bandwidth. The distance is best set to a fraction of the size of the L2 cache.
+     *
+     * @param[in] distance Prefetch distance in bytes, 0 to leave the prefetching to the hardware
+     */
+    void set_weights_prefetch_distance(unsigned int distance)
+    {
+        _weights_prefetch_distance = distance;
+    }
 
 private:
     bool                      _is_a_reshaped;
@@ -397,6 +418,7 @@ private:
     arm_compute::WeightFormat _weight_format;
     bool                      _accumulate;
     bool                      _use_fp32_acc;
+    unsigned int              _weights_prefetch_distance;
 };
 } //namespace arm_compute
 #endif // ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINFO_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,8 @@
 #include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphCalibrator.h"
+#include "arm_compute/graph/GraphPipeline.h"
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/graph/IGraphMutator.h"
 #include "arm_compute/graph/IGraphPrinter.h"
@@ -54,6 +56,7 @@
 // Frontend
 #include "arm_compute/graph/frontend/IStreamOperators.h"
 #include "arm_compute/graph/frontend/Layers.h"
+#include "arm_compute/graph/frontend/RequestBatcher.h"
 #include "arm_compute/graph/frontend/Stream.h"
 #include "arm_compute/graph/frontend/SubStream.h"
 #include "arm_compute/graph/frontend/Types.h"
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -216,6 +216,9 @@ public:
     Tensor *tensor(TensorID id);
 
 private:
+    // Adds the consumer-side tensors of the pipeline stage boundaries
+    friend class GraphPipeline;
+
     /** Creates a tensor object
      *
      * @param[in] desc Tensor descriptor
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_GRAPHCALIBRATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_GRAPHCALIBRATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Types.h"
+
+#include <map>
+#include <string>
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class Tensor;
+
+/** Value ranges of the tensors of a floating-point graph collected over a calibration set
+ *
+ * Ranges are keyed by tensor ID, so they only apply to graphs built in the same way as the calibrated one.
+ */
+class CalibrationData final
+{
+public:
+    /** Extends the range of a tensor
+     *
+     * @param[in] tid Tensor ID
+     * @param[in] min Minimum value observed
+     * @param[in] max Maximum value observed
+     */
+    void update(TensorID tid, float min, float max);
+    /** Returns the range of a tensor
+     *
+     * @param[in]  tid Tensor ID
+     * @param[out] min Minimum value observed
+     * @param[out] max Maximum value observed
+     *
+     * @return True if the tensor has been observed else false
+     */
+    bool range(TensorID tid, float &min, float &max) const;
+    /** Returns the number of observed tensors
+     *
+     * @return Number of observed tensors
+     */
+    size_t size() const;
+    /** Loads the ranges from a file
+     *
+     * @param[in] filename File to load the ranges from
+     */
+    void load(const std::string &filename);
+    /** Saves the ranges to a file
+     *
+     * @param[in] filename File to save the ranges to
+     */
+    void save(const std::string &filename) const;
+
+private:
+    std::map<TensorID, std::pair<float, float>> _ranges{}; /**< Minimum and maximum value of each tensor */
+};
+
+/** Collects the value ranges of a floating-point graph over a calibration set
+ *
+ * The graph is finalized without any of the mutating passes that rewrite its structure, so the tensor IDs of the
+ * collected ranges match the ones of a freshly built copy of the graph. It is then run until one of its input
+ * accessors returns false, observing the inputs and outputs of every executed node.
+ *
+ * The collected ranges are consumed by @ref CalibratedQuantizationMutator, e.g. by saving them and setting
+ * GraphConfig::calibration_file when finalizing a second copy of the graph.
+ *
+ * @note Only F32 graphs can be calibrated
+ */
+class GraphCalibrator final
+{
+public:
+    /** Default Constructor */
+    GraphCalibrator();
+    /** Finalizes a graph and runs it over the calibration set provided by its input accessors
+     *
+     * @note The graph cannot be finalized again afterwards
+     *
+     * @param[in, out] g      Graph to calibrate
+     * @param[in]      target Execution target
+     * @param[in]      config (Optional) Graph configuration to use
+     */
+    void calibrate(Graph &g, Target target, const GraphConfig &config = GraphConfig());
+    /** Returns the ranges collected so far
+     *
+     * @return The calibration data
+     */
+    const CalibrationData &data() const;
+
+private:
+    /** Extends the range of a tensor with its current contents */
+    void observe(Tensor *tensor);
+
+    CalibrationData _data; /**< Collected ranges */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_GRAPHCALIBRATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,10 +28,12 @@
  * @publicapi
  */
 
+#include "arm_compute/graph/GraphPipeline.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
 
 #include <map>
+#include <memory>
 
 namespace arm_compute
 {
@@ -83,7 +85,8 @@ public:
     void invalidate_graph(Graph &graph);
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    std::map<GraphID, ExecutionWorkload>              _workloads = {}; /**< Graph workloads */
+    std::map<GraphID, std::unique_ptr<GraphPipeline>> _pipelines = {}; /**< Pipelines of the pipelined graphs */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_GRAPHPIPELINE_H
+#define ACL_ARM_COMPUTE_GRAPH_GRAPHPIPELINE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+struct ExecutionTask;
+struct ExecutionWorkload;
+
+/** Pipelined execution of a graph over a stream of inputs
+ *
+ * The nodes of the graph are split, in topological order, into stages. Each stage runs on its own thread with its
+ * own scheduler, whose workers are pinned to a group of cores. Consecutive inputs are streamed through the stages, so
+ * that stage s works on input n while stage s + 1 works on input n - 1. This adds some latency to every input but
+ * keeps all the core groups busy, which raises the sustained throughput when a single input cannot use every core
+ * efficiently.
+ *
+ * A tensor produced in one stage and consumed in a later one is a boundary tensor. It is given one buffer per stage
+ * it has to cross, plus the one being written, and the buffers are rotated between the producer tensor and the
+ * consumer-side tensors after every step, so no data is ever copied between the stages.
+ *
+ * @note Only the NEON target is supported
+ * @note Every stage thread installs its scheduler through @ref Scheduler::set(std::shared_ptr<IScheduler>), which
+ *       needs the library to be built with ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+ */
+class GraphPipeline final
+{
+public:
+    /** Default Constructor */
+    GraphPipeline();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    GraphPipeline(const GraphPipeline &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    GraphPipeline &operator=(const GraphPipeline &) = delete;
+    /** Destructor: stops the stage threads */
+    ~GraphPipeline();
+    /** Checks whether pipelined execution is supported by this build of the library
+     *
+     * @return True if the schedulers are local to the threads, so that every stage can drive its own scheduler
+     */
+    static bool is_supported();
+    /** Splits the cores of the system into groups, one per pipeline stage
+     *
+     * Big and little cores are never mixed within a group. On big.LITTLE systems the stages are shared between the
+     * two clusters in proportion to their compute capacity, with the first stages running on the big cores.
+     *
+     * @param[in] num_stages Number of stages. Clamped to the number of cores.
+     *
+     * @return The logical CPU ids of each group
+     */
+    static std::vector<std::vector<unsigned int>> make_core_groups(unsigned int num_stages);
+    /** Splits the nodes of a graph into stages
+     *
+     * Nodes are split into contiguous runs of the topological order, whose estimated cost is proportional to the
+     * compute capacity of the core group they run on. Stages are never cut across a tensor that shares its memory
+     * with another tensor (e.g. a sub-tensor): when this leaves no valid cut for a stage, the stage is merged with the
+     * previous one, so the graph may end up with fewer stages than requested. Every boundary tensor gets a separate
+     * consumer-side tensor for each later stage it is read in, and its consumers are bound to it.
+     *
+     * @note Must be called before the nodes are configured
+     *
+     * @param[in, out] g          Graph to split. Consumer-side tensors are added to it.
+     * @param[in]      node_order Nodes of the graph in topological order
+     * @param[in]      num_stages Number of stages
+     */
+    void partition(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages);
+    /** Binds the tasks of the configured workload to the stages
+     *
+     * The boundary tensors and their consumer-side tensors are given the same padding, so that they can exchange
+     * buffers.
+     *
+     * @note Must be called after the nodes are configured and before the tensors are allocated
+     *
+     * @param[in] workload Workload of the partitioned graph
+     */
+    void configure(ExecutionWorkload &workload);
+    /** Allocates the buffers of the boundary tensors and starts the stage threads
+     *
+     * @note Must be called after the tensors of the graph are allocated
+     */
+    void allocate();
+    /** Streams inputs through the stages
+     *
+     * Returns when an input accessor returns false, once the inputs already in the pipeline have been processed, or
+     * when an output accessor returns false, in which case the inputs still in the pipeline are dropped.
+     *
+     * @param[in] workload Workload of the partitioned graph
+     */
+    void run(ExecutionWorkload &workload);
+    /** Returns the number of stages
+     *
+     * @return Number of stages
+     */
+    unsigned int num_stages() const;
+
+private:
+    /** Pipeline stage */
+    struct Stage
+    {
+        std::vector<unsigned int>    cpus{};           /**< Logical CPU ids the stage runs on */
+        float                        capacity{0.f};    /**< Compute capacity of the cores, in big cores */
+        std::vector<ExecutionTask *> tasks{};          /**< Tasks of the stage in execution order */
+        bool                         has_input{false}; /**< Whether the stage has an input to process in this step */
+        bool                         accepted{false};  /**< Whether the input accessors provided an input */
+        bool                         more{true};       /**< Whether the output accessors expect more outputs */
+        std::thread                  thread{};         /**< Thread running the stage */
+    };
+    /** Boundary tensor along with the buffers it rotates through */
+    struct Boundary
+    {
+        TensorID                                       producer{NullTensorID}; /**< Tensor written by the producer */
+        std::vector<std::pair<unsigned int, TensorID>> consumers{};            /**< Delays and consumer-side tensors */
+        std::vector<std::unique_ptr<IMemoryRegion>>    buffers{};              /**< One buffer per delay plus one */
+        size_t                                         head{0};                /**< Buffer written by the producer */
+    };
+
+    /** Runs the steps of a stage until the pipeline is destroyed
+     *
+     * @param[in] idx Stage index
+     */
+    void stage_loop(unsigned int idx);
+    /** Processes the input held by a stage, if any
+     *
+     * @param[in] idx Stage index
+     */
+    void process(unsigned int idx);
+    /** Imports the current buffers of every boundary into its producer and consumer-side tensors */
+    void import_buffers();
+
+    Graph                    *_graph;       /**< Partitioned graph */
+    ExecutionWorkload        *_workload;    /**< Workload being run */
+    std::vector<unsigned int> _node_stages; /**< Stage of every node, indexed by node ID */
+    std::vector<Stage>        _stages;      /**< Pipeline stages */
+    std::vector<Boundary>     _boundaries;  /**< Boundary tensors */
+    std::mutex                _mtx;         /**< Mutex protecting the step state */
+    std::condition_variable   _start_cv;    /**< Signals the start of a step to the stages */
+    std::condition_variable   _done_cv;     /**< Signals the end of a step to the caller */
+    unsigned int              _step;        /**< Current step */
+    unsigned int              _pending;     /**< Number of stages still running the current step */
+    bool                      _stop;        /**< Whether the stage threads must exit */
+    std::exception_ptr        _error;       /**< First error raised by a stage in the current step */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_GRAPHPIPELINE_H
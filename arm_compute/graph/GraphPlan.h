@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_GRAPHPLAN_H
+#define ACL_ARM_COMPUTE_GRAPH_GRAPHPLAN_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+
+/** Serializable result of a graph finalization
+ *
+ * A plan captures the state of a graph once all the mutating passes have run and its constant tensors have been
+ * filled: the fingerprint of the finalized graph (node types, execution methods, targets, tensor descriptors and the
+ * data identifiers of the constant tensor accessors) and the contents of every constant tensor. A later process that
+ * builds the same graph can load the plan to skip the node validation and the constant tensor accessors (e.g. parsing
+ * the weight files).
+ *
+ * Constant tensors whose accessor doesn't identify its data (see @ref ITensorAccessor::data_id) are not recorded and
+ * are always filled through their accessor.
+ *
+ * @note Plans are only valid for the library build, CPU features and target they were created with
+ */
+class GraphPlan final
+{
+public:
+    /** Default Constructor */
+    GraphPlan();
+    /** Computes the fingerprint of a finalized graph
+     *
+     * @param[in] g Graph to compute the fingerprint of
+     *
+     * @return The graph fingerprint
+     */
+    static uint64_t fingerprint(const Graph &g);
+    /** Records the fingerprint and the constant tensors of a graph
+     *
+     * @note The constant tensors must be allocated and filled
+     *
+     * @param[in] g Graph to record
+     */
+    void record(const Graph &g);
+    /** Checks if the plan was recorded from a graph identical to @p g
+     *
+     * @param[in] g Graph to check
+     *
+     * @return True if the plan can be used for the given graph else false
+     */
+    bool matches(const Graph &g) const;
+    /** Fills the constant tensors of a graph from the plan
+     *
+     * Constant tensors that are not part of the plan are filled through their accessors.
+     *
+     * @note The constant tensors must be allocated
+     *
+     * @param[in, out] g Graph to fill the constant tensors of
+     */
+    void restore_const_tensors(Graph &g) const;
+    /** Loads a plan from a file
+     *
+     * @param[in] filename File to load the plan from
+     *
+     * @return True if a valid plan was loaded else false
+     */
+    bool load(const std::string &filename);
+    /** Saves the plan to a file
+     *
+     * @param[in] filename File to save the plan to
+     *
+     * @return True if the plan was saved else false
+     */
+    bool save(const std::string &filename) const;
+
+private:
+    /** Contents of a constant tensor */
+    struct TensorBlob
+    {
+        TensorID             tensor_id; /**< Tensor the blob belongs to */
+        std::vector<uint8_t> data;      /**< Tensor buffer including any padding */
+    };
+
+    uint64_t                _fingerprint; /**< Fingerprint of the recorded graph */
+    std::vector<TensorBlob> _blobs;       /**< Constant tensor blobs */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_GRAPHPLAN_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,17 @@ public:
      */
     virtual std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) = 0;
+    /** Create a backend strided Sub-Tensor
+     *
+     * @param[in] parent Parent sub-tensor handle
+     * @param[in] shape  Shape of the sub-tensor
+     * @param[in] coords Starting coordinates of the sub-tensor
+     * @param[in] steps  Step in elements along each dimension of the parent
+     *
+     * @return Backend sub-tensor handle, nullptr if the backend does not support strided views
+     */
+    virtual std::unique_ptr<ITensorHandle>
+    create_strided_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, Coordinates steps) = 0;
     /** Configure a backend Node
      *
      * @note This creates an appropriate configured backend function for the given node
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -57,6 +58,17 @@ public:
     {
         return true;
     }
+    /** Returns an identifier of the data provided by the accessor
+     *
+     * Accessors returning the same non-empty identifier must provide the same data. Graph plans only restore the
+     * constant tensors whose accessor returns the identifier they were recorded with.
+     *
+     * @return The identifier of the data, empty if unknown
+     */
+    virtual std::string data_id() const
+    {
+        return "";
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -101,6 +101,12 @@ struct GraphConfig
         -1}; /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
+    std::string   plan_file{};                         /**< File to load/store the finalized graph plan from */
+    std::string   calibration_file{};                  /**< File to load the tensor ranges to quantize the graph from */
+    unsigned int  pipeline_stages{1};                  /**< Number of NEON pipeline stages, 1 disables pipelining */
+    bool          share_weights{false};                /**< Share the prepared constant weights between graphs */
+    bool          fuse_depthwise_separable{false};     /**< Fuse NEON depthwise and pointwise convolution pairs */
+    bool          fuse_residual_additions{false};      /**< Fuse NEON residual additions into the convolutions */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
 };
 
@@ -175,6 +181,7 @@ enum class NodeType
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedDepthwiseSeparableConvolutionLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
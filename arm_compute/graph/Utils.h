@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@ namespace graph
 {
 // Forward Declaration
 class GraphContext;
+class ITensorHandle;
 
 inline bool is_utility_node(INode *node)
 {
@@ -148,6 +149,17 @@ std::vector<NodeIdxPair> get_driver_nodes(const INode &node);
  * @param[in, out] tensor Tensor to configure
  */
 void configure_tensor(Tensor *tensor);
+/** Checks if the rows of a tensor handle are evenly spaced across its dimensions 1 and 2
+ *
+ * GEMM based functions reinterpret a 3D tensor as a matrix whose rows span dimensions 1 and 2, and walk them with the
+ * stride of dimension 1 only (e.g. 1x1 convolutions in NHWC), so the graph doesn't hand out sub-tensors whose rows
+ * aren't evenly spaced.
+ *
+ * @param[in] handle Tensor handle to check
+ *
+ * @return True if the stride of dimension 2 spans the rows of dimension 1, or if dimension 2 has a single element
+ */
+bool has_evenly_spaced_rows(const ITensorHandle &handle);
 } // namespace graph
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_GRAPH_UTILS_H
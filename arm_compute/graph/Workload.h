@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,7 @@ class Graph;
 struct ExecutionTask;
 
 void execute_task(ExecutionTask &task);
+void prepare_task(ExecutionTask &task);
 
 /** Task executor */
 class TaskExecutor final
@@ -65,6 +66,8 @@ public:
     static TaskExecutor &get();
     /** Function that is responsible for executing tasks */
     std::function<decltype(execute_task)> execute_function;
+    /** Function that is responsible for preparing tasks */
+    std::function<decltype(prepare_task)> prepare_function;
 };
 
 /** Execution task
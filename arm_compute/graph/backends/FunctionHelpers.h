@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -207,7 +207,8 @@ template <typename FusedLayerTypes, typename TargetInfo>
 std::unique_ptr<IFunction>
 create_fused_convolution_batch_normalization_layer(FusedConvolutionBatchNormalizationNode &node, GraphContext &ctx)
 {
-    validate_node<TargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+    const size_t num_inputs = node.has_fused_residual() ? 8U : 7U; // The fused residual is an extra input
+    validate_node<TargetInfo>(node, num_inputs /* expected inputs */, 1 /* expected outputs */);
 
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
@@ -263,7 +264,8 @@ std::unique_ptr<IFunction>
 create_fused_depthwise_convolution_batch_normalization_layer(FusedDepthwiseConvolutionBatchNormalizationNode &node,
                                                              GraphContext                                    &ctx)
 {
-    validate_node<TargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+    const size_t num_inputs = node.has_fused_residual() ? 8U : 7U; // The fused residual is an extra input
+    validate_node<TargetInfo>(node, num_inputs /* expected inputs */, 1 /* expected outputs */);
 
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
@@ -432,7 +434,8 @@ std::unique_ptr<arm_compute::IFunction> create_concatenate_layer(ConcatenateLaye
 template <typename ConvolutionLayerFunctions, typename TargetInfo>
 std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node, GraphContext &ctx)
 {
-    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+    const size_t num_inputs = node.has_fused_residual() ? 4U : 3U; // The fused residual is an extra input
+    validate_node<TargetInfo>(node, num_inputs /* expected inputs */, 1 /* expected outputs */);
 
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
@@ -556,7 +559,8 @@ std::unique_ptr<IFunction> create_deconvolution_layer(DeconvolutionLayerNode &no
 template <typename DepthwiseConvolutionLayer, typename TargetInfo>
 std::unique_ptr<IFunction> create_depthwise_convolution_layer(DepthwiseConvolutionLayerNode &node)
 {
-    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+    const size_t num_inputs = node.has_fused_residual() ? 4U : 3U; // The fused residual is an extra input
+    validate_node<TargetInfo>(node, num_inputs /* expected inputs */, 1 /* expected outputs */);
 
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
@@ -1550,6 +1554,12 @@ std::unique_ptr<IFunction> create_slice_layer(SliceLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a view of the input
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1658,6 +1668,12 @@ std::unique_ptr<IFunction> create_strided_slice_layer(StridedSliceLayerNode &nod
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a view of the input
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
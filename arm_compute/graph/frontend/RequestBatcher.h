@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_FRONTEND_REQUESTBATCHER_H
+#define ACL_ARM_COMPUTE_GRAPH_FRONTEND_REQUESTBATCHER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/ITensorAccessor.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+/** Batching policy of a @ref RequestBatcher */
+struct RequestBatcherInfo
+{
+    /** Maximum number of requests per batch. Must match the outermost dimension of the graph's input and output */
+    size_t max_batch_size{1};
+    /** Maximum time the oldest queued request waits for the batch to fill up before the batch is dispatched */
+    std::chrono::microseconds max_queue_delay{1000};
+    /** Target latency of a request, from submission to completion. 0 disables it.
+     *
+     * A batch is dispatched early if waiting any longer would make its oldest request miss the target, given the
+     * average execution time of the previous batches.
+     */
+    std::chrono::microseconds latency_slo{0};
+};
+
+/** Counters reported by @ref RequestBatcher */
+struct RequestBatcherStats
+{
+    size_t                    num_requests{0};         /**< Number of completed requests */
+    size_t                    num_batches{0};          /**< Number of executed batches */
+    size_t                    num_slo_violations{0};   /**< Number of requests that missed the latency target */
+    std::chrono::microseconds total_queueing_delay{0}; /**< Accumulated time requests spent queued */
+    std::chrono::microseconds max_queueing_delay{0};   /**< Longest time a request spent queued */
+    std::chrono::microseconds total_batch_time{0};     /**< Accumulated execution time of the batches */
+    float                     batch_fill_ratio{0.f};   /**< Average ratio of occupied entries per batch */
+};
+
+/** Merges concurrent single-sample requests into batches run by a graph
+ *
+ * The batcher provides the accessors of the graph's input and output layers. The input accessor blocks until a
+ * batch is formed, copies the samples of the requests into the batched input tensor and zeroes the unused entries.
+ * The output accessor scatters the batched output back to the requests and completes them. Running the graph thus
+ * serves requests until @ref RequestBatcher::stop is called:
+ *
+ * @code{.cpp}
+ * RequestBatcher batcher(info);
+ * graph << InputLayer(input_descriptor, batcher.input_accessor()) << ... << OutputLayer(batcher.output_accessor());
+ * graph.finalize(target, config);
+ * std::thread server([&]() { graph.run(); });
+ * ...
+ * batcher.submit(input, output).wait(); // From any thread
+ * ...
+ * batcher.stop();
+ * server.join();
+ * @endcode
+ *
+ * @note Requests are dense samples laid out as the input/output tensors without their outermost dimension.
+ */
+class RequestBatcher
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info Batching policy
+     */
+    explicit RequestBatcher(const RequestBatcherInfo &info);
+    /** Prevent instances of this class from being copied (As this class contains non copyable objects) */
+    RequestBatcher(const RequestBatcher &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains non copyable objects) */
+    RequestBatcher &operator=(const RequestBatcher &) = delete;
+    /** Destructor */
+    ~RequestBatcher();
+    /** Queues a request
+     *
+     * @param[in]  input  Input sample. Must remain valid until the request is completed.
+     * @param[out] output Buffer receiving the output sample. Must remain valid until the request is completed.
+     *
+     * @return Future becoming ready when the output has been written
+     */
+    std::future<void> submit(const void *input, void *output);
+    /** Makes the input accessor stop the graph execution once all the queued requests have been served */
+    void stop();
+    /** Returns the accessor for the input layer of the graph
+     *
+     * @return Input accessor, which must not outlive the batcher
+     */
+    ITensorAccessorUPtr input_accessor();
+    /** Returns the accessor for the output layer of the graph
+     *
+     * @return Output accessor, which must not outlive the batcher
+     */
+    ITensorAccessorUPtr output_accessor();
+    /** Returns a snapshot of the counters of the batcher
+     *
+     * @return The batcher's counters
+     */
+    RequestBatcherStats stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request
+    {
+        const void        *input;
+        void              *output;
+        Clock::time_point  arrival;
+        std::promise<void> done;
+    };
+
+    class InputAccessor;
+    class OutputAccessor;
+
+    /** Latest time at which a batch whose oldest request arrived at @p arrival must be dispatched */
+    Clock::time_point dispatch_deadline(Clock::time_point arrival) const;
+    /** Waits for the next batch and copies it into @p tensor. Returns false once stopped and drained */
+    bool gather(ITensor &tensor);
+    /** Copies the outputs of the current batch from @p tensor and completes the requests */
+    bool scatter(ITensor &tensor);
+
+    const RequestBatcherInfo _info;
+    std::deque<Request>      _queue;
+    std::vector<Request>     _batch;
+    Clock::time_point        _batch_start;
+    Clock::duration          _avg_batch_time;
+    bool                     _stopped;
+    RequestBatcherStats      _stats;
+    mutable std::mutex       _mtx;
+    std::condition_variable  _cv;
+};
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_FRONTEND_REQUESTBATCHER_H
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_CALIBRATEDQUANTIZATIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_CALIBRATEDQUANTIZATIONMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphCalibrator.h"
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to quantize a floating-point graph to QASYMM8_SIGNED using calibrated tensor ranges
+ *
+ * Nodes with an 8-bit implementation get their tensors quantized with the calibrated ranges. Batch normalizations
+ * following a convolution are folded into its weights and biases, which are quantized per output channel
+ * (QSYMM8_PER_CHANNEL) from their actual contents. Every other node keeps running in floating point, with
+ * quantization and dequantization nodes inserted at the boundaries.
+ *
+ * @note The constant tensors of the quantized nodes are loaded through their accessors while mutating the graph
+ */
+class CalibratedQuantizationMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] calibration_data Ranges collected by a @ref GraphCalibrator on an identical graph
+     */
+    CalibratedQuantizationMutator(CalibrationData calibration_data);
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    CalibrationData _calibration_data;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_CALIBRATEDQUANTIZATIONMUTATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,10 +39,23 @@ namespace graph
 class NodeFusionMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] fuse_depthwise_separable (Optional) Fuse the NEON depthwise convolutions with the pointwise
+     *                                     convolutions following them
+     * @param[in] fuse_residual_additions  (Optional) Fuse the NEON residual additions into the convolutions producing
+     *                                     one of their inputs
+     */
+    explicit NodeFusionMutator(bool fuse_depthwise_separable = false, bool fuse_residual_additions = false);
+
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char  *name() override;
+
+private:
+    bool _fuse_depthwise_separable;
+    bool _fuse_residual_additions;
 };
 } // namespace graph
 } // namespace arm_compute
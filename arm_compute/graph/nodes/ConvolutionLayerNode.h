@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,28 @@ public:
      * @param[in] fused_activation Fused activation to set
      */
     void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Fuses a residual addition into the node
+     *
+     * The output of the node becomes act(output + residual), where the residual tensor
+     * is connected to the input @ref residual_input_idx and act is @p residual_activation.
+     * Any activation fused into the node is part of output, so it runs before the addition.
+     *
+     * @note Only float outputs are supported. The NEON backend runs the addition as an in-place
+     *       epilogue right after the node, as the output stages can't read a second tensor.
+     *
+     * @param[in] residual_activation Activation to run after the residual addition
+     */
+    void set_fused_residual(ActivationLayerInfo residual_activation);
+    /** Checks if a residual addition is fused into the node
+     *
+     * @return True if a residual addition is fused
+     */
+    bool has_fused_residual() const;
+    /** Returns the activation run after the fused residual addition
+     *
+     * @return Residual activation
+     */
+    ActivationLayerInfo residual_activation() const;
     /** Sets convolution info
      *
      * @param[in] info Convolution info to set
@@ -118,7 +140,8 @@ public:
     void             accept(INodeVisitor &v) override;
 
 public:
-    static constexpr NodeType node_type = NodeType::ConvolutionLayer;
+    static constexpr NodeType     node_type          = NodeType::ConvolutionLayer;
+    static constexpr unsigned int residual_input_idx = 3; /**< Input index of the fused residual */
 
 private:
     PadStrideInfo       _info;
@@ -127,6 +150,8 @@ private:
     FastMathHint        _fast_math_hint;
     QuantizationInfo    _out_quant_info;
     ActivationLayerInfo _fused_activation;
+    bool                _fused_residual{false};
+    ActivationLayerInfo _residual_activation{};
 };
 } // namespace graph
 } // namespace arm_compute
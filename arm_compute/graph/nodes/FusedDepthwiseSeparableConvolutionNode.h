@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Depthwise Convolution and 1x1 Pointwise Convolution node
+ *
+ * The inputs of the node are:
+ * - 0: Input
+ * - 1: Depthwise weights
+ * - 2: Depthwise biases (optional)
+ * - 3: Pointwise weights
+ * - 4: Pointwise biases (optional)
+ */
+class FusedDepthwiseSeparableConvolutionNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info           Depthwise convolution, activations and quantization of the depthwise output.
+     * @param[in] out_quant_info (Optional) Output quantization info
+     */
+    FusedDepthwiseSeparableConvolutionNode(DepthwiseSeparableConv2dInfo info,
+                                           QuantizationInfo             out_quant_info = QuantizationInfo());
+    /** Fused depthwise separable convolution metadata accessor
+     *
+     * @return Depthwise separable convolution information
+     */
+    const DepthwiseSeparableConv2dInfo &depthwise_separable_info() const;
+    /** Computes the output descriptor
+     *
+     * @param[in] input_descriptor      Input descriptor
+     * @param[in] dw_weights_descriptor Depthwise weights descriptor
+     * @param[in] pw_weights_descriptor Pointwise weights descriptor
+     * @param[in] info                  Padding and stride of the depthwise convolution
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &dw_weights_descriptor,
+                                                      const TensorDescriptor &pw_weights_descriptor,
+                                                      const PadStrideInfo    &info);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedDepthwiseSeparableConvolutionLayer;
+
+private:
+    DepthwiseSeparableConv2dInfo _info;
+    QuantizationInfo             _out_quant_info;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
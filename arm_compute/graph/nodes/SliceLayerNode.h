@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,6 +67,20 @@ public:
      * @return End coordinates of the dimensions
      */
     Coordinates ends() const;
+    /** Disables or not the slice node
+     *
+     * @warning This is used when the slice is performed using a sub-tensor view, where this node is a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the slice (involves copying),
+     *                       while if false, no function is created and the output is assumed to be a view
+     *                       of the input.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -77,6 +91,7 @@ public:
 private:
     Coordinates _starts;
     Coordinates _ends;
+    bool        _is_enabled;
 };
 } // namespace graph
 } // namespace arm_compute
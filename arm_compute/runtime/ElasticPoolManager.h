@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_ELASTICPOOLMANAGER_H
+#define ACL_ARM_COMPUTE_RUNTIME_ELASTICPOOLMANAGER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/IPoolManager.h"
+
+#include "support/Mutex.h"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#ifndef NO_MULTI_THREADING
+#include <condition_variable>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+/** Counters reported by @ref ElasticPoolManager */
+struct ElasticPoolManagerStats
+{
+    size_t                   num_pools{0};                 /**< Number of pools currently managed */
+    size_t                   num_pools_high_water_mark{0}; /**< Maximum number of pools managed at the same time */
+    size_t                   num_pools_created{0};         /**< Number of pools created on demand */
+    size_t                   num_pools_trimmed{0};         /**< Number of idle pools released */
+    size_t                   memory_size{0};               /**< Bytes currently held by the managed pools */
+    size_t                   memory_high_water_mark{0};    /**< Maximum bytes held by the managed pools at the same time */
+    size_t                   num_locks{0};                 /**< Number of calls to lock_pool() */
+    size_t                   num_waits{0};                 /**< Number of lock_pool() calls that had to wait */
+    std::chrono::nanoseconds total_wait_time{0};           /**< Accumulated time spent waiting for a free pool */
+    std::chrono::nanoseconds max_wait_time{0};             /**< Longest time spent waiting for a free pool */
+};
+
+/** Memory pool manager that grows on demand
+ *
+ * Unlike @ref PoolManager, which blocks when all of its pools are occupied, this manager duplicates an existing pool
+ * when none is free as long as the total size of the pools stays within the memory budget. Only when the budget is
+ * exhausted does lock_pool() wait for a pool to be unlocked.
+ *
+ * Pools that have not been used for longer than the idle timeout are released on the next lock/unlock or by
+ * calling @ref ElasticPoolManager::trim_idle_pools. The last pool is never trimmed as it is needed to create new ones.
+ *
+ * @note Pools whose @ref IMemoryPool::size is 0 are not accounted for in the memory budget.
+ * @note Pools can be registered at any time, even when some of them are occupied.
+ */
+class ElasticPoolManager : public IPoolManager
+{
+public:
+    /** Clock used to measure the idle and wait times */
+    using Clock = std::chrono::steady_clock;
+    /** Function returning the current time of @ref Clock */
+    using ClockFunction = std::function<Clock::time_point()>;
+
+    /** Constructor
+     *
+     * @param[in] memory_budget (Optional) Maximum number of bytes the pools are allowed to hold.
+     *                          Pools are never created on demand beyond it. 0 means unbounded.
+     * @param[in] idle_timeout  (Optional) Time after which a free pool is released. 0 disables trimming.
+     * @param[in] clock         (Optional) Function returning the current time. Defaults to Clock::now.
+     */
+    explicit ElasticPoolManager(size_t                    memory_budget = 0,
+                                std::chrono::milliseconds idle_timeout  = std::chrono::milliseconds(0),
+                                ClockFunction             clock         = nullptr);
+    /** Prevent instances of this class to be copy constructed */
+    ElasticPoolManager(const ElasticPoolManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    ElasticPoolManager &operator=(const ElasticPoolManager &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    ElasticPoolManager(ElasticPoolManager &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    ElasticPoolManager &operator=(ElasticPoolManager &&) = delete;
+
+    /** Releases the free pools that have been idle for longer than the idle timeout
+     *
+     * @return Number of pools released
+     */
+    size_t trim_idle_pools();
+    /** Returns a snapshot of the counters of the manager
+     *
+     * @return The manager's counters
+     */
+    ElasticPoolManagerStats stats() const;
+    /** Resets the wait and lock counters and sets the high-water marks to the current values */
+    void reset_stats();
+
+    // Inherited methods overridden:
+    IMemoryPool                 *lock_pool() override;
+    void                         unlock_pool(IMemoryPool *pool) override;
+    void                         register_pool(std::unique_ptr<IMemoryPool> pool) override;
+    std::unique_ptr<IMemoryPool> release_pool() override;
+    void                         clear_pools() override;
+    size_t                       num_pools() const override;
+
+private:
+    /** A free pool and the time it was last unlocked */
+    struct FreePool
+    {
+        std::unique_ptr<IMemoryPool> pool;
+        Clock::time_point            last_used;
+    };
+
+    /** Whether a new pool can be duplicated from an occupied one within the budget. The mutex must be held */
+    bool can_grow() const;
+    /** Updates the high-water marks after a pool has been added */
+    void update_high_water_marks();
+    /** Releases the idle pools. The mutex must be held */
+    size_t trim_idle_pools_locked(Clock::time_point now);
+
+    const size_t                            _memory_budget;  /**< Maximum bytes held by the pools, 0 if unbounded */
+    const std::chrono::milliseconds         _idle_timeout;   /**< Idle time after which a free pool is released */
+    const ClockFunction                     _clock;          /**< Function returning the current time */
+    std::list<FreePool>                     _free_pools;     /**< Free pools, most recently used first */
+    std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
+    ElasticPoolManagerStats                 _stats;          /**< Counters */
+    mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+#ifndef NO_MULTI_THREADING
+    std::condition_variable _cv; /**< Signalled when a pool is unlocked or memory is released */
+#endif                           /* NO_MULTI_THREADING */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_ELASTICPOOLMANAGER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, 2025 Arm Limited.
+ * Copyright (c) 2019-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
+#include <array>
 #include <utility>
 
 namespace arm_compute
@@ -113,5 +114,82 @@ struct Conv3dInfo
     bool                  enable_fast_math{false};
 };
 
+/** Descriptor used by the fused depthwise separable 2d Convolution function
+ *
+ * A depthwise separable block is a depthwise convolution followed by a 1x1 pointwise convolution.
+ */
+struct DepthwiseSeparableConv2dInfo
+{
+    DepthwiseSeparableConv2dInfo() = default;
+
+    DepthwiseSeparableConv2dInfo(const PadStrideInfo       &dw_conv_info,
+                                 const Size2D              &dw_dilation,
+                                 const ActivationLayerInfo &dw_act_info,
+                                 const ActivationLayerInfo &pw_act_info,
+                                 const QuantizationInfo    &dw_output_qinfo = QuantizationInfo())
+        : dw_conv_info(dw_conv_info),
+          dw_dilation(dw_dilation),
+          dw_act_info(dw_act_info),
+          pw_act_info(pw_act_info),
+          dw_output_qinfo(dw_output_qinfo)
+    {
+    }
+
+    PadStrideInfo       dw_conv_info{};      /**< Padding and stride of the depthwise convolution. */
+    Size2D              dw_dilation{1U, 1U}; /**< Dilation of the depthwise convolution. */
+    ActivationLayerInfo dw_act_info{};       /**< Activation run on the depthwise output. */
+    ActivationLayerInfo pw_act_info{};       /**< Activation run on the pointwise output. */
+    QuantizationInfo    dw_output_qinfo{};   /**< Quantization of the depthwise output. Only used by quantized types. */
+};
+
+/** Descriptor used by the image preprocessing function
+ *
+ * The source image is converted to RGB, resized to the size of the destination, and every channel is normalized as
+ * (value - mean) / std_dev. The mean and standard deviation are given in the order of the destination channels and in
+ * the range of the source pixels, i.e. [0, 255].
+ */
+struct ImagePreprocessInfo
+{
+    ImagePreprocessInfo() = default;
+
+    ImagePreprocessInfo(Format                      format,
+                        const std::array<float, 3> &mean,
+                        const std::array<float, 3> &std_dev,
+                        InterpolationPolicy         interpolation   = InterpolationPolicy::BILINEAR,
+                        SamplingPolicy              sampling_policy = SamplingPolicy::CENTER,
+                        bool                        bgr             = false)
+        : format(format),
+          mean(mean),
+          std_dev(std_dev),
+          interpolation(interpolation),
+          sampling_policy(sampling_policy),
+          bgr(bgr)
+    {
+    }
+
+    Format               format{Format::RGB888};                      /**< Source format: RGB888, YUYV422 or NV12. */
+    std::array<float, 3> mean{{0.f, 0.f, 0.f}};                       /**< Mean subtracted from each channel. */
+    std::array<float, 3> std_dev{{1.f, 1.f, 1.f}};                    /**< Standard deviation of each channel. */
+    InterpolationPolicy  interpolation{InterpolationPolicy::BILINEAR}; /**< Resize policy: nearest or bilinear. */
+    SamplingPolicy       sampling_policy{SamplingPolicy::CENTER};      /**< Sampling point of the pixels. */
+    bool                 bgr{false}; /**< Whether the destination channels are in BGR order instead of RGB. */
+};
+
+/** Descriptor used by the grouped GEMM function
+ *
+ * A grouped GEMM runs one matrix multiplication per group, e.g. per expert of a mixture-of-experts layer. Each group
+ * multiplies its own consecutive rows of the left-hand side by its own right-hand side matrix.
+ */
+struct GroupedGemmInfo
+{
+    GroupedGemmInfo() = default;
+
+    GroupedGemmInfo(const ActivationLayerInfo &act_info) : act_info(act_info)
+    {
+    }
+
+    ActivationLayerInfo act_info{}; /**< Activation run on the output. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU. */
+};
+
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_FUNCTIONDESCRIPTORS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,16 @@ public:
      * @return A duplicate of the existing pool
      */
     virtual std::unique_ptr<IMemoryPool> duplicate() = 0;
+    /** Returns the amount of backing memory held by the pool
+     *
+     * @note Pools that do not override it report 0 bytes
+     *
+     * @return Size of the pool in bytes
+     */
+    virtual size_t size() const
+    {
+        return 0;
+    }
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_IMEMORYPOOL_H
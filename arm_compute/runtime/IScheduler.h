@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -156,6 +156,27 @@ public:
      */
     virtual void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func);
 
+    /** Sets the number of threads the scheduler will use and pins them to the logical cores of one NUMA node
+     *
+     * Threads are bound round-robin to the cores of the node, so that the kernels run by this scheduler and
+     * the memory they first-touch stay local to the node.
+     *
+     * @note To serve one model instance per node, build with ARM_COMPUTE_THREAD_LOCAL_SCHEDULER and let each
+     *       serving thread install its own scheduler through @ref Scheduler::set before calling this method.
+     * @note The calling thread is pinned to the node as well.
+     * @note An error is raised if @p node is not a valid NUMA node or has no CPUs.
+     *
+     * @param[in] num_threads If set to 0, then one thread per core of the node will be used, otherwise the number of threads specified.
+     * @param[in] node        NUMA node to bind the threads to.
+     */
+    void set_num_threads_on_numa_node(unsigned int num_threads, unsigned int node);
+
+    /** Returns the NUMA node the scheduler's threads have been bound to.
+     *
+     * @return The NUMA node set by @ref set_num_threads_on_numa_node, -1 if the threads are not bound to a node.
+     */
+    int numa_node() const;
+
     /** Returns the number of threads that the SingleThreadScheduler has in its pool.
      *
      * @return Number of threads available in SingleThreadScheduler.
@@ -238,6 +259,7 @@ protected:
 
 private:
     unsigned int _num_threads_hint = {};
+    int          _numa_node        = {-1};
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_ISCHEDULER_H
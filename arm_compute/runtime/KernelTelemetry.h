@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_KERNELTELEMETRY_H
+#define ACL_ARM_COMPUTE_RUNTIME_KERNELTELEMETRY_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Execution record of one kernel run by a scheduler */
+struct KernelTelemetryRecord
+{
+    std::string  kernel_name{};  /**< Name of the kernel */
+    size_t       window_size{0}; /**< Number of iterations of the window the kernel was run on */
+    unsigned int num_threads{0}; /**< Number of threads the scheduler could split the window between */
+    uint64_t     start_ns{0};    /**< Start time, in nanoseconds of the steady clock */
+    uint64_t     duration_ns{0}; /**< Wall-clock duration of the run, including the scheduling overhead */
+    uint64_t     bytes{0};       /**< Size of the source and destination tensors, 0 if they are owned by the kernel */
+    uint64_t     flops{0};       /**< Estimate of the arithmetic operations, 0 if the kernel does not provide one */
+};
+
+/** Process-wide collection of the kernels run by the CPU schedulers
+ *
+ * Every kernel run through @ref IScheduler::schedule_op or @ref IScheduler::schedule produces a
+ * @ref KernelTelemetryRecord, which is passed to the registered callback and stored in the ring buffer, so that
+ * applications can export the latency of every layer without a special build of the library.
+ *
+ * Telemetry is disabled until a callback is registered or the ring buffer is given a capacity. While disabled,
+ * scheduling a kernel only costs one relaxed atomic load.
+ *
+ * @note The callback is called on the thread that scheduled the kernel, after the kernel has completed. It must not
+ *       schedule kernels itself.
+ */
+class KernelTelemetry final
+{
+public:
+    /** Function receiving the record of every kernel run */
+    using Callback = std::function<void(const KernelTelemetryRecord &record)>;
+
+    /** Access the process-wide telemetry
+     *
+     * @return The telemetry
+     */
+    static KernelTelemetry &get();
+    /** Prevent instances of this class from being copied */
+    KernelTelemetry(const KernelTelemetry &) = delete;
+    /** Prevent instances of this class from being copied */
+    KernelTelemetry &operator=(const KernelTelemetry &) = delete;
+
+    /** Register the function receiving the records
+     *
+     * @param[in] callback Function called with the record of every kernel run. An empty function removes the
+     *                     current callback.
+     */
+    void set_callback(Callback callback);
+    /** Set the number of records kept in the ring buffer
+     *
+     * Once the buffer is full, every new record replaces the oldest one. Changing the capacity drops the records
+     * currently held.
+     *
+     * @param[in] capacity Maximum number of records kept, 0 to disable the ring buffer
+     */
+    void set_ring_buffer_capacity(size_t capacity);
+    /** Remove the records held in the ring buffer
+     *
+     * @return The records, from the oldest to the most recent
+     */
+    std::vector<KernelTelemetryRecord> drain();
+    /** Number of records replaced in the ring buffer before they were drained
+     *
+     * @return The number of records lost since the capacity was last set
+     */
+    size_t num_dropped() const;
+    /** Whether the runs of the kernels are recorded
+     *
+     * @return True if a callback is registered or the ring buffer has a capacity
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Pass a record to the callback and store it in the ring buffer
+     *
+     * @param[in] record Record of a kernel run
+     */
+    void record(KernelTelemetryRecord &&record);
+
+private:
+    KernelTelemetry() = default;
+    /** Update the enabled flag, must be called with the mutex held */
+    void update_enabled();
+
+    mutable std::mutex                 _mtx{};
+    std::shared_ptr<const Callback>    _callback{};
+    std::vector<KernelTelemetryRecord> _ring{};
+    size_t                             _capacity{0};
+    size_t                             _head{0};
+    size_t                             _dropped{0};
+    std::atomic<bool>                  _enabled{false};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_KERNELTELEMETRY_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
 
 #include <memory>
 
@@ -41,6 +42,7 @@ namespace arm_compute
 class ITensor;
 
 /** Basic function to simulate a 3d convolution. This function calls one of the following functions:
+ * -# cpu::CpuGemmConv3d (if the indirect GEMM supports the configuration)
  * -# cpu::CpuDirectConv3d
  *
  */
@@ -48,7 +50,7 @@ class NEConv3D : public IFunction
 {
 public:
     /** Constructor */
-    NEConv3D();
+    NEConv3D(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEConv3D(const NEConv3D &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -95,6 +97,7 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,18 +28,26 @@
  * @publicapi
  */
 
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
 
 namespace arm_compute
 {
 // Forward Declarations
-class Tensor;
 class ITensor;
-class NECropKernel;
+class ITensorInfo;
+class NECropResizeKernel;
 
-/** Function to perform cropping and resizing */
+/** Function to perform cropping and resizing
+ *
+ * This function calls the following kernels:
+ *
+ * -# @ref NECropResizeKernel
+ *
+ * The boxes are read every time the function runs, so they can be updated between runs without reconfiguring.
+ */
 class NECropResize : public IFunction
 {
 public:
@@ -64,7 +72,7 @@ public:
      * Valid data type configurations:
      * |src0     |src1     |src2   |dst      |
      * |:--------|:--------|:------|:--------|
-     * |All      |F32      |F32    |F32      |
+     * |All      |F32      |S32    |F32      |
      *
      * @note Supported tensor rank: up to 4
      * @note Box indices may be outside of the bounds, in which case @p extrapolation_value is used.
@@ -73,7 +81,7 @@ public:
      * @param[in]  input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32
      * @param[in]  boxes               Tensor containing the boxes used to crop the images. Data type supported: F32
      * @param[in]  box_ind             One dimensional tensor containing the batch index of the 3D image in @p input that the corresponding
-     *                                 box in @p boxes will be applied to. Data type supported: F32
+     *                                 box in @p boxes will be applied to. Data type supported: S32
      * @param[out] output              Destination tensor containing a cropped and resized image for each box in @p boxes. Data type supported: F32
      * @param[in]  crop_size           The dimensions that each cropped image will be resized to.
      * @param[in]  method              The policy to be used when resizing image. Default is bilinear.
@@ -87,7 +95,7 @@ public:
                    InterpolationPolicy method              = InterpolationPolicy::BILINEAR,
                    float               extrapolation_value = 0);
 
-    /** Static function to check if given info will lead to a valid configuration of @ref NESlice
+    /** Static function to check if given info will lead to a valid configuration of @ref NECropResize
      *
      * @note Supported tensor rank: up to 4
      * @note Box indices may be outside of the bounds, in which case @p extrapolation_value is used.
@@ -96,7 +104,7 @@ public:
      * @param[in] input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32
      * @param[in] boxes               Tensor info for the tensor containing the boxes used to crop the images. Data type supported: F32
      * @param[in] box_ind             Tensor info for the one dimensional tensor containing the batch index of the 3D image in @p input
-     *                                that the corresponding box in @p boxes will be applied to. Data type supported: F32
+     *                                that the corresponding box in @p boxes will be applied to. Data type supported: S32
      * @param[in] output              Tensor info for the destination tensor containing a cropped and resized image for each box in @p boxes.
      *                                Data type supported: F32
      * @param[in] crop_size           The dimensions that each cropped image will be resized to.
@@ -113,17 +121,11 @@ public:
                            InterpolationPolicy method,
                            float               extrapolation_value);
 
+    // Inherited methods overridden:
     void run() override;
 
-    ITensor            *_output;
-    size_t              _num_boxes;
-    InterpolationPolicy _method;
-    float               _extrapolation_value;
-
-    std::vector<std::unique_ptr<NECropKernel>> _crop;
-    std::vector<std::unique_ptr<NEScale>>      _scale;
-    std::vector<std::unique_ptr<Tensor>>       _crop_results;
-    std::vector<std::unique_ptr<Tensor>>       _scaled_results;
+private:
+    std::unique_ptr<NECropResizeKernel> _kernel;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECROPRESIZE_H
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to run a depthwise convolution followed by a 1x1 pointwise convolution in a single pass.
+ *
+ * Supports only NHWC data layout and a depth multiplier of 1.
+ *
+ * The depthwise output is computed in small tiles that stay in the cache and are consumed straight away by the
+ * pointwise convolution, so the intermediate tensor is never written to memory. The weights of both convolutions are
+ * packed on the first run.
+ *
+ * This function calls the following operators/kernels:
+ * -# cpu::kernels::CpuDepthwiseSeparableConv2dKernel
+ */
+class NEDepthwiseSeparableConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Default move constructor */
+    NEDepthwiseSeparableConvolutionLayer(NEDepthwiseSeparableConvolutionLayer &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer &operator=(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Default move assignment operator */
+    NEDepthwiseSeparableConvolutionLayer &operator=(NEDepthwiseSeparableConvolutionLayer &&) = default;
+    /** Default destructor */
+    ~NEDepthwiseSeparableConvolutionLayer();
+    /** Initialize the function's source, destination, weights and convolution information.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src            |dw/pw weights                     |dw/pw biases |dst            |
+     * |:--------------|:---------------------------------|:------------|:--------------|
+     * |F16            |F16                               |F16          |F16            |
+     * |F32            |F32                               |F32          |F32            |
+     * |QASYMM8        |QASYMM8, QSYMM8_PER_CHANNEL       |S32          |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED, QSYMM8_PER_CHANNEL|S32          |QASYMM8_SIGNED |
+     *
+     * Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU can be fused after either convolution.
+     *
+     * @param[in]  input      Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  dw_weights Depthwise weights tensor. These are 3D tensors with shape [IFM, kernel_x, kernel_y].
+     *                        Data type supported: Same as @p input or QSYMM8_PER_CHANNEL when @p input is quantized.
+     * @param[in]  dw_biases  Depthwise biases tensor. A 1D tensor with shape [IFM]. Can be nullptr.
+     *                        Data type supported: Same as @p input, S32 when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  pw_weights Pointwise weights tensor. These are 4D tensors with shape [IFM, 1, 1, OFM].
+     *                        Data type supported: Same as @p input or QSYMM8_PER_CHANNEL when @p input is quantized.
+     * @param[in]  pw_biases  Pointwise biases tensor. A 1D tensor with shape [OFM]. Can be nullptr.
+     *                        Data type supported: Same as @p input, S32 when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[out] output     Destination tensor. Data type supported: same as @p input.
+     * @param[in]  info       Depthwise convolution, activations and quantization of the depthwise output.
+     */
+    void configure(ITensor                            *input,
+                   const ITensor                      *dw_weights,
+                   const ITensor                      *dw_biases,
+                   const ITensor                      *pw_weights,
+                   const ITensor                      *pw_biases,
+                   ITensor                            *output,
+                   const DepthwiseSeparableConv2dInfo &info);
+
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref NEDepthwiseSeparableConvolutionLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                  *input,
+                           const ITensorInfo                  *dw_weights,
+                           const ITensorInfo                  *dw_biases,
+                           const ITensorInfo                  *pw_weights,
+                           const ITensorInfo                  *pw_biases,
+                           const ITensorInfo                  *output,
+                           const DepthwiseSeparableConv2dInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,6 @@
  */
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/CPP/functions/CPPDetectionPostProcessLayer.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEDequantizationLayer.h"
@@ -37,15 +36,26 @@
 #include "arm_compute/runtime/Tensor.h"
 
 #include <map>
+#include <memory>
 
 namespace arm_compute
 {
 class ITensor;
+class NENonMaximumSuppressionKernel;
 
 /** NE Function to generate the detection output based on center size encoded boxes, class prediction and anchors
  *  by doing non maximum suppression.
  *
+ * This function calls the following functions/kernels:
+ *
+ * -# @ref NEDequantizationLayer (if the inputs are quantized)
+ * -# @ref NENonMaximumSuppressionKernel, over all the classes in parallel when regular NMS is used
+ *
  * @note Intended for use with MultiBox detection method.
+ * @note With fast NMS and DetectionPostProcessLayerInfo::max_classes_per_detection() greater than 1, each candidate
+ *       is suppressed against the box it was scored for. @ref CPPDetectionPostProcessLayer pairs the candidate
+ *       of index i with the decoded box of index i instead, so both functions only give the same detections when
+ *       max_classes_per_detection() is 1.
  */
 class NEDetectionPostProcessLayer : public IFunction
 {
@@ -57,7 +67,7 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEDetectionPostProcessLayer &operator=(const NEDetectionPostProcessLayer &) = delete;
     /** Default destructor */
-    ~NEDetectionPostProcessLayer() = default;
+    ~NEDetectionPostProcessLayer();
     /** Configure the detection output layer NE function
      *
      * Valid data layouts:
@@ -116,10 +126,25 @@ public:
 private:
     MemoryGroup _memory_group;
 
-    NEDequantizationLayer        _dequantize;
-    CPPDetectionPostProcessLayer _detection_post_process;
+    NEDequantizationLayer                          _dequantize;
+    std::unique_ptr<NENonMaximumSuppressionKernel> _nms_kernel;
+
+    const ITensor                *_input_box_encoding;
+    const ITensor                *_input_scores_to_use;
+    const ITensor                *_input_anchors;
+    ITensor                      *_output_boxes;
+    ITensor                      *_output_classes;
+    ITensor                      *_output_scores;
+    ITensor                      *_num_detection;
+    DetectionPostProcessLayerInfo _info;
+    unsigned int                  _num_boxes;
+    unsigned int                  _num_classes_per_box;
 
     Tensor _decoded_scores;
+    Tensor _decoded_boxes;
+    Tensor _nms_boxes;
+    Tensor _class_scores;
+    Tensor _selected_indices;
     bool   _run_dequantize;
 };
 } // namespace arm_compute
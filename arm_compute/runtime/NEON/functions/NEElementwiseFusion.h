@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEFUSION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEFUSION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseFusionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to run a chain of elementwise operations fused in a single pass over memory
+ *
+ * Instead of running one function (and one full read/write of the tensors) per operation,
+ * the whole @ref ElementwiseFusionInfo program is evaluated tile by tile with every
+ * intermediate result kept in L1.
+ */
+class NEElementwiseFusion : public IFunction
+{
+public:
+    /** Constructor */
+    NEElementwiseFusion();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseFusion(const NEElementwiseFusion &) = delete;
+    /** Default move constructor */
+    NEElementwiseFusion(NEElementwiseFusion &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseFusion &operator=(const NEElementwiseFusion &) = delete;
+    /** Default move assignment operator */
+    NEElementwiseFusion &operator=(NEElementwiseFusion &&);
+    /** Destructor */
+    ~NEElementwiseFusion();
+    /** Initialize the function's inputs and outputs.
+     *
+     * Valid data layouts:
+     * - Any
+     *
+     * Valid data type configurations:
+     * |srcs           |dst                          |
+     * |:--------------|:----------------------------|
+     * |F32            |F32, QASYMM8, QASYMM8_SIGNED |
+     * |F16            |F16, F32                     |
+     * |QASYMM8        |QASYMM8, F32                 |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED, F32          |
+     *
+     * Quantized and F16 inputs are computed in F32 and converted back when the result is stored.
+     *
+     * @param[in]  srcs Input tensors, one per input of @p info. Shapes must be broadcast compatible.
+     *                  Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32, all the same.
+     * @param[out] dst  Destination tensor. Data types supported: see the table above.
+     * @param[in]  info Elementwise fusion program. At most @ref ElementwiseFusionInfo::max_values values.
+     */
+    void configure(const std::vector<const ITensor *> &srcs, ITensor *dst, const ElementwiseFusionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEElementwiseFusion
+     *
+     * Similar to @ref NEElementwiseFusion::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status
+    validate(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, const ElementwiseFusionInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEFUSION_H
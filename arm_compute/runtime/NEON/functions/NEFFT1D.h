@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,15 +39,32 @@ namespace arm_compute
 {
 // Forward declaration
 class ITensor;
+class NEFFTBluesteinKernel;
 class NEFFTDigitReverseKernel;
 class NEFFTRadixStageKernel;
+class NEFFTRealSpectrumKernel;
 class NEFFTScaleKernel;
 
 /** Basic function to execute one dimensional FFT. This function calls the following kernels:
  *
+ * -# NEFFTRealSpectrumKernel Merges the spectrum of a real output into a packed half-length spectrum
  * -# NEFFTDigitReverseKernel Performs digit reverse
  * -# NEFFTRadixStageKernel   A list of FFT kernels depending on the radix decomposition
+ * -# NEFFTRealSpectrumKernel Splits the packed half-length spectrum of a real input
  * -# NEFFTScaleKernel        Performs output scaling in case of in inverse FFT
+ *
+ * A forward FFT of a real input or an inverse FFT to a real output along axis 0 runs on the signal packed into a
+ * complex signal of half its length when the length is even.
+ *
+ * Lengths that cannot be decomposed into the supported radices are computed with Bluestein's algorithm, as a
+ * convolution of a supported length. When a packed half length cannot be decomposed, the packed signal is transformed
+ * by a nested NEFFT1D instead of the radix stages. Otherwise this function calls the following kernels and functions:
+ *
+ * -# NEFFTBluesteinKernel Multiplies the input by the chirp
+ * -# NEFFT1D              Transforms the chirped input
+ * -# NEFFTBluesteinKernel Multiplies by the spectrum of the chirp filter, transformed once in @ref prepare()
+ * -# NEFFT1D              Inverse transforms the product
+ * -# NEFFTBluesteinKernel Multiplies the result by the chirp
  */
 class NEFFT1D : public IFunction
 {
@@ -73,8 +90,9 @@ public:
      * |src    |dst    |
      * |:------|:------|
      * |F32    |F32    |
+     * |F16    |F16    |
      *
-     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in]  input  Source tensor. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor.  Data types and data layouts supported: Same as @p input.
      *                    Number of channels supported: 1 (real tensor) or 2 (complex tensor).If @p input is real, @p output must be complex.
      * @param[in]  config FFT related configuration
@@ -82,7 +100,7 @@ public:
     void configure(const ITensor *input, ITensor *output, const FFT1DInfo &config);
     /** Static function to check if given info will lead to a valid configuration of @ref NEFFT1D.
      *
-     * @param[in] input  Source tensor info. Data types supported: F32.
+     * @param[in] input  Source tensor info. Data types supported: F16/F32.
      * @param[in] output Destination tensor info. Data types and data layouts supported: Same as @p input.
      * @param[in] config FFT related configuration
      *
@@ -92,17 +110,43 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 protected:
+    /** Configure the kernels and functions computing the FFT with Bluestein's algorithm */
+    void configure_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config);
+    /** Configure the kernels packing a real signal and the nested function computing its half-length FFT */
+    void configure_packed_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config);
+
     MemoryGroup                                         _memory_group;
+    std::shared_ptr<IMemoryManager>                     _memory_manager;
     std::unique_ptr<NEFFTDigitReverseKernel>            _digit_reverse_kernel;
     std::vector<std::unique_ptr<NEFFTRadixStageKernel>> _fft_kernels;
     std::unique_ptr<NEFFTScaleKernel>                   _scale_kernel;
+    std::unique_ptr<NEFFTRealSpectrumKernel>            _real_spectrum_kernel;
+    std::unique_ptr<NEFFTBluesteinKernel>               _chirp_kernel;
+    std::unique_ptr<NEFFTBluesteinKernel>               _filter_kernel;
+    std::unique_ptr<NEFFTBluesteinKernel>               _dechirp_kernel;
+    std::unique_ptr<NEFFT1D>                            _convolution_fft;
+    std::unique_ptr<NEFFT1D>                            _convolution_ifft;
+    std::unique_ptr<NEFFT1D>                            _filter_fft;
+    std::unique_ptr<NEFFT1D>                            _half_fft;
     Tensor                                              _digit_reversed_input;
     Tensor                                              _digit_reverse_indices;
+    Tensor                                              _packed_spectrum;
+    Tensor                                              _chirp;
+    Tensor                                              _filter;
+    Tensor                                              _filter_spectrum;
+    Tensor                                              _chirped_input;
+    Tensor                                              _convolution_spectrum;
+    Tensor                                              _convolution;
     unsigned int                                        _num_ffts;
     unsigned int                                        _axis;
     bool                                                _run_scale;
+    bool                                                _run_merge;
+    bool                                                _run_split;
+    bool                                                _is_bluestein;
+    bool                                                _is_prepared;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFFT1D_H
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGROUPEDGEMM_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGROUPEDGEMM_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to run a grouped GEMM, as used by mixture-of-experts layers.
+ *
+ * The rows of the left-hand side are split into consecutive groups, and every group is multiplied by its own weights:
+ * for a token routed to expert g, d = a * b[g] + biases[g]. The number of rows of every group is read from
+ * @p group_sizes on every run, so the routing can change between runs without reconfiguring the function.
+ *
+ * All the tiles of all the groups are computed in a single parallel launch, and the threads share them evenly
+ * however unbalanced the groups are. The weights of all the groups are packed on the first run.
+ *
+ * This function calls the following operators/kernels:
+ * -# cpu::kernels::CpuGroupedGemmKernel
+ */
+class NEGroupedGEMM : public IFunction
+{
+public:
+    /** Constructor */
+    NEGroupedGEMM(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupedGEMM(const NEGroupedGEMM &) = delete;
+    /** Default move constructor */
+    NEGroupedGEMM(NEGroupedGEMM &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupedGEMM &operator=(const NEGroupedGEMM &) = delete;
+    /** Default move assignment operator */
+    NEGroupedGEMM &operator=(NEGroupedGEMM &&) = default;
+    /** Default destructor */
+    ~NEGroupedGEMM();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |a              |b              |biases         |group_sizes    |d              |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |S32            |F16            |
+     * |F32            |F32            |F32            |S32            |F32            |
+     *
+     * Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU can be fused.
+     *
+     * @note Groups are laid out back to back from the first row of @p a. Negative sizes count as empty groups, rows
+     *       past the end of @p a are ignored and the rows of @p d past the sum of the sizes are left untouched.
+     *
+     * @param[in]  a           Left-hand side tensor. A 2D tensor with shape [K, rows]. Data types supported: F16/F32.
+     * @param[in]  b           Weights tensor. A 3D tensor with shape [N, K, groups]. Data type supported: Same as @p a.
+     * @param[in]  biases      Biases tensor. A 2D tensor with shape [N, groups]. Can be nullptr.
+     *                         Data type supported: Same as @p a.
+     * @param[in]  group_sizes Number of rows of every group. A 1D tensor with shape [groups]. Data type supported: S32.
+     * @param[out] d           Destination tensor. A 2D tensor with shape [N, rows]. Data type supported: Same as @p a.
+     * @param[in]  info        (Optional) Grouped GEMM information, such as the fused activation.
+     */
+    void configure(const ITensor         *a,
+                   const ITensor         *b,
+                   const ITensor         *biases,
+                   const ITensor         *group_sizes,
+                   ITensor               *d,
+                   const GroupedGemmInfo &info = GroupedGemmInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref NEGroupedGEMM::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *a,
+                           const ITensorInfo     *b,
+                           const ITensorInfo     *biases,
+                           const ITensorInfo     *group_sizes,
+                           const ITensorInfo     *d,
+                           const GroupedGemmInfo &info = GroupedGemmInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGROUPEDGEMM_H
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEIMAGEPREPROCESS_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEIMAGEPREPROCESS_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to turn a camera frame into a normalized network input
+ *
+ * Colour conversion to RGB, resize and per-channel normalization are done in a single pass over the destination, so
+ * neither the converted nor the resized image are ever written to memory.
+ *
+ * This function calls the following kernel:
+ * -# cpu::kernels::CpuImagePreprocessKernel
+ */
+class NEImagePreprocess : public IFunction
+{
+public:
+    /** Default Constructor */
+    NEImagePreprocess();
+    /** Default Destructor */
+    ~NEImagePreprocess();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImagePreprocess(const NEImagePreprocess &) = delete;
+    /** Default move constructor */
+    NEImagePreprocess(NEImagePreprocess &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImagePreprocess &operator=(const NEImagePreprocess &) = delete;
+    /** Default move assignment operator */
+    NEImagePreprocess &operator=(NEImagePreprocess &&);
+    /** Initialise the function's sources and destination.
+     *
+     * Valid data layouts:
+     * - NHWC
+     * - NCHW
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |U8             |F32            |
+     * |U8             |F16            |
+     * |U8             |QASYMM8        |
+     * |U8             |QASYMM8_SIGNED |
+     *
+     * The source is given by its format in @p info:
+     * - RGB888: @p src has 3 channels and @p src_uv is nullptr
+     * - YUYV422: @p src has 2 channels and @p src_uv is nullptr
+     * - NV12: @p src is the luma plane, @p src_uv is the interleaved chroma plane with 2 channels and half the size
+     *
+     * The destination must be initialized. Its width and height give the size of the resized image, and it must have
+     * 3 channels.
+     *
+     * @param[in]  src    Source image, or luma plane for NV12. Data type supported: U8
+     * @param[in]  src_uv Interleaved chroma plane for NV12, nullptr otherwise. Data type supported: U8
+     * @param[out] dst    Destination tensor. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED
+     * @param[in]  info   Preprocessing descriptor
+     */
+    void configure(const ITensor *src, const ITensor *src_uv, ITensor *dst, const ImagePreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEImagePreprocess
+     *
+     * Similar to @ref NEImagePreprocess::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *src_uv,
+                           const ITensorInfo         *dst,
+                           const ImagePreprocessInfo &info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEIMAGEPREPROCESS_H
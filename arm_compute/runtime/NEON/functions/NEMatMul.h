@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,11 @@ public:
     {
         return _fixed_format;
     }
+    // get weights prefetch distance
+    unsigned int weights_prefetch_distance() const
+    {
+        return _weights_prefetch_distance;
+    }
     // Set fast math flag
     CpuMatMulSettings &fast_math(bool fmath)
     {
@@ -62,10 +67,17 @@ public:
         _fixed_format = fixed_format;
         return *this;
     }
+    // Set the number of bytes of the right-hand side to prefetch ahead of their use, 0 to disable
+    CpuMatMulSettings &weights_prefetch_distance(unsigned int distance)
+    {
+        _weights_prefetch_distance = distance;
+        return *this;
+    }
 
 private:
-    bool _fast_math{false};
-    bool _fixed_format{false};
+    bool         _fast_math{false};
+    bool         _fixed_format{false};
+    unsigned int _weights_prefetch_distance{0};
 };
 
 // Forward declarations
@@ -103,13 +115,20 @@ public:
      * |:--------------|:------------------|:--------------|
      * |F32            |F32                |F32            |
      * |F16            |F16                |F16            |
+     * |F32            |QSYMM8             |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32            |
+     * |F16            |QSYMM8             |F16            |
+     * |F16            |QSYMM8_PER_CHANNEL |F16            |
      * |BFLOAT16       |BFLOAT16           |BFLOAT16       |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |QASYMM8_SIGNED |
      * |QASYMM8        |QASYMM8            |QASYMM8        |
      *
+     * @note With F16/F32 @p lhs and QSYMM8/QSYMM8_PER_CHANNEL @p rhs, @p lhs is quantized per row at run time and
+     *       multiplied in int8. In this case @p rhs must be 2D and adj_lhs is not supported.
+     *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
-     * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, or QSYMM8/QSYMM8_PER_CHANNEL if @p lhs is F16/F32.
+     * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
      * @param[in]  act_info (Optional) Contains activation function and lower and upper bound values for bounded activation functions.
@@ -123,8 +142,8 @@ public:
     /** Static function to check if given info will lead to a valid configuration of @ref NEMatMul
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
-     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
-     * @param[out] dst      Output tensor info to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs, or QSYMM8/QSYMM8_PER_CHANNEL if @p lhs is F16/F32.
+     * @param[out] dst      Output tensor info to store the result of the batched matrix multiplication. Data types supported: same as @p lhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
      * @param[in]  act_info (Optional) Contains activation function and lower and upper bound values for bounded activation functions.
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NUMAALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_NUMAALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace arm_compute
+{
+/** Allocator that places its memory on a given NUMA node
+ *
+ * Allocations are page aligned and bound to the node with a preferred memory policy, so that the
+ * physical pages are taken from the node when they are first touched, whichever thread touches them.
+ * Passing this allocator to @ref MemoryManagerOnDemand::populate keeps the workspace of functions
+ * running on a node-bound scheduler (see @ref IScheduler::set_num_threads_on_numa_node) local to that node,
+ * while tensors holding weights can import memory obtained from @ref NUMAAllocator::make_region.
+ *
+ * @note On systems without NUMA support the allocator behaves like the default @ref Allocator.
+ * @note An error is raised if the memory cannot be mapped or if the alignment is larger than a page.
+ */
+class NUMAAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] node NUMA node to allocate memory on
+     */
+    explicit NUMAAllocator(unsigned int node);
+    /** Destructor */
+    ~NUMAAllocator();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NUMAAllocator(const NUMAAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NUMAAllocator &operator=(const NUMAAllocator &) = delete;
+
+    /** Returns the NUMA node the allocator places memory on
+     *
+     * @return The NUMA node id
+     */
+    unsigned int node() const;
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    unsigned int             _node;
+    std::mutex               _mtx;
+    std::map<void *, size_t> _allocations;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NUMAALLOCATOR_H
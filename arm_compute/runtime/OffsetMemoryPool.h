@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,8 +51,8 @@ public:
      * @param[in] blob_info Configuration information of the blob to be allocated
      */
     OffsetMemoryPool(IAllocator *allocator, BlobInfo blob_info);
-    /** Default Destructor */
-    ~OffsetMemoryPool() = default;
+    /** Destructor */
+    ~OffsetMemoryPool();
     /** Prevent instances of this class to be copy constructed */
     OffsetMemoryPool(const OffsetMemoryPool &) = delete;
     /** Prevent instances of this class to be copy assigned */
@@ -72,6 +72,7 @@ public:
     void                         release(MemoryMappings &handles) override;
     MappingType                  mapping_type() const override;
     std::unique_ptr<IMemoryPool> duplicate() override;
+    size_t                       size() const override;
 
 private:
     IAllocator                    *_allocator; /**< Allocator to use for internal allocation */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,10 @@ public:
         CUSTOM /**< Provided by the user. */
     };
     /** Sets the user defined scheduler and makes it the active scheduler.
+     *
+     * @note When the library is built with ARM_COMPUTE_THREAD_LOCAL_SCHEDULER, the custom scheduler and the active
+     *       scheduler type are both local to the calling thread, so that several threads can each drive their own
+     *       scheduler while the other threads keep the default one.
      *
      * @param[in] scheduler A shared pointer to a custom scheduler implemented by the user.
      */
@@ -78,10 +82,11 @@ public:
     static bool is_available(Type t);
 
 private:
-    static Type _scheduler_type;
 #ifndef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    static Type                        _scheduler_type;
     static std::shared_ptr<IScheduler> _custom_scheduler;
 #else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    static Type thread_local                        _scheduler_type;
     static std::shared_ptr<IScheduler> thread_local _custom_scheduler;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
     static std::map<Type, std::unique_ptr<IScheduler>> _schedulers;
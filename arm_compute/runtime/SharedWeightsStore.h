@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_SHAREDWEIGHTSSTORE_H
+#define ACL_ARM_COMPUTE_RUNTIME_SHAREDWEIGHTSSTORE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Process-wide store of prepared weights, shared read-only between functions
+ *
+ * Functions transform constant weights once, e.g. into the pretransposed layout of a GEMM kernel, and normally keep
+ * their own copy of the result. When the store is enabled, the prepared weights are instead looked up by the content
+ * of the source weights and by the identity of the transformation, so that several instances of the same network
+ * (for example one replica per worker thread) hold a single copy.
+ *
+ * Entries are reference counted: the memory is released when the last function using it is destroyed.
+ * The store is disabled by default, and only functions configured while it is enabled take part in the sharing. It
+ * can be enabled for the whole process with @ref SharedWeightsStore::set_enabled, or for the functions configured by
+ * one thread with a @ref SharedWeightsStore::Scope, e.g. around the configuration of a graph.
+ *
+ * @note The shared memory must only be read once produced, so only weights with constant values are shared.
+ */
+class SharedWeightsStore final
+{
+public:
+    /** Key of an entry of the store
+     *
+     * Besides the hash of the source weights, the key holds their size and a sample of their content, so that two
+     * different weights only share an entry if their hashes collide and they also agree on these.
+     */
+    struct Key
+    {
+        uint64_t             content_hash{0}; /**< Hash of the source weights, see @ref SharedWeightsStore::hash */
+        size_t               source_size{0};  /**< Size in bytes of the source weights, without padding */
+        std::vector<uint8_t> source_sample{}; /**< Sample of the source weights, see @ref SharedWeightsStore::sample */
+        std::string          transform{};     /**< Identity of the transformation and of its parameters */
+
+        /** Ordering operator
+         *
+         * @param[in] other Key to compare with
+         *
+         * @return True if this key orders before @p other
+         */
+        bool operator<(const Key &other) const
+        {
+            return std::tie(content_hash, source_size, source_sample, transform) <
+                   std::tie(other.content_hash, other.source_size, other.source_sample, other.transform);
+        }
+    };
+    /** Enables the store for the functions configured by the calling thread, for the lifetime of the object
+     *
+     * Functions configured by other threads are not affected, unless the store is enabled for the whole process.
+     */
+    class Scope
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] enabled (Optional) Whether to enable the store. False makes the scope a no-op.
+         */
+        explicit Scope(bool enabled = true);
+        /** Prevent instances of this class from being copied */
+        Scope(const Scope &) = delete;
+        /** Prevent instances of this class from being copied */
+        Scope &operator=(const Scope &) = delete;
+        /** Destructor, disabling the store for the calling thread again */
+        ~Scope();
+
+    private:
+        bool _enabled;
+    };
+    /** Function writing the prepared weights into a buffer of the requested size */
+    using Producer = std::function<void(void *buffer)>;
+
+    /** Access the process-wide store
+     *
+     * @return The store
+     */
+    static SharedWeightsStore &get();
+    /** Prevent instances of this class from being copied */
+    SharedWeightsStore(const SharedWeightsStore &) = delete;
+    /** Prevent instances of this class from being copied */
+    SharedWeightsStore &operator=(const SharedWeightsStore &) = delete;
+
+    /** Enable or disable the sharing of the weights prepared by functions configured from now on, by any thread
+     *
+     * Disabling the store does not release the entries still in use.
+     *
+     * @param[in] enabled True to share the prepared weights
+     */
+    void set_enabled(bool enabled);
+    /** Whether functions configured now by the calling thread share their prepared weights
+     *
+     * @return True if the store is enabled for the whole process or by a @ref Scope of the calling thread
+     */
+    bool is_enabled() const;
+    /** Acquire the prepared weights of a key, producing them if no function holds them yet
+     *
+     * Concurrent calls with the same key run @p producer once, the other callers wait for it to finish.
+     *
+     * @param[in] key       Key of the prepared weights
+     * @param[in] size      Size in bytes of the prepared weights
+     * @param[in] alignment Alignment in bytes of the prepared weights
+     * @param[in] producer  Function writing the prepared weights, called only if the entry does not exist
+     *
+     * @return The memory holding the prepared weights, released when the last reference is dropped
+     */
+    std::shared_ptr<IMemoryRegion> acquire(const Key &key, size_t size, size_t alignment, const Producer &producer);
+    /** Number of prepared weights currently held by at least one function
+     *
+     * @return The number of live entries
+     */
+    size_t num_entries() const;
+    /** Total size of the prepared weights currently held by at least one function
+     *
+     * @return The size in bytes
+     */
+    size_t total_size() const;
+    /** Hash the content of a tensor, ignoring its padding
+     *
+     * @param[in] tensor Tensor to hash
+     * @param[in] seed   (Optional) Hash to combine the content with, e.g. the hash of another tensor
+     *
+     * @return The hash of the content
+     */
+    static uint64_t hash(const ITensor &tensor, uint64_t seed = 0);
+    /** Copy a few elements of a tensor, evenly spread from its first to its last element
+     *
+     * @param[in] tensor Tensor to sample
+     *
+     * @return The bytes of the sampled elements
+     */
+    static std::vector<uint8_t> sample(const ITensor &tensor);
+
+private:
+    /** One entry of the store, locked while its weights are produced */
+    struct Slot
+    {
+        std::mutex                   mtx{};
+        std::weak_ptr<IMemoryRegion> region{};
+    };
+
+    SharedWeightsStore() = default;
+
+    mutable std::mutex                   _mtx{};
+    std::map<Key, std::shared_ptr<Slot>> _slots{};
+    std::atomic<bool>                    _enabled{false};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_SHAREDWEIGHTSSTORE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2019, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/runtime/ITensorAllocator.h"
 #include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryRegion.h"
 
 #include <cstdint>
 #include <memory>
@@ -105,6 +106,7 @@ public:
      * @warning padding should be accounted by the client code.
      * @warning memory must be writable in case of in-place operations
      * @note buffer alignment will be checked to be compliant with alignment reported by ITensorInfo.
+     * @note importing doesn't allocate any memory, so tensors can be re-pointed on every run.
      *
      * @param[in] memory Raw memory pointer to be used as backing memory
      *
@@ -131,6 +133,7 @@ private:
     IMemoryManageable *_owner;                   /**< Memory manageable object that owns the allocator */
     IMemoryGroup      *_associated_memory_group; /**< Registered memory manager */
     Memory             _memory;                  /**< CPU memory */
+    MemoryRegion       _imported_region;         /**< Region wrapping the imported memory, reused by every import */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_TENSORALLOCATOR_H
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_EXECUTIONPLAN_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_EXECUTIONPLAN_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IOperator.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace arm_compute
+{
+class Tensor;
+
+namespace experimental
+{
+/** Memory footprint of an @ref ExecutionPlan */
+struct ExecutionPlanMemoryStats
+{
+    size_t arena_size{0};      /**< Size of the arena holding the temporary workspaces and intermediate tensors */
+    size_t naive_size{0};      /**< Size of the same buffers if each of them was allocated separately */
+    size_t persistent_size{0}; /**< Size of the persistent workspaces, allocated outside of the arena */
+    size_t prepare_size{0};    /**< Size of the workspaces only used by prepare, released once prepared */
+};
+
+/** Runs an ordered sequence of configured stateless operators out of a single memory arena
+ *
+ * The plan follows the lifetime rules of @ref MemoryGroup:
+ * - The temporary workspace of an operator lives for the duration of that operator.
+ * - An intermediate tensor lives from the operator added after the call to @ref ExecutionPlan::manage to the last
+ *   operator added before the tensor's TensorAllocator::allocate() is called.
+ *
+ * Buffers whose lifetimes do not overlap share the same memory in the arena, which is allocated once by
+ * @ref ExecutionPlan::finalize. Workspace tensors are injected into the operator packs by the plan.
+ *
+ * Example:
+ * @code{.cpp}
+ * ExecutionPlan plan;
+ * plan.manage(&tmp); // Start of the lifetime of tmp
+ * plan.add_operator(&conv, {{ACL_SRC_0, &src}, {ACL_SRC_1, &weights}, {ACL_DST, &tmp}});
+ * plan.add_operator(&act, {{ACL_SRC, &tmp}, {ACL_DST, &dst}});
+ * tmp.allocator()->allocate(); // End of the lifetime of tmp
+ * plan.finalize();
+ * plan.run();
+ * @endcode
+ */
+class ExecutionPlan
+{
+public:
+    /** Constructor */
+    ExecutionPlan();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ExecutionPlan(const ExecutionPlan &) = delete;
+    /** Prevent copy assignment */
+    ExecutionPlan &operator=(const ExecutionPlan &) = delete;
+    /** Default move constructor */
+    ExecutionPlan(ExecutionPlan &&);
+    /** Default move assignment */
+    ExecutionPlan &operator=(ExecutionPlan &&);
+    /** Default destructor */
+    ~ExecutionPlan();
+    /** Starts the lifetime of an intermediate tensor whose memory is provided by the arena
+     *
+     * @param[in] tensor Tensor with an initialised info that is not allocated yet.
+     *                   Its lifetime ends when its TensorAllocator::allocate() is called.
+     */
+    void manage(Tensor *tensor);
+    /** Appends an operator to the plan
+     *
+     * @param[in] op   Configured operator. Must outlive the plan.
+     * @param[in] pack Tensors to run the operator with, without its workspace which is added by the plan.
+     */
+    void add_operator(IOperator *op, const ITensorPack &pack);
+    /** Computes the arena and allocates it
+     *
+     * @pre The lifetime of all the managed tensors has ended.
+     *
+     * @param[in] allocator (Optional) Allocator for the arena. Must outlive the plan. Defaults to @ref Allocator.
+     */
+    void finalize(IAllocator *allocator = nullptr);
+    /** Prepares all the operators and releases the workspaces only needed for it
+     *
+     * @note Called by the first @ref ExecutionPlan::run if not called before.
+     */
+    void prepare();
+    /** Runs all the operators in order */
+    void run();
+    /** Returns the memory footprint of the plan
+     *
+     * @note The arena size is only known after @ref ExecutionPlan::finalize
+     *
+     * @return The memory footprint
+     */
+    ExecutionPlanMemoryStats memory_stats() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+} // namespace experimental
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_EXECUTIONPLAN_H
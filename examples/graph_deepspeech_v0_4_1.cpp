@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -212,6 +212,8 @@ public:
         config.use_tuner          = common_params.enable_tuner;
         config.tuner_file         = common_params.tuner_file;
         config.mlgo_file          = common_params.mlgo_file;
+        config.plan_file          = common_params.plan_file;
+        config.pipeline_stages    = common_params.pipeline_stages;
         config.use_synthetic_type = arm_compute::is_data_type_quantized(common_params.data_type);
         config.synthetic_type     = common_params.data_type;
 
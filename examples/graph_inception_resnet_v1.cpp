@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -224,6 +224,10 @@ public:
         config.tuner_mode  = common_params.tuner_mode;
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
+        config.plan_file   = common_params.plan_file;
+
+        config.pipeline_stages         = common_params.pipeline_stages;
+        config.fuse_residual_additions = common_params.residual_fusion;
 
         graph.finalize(common_params.target, config);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023 Arm Limited.
+ * Copyright (c) 2018-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -104,6 +104,10 @@ public:
         config.use_tuner   = common_params.enable_tuner;
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
+        config.plan_file   = common_params.plan_file;
+
+        config.pipeline_stages          = common_params.pipeline_stages;
+        config.fuse_depthwise_separable = common_params.depthwise_fusion;
 
         graph.finalize(common_params.target, config);
 
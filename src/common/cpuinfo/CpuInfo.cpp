@@ -30,7 +30,10 @@
 #include "support/ToolchainSupport.h"
 #include "support/WindowsSupport.h"
 
+#include <algorithm>
+#include <cctype>
 #include <map>
+#include <numeric>
 #include <sstream>
 
 #if !defined(BARE_METAL)
@@ -579,5 +582,65 @@ uint32_t num_threads_hint()
 
     return num_threads_hint;
 }
+
+std::vector<uint32_t> parse_cpu_list(const std::string &cpu_list)
+{
+    std::vector<uint32_t> ids;
+    std::stringstream     ss(cpu_list);
+    std::string           range;
+    while (std::getline(ss, range, ','))
+    {
+        range.erase(std::remove_if(range.begin(), range.end(), [](char c) { return std::isspace(c); }), range.end());
+        if (range.empty())
+        {
+            continue;
+        }
+        const auto     sep   = range.find('-');
+        const uint32_t first = support::cpp11::stoul(range.substr(0, sep));
+        const uint32_t last  = (sep == std::string::npos) ? first : support::cpp11::stoul(range.substr(sep + 1));
+        for (uint32_t id = first; id <= last; ++id)
+        {
+            ids.emplace_back(id);
+        }
+    }
+    return ids;
+}
+
+std::vector<std::vector<uint32_t>> numa_nodes(uint32_t num_cpus)
+{
+    std::vector<std::vector<uint32_t>> nodes;
+
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
+    std::ifstream online_file("/sys/devices/system/node/online", std::ios::in);
+    std::string   line;
+    if (online_file.is_open() && bool(getline(online_file, line)))
+    {
+        for (const auto node : parse_cpu_list(line))
+        {
+            std::stringstream str;
+            str << "/sys/devices/system/node/node" << node << "/cpulist";
+            std::ifstream cpulist_file(str.str(), std::ios::in);
+            std::string   cpulist;
+            if (cpulist_file.is_open() && bool(getline(cpulist_file, cpulist)))
+            {
+                if (nodes.size() <= node)
+                {
+                    nodes.resize(node + 1);
+                }
+                nodes[node] = parse_cpu_list(cpulist);
+            }
+        }
+    }
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+
+    // Fall back to a single node holding all the CPUs
+    if (nodes.empty())
+    {
+        std::vector<uint32_t> cpus(std::max(num_cpus, 1U));
+        std::iota(cpus.begin(), cpus.end(), 0U);
+        nodes.emplace_back(std::move(cpus));
+    }
+    return nodes;
+}
 } // namespace cpuinfo
 } // namespace arm_compute
@@ -154,6 +154,25 @@ private:
  * @return The minumum number of common cores.
  */
 uint32_t num_threads_hint();
+
+/** Discover the NUMA topology of the system
+ *
+ * The topology is read from /sys/devices/system/node/node<N>/cpulist. Systems that do not expose
+ * this information are reported as a single node containing all the CPUs.
+ *
+ * @param[in] num_cpus Number of CPUs to use for the single-node fallback
+ *
+ * @return A list with the logical CPU ids of each NUMA node, indexed by node id
+ */
+std::vector<std::vector<uint32_t>> numa_nodes(uint32_t num_cpus);
+
+/** Parse a Linux CPU list string (e.g. "0-3,8,10-11") into the list of CPU ids it contains
+ *
+ * @param[in] cpu_list CPU list in the sysfs "cpulist" format
+ *
+ * @return The CPU ids, in the order they appear in the list
+ */
+std::vector<uint32_t> parse_cpu_list(const std::string &cpu_list);
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif // ACL_SRC_COMMON_CPUINFO_CPUINFO_H
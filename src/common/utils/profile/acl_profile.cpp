@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,7 +24,13 @@
 #if defined(ACL_PROFILE_ENABLE) && (ACL_PROFILE_BACKEND == PERFETTO)
 #include "src/common/utils/profile/acl_profile.h"
 
+#include <atomic>
 #include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
 
 PERFETTO_TRACK_EVENT_STATIC_STORAGE();
 namespace arm_compute
@@ -206,6 +212,48 @@ PerfettoProfiler &get_profiler()
     return acl_perfetto;
 }
 
+uint64_t new_flow_ids(uint64_t count)
+{
+    static std::atomic<uint64_t> next_flow_id{1};
+    return next_flow_id.fetch_add(count, std::memory_order_relaxed);
+}
+
+void set_thread_track_name(const char *name)
+{
+    const perfetto::ThreadTrack track = perfetto::ThreadTrack::Current();
+    auto                        desc  = track.Serialize();
+    desc.mutable_thread()->set_thread_name(name);
+    perfetto::TrackEvent::SetTrackDescriptor(track, desc);
+}
+
+perfetto::Track custom_event_track(const char *category)
+{
+    static std::mutex            mtx;
+    static std::set<std::string> named_tracks;
+
+    const std::string     track_name = std::string("ACL ") + category;
+    const perfetto::Track track(std::hash<std::string>{}(track_name));
+
+    // Name the track the first time it is used
+    std::lock_guard<std::mutex> lock(mtx);
+    if (named_tracks.insert(track_name).second)
+    {
+        auto desc = track.Serialize();
+        desc.set_name(track_name);
+        perfetto::TrackEvent::SetTrackDescriptor(track, desc);
+    }
+    return track;
+}
+
+int64_t accumulate_counter(const char *name, int64_t delta)
+{
+    static std::mutex                     mtx;
+    static std::map<std::string, int64_t> totals;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    return totals[name] += delta;
+}
+
 } // namespace profile
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 #ifndef ACL_SRC_COMMON_UTILS_PROFILE_ACL_PROFILE_H
 #define ACL_SRC_COMMON_UTILS_PROFILE_ACL_PROFILE_H
 
+#include <cstdint>
+
 // Define ACL profile categories
 #define ARM_COMPUTE_PROF_CAT_NONE      "NONE"
 #define ARM_COMPUTE_PROF_CAT_CPU       "CPU"
@@ -43,6 +45,8 @@
 #if defined(ACL_PROFILE_ENABLE) && (ACL_PROFILE_BACKEND == PERFETTO)
 #include "third_party/perfetto/perfetto.h"
 
+#include <utility>
+
 #ifdef ARM_COMPUTE_CL
 #include "tests/framework/instruments/OpenCLTimer.h"
 using namespace arm_compute::test::framework;
@@ -88,13 +92,17 @@ private:
 // 👇 Singleton accessor declaration
 PerfettoProfiler &get_profiler();
 
+/** Ends a trace event when going out of scope
+ *
+ * Perfetto needs the category of an event at compile time, so the end of the event is emitted by @p EndFn, a lambda
+ * written where the category is known.
+ */
+template <typename EndFn>
 class ScopedPerfettoTrace final
 {
 public:
-    ScopedPerfettoTrace(uint64_t start_ts) : _start_ts(start_ts)
+    ScopedPerfettoTrace(uint64_t start_ts, EndFn end_fn) : _start_ts(start_ts), _end_fn(std::move(end_fn))
     {
-        // TODO : add support for categories
-        (void)_start_ts;
     }
 
     ~ScopedPerfettoTrace()
@@ -103,13 +111,45 @@ public:
         if (end_ts < _start_ts)
             end_ts = _start_ts + 1;
 
-        TRACE_EVENT_END(ARM_COMPUTE_PROF_CAT_NONE, end_ts);
+        _end_fn(end_ts);
     }
 
 private:
     uint64_t _start_ts;
+    EndFn    _end_fn;
 };
 
+/** Reserve identifiers for flow events
+ *
+ * @param[in] count Number of identifiers to reserve
+ *
+ * @return The first of @p count consecutive identifiers not used by any other flow
+ */
+uint64_t new_flow_ids(uint64_t count);
+
+/** Name the track of the calling thread
+ *
+ * @param[in] name Name of the track
+ */
+void set_thread_track_name(const char *name);
+
+/** Track on which the custom events of a category are drawn
+ *
+ * @param[in] category Category of the events
+ *
+ * @return A track named after the category, the same for every call with the same category
+ */
+perfetto::Track custom_event_track(const char *category);
+
+/** Add to the total of a counter
+ *
+ * @param[in] name  Name of the counter
+ * @param[in] delta Value to add, can be negative
+ *
+ * @return The new total of the counter
+ */
+int64_t accumulate_counter(const char *name, int64_t delta);
+
 } // namespace profile
 } // namespace arm_compute
 
@@ -128,14 +168,15 @@ private:
 #define USE_CUSTOM_TIMESTAMP
 #endif
 
-#define ARM_COMPUTE_TRACE_CUSTOM_EVENT(category, level, timestamp_ns, duration_ns, name, arg)                 \
-    do                                                                                                        \
-    {                                                                                                         \
-        if ((int)(level) <= ACL_PROFILE_LEVEL)                                                                \
-        {                                                                                                     \
-            TRACE_EVENT_BEGIN(category, name, perfetto::Track(0xFF), (uint64_t)timestamp_ns, "arg", arg);     \
-            TRACE_EVENT_END(category, perfetto::Track(0xFF), (uint64_t)timestamp_ns + (uint64_t)duration_ns); \
-        }                                                                                                     \
+#define ARM_COMPUTE_TRACE_CUSTOM_EVENT(category, level, timestamp_ns, duration_ns, name, arg) \
+    do                                                                                        \
+    {                                                                                         \
+        if ((int)(level) <= ACL_PROFILE_LEVEL)                                                \
+        {                                                                                     \
+            const perfetto::Track track = arm_compute::profile::custom_event_track(category); \
+            TRACE_EVENT_BEGIN(category, name, track, (uint64_t)timestamp_ns, "arg", arg);     \
+            TRACE_EVENT_END(category, track, (uint64_t)timestamp_ns + (uint64_t)duration_ns); \
+        }                                                                                     \
     } while (0)
 
 #define ARM_COMPUTE_TRACE_CUSTOM_EVENT_BEGIN(category, level, timestamp_ns, name, arg) \
@@ -161,20 +202,54 @@ private:
             TRACE_EVENT_INSTANT(category, name, (uint64_t)timestamp_ns);            \
     } while (0)
 
+// Scoped trace events: they last until the end of the enclosing scope and are drawn on the track of the calling thread
 #define ARM_COMPUTE_TRACE_EVENT(...) _ARM_COMPUTE_TRACE_EVENT_SELECT(__VA_ARGS__)
 
-#define _ARM_COMPUTE_TRACE_EVENT_SELECT(cat, level, name) _ARM_COMPUTE_TRACE_EVENT_L##level(cat, name)
+#define _ARM_COMPUTE_TRACE_EVENT_SELECT(cat, level, name) \
+    _ARM_COMPUTE_TRACE_SCOPE_L##level(cat, name, _ARM_COMPUTE_TRACE_NO_ARGS)
+
+// Scoped trace event which is the origin of the flows [flow_base, flow_base + num_flows)
+#define ARM_COMPUTE_TRACE_EVENT_WITH_FLOWS(...) _ARM_COMPUTE_TRACE_EVENT_WITH_FLOWS_SELECT(__VA_ARGS__)
+
+#define _ARM_COMPUTE_TRACE_EVENT_WITH_FLOWS_SELECT(cat, level, name, flow_base, num_flows) \
+    _ARM_COMPUTE_TRACE_SCOPE_L##level(cat, name, [&](perfetto::EventContext ctx) {         \
+        for (uint64_t flow = 0; flow < (uint64_t)(num_flows); ++flow)                      \
+            perfetto::Flow::ProcessScoped((uint64_t)(flow_base) + flow)(ctx);              \
+    })
+
+// Scoped trace event which terminates the flow flow_id
+#define ARM_COMPUTE_TRACE_EVENT_FLOW_END(...) _ARM_COMPUTE_TRACE_EVENT_FLOW_END_SELECT(__VA_ARGS__)
+
+#define _ARM_COMPUTE_TRACE_EVENT_FLOW_END_SELECT(cat, level, name, flow_id) \
+    _ARM_COMPUTE_TRACE_SCOPE_L##level(cat, name, perfetto::TerminatingFlow::ProcessScoped((uint64_t)(flow_id)))
+
+#define ARM_COMPUTE_TRACE_NEW_FLOW_IDS(count) arm_compute::profile::new_flow_ids((uint64_t)(count))
+
+#define ARM_COMPUTE_TRACE_THREAD_NAME(name) arm_compute::profile::set_thread_track_name(name)
+
+// Counter holding the running total of the values added to it from anywhere in the library
+#define ARM_COMPUTE_TRACE_COUNTER_ADD(category, level, name, delta)                                      \
+    do                                                                                                   \
+    {                                                                                                    \
+        if ((int)(level) <= ACL_PROFILE_LEVEL)                                                           \
+            ARM_COMPUTE_TRACE_COUNTER(category, level, name,                                             \
+                                      arm_compute::profile::accumulate_counter(name, (int64_t)(delta))); \
+    } while (0)
+
+#define _ARM_COMPUTE_TRACE_NO_ARGS [](perfetto::EventContext) {}
+
+#define _ARM_COMPUTE_TRACE_CONCAT_IMPL(a, b) a##b
+#define _ARM_COMPUTE_TRACE_CONCAT(a, b)      _ARM_COMPUTE_TRACE_CONCAT_IMPL(a, b)
+#define _ARM_COMPUTE_TRACE_UNIQUE(prefix)    _ARM_COMPUTE_TRACE_CONCAT(prefix, __LINE__)
 
 #ifdef USE_CUSTOM_TIMESTAMP
 
-// TODO : find a better way to handle category with scoped trace event.
-// At the moment these event category are set to None.
-#if ACL_PROFILE_LEVEL >= 0
-#define _ARM_COMPUTE_TRACE_EVENT_L0(category, name)                               \
-    uint64_t __ts_##__COUNTER__ = arm_compute::profile::get_profiler().getTsNs(); \
-    TRACE_EVENT_BEGIN(ARM_COMPUTE_PROF_CAT_NONE, name, __ts_##__COUNTER__);       \
-    arm_compute::profile::ScopedPerfettoTrace __trace_scope_##__COUNTER__(__ts_##__COUNTER__);
-#endif
+#define _ARM_COMPUTE_TRACE_SCOPE(category, name, args)                                                        \
+    const uint64_t _ARM_COMPUTE_TRACE_UNIQUE(acl_trace_ts_) = arm_compute::profile::get_profiler().getTsNs(); \
+    TRACE_EVENT_BEGIN(category, name, _ARM_COMPUTE_TRACE_UNIQUE(acl_trace_ts_), args);                        \
+    const arm_compute::profile::ScopedPerfettoTrace _ARM_COMPUTE_TRACE_UNIQUE(acl_trace_scope_)(              \
+        _ARM_COMPUTE_TRACE_UNIQUE(acl_trace_ts_), [](uint64_t end_ts) { TRACE_EVENT_END(category, end_ts); })
+
 #define ARM_COMPUTE_TRACE_EVENT_BEGIN(category, level, name)                                             \
     do                                                                                                   \
     {                                                                                                    \
@@ -204,9 +279,7 @@ private:
     } while (0)
 #else
 
-#if ACL_PROFILE_LEVEL >= 0
-#define _ARM_COMPUTE_TRACE_EVENT_L0(category, name) TRACE_EVENT(category, name)
-#endif
+#define _ARM_COMPUTE_TRACE_SCOPE(category, name, args) TRACE_EVENT(category, name, args)
 
 #define ARM_COMPUTE_TRACE_EVENT_BEGIN(category, level, name) \
     do                                                       \
@@ -237,27 +310,41 @@ private:
     } while (0)
 #endif
 
+#if ACL_PROFILE_LEVEL >= 0
+#define _ARM_COMPUTE_TRACE_SCOPE_L0(category, name, args) _ARM_COMPUTE_TRACE_SCOPE(category, name, args)
+#else
+#define _ARM_COMPUTE_TRACE_SCOPE_L0(category, name, args)
+#endif
+
 #if ACL_PROFILE_LEVEL >= 1
-#define _ARM_COMPUTE_TRACE_EVENT_L1(category, name) _ARM_COMPUTE_TRACE_EVENT_L0(category, name)
+#define _ARM_COMPUTE_TRACE_SCOPE_L1(category, name, args) _ARM_COMPUTE_TRACE_SCOPE(category, name, args)
 #else
-#define _ARM_COMPUTE_TRACE_EVENT_L1(category, name)
+#define _ARM_COMPUTE_TRACE_SCOPE_L1(category, name, args)
 #endif
 
 #if ACL_PROFILE_LEVEL >= 2
-#define _ARM_COMPUTE_TRACE_EVENT_L2(category, name) _ARM_COMPUTE_TRACE_EVENT_L1(category, name)
+#define _ARM_COMPUTE_TRACE_SCOPE_L2(category, name, args) _ARM_COMPUTE_TRACE_SCOPE(category, name, args)
 #else
-#define _ARM_COMPUTE_TRACE_EVENT_L2(category, name)
+#define _ARM_COMPUTE_TRACE_SCOPE_L2(category, name, args)
 #endif
 
 #else
 // Stub PROFILE macros to do nothing
 #define ARM_COMPUTE_TRACE_OPENCL_BEGIN() (void)0
 #define ARM_COMPUTE_TRACE_OPENCL_SYNC()  (void)0
+#define ARM_COMPUTE_TRACE_CUSTOM_EVENT(category, level, timestamp_ns, duration_ns, name, arg) \
+    (void)category;                                                                           \
+    (void)level;                                                                              \
+    (void)(timestamp_ns);                                                                     \
+    (void)(duration_ns);                                                                      \
+    (void)name;                                                                               \
+    (void)(arg)
 #define ARM_COMPUTE_TRACE_CUSTOM_EVENT_BEGIN(category, level, timestamp_ns, name, arg) \
     (void)category;                                                                    \
     (void)name;                                                                        \
     (void)level;                                                                       \
-    (void)timestamp_ns(void) arg;
+    (void)(timestamp_ns);                                                              \
+    (void)(arg)
 #define ARM_COMPUTE_TRACE_CUSTOM_EVENT_END(category, level, timestamp_ns) \
     (void)category;                                                       \
     (void)level;                                                          \
@@ -277,6 +364,34 @@ private:
     (void)category;                                            \
     (void)name;                                                \
     (void)level
+#define ARM_COMPUTE_TRACE_CUSTOM_EVENT_INSTANT(category, level, name, timestamp_ns) \
+    (void)category;                                                                 \
+    (void)level;                                                                    \
+    (void)name;                                                                     \
+    (void)(timestamp_ns)
+#define ARM_COMPUTE_TRACE_EVENT_WITH_FLOWS(category, level, name, flow_base, num_flows) \
+    (void)category;                                                                     \
+    (void)level;                                                                        \
+    (void)name;                                                                         \
+    (void)(flow_base);                                                                  \
+    (void)(num_flows)
+#define ARM_COMPUTE_TRACE_EVENT_FLOW_END(category, level, name, flow_id) \
+    (void)category;                                                      \
+    (void)level;                                                         \
+    (void)name;                                                          \
+    (void)(flow_id)
+#define ARM_COMPUTE_TRACE_NEW_FLOW_IDS(count) ((void)(count), uint64_t{0})
+#define ARM_COMPUTE_TRACE_THREAD_NAME(name)   (void)(name)
+#define ARM_COMPUTE_TRACE_COUNTER(category, level, name, value) \
+    (void)category;                                             \
+    (void)level;                                                \
+    (void)name;                                                 \
+    (void)(value)
+#define ARM_COMPUTE_TRACE_COUNTER_ADD(category, level, name, delta) \
+    (void)category;                                                 \
+    (void)level;                                                    \
+    (void)name;                                                     \
+    (void)(delta)
 #define ARM_COMPUTE_PROFILE_INIT() \
     do                             \
     {                              \
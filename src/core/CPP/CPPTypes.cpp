@@ -32,13 +32,16 @@
 #include "src/cpu/kernels/assembly/arm_common/internal/utils.hpp"
 #endif // ARM_COMPUTE_CPU_ENABLED
 
+#include <algorithm>
+
 namespace arm_compute
 {
 struct CPUInfo::Impl
 {
-    cpuinfo::CpuInfo info{};
-    unsigned int     L1_cache_size = 32768;
-    unsigned int     L2_cache_size = 262144;
+    cpuinfo::CpuInfo                   info{};
+    std::vector<std::vector<uint32_t>> numa_nodes{};
+    unsigned int                       L1_cache_size = 32768;
+    unsigned int                       L2_cache_size = 262144;
 };
 
 CPUInfo &CPUInfo::get()
@@ -49,7 +52,8 @@ CPUInfo &CPUInfo::get()
 
 CPUInfo::CPUInfo() : _impl(std::make_unique<Impl>())
 {
-    _impl->info = cpuinfo::CpuInfo::build();
+    _impl->info       = cpuinfo::CpuInfo::build();
+    _impl->numa_nodes = cpuinfo::numa_nodes(_impl->info.num_cpus());
 }
 
 CPUInfo::~CPUInfo() = default;
@@ -189,4 +193,31 @@ unsigned int CPUInfo::get_cpu_num_excluding_little() const
     return get_cpu_num();
 #endif /* defined(__ANDROID__) */
 }
+
+unsigned int CPUInfo::get_numa_node_count() const
+{
+    return _impl->numa_nodes.size();
+}
+
+std::vector<unsigned int> CPUInfo::get_numa_node_cpus(unsigned int node) const
+{
+    if (node < _impl->numa_nodes.size())
+    {
+        return std::vector<unsigned int>(_impl->numa_nodes[node].begin(), _impl->numa_nodes[node].end());
+    }
+    return {};
+}
+
+int CPUInfo::get_numa_node_of_cpu(unsigned int cpuid) const
+{
+    for (size_t node = 0; node < _impl->numa_nodes.size(); ++node)
+    {
+        const auto &cpus = _impl->numa_nodes[node];
+        if (std::find(cpus.begin(), cpus.end(), cpuid) != cpus.end())
+        {
+            return static_cast<int>(node);
+        }
+    }
+    return -1;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,24 +25,28 @@
 
 #include "arm_compute/core/ITensor.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
-ITensorPack::ITensorPack(std::initializer_list<PackElement> l) : _pack()
+constexpr size_t ITensorPack::inline_capacity;
+
+ITensorPack::ITensorPack(std::initializer_list<PackElement> l)
 {
     for (auto &e : l)
     {
-        _pack[e.id] = e;
+        store(e);
     }
 }
 
 void ITensorPack::add_tensor(int id, ITensor *tensor)
 {
-    _pack[id] = PackElement(id, tensor);
+    store(PackElement(id, tensor));
 }
 
 void ITensorPack::add_tensor(int id, const ITensor *tensor)
 {
-    _pack[id] = PackElement(id, tensor);
+    store(PackElement(id, tensor));
 }
 
 void ITensorPack::add_const_tensor(int id, const ITensor *tensor)
@@ -52,32 +56,92 @@ void ITensorPack::add_const_tensor(int id, const ITensor *tensor)
 
 const ITensor *ITensorPack::get_const_tensor(int id) const
 {
-    auto it = _pack.find(id);
-    if (it != _pack.end())
+    const PackElement *e = find(id);
+    if (e != nullptr)
     {
-        return it->second.ctensor != nullptr ? it->second.ctensor : it->second.tensor;
+        return e->ctensor != nullptr ? e->ctensor : e->tensor;
     }
     return nullptr;
 }
 
 ITensor *ITensorPack::get_tensor(int id)
 {
-    auto it = _pack.find(id);
-    return it != _pack.end() ? it->second.tensor : nullptr;
+    PackElement *e = find(id);
+    return e != nullptr ? e->tensor : nullptr;
 }
 
 void ITensorPack::remove_tensor(int id)
 {
-    _pack.erase(id);
+    PackElement *e = find(id);
+    if (e == nullptr)
+    {
+        return;
+    }
+
+    // The order of the elements doesn't matter: fill the hole with the last element
+    *e = at(_size - 1);
+    if (_size > inline_capacity)
+    {
+        _overflow.pop_back();
+    }
+    --_size;
 }
 
 size_t ITensorPack::size() const
 {
-    return _pack.size();
+    return _size;
 }
 
 bool ITensorPack::empty() const
 {
-    return _pack.empty();
+    return _size == 0;
+}
+
+ITensorPack::PackElement *ITensorPack::find(int id)
+{
+    return const_cast<PackElement *>(static_cast<const ITensorPack *>(this)->find(id));
+}
+
+const ITensorPack::PackElement *ITensorPack::find(int id) const
+{
+    const size_t num_inline = std::min(_size, inline_capacity);
+    for (size_t i = 0; i < num_inline; ++i)
+    {
+        if (_inline[i].id == id)
+        {
+            return &_inline[i];
+        }
+    }
+    for (const auto &e : _overflow)
+    {
+        if (e.id == id)
+        {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+ITensorPack::PackElement &ITensorPack::at(size_t idx)
+{
+    return idx < inline_capacity ? _inline[idx] : _overflow[idx - inline_capacity];
+}
+
+void ITensorPack::store(const PackElement &element)
+{
+    PackElement *e = find(element.id);
+    if (e != nullptr)
+    {
+        *e = element;
+    }
+    else if (_size < inline_capacity)
+    {
+        _inline[_size++] = element;
+    }
+    else
+    {
+        _overflow.push_back(element);
+        ++_size;
+    }
 }
 } // namespace arm_compute
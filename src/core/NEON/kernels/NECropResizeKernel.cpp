@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NECropResizeKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/crop/list.h"
+
+namespace arm_compute
+{
+namespace
+{
+struct CropResizeSelectorData
+{
+    DataType dt;
+};
+
+using CropResizeSelectorPtr = std::add_pointer<bool(const CropResizeSelectorData &data)>::type;
+using CropResizeUKernelPtr  = std::add_pointer<NECropResizeKernel::CropResizeFunction>::type;
+
+struct CropResizeUKernel
+{
+    const char                 *name;
+    const CropResizeSelectorPtr is_selected;
+    CropResizeUKernelPtr        ukernel;
+};
+
+static const CropResizeUKernel available_kernels[] = {
+    {"fp16_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::F16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::fp16_crop_resize)},
+    {"f32_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::fp32_crop_resize)},
+    {"u8_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::U8; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u8_crop_resize)},
+    {"u16_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::U16; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u16_crop_resize)},
+    {"u32_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::U32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u32_crop_resize)},
+    {"s16_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::S16; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::s16_crop_resize)},
+    {"s32_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::S32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::s32_crop_resize)},
+};
+
+/** Micro-kernel selector
+ *
+ * @param[in] data Selection data passed to help pick the appropriate micro-kernel
+ *
+ * @return A matching micro-kernel else nullptr
+ */
+const CropResizeUKernel *get_implementation(const CropResizeSelectorData &data)
+{
+    for (const auto &uk : available_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+
+    return nullptr;
+}
+
+TensorShape compute_output_shape(const ITensorInfo *input, const ITensorInfo *boxes, Coordinates2D crop_size)
+{
+    return TensorShape(input->tensor_shape()[0], crop_size.x, crop_size.y, boxes->tensor_shape()[1]);
+}
+} // namespace
+
+NECropResizeKernel::NECropResizeKernel()
+    : _input(nullptr),
+      _boxes(nullptr),
+      _box_ind(nullptr),
+      _output(nullptr),
+      _method(InterpolationPolicy::BILINEAR),
+      _extrapolation_value(0),
+      _func(nullptr)
+{
+}
+
+void NECropResizeKernel::configure(const ITensor      *input,
+                                   const ITensor      *boxes,
+                                   const ITensor      *box_ind,
+                                   ITensor            *output,
+                                   Coordinates2D       crop_size,
+                                   InterpolationPolicy method,
+                                   float               extrapolation_value)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, boxes, box_ind, output);
+
+    // Auto initialize output if not initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_data_type(DataType::F32).set_tensor_shape(
+                                            compute_output_shape(input->info(), boxes->info(), crop_size)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input->info(), boxes->info(), box_ind->info(), output->info(), crop_size,
+                                        method, extrapolation_value));
+
+    _input               = input;
+    _boxes               = boxes;
+    _box_ind             = box_ind;
+    _output              = output;
+    _method              = method;
+    _extrapolation_value = extrapolation_value;
+    _func                = get_implementation(CropResizeSelectorData{input->info()->data_type()})->ukernel;
+
+    // Each step of the window is one row of one output image, so that the rows of all the boxes can be split
+    // between the threads
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(2) * output->info()->dimension(3), 1));
+    INEKernel::configure(win);
+}
+
+Status NECropResizeKernel::validate(const ITensorInfo  *input,
+                                    const ITensorInfo  *boxes,
+                                    const ITensorInfo  *box_ind,
+                                    const ITensorInfo  *output,
+                                    Coordinates2D       crop_size,
+                                    InterpolationPolicy method,
+                                    float               extrapolation_value)
+{
+    ARM_COMPUTE_UNUSED(extrapolation_value);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, boxes, box_ind, output);
+    const auto *uk = get_implementation(CropResizeSelectorData{input->data_type()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::U16, DataType::S16,
+                                                         DataType::F16, DataType::U32, DataType::S32, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape().num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(boxes, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(boxes->tensor_shape()[0] != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(box_ind, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(boxes->tensor_shape()[1] != box_ind->tensor_shape()[0]);
+    ARM_COMPUTE_RETURN_ERROR_ON(crop_size.x <= 0 || crop_size.y <= 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(method != InterpolationPolicy::NEAREST_NEIGHBOR &&
+                                method != InterpolationPolicy::BILINEAR);
+    if (output->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                           compute_output_shape(input, boxes, crop_size));
+    }
+    return Status{};
+}
+
+void NECropResizeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    (*_func)(_input, _boxes, _box_ind, _output, _method, _extrapolation_value, window);
+}
+} // namespace arm_compute
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NECROPRESIZEKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NECROPRESIZEKERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Kernel to crop a set of boxes out of a batch of images and resize them, in a single pass
+ *
+ * Every output pixel is sampled directly from the source image, as if the box had been cropped and then scaled to
+ * the crop size, so no intermediate crop is stored. The boxes are read when the kernel runs, so they can change
+ * between runs without reconfiguring. The window spans the rows of all the output images, so the scheduler can
+ * split the work over boxes and rows.
+ */
+class NECropResizeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NECropResizeKernel";
+    }
+    /** Default constructor */
+    NECropResizeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECropResizeKernel(const NECropResizeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECropResizeKernel &operator=(const NECropResizeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NECropResizeKernel(NECropResizeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NECropResizeKernel &operator=(NECropResizeKernel &&) = default;
+    /** Default destructor */
+    ~NECropResizeKernel() = default;
+    /** Configure kernel
+     *
+     * @note Supported tensor rank: up to 4
+     * @note Box coordinates may be outside of the image, in which case @p extrapolation_value is used.
+     *
+     * @param[in]  input               Source tensor. Data type supported: U8/U16/S16/U32/S32/F16/F32.
+     *                                 Data layouts supported: NHWC.
+     * @param[in]  boxes               Tensor containing the boxes, each represented by 4 normalized values
+     *                                 [y0, x0, y1, x1]. Data type supported: F32
+     * @param[in]  box_ind             One dimensional tensor containing the batch index of the image in @p input each
+     *                                 box is applied to. Data type supported: S32
+     * @param[out] output              Destination tensor, with one image of size @p crop_size per box.
+     *                                 Data type supported: F32
+     * @param[in]  crop_size           The dimensions that each cropped image is resized to.
+     * @param[in]  method              The policy to be used when resizing. Nearest neighbour or bilinear.
+     * @param[in]  extrapolation_value Value to be used for values outside of the image.
+     */
+    void configure(const ITensor      *input,
+                   const ITensor      *boxes,
+                   const ITensor      *box_ind,
+                   ITensor            *output,
+                   Coordinates2D       crop_size,
+                   InterpolationPolicy method,
+                   float               extrapolation_value);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NECropResizeKernel
+     *
+     * Similar to @ref NECropResizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo  *input,
+                           const ITensorInfo  *boxes,
+                           const ITensorInfo  *box_ind,
+                           const ITensorInfo  *output,
+                           Coordinates2D       crop_size,
+                           InterpolationPolicy method,
+                           float               extrapolation_value);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+    /** Function to use for the particular tensor types passed to configure() */
+    using CropResizeFunction = void(const ITensor *,
+                                    const ITensor *,
+                                    const ITensor *,
+                                    ITensor *,
+                                    InterpolationPolicy,
+                                    float,
+                                    const Window &);
+
+private:
+    const ITensor      *_input;
+    const ITensor      *_boxes;
+    const ITensor      *_box_ind;
+    ITensor            *_output;
+    InterpolationPolicy _method;
+    float               _extrapolation_value;
+    CropResizeFunction *_func;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NECROPRESIZEKERNEL_H
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTBluesteinKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <set>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo            *input,
+                          const ITensorInfo            *coefficients,
+                          const ITensorInfo            *output,
+                          const FFTBluesteinKernelInfo &config)
+{
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use CPU FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(coefficients, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(coefficients->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(input);
+
+    if (output == input)
+    {
+        // In-place multiplication
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(output);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() > 2);
+        const TensorShape expected_shape =
+            TensorShape(input->tensor_shape()).set(config.axis, output->dimension(config.axis));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), expected_shape);
+    }
+
+    return Status{};
+}
+
+/** Window over the output, every window slice processes all the values along the axis */
+Window calculate_kernel_window(const ITensorInfo &output, unsigned int axis)
+{
+    Window win = calculate_max_window(output, Steps());
+    for (unsigned int d = 0; d <= axis; ++d)
+    {
+        win.set(d, Window::Dimension(0, 1, 1));
+    }
+    return win;
+}
+} // namespace
+
+NEFFTBluesteinKernel::NEFFTBluesteinKernel()
+    : _func(nullptr), _input(nullptr), _coefficients(nullptr), _output(nullptr), _axis(0), _scale(1.f)
+{
+}
+
+void NEFFTBluesteinKernel::configure(const ITensor                *input,
+                                     const ITensor                *coefficients,
+                                     ITensor                      *output,
+                                     const FFTBluesteinKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, coefficients, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), coefficients->info(), output->info(), config));
+
+    _input        = input;
+    _coefficients = coefficients;
+    _output       = output;
+    _axis         = config.axis;
+    _scale        = config.scale;
+
+    const bool is_input_f16  = input->info()->data_type() == DataType::F16;
+    const bool is_output_f16 = _output->info()->data_type() == DataType::F16;
+    if (is_input_f16)
+    {
+        _func = is_output_f16 ? &NEFFTBluesteinKernel::multiply<half, half>
+                              : &NEFFTBluesteinKernel::multiply<half, float>;
+    }
+    else
+    {
+        _func = is_output_f16 ? &NEFFTBluesteinKernel::multiply<float, half>
+                              : &NEFFTBluesteinKernel::multiply<float, float>;
+    }
+
+    INEKernel::configure(calculate_kernel_window(*_output->info(), _axis));
+}
+
+Status NEFFTBluesteinKernel::validate(const ITensorInfo            *input,
+                                      const ITensorInfo            *coefficients,
+                                      const ITensorInfo            *output,
+                                      const FFTBluesteinKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, coefficients, output);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, coefficients, output, config));
+    return Status{};
+}
+
+template <typename TIn, typename TOut>
+void NEFFTBluesteinKernel::multiply(const Window &window)
+{
+    const ITensorInfo *in_info  = _input->info();
+    const ITensorInfo *out_info = _output->info();
+
+    const size_t out_len   = out_info->dimension(_axis);
+    const size_t valid_len = std::min(in_info->dimension(_axis), _coefficients->info()->dimension(0));
+    const size_t width     = (_axis == 0) ? 1 : out_info->dimension(0);
+
+    const bool   is_input_complex  = in_info->num_channels() == 2;
+    const bool   is_output_complex = out_info->num_channels() == 2;
+    const size_t in_stride_axis    = in_info->strides_in_bytes()[_axis];
+    const size_t in_stride_x       = in_info->strides_in_bytes()[0];
+    const size_t out_stride_axis   = out_info->strides_in_bytes()[_axis];
+    const size_t out_stride_x      = out_info->strides_in_bytes()[0];
+
+    const auto *coeffs = reinterpret_cast<const float *>(_coefficients->buffer() +
+                                                         _coefficients->info()->offset_first_element_in_bytes());
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            for (size_t i = 0; i < valid_len; ++i)
+            {
+                const float c_re = coeffs[2 * i] * _scale;
+                const float c_im = coeffs[2 * i + 1] * _scale;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    const auto *in_ptr =
+                        reinterpret_cast<const TIn *>(in.ptr() + i * in_stride_axis + x * in_stride_x);
+                    auto *out_ptr = reinterpret_cast<TOut *>(out.ptr() + i * out_stride_axis + x * out_stride_x);
+
+                    const float in_re = static_cast<float>(in_ptr[0]);
+                    const float in_im = is_input_complex ? static_cast<float>(in_ptr[1]) : 0.f;
+                    out_ptr[0]        = static_cast<TOut>(in_re * c_re - in_im * c_im);
+                    if (is_output_complex)
+                    {
+                        out_ptr[1] = static_cast<TOut>(in_re * c_im + in_im * c_re);
+                    }
+                }
+            }
+
+            // Zero padding
+            for (size_t i = valid_len; i < out_len; ++i)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    auto *out_ptr = reinterpret_cast<TOut *>(out.ptr() + i * out_stride_axis + x * out_stride_x);
+                    out_ptr[0]    = static_cast<TOut>(0.f);
+                    if (is_output_complex)
+                    {
+                        out_ptr[1] = static_cast<TOut>(0.f);
+                    }
+                }
+            }
+        },
+        in, out);
+}
+
+void NEFFTBluesteinKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEFFTBLUESTEINKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEFFTBLUESTEINKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel multiplying a signal by a complex sequence along the FFT axis, as done by the pointwise
+ *  steps of Bluestein's algorithm.
+ *
+ * The output is out[n] = in[n] * coefficients[n] * scale for every n smaller than the lengths of the input and of the
+ * coefficients along the axis, and zero for the remaining values, so the same kernel:
+ * - Multiplies the input by the chirp and zero pads it to the length of the convolution.
+ * - Multiplies the spectrum of the padded signal by the spectrum of the chirp filter.
+ * - Multiplies the first values of the convolution by the chirp to get the FFT of the input.
+ */
+class NEFFTBluesteinKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTBluesteinKernel";
+    }
+    /** Constructor */
+    NEFFTBluesteinKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTBluesteinKernel(const NEFFTBluesteinKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTBluesteinKernel &operator=(const NEFFTBluesteinKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTBluesteinKernel(NEFFTBluesteinKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTBluesteinKernel &operator=(NEFFTBluesteinKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTBluesteinKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @note If the output tensor is the input tensor, the multiplication will be performed in-place
+     *
+     * @param[in]  input        Source tensor. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in]  coefficients 1D tensor of the sequence to multiply by. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[out] output       Destination tensor. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     *                          Same shape as @p input, except along the axis.
+     * @param[in]  config       Kernel configuration.
+     */
+    void configure(const ITensor                *input,
+                   const ITensor                *coefficients,
+                   ITensor                      *output,
+                   const FFTBluesteinKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTBluesteinKernel
+     *
+     * @param[in] input        Source tensor info. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in] coefficients 1D tensor info of the sequence to multiply by. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[in] output       Destination tensor info. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in] config       Kernel configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *input,
+                           const ITensorInfo            *coefficients,
+                           const ITensorInfo            *output,
+                           const FFTBluesteinKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using NEFFTBluesteinKernelFunctionPtr = void (NEFFTBluesteinKernel::*)(const Window &window);
+
+    template <typename TIn, typename TOut>
+    void multiply(const Window &window);
+
+    NEFFTBluesteinKernelFunctionPtr _func;
+    const ITensor                  *_input;
+    const ITensor                  *_coefficients;
+    ITensor                        *_output;
+    unsigned int                    _axis;
+    float                           _scale;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEFFTBLUESTEINKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,35 +33,51 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
+#include <algorithm>
 #include <set>
 
 namespace arm_compute
 {
 namespace
 {
+bool is_packed_real(const ITensorInfo *input, const ITensorInfo *idx, const FFTDigitReverseKernelInfo &config)
+{
+    return config.axis == 0 && input->num_channels() == 1 && input->dimension(0) == 2 * idx->dimension(0);
+}
+
+TensorShape
+compute_output_shape(const ITensorInfo *input, const ITensorInfo *idx, const FFTDigitReverseKernelInfo &config)
+{
+    TensorShape output_shape = input->tensor_shape();
+    output_shape.set(config.axis, idx->dimension(0));
+    return output_shape;
+}
+
 Status validate_arguments(const ITensorInfo               *input,
                           const ITensorInfo               *output,
                           const ITensorInfo               *idx,
                           const FFTDigitReverseKernelInfo &config)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != DataType::F32);
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use CPU FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(idx, 1, DataType::U32);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
-    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x() &&
+                                !is_packed_real(input, idx, config));
     ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(input, idx);
 
     // Checks performed when output is configured
     if ((output != nullptr) && (output->total_size() != 0))
     {
         ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(output);
-        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 2, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                           compute_output_shape(input, idx, config));
     }
     else
     {
-        const auto output_info = TensorInfo(input->tensor_shape(), 2, input->data_type());
+        const auto output_info = TensorInfo(compute_output_shape(input, idx, config), 2, DataType::F32);
         ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(&output_info);
     }
 
@@ -73,11 +89,12 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo
                                                         ITensorInfo                     *idx,
                                                         const FFTDigitReverseKernelInfo &config)
 {
-    ARM_COMPUTE_UNUSED(idx, config);
+    auto_init_if_empty(*output, input->clone()
+                                    ->set_num_channels(2)
+                                    .set_data_type(DataType::F32)
+                                    .set_tensor_shape(compute_output_shape(input, idx, config)));
 
-    auto_init_if_empty(*output, input->clone()->set_num_channels(2));
-
-    Window win = calculate_max_window(*input, Steps());
+    Window win = calculate_max_window(*output, Steps());
 
     return std::make_pair(Status{}, win);
 }
@@ -99,9 +116,13 @@ void NEFFTDigitReverseKernel::configure(const ITensor                   *input,
     _output = output;
     _idx    = idx;
 
-    const size_t axis             = config.axis;
-    const bool   is_conj          = config.conjugate;
-    const bool   is_input_complex = (input->info()->num_channels() == 2);
+    const size_t axis    = config.axis;
+    const bool   is_conj = config.conjugate;
+    const bool   is_f16  = input->info()->data_type() == DataType::F16;
+
+    // A packed real input is read the same way as a complex one
+    const bool is_input_complex =
+        (input->info()->num_channels() == 2) || is_packed_real(input->info(), idx->info(), config);
 
     // Configure kernel window
     auto win_config = validate_and_configure_window(input->info(), output->info(), idx->info(), config);
@@ -114,16 +135,19 @@ void NEFFTDigitReverseKernel::configure(const ITensor                   *input,
         {
             if (is_conj)
             {
-                _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<true, true>;
+                _func = is_f16 ? &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<half, true, true>
+                               : &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<float, true, true>;
             }
             else
             {
-                _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<true, false>;
+                _func = is_f16 ? &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<half, true, false>
+                               : &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<float, true, false>;
             }
         }
         else
         {
-            _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<false, false>;
+            _func = is_f16 ? &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<half, false, false>
+                           : &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<float, false, false>;
         }
     }
     else if (axis == 1)
@@ -132,16 +156,19 @@ void NEFFTDigitReverseKernel::configure(const ITensor                   *input,
         {
             if (is_conj)
             {
-                _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<true, true>;
+                _func = is_f16 ? &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<half, true, true>
+                               : &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<float, true, true>;
             }
             else
             {
-                _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<true, false>;
+                _func = is_f16 ? &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<half, true, false>
+                               : &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<float, true, false>;
             }
         }
         else
         {
-            _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<false, false>;
+            _func = is_f16 ? &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<half, false, false>
+                           : &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1<float, false, false>;
         }
     }
     else
@@ -161,10 +188,10 @@ Status NEFFTDigitReverseKernel::validate(const ITensorInfo               *input,
     return Status{};
 }
 
-template <bool is_input_complex, bool is_conj>
+template <typename T, bool is_input_complex, bool is_conj>
 void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
 {
-    const size_t N = _input->info()->dimension(0);
+    const size_t N = _idx->info()->dimension(0);
 
     // Copy the look-up buffer to a local array
     std::vector<unsigned int> buffer_idx(N);
@@ -187,7 +214,7 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
             if (is_input_complex)
             {
                 // Load
-                memcpy(buffer_row_in.data(), reinterpret_cast<float *>(in.ptr()), 2 * N * sizeof(float));
+                std::copy_n(reinterpret_cast<const T *>(in.ptr()), 2 * N, buffer_row_in.data());
 
                 // Shuffle
                 for (size_t x = 0; x < 2 * N; x += 2)
@@ -200,7 +227,7 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
             else
             {
                 // Load
-                memcpy(buffer_row_in.data(), reinterpret_cast<float *>(in.ptr()), N * sizeof(float));
+                std::copy_n(reinterpret_cast<const T *>(in.ptr()), N, buffer_row_in.data());
 
                 // Shuffle
                 for (size_t x = 0; x < N; ++x)
@@ -216,7 +243,7 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
         in, out);
 }
 
-template <bool is_input_complex, bool is_conj>
+template <typename T, bool is_input_complex, bool is_conj>
 void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1(const Window &window)
 {
     const size_t Nx = _input->info()->dimension(0);
@@ -235,6 +262,8 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1(const Window &window)
     std::vector<float> buffer_row(Nx);
 
     // Strides
+    const size_t offset   = _input->info()->offset_first_element_in_bytes();
+    const size_t stride_y = _input->info()->strides_in_bytes()[1];
     const size_t stride_z = _input->info()->strides_in_bytes()[2];
     const size_t stride_w = _input->info()->strides_in_bytes()[3];
 
@@ -242,14 +271,15 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1(const Window &window)
         slice,
         [&](const Coordinates &id)
         {
-            auto        *out_ptr = reinterpret_cast<float *>(out.ptr());
-            auto        *in_ptr  = reinterpret_cast<float *>(_input->buffer() + id.z() * stride_z + id[3] * stride_w);
+            auto        *out_ptr    = reinterpret_cast<float *>(out.ptr());
             const size_t y_shuffled = buffer_idx[id.y()];
+            const auto  *in_ptr     = reinterpret_cast<const T *>(_input->buffer() + offset + y_shuffled * stride_y +
+                                                                 id.z() * stride_z + id[3] * stride_w);
 
             if (is_input_complex)
             {
                 // Shuffle the entire row into the output
-                memcpy(out_ptr, in_ptr + 2 * Nx * y_shuffled, 2 * Nx * sizeof(float));
+                std::copy_n(in_ptr, 2 * Nx, out_ptr);
 
                 // Conjugate if necessary
                 if (is_conj)
@@ -263,12 +293,13 @@ void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_1(const Window &window)
             else
             {
                 // Shuffle the entire row into the buffer
-                memcpy(buffer_row.data(), in_ptr + Nx * y_shuffled, Nx * sizeof(float));
+                std::copy_n(in_ptr, Nx, buffer_row.data());
 
                 // Copy the buffer to the output, with a zero imaginary part
                 for (size_t x = 0; x < 2 * Nx; x += 2)
                 {
-                    out_ptr[x] = buffer_row[x / 2];
+                    out_ptr[x]     = buffer_row[x / 2];
+                    out_ptr[x + 1] = 0.f;
                 }
             }
         },
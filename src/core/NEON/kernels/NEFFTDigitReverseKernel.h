@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,8 +55,11 @@ public:
     ~NEFFTDigitReverseKernel() = default;
     /** Set the input and output tensors.
      *
-     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
-     * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @note A real @p input twice as long as @p idx along axis 0 is read as a packed complex signal,
+     *       whose n-th value has its real part at index 2n and its imaginary part at index 2n+1.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[out] output Destination tensor. Data type supported: F32. Number of channels supported: 2 (complex tensor).
      * @param[in]  idx    Digit reverse index tensor. Data type supported: U32
      * @param[in]  config Kernel configuration.
      */
@@ -64,8 +67,8 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEFFTDigitReverseKernel
      *
-     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
-     * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     * @param[in] input  Source tensor info. Data types supported: F16/F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     * @param[in] output Destination tensor info. Data type supported: F32. Number of channels supported: 2 (complex tensor).
      * @param[in] idx    Digit reverse index tensor info. Data type supported: U32
      * @param[in] config Kernel configuration
      *
@@ -82,10 +85,10 @@ public:
 private:
     using NEFFTDigitReverseKernelFunctionPtr = void (NEFFTDigitReverseKernel::*)(const Window &window);
 
-    template <bool is_input_complex, bool is_conj>
+    template <typename T, bool is_input_complex, bool is_conj>
     void digit_reverse_kernel_axis_0(const Window &window);
 
-    template <bool is_input_complex, bool is_conj>
+    template <typename T, bool is_input_complex, bool is_conj>
     void digit_reverse_kernel_axis_1(const Window &window);
 
     NEFFTDigitReverseKernelFunctionPtr _func;
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTRealSpectrumKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTRealSpectrumKernelInfo &config)
+{
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use CPU FP16 instructions.
+    const ITensorInfo *packed = config.inverse ? output : input;
+    const ITensorInfo *full   = config.inverse ? input : output;
+
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(packed, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(packed);
+
+    if ((full != nullptr) && (full->total_size() != 0))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(full, 2, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(full);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            full->tensor_shape(), TensorShape(packed->tensor_shape()).set(0, 2 * packed->dimension(0)));
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
+{
+    // The forward kernel creates the full spectrum, the inverse kernel requires the packed one to be initialized
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(
+                                    TensorShape(input->tensor_shape()).set(0, 2 * input->dimension(0))));
+
+    return std::make_pair(Status{}, Window{});
+}
+
+/** Window over the rows of the packed spectrum */
+Window calculate_row_window(const ITensorInfo &packed)
+{
+    Window win = calculate_max_window(packed, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    return win;
+}
+} // namespace
+
+NEFFTRealSpectrumKernel::NEFFTRealSpectrumKernel() : _func(nullptr), _input(nullptr), _output(nullptr), _twiddles()
+{
+}
+
+void NEFFTRealSpectrumKernel::configure(const ITensor                   *input,
+                                        ITensor                         *output,
+                                        const FFTRealSpectrumKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    if (!config.inverse)
+    {
+        auto win_config = validate_and_configure_window(input->info(), output->info());
+        ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    }
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), config));
+
+    _input  = input;
+    _output = output;
+
+    const ITensorInfo *packed = config.inverse ? output->info() : input->info();
+    const ITensorInfo *full   = config.inverse ? input->info() : output->info();
+    const bool         is_f16 = full->data_type() == DataType::F16;
+
+    // Twiddle factors exp(-2 * pi * i * k / N) of the full length N
+    const size_t L = packed->dimension(0);
+    _twiddles.resize(2 * L);
+    for (size_t k = 0; k < L; ++k)
+    {
+        const double angle   = -M_PI * static_cast<double>(k) / static_cast<double>(L);
+        _twiddles[2 * k]     = static_cast<float>(std::cos(angle));
+        _twiddles[2 * k + 1] = static_cast<float>(std::sin(angle));
+    }
+
+    if (config.inverse)
+    {
+        _func = is_f16 ? &NEFFTRealSpectrumKernel::merge_spectrum<half>
+                       : &NEFFTRealSpectrumKernel::merge_spectrum<float>;
+    }
+    else
+    {
+        _func = is_f16 ? &NEFFTRealSpectrumKernel::split_spectrum<half>
+                       : &NEFFTRealSpectrumKernel::split_spectrum<float>;
+    }
+
+    INEKernel::configure(calculate_row_window(*packed));
+}
+
+Status NEFFTRealSpectrumKernel::validate(const ITensorInfo               *input,
+                                         const ITensorInfo               *output,
+                                         const FFTRealSpectrumKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    if (config.inverse)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    }
+    else
+    {
+        auto output_clone = output->clone();
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output_clone.get()).first);
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output_clone.get(), config));
+    }
+    return Status{};
+}
+
+template <typename T>
+void NEFFTRealSpectrumKernel::split_spectrum(const Window &window)
+{
+    const size_t L  = _input->info()->dimension(0);
+    const float *tw = _twiddles.data();
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const auto *z = reinterpret_cast<const float *>(in.ptr());
+            auto       *x = reinterpret_cast<T *>(out.ptr());
+            for (size_t k = 0; k < L; ++k)
+            {
+                const size_t kc = (L - k) % L;
+
+                // Even part E = (Z[k] + conj(Z[L - k])) / 2 and odd part O = (Z[k] - conj(Z[L - k])) / 2i
+                const float e_re = 0.5f * (z[2 * k] + z[2 * kc]);
+                const float e_im = 0.5f * (z[2 * k + 1] - z[2 * kc + 1]);
+                const float o_re = 0.5f * (z[2 * k + 1] + z[2 * kc + 1]);
+                const float o_im = -0.5f * (z[2 * k] - z[2 * kc]);
+
+                // Odd part rotated by the twiddle factor
+                const float t_re = tw[2 * k] * o_re - tw[2 * k + 1] * o_im;
+                const float t_im = tw[2 * k] * o_im + tw[2 * k + 1] * o_re;
+
+                x[2 * k]           = static_cast<T>(e_re + t_re);
+                x[2 * k + 1]       = static_cast<T>(e_im + t_im);
+                x[2 * (k + L)]     = static_cast<T>(e_re - t_re);
+                x[2 * (k + L) + 1] = static_cast<T>(e_im - t_im);
+            }
+        },
+        in, out);
+}
+
+template <typename T>
+void NEFFTRealSpectrumKernel::merge_spectrum(const Window &window)
+{
+    const size_t L  = _output->info()->dimension(0);
+    const float *tw = _twiddles.data();
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    std::vector<float> row(4 * L);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            std::copy_n(reinterpret_cast<const T *>(in.ptr()), 4 * L, row.data());
+            const float *x = row.data();
+            auto        *z = reinterpret_cast<float *>(out.ptr());
+            for (size_t k = 0; k < L; ++k)
+            {
+                const size_t kc = L - k;
+
+                // Even part E = (X[k] + conj(X[L - k])) / 2 and odd part D = (X[k] - conj(X[L - k])) / 2
+                const float e_re = 0.5f * (x[2 * k] + x[2 * kc]);
+                const float e_im = 0.5f * (x[2 * k + 1] - x[2 * kc + 1]);
+                const float d_re = 0.5f * (x[2 * k] - x[2 * kc]);
+                const float d_im = 0.5f * (x[2 * k + 1] + x[2 * kc + 1]);
+
+                // Odd part O = D * conj(twiddle)
+                const float o_re = tw[2 * k] * d_re + tw[2 * k + 1] * d_im;
+                const float o_im = tw[2 * k] * d_im - tw[2 * k + 1] * d_re;
+
+                // Z[k] = E + i * O
+                z[2 * k]     = e_re - o_im;
+                z[2 * k + 1] = e_im + o_re;
+            }
+        },
+        in, out);
+}
+
+void NEFFTRealSpectrumKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEFFTREALSPECTRUMKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEFFTREALSPECTRUMKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel converting between the spectrum of a real signal and the spectrum of the same signal
+ *  packed into a complex signal of half its length.
+ *
+ * A real signal x of even length N is packed into the complex signal z[n] = x[2n] + i * x[2n+1] of length N/2,
+ * so a FFT of length N/2 is enough to compute its spectrum:
+ * - The forward kernel splits the spectrum Z of z into the full spectrum X of x.
+ * - The inverse kernel merges the spectrum X of x into the spectrum Z of z, whose inverse FFT is the packed signal.
+ *
+ * The kernel runs along axis 0.
+ */
+class NEFFTRealSpectrumKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTRealSpectrumKernel";
+    }
+    /** Constructor */
+    NEFFTRealSpectrumKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealSpectrumKernel(const NEFFTRealSpectrumKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealSpectrumKernel &operator=(const NEFFTRealSpectrumKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTRealSpectrumKernel(NEFFTRealSpectrumKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTRealSpectrumKernel &operator=(NEFFTRealSpectrumKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTRealSpectrumKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Number of channels supported: 2 (complex tensor).
+     *                    Data types supported: F32 for the forward kernel, F16/F32 for the inverse kernel.
+     * @param[out] output Destination tensor. Number of channels supported: 2 (complex tensor).
+     *                    Data types supported: F16/F32 for the forward kernel, F32 for the inverse kernel.
+     *                    Twice as long as @p input along axis 0 for the forward kernel, half as long for the inverse kernel.
+     * @param[in]  config Kernel configuration.
+     */
+    void configure(const ITensor *input, ITensor *output, const FFTRealSpectrumKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTRealSpectrumKernel
+     *
+     * @param[in] input  Source tensor info. Number of channels supported: 2 (complex tensor).
+     *                   Data types supported: F32 for the forward kernel, F16/F32 for the inverse kernel.
+     * @param[in] output Destination tensor info. Number of channels supported: 2 (complex tensor).
+     *                   Data types supported: F16/F32 for the forward kernel, F32 for the inverse kernel.
+     * @param[in] config Kernel configuration.
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRealSpectrumKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using NEFFTRealSpectrumKernelFunctionPtr = void (NEFFTRealSpectrumKernel::*)(const Window &window);
+
+    template <typename T>
+    void split_spectrum(const Window &window);
+
+    template <typename T>
+    void merge_spectrum(const Window &window);
+
+    NEFFTRealSpectrumKernelFunctionPtr _func;
+    const ITensor                     *_input;
+    ITensor                           *_output;
+    std::vector<float>                 _twiddles;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEFFTREALSPECTRUMKERNEL_H
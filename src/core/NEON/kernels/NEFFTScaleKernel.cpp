@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,25 +32,51 @@
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
-#include "src/core/NEON/wrapper/wrapper.h"
-
-#include <arm_neon.h>
 
 namespace arm_compute
 {
 namespace
 {
-void scale_complex(float *c_in, float *c_out, bool is_conjugate, float scale)
+bool is_packed_real(const ITensorInfo *input, const ITensorInfo *output)
 {
-    const auto a = wrapper::vload(c_in);
-    auto       b = wrapper::vdiv(a, float32x2_t{scale, scale});
-    if (is_conjugate)
-    {
-        const float img_part = wrapper::vgetlane(b, 1);
-        b                    = wrapper::vsetlane(-img_part, b, 1);
-    }
+    return output->num_channels() == 1 && output->dimension(0) == 2 * input->dimension(0);
+}
+
+template <typename T>
+void scale_complex(const ITensor *input,
+                   ITensor       *output,
+                   const Window  &window,
+                   float          scale,
+                   bool           is_conjugate,
+                   bool           write_imaginary)
+{
+    const size_t N = input->info()->dimension(0);
+
+    Iterator in(input, window);
+    Iterator out(output, window);
 
-    wrapper::vstore(c_out, b);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const auto *in_ptr  = reinterpret_cast<const float *>(in.ptr());
+            auto       *out_ptr = reinterpret_cast<T *>(out.ptr());
+            for (size_t x = 0; x < N; ++x)
+            {
+                const float real = in_ptr[2 * x] / scale;
+                const float img  = in_ptr[2 * x + 1] / scale;
+                if (write_imaginary)
+                {
+                    out_ptr[2 * x]     = static_cast<T>(real);
+                    out_ptr[2 * x + 1] = static_cast<T>(is_conjugate ? -img : img);
+                }
+                else
+                {
+                    out_ptr[x] = static_cast<T>(real);
+                }
+            }
+        },
+        in, out);
 }
 
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
@@ -61,10 +87,19 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
     // Checks performed when output is configured
     if ((output != nullptr) && (output->total_size() != 0))
     {
+        //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(output) is not needed here as this kernel doesn't use CPU FP16 instructions.
         ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(output);
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1 && output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F16, DataType::F32);
+        if (is_packed_real(input, output))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+                output->tensor_shape(), TensorShape(input->tensor_shape()).set(0, output->dimension(0)));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        }
     }
 
     return Status{};
@@ -72,8 +107,9 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
 {
-    // Configure kernel window
+    // Configure kernel window, every window slice processes entire rows
     Window win = calculate_max_window(*input, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     if (output != nullptr)
     {
@@ -124,16 +160,18 @@ void NEFFTScaleKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_UNUSED(info);
 
-    Window input_window = window;
-    input_window.set(Window::DimX, 0);
+    ITensor *output = _run_in_place ? _input : _output;
 
-    Iterator in(_input, input_window);
-    Iterator out(_run_in_place ? _input : _output, input_window);
+    // Complex and packed real destinations both hold the real and imaginary parts of every value
+    const bool write_imaginary = output->info()->num_channels() == 2 || is_packed_real(_input->info(), output->info());
 
-    execute_window_loop(
-        window,
-        [&](const Coordinates &)
-        { scale_complex(reinterpret_cast<float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), _is_conj, _scale); },
-        in, out);
+    if (output->info()->data_type() == DataType::F16)
+    {
+        scale_complex<half>(_input, output, window, _scale, _is_conj, write_imaginary);
+    }
+    else
+    {
+        scale_complex<float>(_input, output, window, _scale, _is_conj, write_imaginary);
+    }
 }
 } // namespace arm_compute
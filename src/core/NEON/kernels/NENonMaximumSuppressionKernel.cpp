@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NENonMaximumSuppressionKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *bboxes,
+                          const ITensorInfo *scores,
+                          const ITensorInfo *output_indices,
+                          unsigned int       max_output_size,
+                          const float        score_threshold,
+                          const float        iou_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(bboxes, scores, output_indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bboxes, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_indices, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(bboxes, scores);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(bboxes->num_dimensions() > 2 || bboxes->dimension(0) != 4,
+                                    "The bboxes tensor must be a 2-D float tensor of shape [4, num_boxes].");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scores->num_dimensions() > 2,
+                                    "The scores tensor must be a 2-D float tensor of shape [num_boxes, num_classes].");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scores->dimension(0) != bboxes->dimension(1),
+                                    "The scores tensor must have one score per box.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(max_output_size == 0, "Max size cannot be 0");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(iou_threshold < 0.f || iou_threshold > 1.f, "IOU threshold must be in [0,1]");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(score_threshold < 0.f || score_threshold > 1.f, "Score threshold must be in [0,1]");
+
+    if (output_indices->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_indices->num_dimensions() > 2,
+                                        "The indices must be a 2-D integer tensor of shape [M, num_classes].");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_indices->dimension(0) < max_output_size,
+                                        "Indices tensor must hold max_output_size elements per class");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_indices->dimension(1) != scores->dimension(1),
+                                        "Indices tensor must have one row per class");
+    }
+
+    return Status{};
+}
+
+/** Boxes above the score threshold, in decreasing score order, stored as a structure of arrays */
+struct CandidateBoxes
+{
+    std::vector<int>      indices{};
+    std::vector<float>    xmin{};
+    std::vector<float>    ymin{};
+    std::vector<float>    xmax{};
+    std::vector<float>    ymax{};
+    std::vector<float>    area{};
+    std::vector<uint32_t> suppressed{};
+};
+
+inline bool any_lane_set(uint32x4_t mask)
+{
+#if defined(__aarch64__)
+    return vmaxvq_u32(mask) != 0;
+#else  // defined(__aarch64__)
+    const uint32x2_t reduced = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return (vget_lane_u32(reduced, 0) | vget_lane_u32(reduced, 1)) != 0;
+#endif // defined(__aarch64__)
+}
+
+/** Collect the boxes whose score reaches the threshold and sort them by decreasing score
+ *
+ * The sort is the same as in @ref CPPNonMaximumSuppressionKernel so that boxes with equal scores come out in the
+ * same order.
+ */
+void select_candidates(const float   *scores,
+                       const uint8_t *bboxes,
+                       size_t         bbox_stride,
+                       unsigned int   num_boxes,
+                       float          score_threshold,
+                       CandidateBoxes &candidates)
+{
+    std::vector<int>   indices_above_thd;
+    std::vector<float> scores_above_thd;
+
+    const float32x4_t vthreshold = vdupq_n_f32(score_threshold);
+    unsigned int      i          = 0;
+    for (; i + 4 <= num_boxes; i += 4)
+    {
+        // Most anchors fall below the threshold, so only inspect the lanes of blocks with a hit
+        if (!any_lane_set(vcgeq_f32(vld1q_f32(scores + i), vthreshold)))
+        {
+            continue;
+        }
+        for (unsigned int k = i; k < i + 4; ++k)
+        {
+            if (scores[k] >= score_threshold)
+            {
+                scores_above_thd.emplace_back(scores[k]);
+                indices_above_thd.emplace_back(k);
+            }
+        }
+    }
+    for (; i < num_boxes; ++i)
+    {
+        if (scores[i] >= score_threshold)
+        {
+            scores_above_thd.emplace_back(scores[i]);
+            indices_above_thd.emplace_back(i);
+        }
+    }
+
+    const unsigned int        num_above_thd = indices_above_thd.size();
+    std::vector<unsigned int> sorted_indices(num_above_thd);
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    std::sort(std::begin(sorted_indices), std::end(sorted_indices),
+              [&](unsigned int first, unsigned int second)
+              { return scores_above_thd[first] > scores_above_thd[second]; });
+
+    candidates.indices.resize(num_above_thd);
+    candidates.xmin.resize(num_above_thd);
+    candidates.ymin.resize(num_above_thd);
+    candidates.xmax.resize(num_above_thd);
+    candidates.ymax.resize(num_above_thd);
+    candidates.area.resize(num_above_thd);
+    candidates.suppressed.assign(num_above_thd, 0U);
+    for (unsigned int k = 0; k < num_above_thd; ++k)
+    {
+        // Box-corner format: xmin, ymin, xmax, ymax
+        const int    index = indices_above_thd[sorted_indices[k]];
+        const float *box   = reinterpret_cast<const float *>(bboxes + index * bbox_stride);
+
+        candidates.indices[k] = index;
+        candidates.xmin[k]    = box[0];
+        candidates.ymin[k]    = box[1];
+        candidates.xmax[k]    = box[2];
+        candidates.ymax[k]    = box[3];
+        candidates.area[k]    = (box[2] - box[0]) * (box[3] - box[1]);
+    }
+}
+
+/** Suppress the candidates after @p selected whose IoU with it is above the threshold */
+void suppress_overlapping(CandidateBoxes &candidates, unsigned int selected, float iou_threshold)
+{
+    const unsigned int num_candidates = candidates.indices.size();
+    const float        area_i         = candidates.area[selected];
+
+    // Nothing overlaps an empty box
+    if (!(area_i > 0.f))
+    {
+        return;
+    }
+
+    const float xmin_i = candidates.xmin[selected];
+    const float ymin_i = candidates.ymin[selected];
+    const float xmax_i = candidates.xmax[selected];
+    const float ymax_i = candidates.ymax[selected];
+
+    unsigned int j = selected + 1;
+
+#if defined(__aarch64__)
+    // The division is only IEEE exact on AArch64, which keeps the selection identical to the reference
+    const float32x4_t vzero      = vdupq_n_f32(0.f);
+    const float32x4_t vthreshold = vdupq_n_f32(iou_threshold);
+    const float32x4_t varea_i    = vdupq_n_f32(area_i);
+    const float32x4_t vxmin_i    = vdupq_n_f32(xmin_i);
+    const float32x4_t vymin_i    = vdupq_n_f32(ymin_i);
+    const float32x4_t vxmax_i    = vdupq_n_f32(xmax_i);
+    const float32x4_t vymax_i    = vdupq_n_f32(ymax_i);
+    for (; j + 4 <= num_candidates; j += 4)
+    {
+        const float32x4_t y_min_intersection = vmaxq_f32(vymin_i, vld1q_f32(candidates.ymin.data() + j));
+        const float32x4_t x_min_intersection = vmaxq_f32(vxmin_i, vld1q_f32(candidates.xmin.data() + j));
+        const float32x4_t y_max_intersection = vminq_f32(vymax_i, vld1q_f32(candidates.ymax.data() + j));
+        const float32x4_t x_max_intersection = vminq_f32(vxmax_i, vld1q_f32(candidates.xmax.data() + j));
+        const float32x4_t area_intersection =
+            vmulq_f32(vmaxq_f32(vsubq_f32(y_max_intersection, y_min_intersection), vzero),
+                      vmaxq_f32(vsubq_f32(x_max_intersection, x_min_intersection), vzero));
+        const float32x4_t area_j = vld1q_f32(candidates.area.data() + j);
+        const float32x4_t overlap =
+            vdivq_f32(area_intersection, vsubq_f32(vaddq_f32(varea_i, area_j), area_intersection));
+        const uint32x4_t mask = vandq_u32(vcgtq_f32(area_j, vzero), vcgtq_f32(overlap, vthreshold));
+
+        uint32_t *suppressed = candidates.suppressed.data() + j;
+        vst1q_u32(suppressed, vorrq_u32(vld1q_u32(suppressed), mask));
+    }
+#endif // defined(__aarch64__)
+
+    for (; j < num_candidates; ++j)
+    {
+        const float area_j = candidates.area[j];
+        if (candidates.suppressed[j] != 0 || area_j <= 0)
+        {
+            continue;
+        }
+        const auto y_min_intersection = std::max<float>(ymin_i, candidates.ymin[j]);
+        const auto x_min_intersection = std::max<float>(xmin_i, candidates.xmin[j]);
+        const auto y_max_intersection = std::min<float>(ymax_i, candidates.ymax[j]);
+        const auto x_max_intersection = std::min<float>(xmax_i, candidates.xmax[j]);
+        const auto area_intersection  = std::max<float>(y_max_intersection - y_min_intersection, 0.0f) *
+                                       std::max<float>(x_max_intersection - x_min_intersection, 0.0f);
+        const float overlap = area_intersection / (area_i + area_j - area_intersection);
+        if (overlap > iou_threshold)
+        {
+            candidates.suppressed[j] = 1U;
+        }
+    }
+}
+} // namespace
+
+NENonMaximumSuppressionKernel::NENonMaximumSuppressionKernel()
+    : _input_bboxes(nullptr),
+      _input_scores(nullptr),
+      _output_indices(nullptr),
+      _max_output_size(0),
+      _score_threshold(0.f),
+      _iou_threshold(0.f)
+{
+}
+
+void NENonMaximumSuppressionKernel::configure(const ITensor *input_bboxes,
+                                              const ITensor *input_scores,
+                                              ITensor       *output_indices,
+                                              unsigned int   max_output_size,
+                                              const float    score_threshold,
+                                              const float    iou_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_bboxes, input_scores, output_indices);
+
+    const unsigned int num_classes = input_scores->info()->dimension(1);
+    auto_init_if_empty(*output_indices->info(), TensorShape(max_output_size, num_classes), 1, DataType::S32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_bboxes->info(), input_scores->info(), output_indices->info(),
+                                                  max_output_size, score_threshold, iou_threshold));
+
+    _input_bboxes    = input_bboxes;
+    _input_scores    = input_scores;
+    _output_indices  = output_indices;
+    _max_output_size = max_output_size;
+    _score_threshold = score_threshold;
+    _iou_threshold   = iou_threshold;
+
+    // Configure kernel window: one step per class
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_classes, 1));
+    INEKernel::configure(win);
+}
+
+Status NENonMaximumSuppressionKernel::validate(const ITensorInfo *input_bboxes,
+                                               const ITensorInfo *input_scores,
+                                               const ITensorInfo *output_indices,
+                                               unsigned int       max_output_size,
+                                               const float        score_threshold,
+                                               const float        iou_threshold)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input_bboxes, input_scores, output_indices, max_output_size,
+                                                   score_threshold, iou_threshold));
+    return Status{};
+}
+
+void NENonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const ITensorInfo *bboxes_info  = _input_bboxes->info();
+    const ITensorInfo *scores_info  = _input_scores->info();
+    const ITensorInfo *indices_info = _output_indices->info();
+    const unsigned int num_boxes    = scores_info->dimension(0);
+
+    const uint8_t *bboxes = _input_bboxes->buffer() + bboxes_info->offset_first_element_in_bytes();
+
+    CandidateBoxes candidates;
+    for (int c = window.y().start(); c < window.y().end(); ++c)
+    {
+        const auto scores  = reinterpret_cast<const float *>(_input_scores->buffer() +
+                                                            scores_info->offset_first_element_in_bytes() +
+                                                            c * scores_info->strides_in_bytes()[1]);
+        auto       indices = reinterpret_cast<int32_t *>(_output_indices->buffer() +
+                                                   indices_info->offset_first_element_in_bytes() +
+                                                   c * indices_info->strides_in_bytes()[1]);
+
+        select_candidates(scores, bboxes, bboxes_info->strides_in_bytes()[1], num_boxes, _score_threshold, candidates);
+
+        // Number of output is the minimum between max_detection and the scores above the threshold
+        const unsigned int num_candidates = candidates.indices.size();
+        const unsigned int num_output     = std::min(_max_output_size, num_candidates);
+        unsigned int       output_idx     = 0;
+
+        // Keep only boxes with small IoU
+        for (unsigned int i = 0; i < num_candidates && output_idx < num_output; ++i)
+        {
+            if (candidates.suppressed[i] != 0)
+            {
+                continue;
+            }
+            indices[output_idx++] = candidates.indices[i];
+            suppress_overlapping(candidates, i, _iou_threshold);
+        }
+
+        // The output could be full but not the output indices tensor
+        // Instead return values not valid we put -1
+        for (; output_idx < _max_output_size; ++output_idx)
+        {
+            indices[output_idx] = -1;
+        }
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NENONMAXIMUMSUPPRESSIONKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NENONMAXIMUMSUPPRESSIONKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Kernel to perform non maximum suppression independently for a set of classes sharing the same boxes
+ *
+ * Each class is processed as @ref CPPNonMaximumSuppressionKernel does and produces the same indices. The boxes
+ * above the score threshold are stored as a structure of arrays so the intersection over union against the
+ * selected box is computed for several boxes at once. The window spans the classes so that the scheduler
+ * can suppress them in parallel.
+ */
+class NENonMaximumSuppressionKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NENonMaximumSuppressionKernel";
+    }
+    /** Default constructor */
+    NENonMaximumSuppressionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENonMaximumSuppressionKernel(const NENonMaximumSuppressionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENonMaximumSuppressionKernel &operator=(const NENonMaximumSuppressionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NENonMaximumSuppressionKernel(NENonMaximumSuppressionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NENonMaximumSuppressionKernel &operator=(NENonMaximumSuppressionKernel &&) = default;
+    /** Default destructor */
+    ~NENonMaximumSuppressionKernel() = default;
+
+    /** Configure the kernel to perform non maximal suppression
+     *
+     * @param[in]  input_bboxes    The input bounding boxes. Data types supported: F32. Shape [4, num_boxes],
+     *                             in box-corner format [xmin, ymin, xmax, ymax].
+     * @param[in]  input_scores    The corresponding input confidence, one row per class.
+     *                             Same data type as @p input_bboxes. Shape [num_boxes, num_classes].
+     * @param[out] output_indices  The kept indices of bboxes for each class. Data types supported: S32.
+     *                             Shape [max_output_size, num_classes]. Unused entries are set to -1.
+     * @param[in]  max_output_size An integer tensor representing the maximum number of boxes to be selected per class.
+     * @param[in]  score_threshold The threshold used to filter detection results.
+     * @param[in]  iou_threshold   The threshold used in non maximum suppression.
+     */
+    void configure(const ITensor *input_bboxes,
+                   const ITensor *input_scores,
+                   ITensor       *output_indices,
+                   unsigned int   max_output_size,
+                   const float    score_threshold,
+                   const float    iou_threshold);
+
+    /** Static function to check if given arguments will lead to a valid configuration of @ref NENonMaximumSuppressionKernel
+     *
+     * Similar to @ref NENonMaximumSuppressionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input_bboxes,
+                           const ITensorInfo *input_scores,
+                           const ITensorInfo *output_indices,
+                           unsigned int       max_output_size,
+                           const float        score_threshold,
+                           const float        iou_threshold);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input_bboxes;
+    const ITensor *_input_scores;
+    ITensor       *_output_indices;
+    unsigned int   _max_output_size;
+    float          _score_threshold;
+    float          _iou_threshold;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NENONMAXIMUMSUPPRESSIONKERNEL_H
@@ -273,6 +273,9 @@ class GemmHybridIndirect : public GemmCommon<To, Tw, Tr> {
     const unsigned int _Ktotal;
     const unsigned int _rounded_Ksize;
 
+    /* Bytes of B to prefetch ahead of the kernel, 0 if disabled. */
+    const unsigned int _prefetch_distance;
+
     /* Blocking info */
     const unsigned int _k_block;
     unsigned int _n_block;
@@ -341,13 +344,31 @@ class GemmHybridIndirect : public GemmCommon<To, Tw, Tr> {
         return ktotal;
     }
 
+    // Software prefetching of B is only used for GEMV shapes with pretransposed B, where every block of B is read
+    // once per run and the hardware prefetcher alone cannot keep up with the kernel.
+    static unsigned int get_prefetch_distance(const GemmArgs &args) {
+        if (FixedFormat || !args._cfg || args._Msize > strategy::out_height()) {
+            return 0;
+        }
+
+        return args._cfg->weights_prefetch_distance;
+    }
+
     // New N blocking strategy: if it's narrow, or much taller than it is wide, do the full width.  Otherwise do a
     // single block.
-    static unsigned int compute_n_block(const GemmArgs &args, const OutputStage os = {}) {
+    static unsigned int compute_n_block(const GemmArgs &args, const OutputStage os = {}, unsigned int prefetch_distance = 0) {
         if (args._cfg && args._cfg->outer_block_size) {
             return args._cfg->outer_block_size;
         }
 
+        // When prefetching, use blocks of about the prefetch distance so that the next block can be fetched while
+        // the kernel runs on the current one.
+        if (prefetch_distance) {
+            const size_t panel_bytes = get_ktotal(args) * strategy::out_width() * sizeof(Troi);
+
+            return std::max<size_t>(prefetch_distance / panel_bytes, 1) * strategy::out_width();
+        }
+
         if (args._Nsize <= 64) {
             return args._Nsize;
         }
@@ -396,7 +417,8 @@ public:
     GemmHybridIndirect(const GemmArgs &args, const OutputStage &os)
               : _args(args), _os(os), _Ktotal(get_ktotal(args)),
                 _rounded_Ksize(roundup(args._Ksize, strategy::k_unroll())),
-                _k_block(compute_k_block(args)), _n_block(compute_n_block(args, os)),
+                _prefetch_distance(get_prefetch_distance(args)),
+                _k_block(compute_k_block(args)), _n_block(compute_n_block(args, os, _prefetch_distance)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
                 _window_range(iceildiv(args._Msize, strategy::out_height()), args._nbatches,
                               iceildiv(args._Nsize, _n_block), args._nmulti)
@@ -410,7 +432,8 @@ public:
     GemmHybridIndirect(const GemmArgs &args)
               : _args(args), _Ktotal(get_ktotal(args)),
                 _rounded_Ksize(roundup(args._Ksize, strategy::k_unroll())),
-                _k_block(compute_k_block(args)), _n_block(compute_n_block(args)),
+                _prefetch_distance(get_prefetch_distance(args)),
+                _k_block(compute_k_block(args)), _n_block(compute_n_block(args, {}, _prefetch_distance)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
                 _window_range(iceildiv(args._Msize, strategy::out_height()), args._nbatches,
                               iceildiv(args._Nsize, _n_block), args._nmulti)
@@ -529,6 +552,22 @@ public:
 
                 IndirectOutputArg<Tr> out_arg(g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (batch * g_arrays._C_batch_stride) + (m_start * g_arrays._ldc) + n0, g_arrays._ldc);
 
+                // Fetch the B panel of the next block of columns while this one is computed.
+                if (_prefetch_distance) {
+                    auto next = p;
+
+                    if ((process_all_rows ? next.next_dim1() : next.next_dim0()) && (next.dim(2) != p.dim(2) || next.dim(3) != p.dim(3))) {
+                        const unsigned int next_n0   = next.dim(2) * _n_block;
+                        const unsigned int next_nmax = std::min(next_n0 + _n_block, _args._Nsize);
+
+                        prefetch_l2(_B_transposed +
+                                    (next.dim(3) * roundup(_args._Nsize, strategy::out_width()) * _Ktotal) +
+                                    (k0 * roundup(_args._Nsize, strategy::out_width())) +
+                                    (next_n0 * kern_k),
+                                    roundup(next_nmax - next_n0, strategy::out_width()) * kern_k * sizeof(Troi));
+                    }
+                }
+
 #ifdef CYCLE_PROFILING
                 auto p = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)(m_end - m_start) * kern_k * roundup(nmax-n0, strategy::out_width()));
 #endif
@@ -872,7 +911,7 @@ public:
             qp->per_channel_muls = re.per_channel_muls;
             qp->minval = re.minval;
             qp->maxval = re.maxval;
-            _n_block = compute_n_block(_args, _os);
+            _n_block = compute_n_block(_args, _os, _prefetch_distance);
 
             // Also update the window range because computation of n_block may change wrt B's offset
             NDRange<4> window_range(iceildiv(_args._Msize, strategy::out_height()), _args._nbatches,
@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "arm_gemm/arm_gemm.hpp"
+#include "arm_common/internal/utils.hpp"
 
 #ifdef CYCLE_PROFILING
 #include "arm_common/profiler.hpp"
@@ -93,6 +94,9 @@ class GemvPretransposed : public GemmCommon<Tlo, Tro, Tr> {
     unsigned int k_block=0;
     unsigned int n_block=0;
 
+    /* Bytes of B to prefetch ahead of the kernel, 0 if disabled. */
+    unsigned int _prefetch_distance=0;
+
     const Troi *_B_pretransposed = nullptr;
 
     OutputStage _os;
@@ -124,8 +128,17 @@ public:
             k_block = args._Ksize;
         }
 
+        if (args._cfg && args._cfg->weights_prefetch_distance) {
+            _prefetch_distance = args._cfg->weights_prefetch_distance;
+        }
+
         if (args._cfg && args._cfg->outer_block_size) {
             n_block = args._cfg->outer_block_size;
+        } else if (_prefetch_distance) {
+            /* Split the columns in blocks of about the prefetch distance, so that the next block can be fetched
+             * while the kernel runs on the current one. */
+            const size_t panel_bytes = roundup(args._Ksize, strategy::k_unroll()) * strategy::out_width() * sizeof(Troi);
+            n_block = std::max<size_t>(_prefetch_distance / panel_bytes, 1) * strategy::out_width();
         } else {
             n_block = args._Nsize;
         }
@@ -171,6 +184,16 @@ public:
 
                 for (unsigned int n=n_start; n<n_end; n+=n_block) {
                     unsigned int nmax = std::min(n + n_block, n_end);
+
+                    /* Fetch the B panels of the next block while this one is computed. */
+                    if (_prefetch_distance && nmax < n_end) {
+                        const unsigned int next_nmax = std::min(nmax + n_block, n_end);
+                        const size_t k_bytes = roundup(kmax - k0, strategy::k_unroll()) * strategy::out_width() * sizeof(Troi);
+
+                        for (unsigned int panel=nmax; panel<next_nmax; panel+=strategy::out_width()) {
+                            prefetch_l2(_B_pretransposed + (multi * _buffer_per_multi) + (panel * roundup(_args._Ksize, strategy::k_unroll())) + (k0 * strategy::out_width()), k_bytes);
+                        }
+                    }
 #ifdef CYCLE_PROFILING
                     auto p = prof.ScopedProfiler(PROFILE_KERNEL, (kmax-k0) * (nmax-n));
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,42 @@ TensorShape extend_parent_shape(TensorShape parent_shape, TensorShape shape, Coo
 
     return parent_shape;
 }
+
+/** Normalise the steps of a view so that every dimension has a step
+ *
+ * @param steps Steps as provided by the user. Unspecified dimensions default to 1
+ *
+ * @return Steps for all the dimensions
+ */
+Coordinates complete_steps(const Coordinates &steps)
+{
+    Coordinates complete_steps;
+    for (unsigned int i = 0; i < Coordinates::num_max_dimensions; ++i)
+    {
+        complete_steps.set(i, (i < steps.num_dimensions()) ? steps[i] : 1);
+    }
+    return complete_steps;
+}
+
+/** Compute the region of the parent that a strided view spans
+ *
+ * @param shape View shape
+ * @param steps View steps
+ *
+ * @return Shape of the parent region covered by the view
+ */
+TensorShape strided_extent(const TensorShape &shape, const Coordinates &steps)
+{
+    TensorShape extent = shape;
+    for (unsigned int i = 0; i < shape.num_dimensions(); ++i)
+    {
+        if (shape[i] > 0)
+        {
+            extent.set(i, (shape[i] - 1) * steps[i] + 1, false);
+        }
+    }
+    return extent;
+}
 } // namespace
 
 SubTensorInfo::SubTensorInfo()
@@ -60,9 +96,12 @@ SubTensorInfo::SubTensorInfo()
       _tensor_shape(),
       _dims_state(),
       _coords(),
+      _steps(complete_steps(Coordinates())),
+      _strides(),
       _valid_region{Coordinates(), _tensor_shape},
       _extend_parent(false),
-      _lock_paddings(false)
+      _lock_paddings(false),
+      _is_strided(false)
 {
     _dims_state.fill(ITensorInfo::get_static_state_value());
 }
@@ -72,9 +111,12 @@ SubTensorInfo::SubTensorInfo(ITensorInfo *parent, TensorShape tensor_shape, Coor
       _tensor_shape(tensor_shape),
       _dims_state(),
       _coords(coords),
+      _steps(complete_steps(Coordinates())),
+      _strides(),
       _valid_region{Coordinates(), _tensor_shape},
       _extend_parent(extend_parent),
-      _lock_paddings(false)
+      _lock_paddings(false),
+      _is_strided(false)
 {
     ARM_COMPUTE_ERROR_ON(parent == nullptr);
     ARM_COMPUTE_ERROR_ON_MSG(parent->is_dynamic(), "SubTensors for dynamically shaped parent tensor is not supported!");
@@ -89,6 +131,40 @@ SubTensorInfo::SubTensorInfo(ITensorInfo *parent, TensorShape tensor_shape, Coor
     _valid_region = ValidRegion{Coordinates(), _tensor_shape};
 }
 
+SubTensorInfo::SubTensorInfo(ITensorInfo       *parent,
+                             TensorShape        tensor_shape,
+                             Coordinates        coords,
+                             const Coordinates &steps)
+    : _parent(parent),
+      _tensor_shape(tensor_shape),
+      _dims_state(),
+      _coords(coords),
+      _steps(complete_steps(steps)),
+      _strides(),
+      _valid_region{Coordinates(), _tensor_shape},
+      _extend_parent(false),
+      _lock_paddings(false),
+      _is_strided(false)
+{
+    ARM_COMPUTE_ERROR_ON(parent == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(parent->is_dynamic(), "SubTensors for dynamically shaped parent tensor is not supported!");
+
+    for (unsigned int i = 0; i < Coordinates::num_max_dimensions; ++i)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_steps[i] < 1, "Only positive steps are supported for strided sub-tensors");
+        _is_strided = _is_strided || (_steps[i] != 1);
+    }
+
+    // Check if the strided view is valid if parent is configured
+    if (parent->tensor_shape().total_size() != 0)
+    {
+        ARM_COMPUTE_ERROR_ON_INVALID_SUBTENSOR(parent->tensor_shape(), coords, strided_extent(tensor_shape, _steps));
+    }
+
+    // Initialize valid region
+    _valid_region = ValidRegion{Coordinates(), _tensor_shape};
+}
+
 std::unique_ptr<ITensorInfo> SubTensorInfo::clone() const
 {
     // Clone creates a TensorInfo object from SubTensorInfo's parent which will conclude to a TensorInfo
@@ -107,7 +183,7 @@ ITensorInfo &SubTensorInfo::set_tensor_shape(const TensorShape &shape)
     // Check if subtensor is valid if parent is configured
     if (_parent->tensor_shape().total_size() != 0 && !_extend_parent)
     {
-        ARM_COMPUTE_ERROR_ON_INVALID_SUBTENSOR(_parent->tensor_shape(), _coords, shape);
+        ARM_COMPUTE_ERROR_ON_INVALID_SUBTENSOR(_parent->tensor_shape(), _coords, strided_extent(shape, _steps));
         _valid_region = ValidRegion{_coords, shape};
     }
     else if (_extend_parent) // Extend parent shape, configure if specified
@@ -175,6 +251,23 @@ bool SubTensorInfo::extend_padding(const PaddingSize &padding)
     return _parent->extend_padding(padding);
 }
 
+const Strides &SubTensorInfo::strides_in_bytes() const
+{
+    ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+    if (!_is_strided)
+    {
+        return _parent->strides_in_bytes();
+    }
+
+    // Recompute on every query as the parent strides change whenever its padding is extended
+    const Strides &parent_strides = _parent->strides_in_bytes();
+    for (size_t i = 0; i < parent_strides.num_dimensions(); ++i)
+    {
+        _strides.set(i, parent_strides[i] * _steps[i]);
+    }
+    return _strides;
+}
+
 int32_t SubTensorInfo::offset_element_in_bytes(const Coordinates &pos) const
 {
     ARM_COMPUTE_ERROR_ON_COORDINATES_DIMENSIONS_GTE(pos, _tensor_shape.num_dimensions());
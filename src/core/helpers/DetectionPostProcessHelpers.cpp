@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/helpers/DetectionPostProcessHelpers.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace detection_post_process_helpers
+{
+namespace
+{
+inline void decode_box_corner(const BBox                          &box_centersize,
+                              const BBox                          &anchor,
+                              Iterator                            &decoded_it,
+                              const DetectionPostProcessLayerInfo &info)
+{
+    const float half_factor = 0.5f;
+
+    // BBox is equavalent to CenterSizeEncoding [y,x,h,w]
+    const float y_center = box_centersize[0] / info.scale_value_y() * anchor[2] + anchor[0];
+    const float x_center = box_centersize[1] / info.scale_value_x() * anchor[3] + anchor[1];
+    const float half_h =
+        half_factor * static_cast<float>(std::exp(box_centersize[2] / info.scale_value_h())) * anchor[2];
+    const float half_w =
+        half_factor * static_cast<float>(std::exp(box_centersize[3] / info.scale_value_w())) * anchor[3];
+
+    // Box Corner encoding boxes are saved as [xmin, ymin, xmax, ymax]
+    auto decoded_ptr   = reinterpret_cast<float *>(decoded_it.ptr());
+    *(decoded_ptr)     = x_center - half_w; // xmin
+    *(1 + decoded_ptr) = y_center - half_h; // ymin
+    *(2 + decoded_ptr) = x_center + half_w; // xmax
+    *(3 + decoded_ptr) = y_center + half_h; // ymax
+}
+} // namespace
+
+void decode_center_size_boxes(const ITensor                       *input_box_encoding,
+                              const ITensor                       *input_anchors,
+                              const DetectionPostProcessLayerInfo &info,
+                              ITensor                             *decoded_boxes)
+{
+    const QuantizationInfo &qi_box     = input_box_encoding->info()->quantization_info();
+    const QuantizationInfo &qi_anchors = input_anchors->info()->quantization_info();
+    BBox                    box_centersize{{}};
+    BBox                    anchor{{}};
+
+    Window win;
+    win.use_tensor_dimensions(input_box_encoding->info()->tensor_shape());
+    win.set_dimension_step(0U, 4U);
+    win.set_dimension_step(1U, 1U);
+    Iterator box_it(input_box_encoding, win);
+    Iterator anchor_it(input_anchors, win);
+    Iterator decoded_it(decoded_boxes, win);
+
+    if (input_box_encoding->info()->data_type() == DataType::QASYMM8)
+    {
+        execute_window_loop(
+            win,
+            [&](const Coordinates &)
+            {
+                const auto box_ptr    = reinterpret_cast<const qasymm8_t *>(box_it.ptr());
+                const auto anchor_ptr = reinterpret_cast<const qasymm8_t *>(anchor_it.ptr());
+                box_centersize =
+                    BBox({dequantize_qasymm8(*box_ptr, qi_box), dequantize_qasymm8(*(box_ptr + 1), qi_box),
+                          dequantize_qasymm8(*(2 + box_ptr), qi_box), dequantize_qasymm8(*(3 + box_ptr), qi_box)});
+                anchor = BBox({dequantize_qasymm8(*anchor_ptr, qi_anchors),
+                               dequantize_qasymm8(*(anchor_ptr + 1), qi_anchors),
+                               dequantize_qasymm8(*(2 + anchor_ptr), qi_anchors),
+                               dequantize_qasymm8(*(3 + anchor_ptr), qi_anchors)});
+                decode_box_corner(box_centersize, anchor, decoded_it, info);
+            },
+            box_it, anchor_it, decoded_it);
+    }
+    else if (input_box_encoding->info()->data_type() == DataType::QASYMM8_SIGNED)
+    {
+        execute_window_loop(
+            win,
+            [&](const Coordinates &)
+            {
+                const auto box_ptr    = reinterpret_cast<const qasymm8_signed_t *>(box_it.ptr());
+                const auto anchor_ptr = reinterpret_cast<const qasymm8_signed_t *>(anchor_it.ptr());
+                box_centersize        = BBox({dequantize_qasymm8_signed(*box_ptr, qi_box),
+                                              dequantize_qasymm8_signed(*(box_ptr + 1), qi_box),
+                                              dequantize_qasymm8_signed(*(2 + box_ptr), qi_box),
+                                              dequantize_qasymm8_signed(*(3 + box_ptr), qi_box)});
+                anchor                = BBox({dequantize_qasymm8_signed(*anchor_ptr, qi_anchors),
+                                              dequantize_qasymm8_signed(*(anchor_ptr + 1), qi_anchors),
+                                              dequantize_qasymm8_signed(*(2 + anchor_ptr), qi_anchors),
+                                              dequantize_qasymm8_signed(*(3 + anchor_ptr), qi_anchors)});
+                decode_box_corner(box_centersize, anchor, decoded_it, info);
+            },
+            box_it, anchor_it, decoded_it);
+    }
+    else
+    {
+        execute_window_loop(
+            win,
+            [&](const Coordinates &)
+            {
+                const auto box_ptr    = reinterpret_cast<const float *>(box_it.ptr());
+                const auto anchor_ptr = reinterpret_cast<const float *>(anchor_it.ptr());
+                box_centersize        = BBox({*box_ptr, *(box_ptr + 1), *(2 + box_ptr), *(3 + box_ptr)});
+                anchor                = BBox({*anchor_ptr, *(anchor_ptr + 1), *(2 + anchor_ptr), *(3 + anchor_ptr)});
+                decode_box_corner(box_centersize, anchor, decoded_it, info);
+            },
+            box_it, anchor_it, decoded_it);
+    }
+}
+
+void save_outputs(const ITensor                   *decoded_boxes,
+                  const std::vector<int>          &result_idx_boxes_after_nms,
+                  const std::vector<float>        &result_scores_after_nms,
+                  const std::vector<int>          &result_classes_after_nms,
+                  const std::vector<unsigned int> &sorted_indices,
+                  unsigned int                     num_output,
+                  unsigned int                     max_detections,
+                  ITensor                         *output_boxes,
+                  ITensor                         *output_classes,
+                  ITensor                         *output_scores,
+                  ITensor                         *num_detection)
+{
+    // xmin,ymin,xmax,ymax -> ymin,xmin,ymax,xmax
+    unsigned int i = 0;
+    for (; i < num_output; ++i)
+    {
+        const unsigned int box_in_idx = result_idx_boxes_after_nms[sorted_indices[i]];
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(0, i)))) =
+            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(1, box_in_idx))));
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(1, i)))) =
+            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(0, box_in_idx))));
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(2, i)))) =
+            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(3, box_in_idx))));
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(3, i)))) =
+            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(2, box_in_idx))));
+        *(reinterpret_cast<float *>(output_classes->ptr_to_element(Coordinates(i)))) =
+            static_cast<float>(result_classes_after_nms[sorted_indices[i]]);
+        *(reinterpret_cast<float *>(output_scores->ptr_to_element(Coordinates(i)))) =
+            result_scores_after_nms[sorted_indices[i]];
+    }
+    for (; i < max_detections; ++i)
+    {
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(1, i)))) = 0.0f;
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(0, i)))) = 0.0f;
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(3, i)))) = 0.0f;
+        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(2, i)))) = 0.0f;
+        *(reinterpret_cast<float *>(output_classes->ptr_to_element(Coordinates(i))))  = 0.0f;
+        *(reinterpret_cast<float *>(output_scores->ptr_to_element(Coordinates(i))))   = 0.0f;
+    }
+    *(reinterpret_cast<float *>(num_detection->ptr_to_element(Coordinates(0)))) = num_output;
+}
+} // namespace detection_post_process_helpers
+} // namespace arm_compute
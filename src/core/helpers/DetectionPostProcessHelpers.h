@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_HELPERS_DETECTIONPOSTPROCESSHELPERS_H
+#define ACL_SRC_CORE_HELPERS_DETECTIONPOSTPROCESSHELPERS_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace detection_post_process_helpers
+{
+/** Decode center-size encoded boxes according to the anchors and scale info.
+ *
+ * @param[in]  input_box_encoding The input prior bounding boxes.
+ * @param[in]  input_anchors      The corresponding input variance.
+ * @param[in]  info               The detection informations
+ * @param[out] decoded_boxes      The decoded bboxes, in box-corner format [xmin, ymin, xmax, ymax].
+ */
+void decode_center_size_boxes(const ITensor                       *input_box_encoding,
+                              const ITensor                       *input_anchors,
+                              const DetectionPostProcessLayerInfo &info,
+                              ITensor                             *decoded_boxes);
+
+/** Write the selected detections to the outputs of a detection post-process layer
+ *
+ * Unused output slots up to @p max_detections are zeroed.
+ *
+ * @param[in]  decoded_boxes              The decoded bboxes.
+ * @param[in]  result_idx_boxes_after_nms Box index of each detection.
+ * @param[in]  result_scores_after_nms    Score of each detection.
+ * @param[in]  result_classes_after_nms   Class of each detection.
+ * @param[in]  sorted_indices             Order in which the detections are written.
+ * @param[in]  num_output                 Number of detections to write.
+ * @param[in]  max_detections             Maximum number of detections.
+ * @param[out] output_boxes               The boxes output tensor, in [ymin, xmin, ymax, xmax] format.
+ * @param[out] output_classes             The classes output tensor.
+ * @param[out] output_scores              The scores output tensor.
+ * @param[out] num_detection              The number of detections output tensor.
+ */
+void save_outputs(const ITensor                   *decoded_boxes,
+                  const std::vector<int>          &result_idx_boxes_after_nms,
+                  const std::vector<float>        &result_scores_after_nms,
+                  const std::vector<int>          &result_classes_after_nms,
+                  const std::vector<unsigned int> &sorted_indices,
+                  unsigned int                     num_output,
+                  unsigned int                     max_detections,
+                  ITensor                         *output_boxes,
+                  ITensor                         *output_classes,
+                  ITensor                         *output_scores,
+                  ITensor                         *num_detection);
+} // namespace detection_post_process_helpers
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_HELPERS_DETECTIONPOSTPROCESSHELPERS_H
@@ -23,6 +23,8 @@
  */
 #include "src/core/utils/helpers/fft.h"
 
+#include <cmath>
+#include <cstdint>
 #include <numeric>
 
 namespace arm_compute
@@ -120,6 +122,33 @@ std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vecto
 
     return idx_digit_reverse;
 }
+
+unsigned int next_decomposable_size(unsigned int N, const std::set<unsigned int> &supported_factors)
+{
+    unsigned int size = N;
+    while (decompose_stages(size, supported_factors).empty())
+    {
+        ++size;
+    }
+    return size;
+}
+
+std::vector<float> bluestein_chirp(unsigned int N, bool inverse)
+{
+    std::vector<float> chirp(2 * N);
+
+    const double sign = inverse ? 1.0 : -1.0;
+    for (unsigned int n = 0; n < N; ++n)
+    {
+        // The chirp is periodic in n^2 with period 2N: reduce it first to keep the angle accurate for large n
+        const uint64_t n2    = (static_cast<uint64_t>(n) * n) % (2 * static_cast<uint64_t>(N));
+        const double   angle = sign * M_PI * static_cast<double>(n2) / static_cast<double>(N);
+        chirp[2 * n]         = static_cast<float>(std::cos(angle));
+        chirp[2 * n + 1]     = static_cast<float>(std::sin(angle));
+    }
+
+    return chirp;
+}
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
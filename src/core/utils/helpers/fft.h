@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,24 @@ std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsign
  * @return A vector with the digit reverse indices. Will be empty if it failed.
  */
 std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vector<unsigned int> &fft_stages);
+/** Find the smallest size that is not smaller than a given size and can be decomposed using the provided factors.
+ *
+ * @param[in] N                 Minimum size.
+ * @param[in] supported_factors Supported factors that can be used for decomposition.
+ *
+ * @return The smallest decomposable size not smaller than @p N.
+ */
+unsigned int next_decomposable_size(unsigned int N, const std::set<unsigned int> &supported_factors);
+/** Calculate the chirp used by Bluestein's algorithm to compute a FFT of any size
+ *
+ * The chirp is c[n] = exp(-i * pi * n^2 / N) for a forward FFT and its conjugate for an inverse one.
+ *
+ * @param[in] N       Size of the FFT.
+ * @param[in] inverse True to calculate the chirp of an inverse FFT.
+ *
+ * @return A vector with the @p N complex values of the chirp, interleaved as real and imaginary parts.
+ */
+std::vector<float> bluestein_chirp(unsigned int N, bool inverse);
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
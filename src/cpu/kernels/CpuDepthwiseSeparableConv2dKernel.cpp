@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDepthwiseSeparableConv2dKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/function_info/ConvolutionInfo.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/depthwise_separable_conv2d/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Alignment of every section of the packed weights and of the workspace */
+constexpr size_t packed_alignment = 64;
+/** Bytes of depthwise output kept per tile. Half of a typical L1 data cache, leaving room for the weights. */
+constexpr size_t tile_size_bytes = 16 * 1024;
+
+static const std::vector<CpuDepthwiseSeparableConv2dKernel::DepthwiseSeparableConv2dKernel> available_kernels = {
+    {"neon_fp32_depthwise_separable_conv2d",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_depthwise_separable_pack_weights),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_depthwise_separable_conv2d)},
+    {"neon_fp16_depthwise_separable_conv2d",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_depthwise_separable_pack_weights),
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_depthwise_separable_conv2d)},
+    {"neon_qasymm8_depthwise_separable_conv2d",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_depthwise_separable_pack_weights),
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_depthwise_separable_conv2d)},
+    {"neon_qasymm8_signed_depthwise_separable_conv2d",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_depthwise_separable_pack_weights),
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_depthwise_separable_conv2d)},
+};
+
+bool is_supported_activation(const ActivationLayerInfo &act_info)
+{
+    if (!act_info.enabled())
+    {
+        return true;
+    }
+    switch (act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+        case ActivationLayerInfo::ActivationFunction::RELU:
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+TensorShape compute_output_shape(const ITensorInfo                  *src,
+                                 const ITensorInfo                  *dw_weights,
+                                 const ITensorInfo                  *pw_weights,
+                                 const DepthwiseSeparableConv2dInfo &info)
+{
+    const ConvolutionInfo dw_info{info.dw_conv_info, 1U, ActivationLayerInfo(), info.dw_dilation};
+    TensorShape out_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*src, *dw_weights, dw_info);
+    out_shape.set(0, pw_weights->dimension(3));
+    return out_shape;
+}
+
+Status validate_weights(const ITensorInfo *src, const ITensorInfo *weights)
+{
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->data_type() != src->data_type() &&
+                                            weights->data_type() != DataType::QSYMM8_PER_CHANNEL,
+                                        "Weights must have the source data type or QSYMM8_PER_CHANNEL");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    }
+    return Status{};
+}
+
+Status validate_biases(const ITensorInfo *src, const ITensorInfo *biases, size_t num_channels)
+{
+    if (biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != num_channels);
+        if (is_data_type_quantized_asymmetric(src->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, biases);
+        }
+    }
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo                  *src,
+                          const ITensorInfo                  *dw_weights,
+                          const ITensorInfo                  *dw_biases,
+                          const ITensorInfo                  *pw_weights,
+                          const ITensorInfo                  *pw_biases,
+                          const ITensorInfo                  *dst,
+                          const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dw_weights, pw_weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(src, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+
+    const size_t channels = src->dimension(0);
+
+    // Depthwise weights: [channels, kernel_width, kernel_height], depth multiplier of 1
+    ARM_COMPUTE_RETURN_ERROR_ON(dw_weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dw_weights->dimension(0) != channels, "Only a depth multiplier of 1 is supported");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_weights(src, dw_weights));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_biases(src, dw_biases, channels));
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dw_dilation.x() < 1 || info.dw_dilation.y() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dw_conv_info.stride().first < 1 || info.dw_conv_info.stride().second < 1);
+
+    // Pointwise weights: [channels, 1, 1, out_channels]
+    ARM_COMPUTE_RETURN_ERROR_ON(pw_weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(pw_weights->dimension(0) != channels);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pw_weights->dimension(1) != 1 || pw_weights->dimension(2) != 1,
+                                    "Only 1x1 pointwise weights are supported");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_weights(src, pw_weights));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_biases(src, pw_biases, pw_weights->dimension(3)));
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_supported_activation(info.dw_act_info) ||
+                                        !is_supported_activation(info.pw_act_info),
+                                    "Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU activations can be fused");
+
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.dw_output_qinfo.empty() || info.dw_output_qinfo.uniform().scale <= 0.f,
+                                        "The quantization of the depthwise output must be set");
+        ARM_COMPUTE_RETURN_ERROR_ON(dw_weights->quantization_info().scale().size() != 1 &&
+                                    dw_weights->quantization_info().scale().size() != channels);
+        ARM_COMPUTE_RETURN_ERROR_ON(pw_weights->quantization_info().scale().size() != 1 &&
+                                    pw_weights->quantization_info().scale().size() != pw_weights->dimension(3));
+    }
+
+    // Validate in case the destination has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(),
+                                                           compute_output_shape(src, dw_weights, pw_weights, info));
+    }
+
+    const auto uk = CpuDepthwiseSeparableConv2dKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->pack_weights == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+CpuDepthwiseSeparableConv2dKernel::PackedLayout compute_packed_layout(const ITensorInfo *src,
+                                                                      const ITensorInfo *dw_weights,
+                                                                      const ITensorInfo *pw_weights,
+                                                                      const ITensorInfo *dst)
+{
+    CpuDepthwiseSeparableConv2dKernel::PackedLayout layout;
+    layout.channels      = src->dimension(0);
+    layout.out_channels  = pw_weights->dimension(3);
+    layout.kernel_width  = dw_weights->dimension(1);
+    layout.kernel_height = dw_weights->dimension(2);
+
+    // Quantized types accumulate in int32 and keep the offset-free intermediate and pointwise weights in int16
+    const bool   is_quantized = is_data_type_quantized_asymmetric(src->data_type());
+    const size_t value_size   = is_quantized ? sizeof(int32_t) : src->element_size();
+    const size_t narrow_size  = is_quantized ? sizeof(int16_t) : src->element_size();
+    const size_t kernel_size  = layout.kernel_width * layout.kernel_height;
+
+    size_t     offset  = 0;
+    const auto reserve = [&offset](size_t bytes)
+    {
+        const size_t start = offset;
+        offset             = ceil_to_multiple(offset + bytes, packed_alignment);
+        return start;
+    };
+
+    layout.dw_weights_offset = reserve(kernel_size * layout.channels * value_size);
+    layout.dw_biases_offset  = reserve(layout.channels * value_size);
+    if (is_quantized)
+    {
+        layout.dw_multipliers_offset = reserve(layout.channels * sizeof(int32_t));
+        layout.dw_shifts_offset      = reserve(layout.channels * sizeof(int32_t));
+    }
+    layout.pw_weights_offset = reserve(layout.channels * layout.out_channels * narrow_size);
+    layout.pw_biases_offset  = reserve(layout.out_channels * value_size);
+    if (is_quantized)
+    {
+        layout.pw_multipliers_offset = reserve(layout.out_channels * sizeof(int32_t));
+        layout.pw_shifts_offset      = reserve(layout.out_channels * sizeof(int32_t));
+    }
+    layout.packed_size = offset;
+
+    // Size the tile so that the depthwise outputs of a tile stay in the L1 cache until the pointwise stage reads them
+    const size_t column_size = std::max<size_t>(1U, layout.channels * narrow_size);
+    layout.tile_width        = std::max<size_t>(1U, std::min<size_t>(dst->dimension(1), tile_size_bytes / column_size));
+
+    offset             = 0;
+    layout.tile_offset = reserve(layout.tile_width * layout.channels * narrow_size);
+    if (is_quantized)
+    {
+        layout.accumulators_offset = reserve(layout.channels * sizeof(int32_t));
+    }
+    layout.workspace_size = offset;
+
+    return layout;
+}
+} // namespace
+
+void CpuDepthwiseSeparableConv2dKernel::configure(const ITensorInfo                  *src,
+                                                  const ITensorInfo                  *dw_weights,
+                                                  const ITensorInfo                  *dw_biases,
+                                                  const ITensorInfo                  *pw_weights,
+                                                  const ITensorInfo                  *pw_biases,
+                                                  ITensorInfo                        *dst,
+                                                  const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2dKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dw_weights, pw_weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dw_weights, dw_biases, pw_weights, pw_biases, dst, info));
+
+    const auto uk = CpuDepthwiseSeparableConv2dKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    // Auto initialize the destination if not initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_output_shape(src, dw_weights, pw_weights, info)));
+
+    _info        = info;
+    _src_qinfo   = src->quantization_info();
+    _dst_qinfo   = dst->quantization_info();
+    _layout      = compute_packed_layout(src, dw_weights, pw_weights, dst);
+    _pack_method = uk->pack_weights;
+    _run_method  = uk->ukernel;
+    _name        = std::string("CpuDepthwiseSeparableConv2dKernel/").append(uk->name);
+
+    // Every window iteration computes a full output row
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDepthwiseSeparableConv2dKernel::validate(const ITensorInfo                  *src,
+                                                   const ITensorInfo                  *dw_weights,
+                                                   const ITensorInfo                  *dw_biases,
+                                                   const ITensorInfo                  *pw_weights,
+                                                   const ITensorInfo                  *pw_biases,
+                                                   const ITensorInfo                  *dst,
+                                                   const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2dKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dw_weights, dw_biases, pw_weights, pw_biases, dst, info));
+    return Status{};
+}
+
+void CpuDepthwiseSeparableConv2dKernel::pack_weights(const ITensor *dw_weights,
+                                                     const ITensor *dw_biases,
+                                                     const ITensor *pw_weights,
+                                                     const ITensor *pw_biases,
+                                                     ITensor       *packed) const
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2dKernel::pack_weights");
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dw_weights, pw_weights, packed);
+    ARM_COMPUTE_ERROR_ON(packed->info()->total_size() < _layout.packed_size);
+    ARM_COMPUTE_ERROR_ON(_pack_method == nullptr);
+
+    _pack_method(dw_weights, dw_biases, pw_weights, pw_biases, packed, _src_qinfo, _dst_qinfo, _info, _layout);
+}
+
+const CpuDepthwiseSeparableConv2dKernel::PackedLayout &CpuDepthwiseSeparableConv2dKernel::packed_layout() const
+{
+    return _layout;
+}
+
+void CpuDepthwiseSeparableConv2dKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2dKernel::run_op");
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src       = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed    = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *workspace = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst       = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, packed, workspace, dst);
+    ARM_COMPUTE_ERROR_ON(workspace->info()->total_size() < (info.thread_id + 1) * _layout.workspace_size);
+
+    _run_method(src, packed, dst, workspace, _info, _layout, window, info);
+}
+
+const char *CpuDepthwiseSeparableConv2dKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuDepthwiseSeparableConv2dKernel::DepthwiseSeparableConv2dKernel> &
+CpuDepthwiseSeparableConv2dKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
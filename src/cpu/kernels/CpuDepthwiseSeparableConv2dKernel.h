@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUDEPTHWISESEPARABLECONV2DKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUDEPTHWISESEPARABLECONV2DKERNEL_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to run a depthwise convolution followed by a 1x1 pointwise convolution
+ *
+ * The depthwise output is never written to memory.
+ * Each output row is processed in tiles of columns. The depthwise stage writes its activated (and, for quantized types,
+ * requantized) output for a tile into a small per-thread buffer that stays in the cache, and the pointwise stage
+ * consumes it straight away.
+ *
+ * The weights, biases and requantization parameters of both stages are packed once by @ref pack_weights().
+ * The tensors are passed to @ref run_op() as:
+ * - ACL_SRC_0: source
+ * - ACL_SRC_1: packed weights, of size @ref PackedLayout::packed_size
+ * - ACL_INT_0: per-thread workspace, of size @ref PackedLayout::workspace_size times the number of threads
+ * - ACL_DST: destination
+ */
+class CpuDepthwiseSeparableConv2dKernel : public ICpuKernel<CpuDepthwiseSeparableConv2dKernel>
+{
+public:
+    /** Layout of the packed weights and of the per-thread workspace. All offsets are in bytes. */
+    struct PackedLayout
+    {
+        size_t channels{0};              /**< Number of input channels */
+        size_t out_channels{0};          /**< Number of output channels */
+        size_t kernel_width{0};          /**< Width of the depthwise kernel */
+        size_t kernel_height{0};         /**< Height of the depthwise kernel */
+        size_t tile_width{0};            /**< Number of output columns computed per tile */
+        size_t dw_weights_offset{0};     /**< Depthwise weights, [kernel_height * kernel_width][channels] */
+        size_t dw_biases_offset{0};      /**< Depthwise biases, [channels] */
+        size_t dw_multipliers_offset{0}; /**< Depthwise requantization multipliers, [channels]. Quantized only */
+        size_t dw_shifts_offset{0};      /**< Depthwise requantization shifts, [channels]. Quantized only */
+        size_t pw_weights_offset{0};     /**< Pointwise weights, [channels][out_channels] */
+        size_t pw_biases_offset{0};      /**< Pointwise biases, [out_channels] */
+        size_t pw_multipliers_offset{0}; /**< Pointwise requantization multipliers, [out_channels]. Quantized only */
+        size_t pw_shifts_offset{0};      /**< Pointwise requantization shifts, [out_channels]. Quantized only */
+        size_t packed_size{0};           /**< Total size of the packed weights */
+        size_t tile_offset{0};           /**< Depthwise output tile, [tile_width][channels] */
+        size_t accumulators_offset{0};   /**< Depthwise accumulators, [channels]. Quantized only */
+        size_t workspace_size{0};        /**< Size of the workspace of a single thread */
+    };
+
+private:
+    using PackWeightsPtr = std::add_pointer<void(const ITensor *,
+                                                 const ITensor *,
+                                                 const ITensor *,
+                                                 const ITensor *,
+                                                 ITensor *,
+                                                 const QuantizationInfo &,
+                                                 const QuantizationInfo &,
+                                                 const DepthwiseSeparableConv2dInfo &,
+                                                 const PackedLayout &)>::type;
+    using DepthwiseSeparableConv2dKernelPtr = std::add_pointer<void(const ITensor *,
+                                                                    const ITensor *,
+                                                                    ITensor *,
+                                                                    ITensor *,
+                                                                    const DepthwiseSeparableConv2dInfo &,
+                                                                    const PackedLayout &,
+                                                                    const Window &,
+                                                                    const ThreadInfo &)>::type;
+
+public:
+    struct DepthwiseSeparableConv2dKernel
+    {
+        const char                       *name;
+        const DataTypeISASelectorPtr      is_selected;
+        PackWeightsPtr                    pack_weights;
+        DepthwiseSeparableConv2dKernelPtr ukernel;
+    };
+
+    CpuDepthwiseSeparableConv2dKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDepthwiseSeparableConv2dKernel);
+    /** Initialize the kernel's inputs and output.
+     *
+     * Similar to @ref NEDepthwiseSeparableConvolutionLayer::configure()
+     *
+     */
+    void configure(const ITensorInfo                  *src,
+                   const ITensorInfo                  *dw_weights,
+                   const ITensorInfo                  *dw_biases,
+                   const ITensorInfo                  *pw_weights,
+                   const ITensorInfo                  *pw_biases,
+                   ITensorInfo                        *dst,
+                   const DepthwiseSeparableConv2dInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDepthwiseSeparableConv2dKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                  *src,
+                           const ITensorInfo                  *dw_weights,
+                           const ITensorInfo                  *dw_biases,
+                           const ITensorInfo                  *pw_weights,
+                           const ITensorInfo                  *pw_biases,
+                           const ITensorInfo                  *dst,
+                           const DepthwiseSeparableConv2dInfo &info);
+    /** Pack the weights, biases and requantization parameters of both stages
+     *
+     * @param[in]  dw_weights Depthwise weights tensor.
+     * @param[in]  dw_biases  Depthwise biases tensor. Can be nullptr.
+     * @param[in]  pw_weights Pointwise weights tensor.
+     * @param[in]  pw_biases  Pointwise biases tensor. Can be nullptr.
+     * @param[out] packed     Packed weights tensor of at least @ref PackedLayout::packed_size bytes.
+     */
+    void pack_weights(const ITensor *dw_weights,
+                      const ITensor *dw_biases,
+                      const ITensor *pw_weights,
+                      const ITensor *pw_biases,
+                      ITensor       *packed) const;
+    /** Layout of the packed weights and workspace for the configured shapes
+     *
+     * @return The packed layout
+     */
+    const PackedLayout &packed_layout() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<DepthwiseSeparableConv2dKernel> &get_available_kernels();
+
+private:
+    DepthwiseSeparableConv2dInfo      _info{};
+    PackedLayout                      _layout{};
+    QuantizationInfo                  _src_qinfo{};
+    QuantizationInfo                  _dst_qinfo{};
+    PackWeightsPtr                    _pack_method{nullptr};
+    DepthwiseSeparableConv2dKernelPtr _run_method{nullptr};
+    std::string                       _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUDEPTHWISESEPARABLECONV2DKERNEL_H
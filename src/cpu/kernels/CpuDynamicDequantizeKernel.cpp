@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDynamicDequantizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/dynamic_quantize/generic/neon/list.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *src_scales,
+                          const ITensorInfo         *weights,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, src_scales, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src_scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QSYMM8_PER_CHANNEL, DataType::QSYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Only 2D matrices are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(src_scales->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(src_scales->dimension(0) != src->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        !CpuDynamicDequantizeKernel::is_activation_supported(act_info),
+        "Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU can be fused in the dynamic dequantization");
+
+    const size_t num_scales = weights->quantization_info().scale().size();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_scales != 1 && num_scales != src->dimension(0),
+                                    "The weights need one scale per output channel");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != src->dimension(0));
+        if (dst->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(bias, dst);
+        }
+    }
+
+    return Status{};
+}
+} // namespace
+
+bool CpuDynamicDequantizeKernel::is_activation_supported(const ActivationLayerInfo &act_info)
+{
+    return !act_info.enabled() || act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU ||
+           act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU ||
+           act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
+}
+
+void CpuDynamicDequantizeKernel::configure(const ITensorInfo         *src,
+                                           const ITensorInfo         *src_scales,
+                                           const ITensorInfo         *weights,
+                                           const ITensorInfo         *bias,
+                                           ITensorInfo               *dst,
+                                           const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDynamicDequantizeKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, src_scales, weights, dst);
+
+    // Output tensor auto initialization if not yet initialized
+    auto_init_if_empty(*dst, src->tensor_shape(), 1, DataType::F32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, src_scales, weights, bias, dst, act_info));
+
+    // Expand a per-tensor scale so that the micro-kernels always read one scale per output channel
+    const std::vector<float> &scales = weights->quantization_info().scale();
+    _weights_scales = scales.size() == 1 ? std::vector<float>(src->dimension(0), scales[0]) : scales;
+
+    _min_bound = std::numeric_limits<float>::lowest();
+    _max_bound = std::numeric_limits<float>::max();
+    if (act_info.enabled())
+    {
+        switch (act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                _min_bound = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                _min_bound = 0.f;
+                _max_bound = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                _min_bound = act_info.b();
+                _max_bound = act_info.a();
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported activation function.");
+        }
+    }
+
+    // Every row is processed at once: split the work along the rows only
+    Window win = calculate_max_window(*src, Steps(src->dimension(0)));
+
+    ICpuKernel::configure(win);
+
+    switch (dst->data_type())
+    {
+        case DataType::F32:
+            _func = REGISTER_FP32_NEON(fp32_run_dynamic_dequantization);
+            break;
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        case DataType::F16:
+            _func = REGISTER_FP16_NEON(fp16_run_dynamic_dequantization);
+            break;
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+    }
+}
+
+Status CpuDynamicDequantizeKernel::validate(const ITensorInfo         *src,
+                                            const ITensorInfo         *src_scales,
+                                            const ITensorInfo         *weights,
+                                            const ITensorInfo         *bias,
+                                            const ITensorInfo         *dst,
+                                            const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicDequantizeKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, src_scales, weights, bias, dst, act_info));
+    return Status{};
+}
+
+void CpuDynamicDequantizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicDequantizeKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto src        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto src_scales = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto bias       = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto       dst        = tensors.get_tensor(TensorType::ACL_DST);
+    _func(src, src_scales, _weights_scales.data(), bias, dst, _min_bound, _max_bound, window);
+}
+
+const char *CpuDynamicDequantizeKernel::name() const
+{
+    return "CpuDynamicDequantizeKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
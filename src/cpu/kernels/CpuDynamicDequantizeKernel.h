@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUDYNAMICDEQUANTIZEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUDYNAMICDEQUANTIZEKERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the dynamic dequantization kernel.
+ *
+ * Converts the int32 accumulators of a GEMM between dynamically quantized activations and per-channel quantized
+ * weights back to floating point: dst[m][n] = src[m][n] * src_scales[m] * weights_scale[n] + bias[n].
+ * RELU, BOUNDED_RELU and LU_BOUNDED_RELU activations are applied on the fly.
+ */
+class CpuDynamicDequantizeKernel : public ICpuKernel<CpuDynamicDequantizeKernel>
+{
+public:
+    CpuDynamicDequantizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicDequantizeKernel);
+    /** Set input, output tensors.
+     *
+     * @param[in]  src        Accumulators tensor info. A 2D matrix of shape [N, M]. Data type supported: S32.
+     * @param[in]  src_scales Scales of the rows of the quantized activations, of shape [M]. Data type supported: F32.
+     * @param[in]  weights    Weights tensor info, only used for its quantization info.
+     *                        Data type supported: QSYMM8_PER_CHANNEL/QSYMM8.
+     * @param[in]  bias       (Optional) Bias tensor info of shape [N]. Can be nullptr.
+     *                        Data type supported: same as @p dst.
+     * @param[out] dst        Destination tensor info with the same dimensions of @p src. Data type supported: F16/F32.
+     * @param[in]  act_info   (Optional) Activation to fuse. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *src_scales,
+                   const ITensorInfo         *weights,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuDynamicDequantizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *src_scales,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Whether an activation can be fused in the kernel
+     *
+     * @param[in] act_info Activation to check.
+     *
+     * @return True if @p act_info is disabled or can be applied by the kernel.
+     */
+    static bool is_activation_supported(const ActivationLayerInfo &act_info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    /** Common signature for all the specialised @ref CpuDynamicDequantizeKernel functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using DynamicDequantizeFunctionExecutorPtr = void (*)(const ITensor *src,
+                                                          const ITensor *src_scales,
+                                                          const float   *weights_scales,
+                                                          const ITensor *bias,
+                                                          ITensor       *dst,
+                                                          float          min_bound,
+                                                          float          max_bound,
+                                                          const Window  &window);
+    DynamicDequantizeFunctionExecutorPtr _func{nullptr};
+    std::vector<float>                   _weights_scales{};
+    float                                _min_bound{0.f};
+    float                                _max_bound{0.f};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUDYNAMICDEQUANTIZEKERNEL_H
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDynamicQuantizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/dynamic_quantize/generic/neon/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst, scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Only 2D matrices are supported");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    if (scales->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(scales->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(scales->dimension(0) != src->dimension(1));
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuDynamicQuantizeKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizeKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, scales);
+
+    // Output tensors auto initialization if not yet initialized. The scales are only known at run time and live in
+    // @p scales: the quantization info of the destination only records that the values are symmetric.
+    auto_init_if_empty(*dst, src->clone()->set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(
+                                 QuantizationInfo(1.f, 0)));
+    auto_init_if_empty(*scales, TensorShape(src->dimension(1)), 1, DataType::F32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, scales));
+
+    // Every row is processed at once: split the work along the rows only
+    Window win = calculate_max_window(*src, Steps(src->dimension(0)));
+
+    ICpuKernel::configure(win);
+
+    switch (src->data_type())
+    {
+        case DataType::F32:
+            _func = REGISTER_FP32_NEON(fp32_run_dynamic_quantization);
+            break;
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        case DataType::F16:
+            _func = REGISTER_FP16_NEON(fp16_run_dynamic_quantization);
+            break;
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+    }
+}
+
+Status CpuDynamicQuantizeKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizeKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, scales));
+    return Status{};
+}
+
+void CpuDynamicQuantizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizeKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto src    = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst    = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto       scales = tensors.get_tensor(TensorType::ACL_DST_1);
+    _func(src, dst, scales, window);
+}
+
+const char *CpuDynamicQuantizeKernel::name() const
+{
+    return "CpuDynamicQuantizeKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
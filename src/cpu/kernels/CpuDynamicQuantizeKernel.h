@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUDYNAMICQUANTIZEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUDYNAMICQUANTIZEKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the dynamic quantization kernel.
+ *
+ * Quantizes each row of a floating-point matrix to QASYMM8_SIGNED with a symmetric scale computed at run time from
+ * the absolute maximum of the row. The scale of every row is written to a separate F32 tensor.
+ */
+class CpuDynamicQuantizeKernel : public ICpuKernel<CpuDynamicQuantizeKernel>
+{
+public:
+    CpuDynamicQuantizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicQuantizeKernel);
+    /** Set input, output tensors.
+     *
+     * @param[in]  src    Source tensor info. A 2D matrix with one row per token/sample. Data type supported: F16/F32.
+     * @param[out] dst    Destination tensor info with the same dimensions of @p src.
+     *                    Data type supported: QASYMM8_SIGNED.
+     * @param[out] scales Destination tensor info holding the scale of each row of @p src. Data type supported: F32.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuDynamicQuantizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    /** Common signature for all the specialised @ref CpuDynamicQuantizeKernel functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using DynamicQuantizeFunctionExecutorPtr = void (*)(const ITensor *src,
+                                                        ITensor       *dst,
+                                                        ITensor       *scales,
+                                                        const Window  &window);
+    DynamicQuantizeFunctionExecutorPtr _func{nullptr};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUDYNAMICQUANTIZEKERNEL_H
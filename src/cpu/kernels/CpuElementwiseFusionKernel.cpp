@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuElementwiseFusionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/elementwise_fusion/list.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuElementwiseFusionKernel::ElementwiseFusionKernel> available_kernels = {
+    {"neon_fp32_elementwise_fusion", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_elementwise_fusion)},
+    {"neon_fp16_elementwise_fusion",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_elementwise_fusion)},
+    {"neon_qasymm8_elementwise_fusion",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_elementwise_fusion)},
+    {"neon_qasymm8_signed_elementwise_fusion",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_elementwise_fusion)},
+};
+
+Status validate_program(const ElementwiseFusionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_inputs() == 0, "At least one input is required");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_values() > ElementwiseFusionInfo::max_values,
+                                    "Too many values in the elementwise fusion program");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.nodes().empty() && info.num_inputs() != 1,
+                                    "A program without nodes must have exactly one input");
+
+    int value = static_cast<int>(info.num_inputs());
+    for (const auto &node : info.nodes())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.lhs < 0 || node.lhs >= value, "Operand must be an earlier value");
+        if (is_binary_op(node.op))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.rhs < 0 || node.rhs >= value, "Operand must be an earlier value");
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.rhs != -1, "Unary operations take a single operand");
+        }
+#ifndef __aarch64__
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.op == ElementwiseFusionOp::ACTIVATION &&
+                                            node.act_info.activation() == ActivationLayerInfo::ActivationFunction::GELU,
+                                        "GELU is only supported on AArch64");
+#endif /* __aarch64__ */
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.op == ElementwiseFusionOp::CAST &&
+                                            node.data_type != DataType::QASYMM8 &&
+                                            node.data_type != DataType::QASYMM8_SIGNED &&
+                                            node.data_type != DataType::F16 && node.data_type != DataType::F32,
+                                        "Unsupported data type for a cast");
+        ++value;
+    }
+    return Status{};
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &srcs,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseFusionInfo            &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_program(info));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.size() != info.num_inputs(),
+                                    "Number of sources does not match the elementwise fusion program");
+
+    const ITensorInfo *src0 = srcs[0];
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src0);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src0, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+
+    TensorShape out_shape = src0->tensor_shape();
+    for (const ITensorInfo *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, src);
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_shape.total_size() == 0, "Inputs are not broadcast compatible");
+    }
+
+    // Validate in case the destination has been initialized
+    if (dst->total_size() > 0)
+    {
+        const DataType src_dt = src0->data_type();
+        const DataType dst_dt = dst->data_type();
+        const bool     quantized_dst =
+            src_dt == DataType::F32 && (dst_dt == DataType::QASYMM8 || dst_dt == DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst_dt != src_dt && dst_dt != DataType::F32 && !quantized_dst,
+                                        "Unsupported source/destination data type combination");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(detail::have_different_dimensions(out_shape, dst->tensor_shape(), 0),
+                                        "Wrong shape for destination");
+    }
+
+    const auto uk = CpuElementwiseFusionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuElementwiseFusionKernel::configure(const std::vector<const ITensorInfo *> &srcs,
+                                           ITensorInfo                            *dst,
+                                           const ElementwiseFusionInfo            &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuElementwiseFusionKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(srcs, dst, info));
+
+    const auto uk = CpuElementwiseFusionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{srcs[0]->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+    ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuElementwiseFusionKernel/").append(uk->name);
+
+    TensorShape out_shape = srcs[0]->tensor_shape();
+    for (const ITensorInfo *src : srcs)
+    {
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+    }
+
+    // Auto initialize the destination if not initialized
+    auto_init_if_empty(*dst, out_shape, 1, srcs[0]->data_type(), srcs[0]->quantization_info());
+
+    // Rows are processed whole, so the workload is split along the outer dimension with the most rows.
+    // A single row is split along X instead, so 1D tensors still run on all the threads.
+    _split_dimension = Window::DimX;
+    size_t max_rows  = 1;
+    for (size_t d = 1; d < out_shape.num_dimensions(); ++d)
+    {
+        if (out_shape[d] > max_rows)
+        {
+            _split_dimension = d;
+            max_rows         = out_shape[d];
+        }
+    }
+
+    // Configure kernel window
+    Window win = calculate_max_window(out_shape, Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuElementwiseFusionKernel::validate(const std::vector<const ITensorInfo *> &srcs,
+                                            const ITensorInfo                      *dst,
+                                            const ElementwiseFusionInfo            &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuElementwiseFusionKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(srcs, dst, info));
+    return Status{};
+}
+
+void CpuElementwiseFusionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuElementwiseFusionKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const size_t num_srcs = _info.num_inputs();
+
+    std::array<const ITensor *, ElementwiseFusionInfo::max_values> srcs{};
+    for (size_t i = 0; i < num_srcs; ++i)
+    {
+        srcs[i] = tensors.get_const_tensor(TensorType::ACL_SRC_VEC + i);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(srcs[i]);
+    }
+    ITensor *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(srcs.data(), num_srcs, dst, _info, window);
+}
+
+const char *CpuElementwiseFusionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuElementwiseFusionKernel::ElementwiseFusionKernel> &
+CpuElementwiseFusionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUELEMENTWISEFUSIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUELEMENTWISEFUSIONKERNEL_H
+
+#include "arm_compute/function_info/ElementwiseFusionInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to run a fused chain of elementwise operations in a single pass over memory
+ *
+ * The sources are passed to @ref run_op() in the slots ACL_SRC_VEC + i and the destination in ACL_DST.
+ */
+class CpuElementwiseFusionKernel : public ICpuKernel<CpuElementwiseFusionKernel>
+{
+private:
+    using ElementwiseFusionKernelPtr = std::add_pointer<void(
+        const ITensor *const *, size_t, ITensor *, const ElementwiseFusionInfo &, const Window &)>::type;
+
+public:
+    struct ElementwiseFusionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ElementwiseFusionKernelPtr   ukernel;
+    };
+
+    CpuElementwiseFusionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuElementwiseFusionKernel);
+    /** Initialize the kernel's inputs and outputs.
+     *
+     * Similar to @ref NEElementwiseFusion::configure()
+     *
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, const ElementwiseFusionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuElementwiseFusionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, const ElementwiseFusionInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension.
+     */
+    size_t get_split_dimension() const
+    {
+        return _split_dimension;
+    }
+
+    static const std::vector<ElementwiseFusionKernel> &get_available_kernels();
+
+private:
+    ElementwiseFusionInfo      _info{};
+    ElementwiseFusionKernelPtr _run_method{nullptr};
+    std::string                _name{};
+    size_t                     _split_dimension{Window::DimY};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUELEMENTWISEFUSIONKERNEL_H
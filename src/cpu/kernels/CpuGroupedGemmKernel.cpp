@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGroupedGemmKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/grouped_gemm/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Alignment of every section of the packed weights */
+constexpr size_t packed_alignment = 64;
+/** Number of destination rows computed per tile, shared with the micro-kernels */
+constexpr size_t tile_rows = 4;
+/** Number of destination columns computed per tile, in bytes */
+constexpr size_t block_bytes = 64;
+
+static const std::vector<CpuGroupedGemmKernel::GroupedGemmKernel> available_kernels = {
+    {"neon_fp32_grouped_gemm", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_grouped_gemm_pack_weights),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_grouped_gemm)},
+    {"neon_fp16_grouped_gemm",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_grouped_gemm_pack_weights),
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_grouped_gemm)},
+};
+
+bool is_supported_activation(const ActivationLayerInfo &act_info)
+{
+    if (!act_info.enabled())
+    {
+        return true;
+    }
+    switch (act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+        case ActivationLayerInfo::ActivationFunction::RELU:
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Status validate_arguments(const ITensorInfo     *a,
+                          const ITensorInfo     *b,
+                          const ITensorInfo     *biases,
+                          const ITensorInfo     *group_sizes,
+                          const ITensorInfo     *dst,
+                          const GroupedGemmInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, group_sizes, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
+    ARM_COMPUTE_RETURN_ERROR_ON(a->num_dimensions() > 2);
+
+    // Weights: [N, K, groups]
+    const size_t num_groups = b->dimension(2);
+    ARM_COMPUTE_RETURN_ERROR_ON(b->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(1) != a->dimension(0),
+                                    "The rows of the weights must match the columns of the left-hand side");
+
+    // Biases: [N, groups]
+    if (biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != b->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(1) != num_groups);
+    }
+
+    // Group sizes: [groups]
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(group_sizes, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(group_sizes->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(group_sizes->dimension(0) != num_groups,
+                                    "There must be one size per group of weights");
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_supported_activation(info.act_info),
+                                    "Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU activations can be fused");
+
+    // Validate in case the destination has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(),
+                                                           TensorShape(b->dimension(0), a->dimension(1)));
+    }
+
+    const auto uk = CpuGroupedGemmKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{a->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->pack_weights == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+CpuGroupedGemmKernel::PackedLayout compute_packed_layout(const ITensorInfo *a, const ITensorInfo *b)
+{
+    CpuGroupedGemmKernel::PackedLayout layout;
+    layout.k           = a->dimension(0);
+    layout.n           = b->dimension(0);
+    layout.num_groups  = b->dimension(2);
+    layout.tile_rows   = tile_rows;
+    layout.block_width = block_bytes / a->element_size();
+    layout.num_blocks  = DIV_CEIL(layout.n, layout.block_width);
+
+    // Every group ends with at most one partial tile, and a group cannot hold more rows than the left-hand side
+    const size_t num_rows = a->dimension(1);
+    layout.max_tiles      = std::max<size_t>(1U, num_rows / tile_rows + std::min(layout.num_groups, num_rows));
+
+    size_t     offset  = 0;
+    const auto reserve = [&offset](size_t bytes)
+    {
+        const size_t start = offset;
+        offset             = ceil_to_multiple(offset + bytes, packed_alignment);
+        return start;
+    };
+
+    const size_t num_blocks = layout.num_groups * layout.num_blocks;
+    layout.weights_offset   = reserve(num_blocks * layout.k * layout.block_width * a->element_size());
+    layout.biases_offset    = reserve(num_blocks * layout.block_width * a->element_size());
+    layout.packed_size      = offset;
+
+    return layout;
+}
+} // namespace
+
+void CpuGroupedGemmKernel::configure(const ITensorInfo     *a,
+                                     const ITensorInfo     *b,
+                                     const ITensorInfo     *biases,
+                                     const ITensorInfo     *group_sizes,
+                                     ITensorInfo           *dst,
+                                     const GroupedGemmInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemmKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, group_sizes, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(a, b, biases, group_sizes, dst, info));
+
+    const auto uk = CpuGroupedGemmKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{a->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    // Auto initialize the destination if not initialized
+    auto_init_if_empty(*dst, a->clone()->set_tensor_shape(TensorShape(b->dimension(0), a->dimension(1))));
+
+    _info        = info;
+    _layout      = compute_packed_layout(a, b);
+    _pack_method = uk->pack_weights;
+    _run_method  = uk->ukernel;
+    _name        = std::string("CpuGroupedGemmKernel/").append(uk->name);
+
+    // Every window iteration is a tile of rows by a block of columns. The sizes of the groups are only known at run
+    // time, so the window covers the most tiles any routing can produce and the micro-kernels rescale it.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _layout.max_tiles * _layout.num_blocks, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGroupedGemmKernel::validate(const ITensorInfo     *a,
+                                      const ITensorInfo     *b,
+                                      const ITensorInfo     *biases,
+                                      const ITensorInfo     *group_sizes,
+                                      const ITensorInfo     *dst,
+                                      const GroupedGemmInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemmKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(a, b, biases, group_sizes, dst, info));
+    return Status{};
+}
+
+void CpuGroupedGemmKernel::pack_weights(const ITensor *b, const ITensor *biases, ITensor *packed) const
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemmKernel::pack_weights");
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(b, packed);
+    ARM_COMPUTE_ERROR_ON(packed->info()->total_size() < _layout.packed_size);
+    ARM_COMPUTE_ERROR_ON(_pack_method == nullptr);
+
+    _pack_method(b, biases, packed, _layout);
+}
+
+const CpuGroupedGemmKernel::PackedLayout &CpuGroupedGemmKernel::packed_layout() const
+{
+    return _layout;
+}
+
+void CpuGroupedGemmKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemmKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *a           = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *packed      = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *group_sizes = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst         = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, packed, group_sizes, dst);
+
+    _run_method(a, packed, group_sizes, dst, _info, _layout, window);
+}
+
+const char *CpuGroupedGemmKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGroupedGemmKernel::GroupedGemmKernel> &CpuGroupedGemmKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGROUPEDGEMMKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGROUPEDGEMMKERNEL_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to run a grouped GEMM, where every group multiplies its own rows of the left-hand side by its own weights
+ *
+ * The number of rows of every group is read from a tensor at run time, so the routing can change between runs.
+ * The output is split into tiles of @ref PackedLayout::tile_rows rows by @ref PackedLayout::block_width columns, and
+ * the tiles of all the groups are numbered in a single sequence. The window runs over an upper bound of the number of
+ * tiles, and every slice of the window is mapped to the same fraction of the tiles actually present in this run, so
+ * the threads share the work evenly whatever the sizes of the groups.
+ *
+ * The weights and biases of every group are packed once by @ref pack_weights().
+ * The tensors are passed to @ref run_op() as:
+ * - ACL_SRC_0: left-hand side, [K, rows]
+ * - ACL_SRC_1: packed weights, of size @ref PackedLayout::packed_size
+ * - ACL_SRC_2: number of rows of every group, [groups]
+ * - ACL_DST: destination, [N, rows]
+ */
+class CpuGroupedGemmKernel : public ICpuKernel<CpuGroupedGemmKernel>
+{
+public:
+    /** Layout of the packed weights. All offsets are in bytes. */
+    struct PackedLayout
+    {
+        size_t k{0};              /**< Number of columns of the left-hand side */
+        size_t n{0};              /**< Number of columns of the destination */
+        size_t num_groups{0};     /**< Number of groups */
+        size_t tile_rows{0};      /**< Number of destination rows computed per tile */
+        size_t block_width{0};    /**< Number of destination columns computed per tile */
+        size_t num_blocks{0};     /**< Number of blocks of columns, N rounded up to the block width */
+        size_t max_tiles{0};      /**< Upper bound of the number of tiles of rows over all the groups */
+        size_t weights_offset{0}; /**< Weights, [groups][blocks][K][block_width] */
+        size_t biases_offset{0};  /**< Biases, [groups][blocks][block_width] */
+        size_t packed_size{0};    /**< Total size of the packed weights */
+    };
+
+private:
+    using PackWeightsPtr =
+        std::add_pointer<void(const ITensor *, const ITensor *, ITensor *, const PackedLayout &)>::type;
+    using GroupedGemmKernelPtr = std::add_pointer<void(const ITensor *,
+                                                       const ITensor *,
+                                                       const ITensor *,
+                                                       ITensor *,
+                                                       const GroupedGemmInfo &,
+                                                       const PackedLayout &,
+                                                       const Window &)>::type;
+
+public:
+    struct GroupedGemmKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        PackWeightsPtr               pack_weights;
+        GroupedGemmKernelPtr         ukernel;
+    };
+
+    CpuGroupedGemmKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGroupedGemmKernel);
+    /** Initialize the kernel's inputs and output.
+     *
+     * Similar to @ref NEGroupedGEMM::configure()
+     *
+     */
+    void configure(const ITensorInfo     *a,
+                   const ITensorInfo     *b,
+                   const ITensorInfo     *biases,
+                   const ITensorInfo     *group_sizes,
+                   ITensorInfo           *dst,
+                   const GroupedGemmInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGroupedGemmKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *a,
+                           const ITensorInfo     *b,
+                           const ITensorInfo     *biases,
+                           const ITensorInfo     *group_sizes,
+                           const ITensorInfo     *dst,
+                           const GroupedGemmInfo &info);
+    /** Pack the weights and biases of every group
+     *
+     * @param[in]  b      Weights tensor.
+     * @param[in]  biases Biases tensor. Can be nullptr.
+     * @param[out] packed Packed weights tensor of at least @ref PackedLayout::packed_size bytes.
+     */
+    void pack_weights(const ITensor *b, const ITensor *biases, ITensor *packed) const;
+    /** Layout of the packed weights for the configured shapes
+     *
+     * @return The packed layout
+     */
+    const PackedLayout &packed_layout() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GroupedGemmKernel> &get_available_kernels();
+
+private:
+    GroupedGemmInfo      _info{};
+    PackedLayout         _layout{};
+    PackWeightsPtr       _pack_method{nullptr};
+    GroupedGemmKernelPtr _run_method{nullptr};
+    std::string          _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGROUPEDGEMMKERNEL_H
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuImagePreprocessKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/image_preprocess/list.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Number of destination columns computed together by the micro-kernels */
+constexpr size_t column_block = 4;
+
+static const std::vector<CpuImagePreprocessKernel::ImagePreprocessKernel> available_kernels = {
+    {"neon_fp32_image_preprocess", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_image_preprocess)},
+    {"neon_fp16_image_preprocess",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_image_preprocess)},
+    {"neon_qasymm8_image_preprocess",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_image_preprocess)},
+    {"neon_qasymm8_signed_image_preprocess",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_image_preprocess)},
+};
+
+/** Number of channels of a source tensor for a given format, the luma plane for NV12 */
+size_t num_source_channels(Format format)
+{
+    switch (format)
+    {
+        case Format::RGB888:
+            return 3;
+        case Format::YUYV422:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *src_uv,
+                          const ITensorInfo         *dst,
+                          const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.format != Format::RGB888 && info.format != Format::YUYV422 &&
+                                        info.format != Format::NV12,
+                                    "Only RGB888, YUYV422 and NV12 sources are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(src, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_channels() != num_source_channels(info.format));
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) == 0 || src->dimension(1) == 0);
+    if (info.format != Format::RGB888)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % 2 != 0, "YUV sources must have an even width");
+    }
+    if (info.format == Format::NV12)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) % 2 != 0, "NV12 sources must have an even height");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(src_uv == nullptr, "NV12 sources need a chroma plane");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(src_uv, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON(src_uv->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(src_uv->num_dimensions() > 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(src_uv->dimension(0) != src->dimension(0) / 2 ||
+                                    src_uv->dimension(1) != src->dimension(1) / 2);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "The destination must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32, DataType::F16, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(dst, DataLayout::NCHW, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(get_data_layout_dimension_index(
+                                    dst->data_layout(), DataLayoutDimension::CHANNEL)) != 3);
+    if (is_data_type_quantized_asymmetric(dst->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->quantization_info().uniform().scale <= 0.f);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.std_dev[0] == 0.f || info.std_dev[1] == 0.f || info.std_dev[2] == 0.f,
+                                    "The standard deviation must not be zero");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation != InterpolationPolicy::NEAREST_NEIGHBOR &&
+                                info.interpolation != InterpolationPolicy::BILINEAR);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.sampling_policy != SamplingPolicy::CENTER &&
+                                info.sampling_policy != SamplingPolicy::TOP_LEFT);
+
+    const auto uk = CpuImagePreprocessKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+/** Computes the source coordinates and the weights used to resample one dimension
+ *
+ * @param[in]  src_size Size of the source along the dimension
+ * @param[in]  dst_size Size of the destination along the dimension
+ * @param[in]  info     Preprocessing descriptor
+ * @param[out] c0       First source coordinate of every destination coordinate
+ * @param[out] c1       Second source coordinate of every destination coordinate
+ * @param[out] w        Weight of the second source coordinate of every destination coordinate
+ */
+void compute_resample_table(size_t                     src_size,
+                            size_t                     dst_size,
+                            const ImagePreprocessInfo &info,
+                            std::vector<int32_t>      &c0,
+                            std::vector<int32_t>      &c1,
+                            std::vector<float>        &w)
+{
+    const float   scale  = static_cast<float>(src_size) / static_cast<float>(dst_size);
+    const bool    center = info.sampling_policy == SamplingPolicy::CENTER;
+    const int32_t last   = static_cast<int32_t>(src_size) - 1;
+
+    c0.resize(dst_size);
+    c1.resize(dst_size);
+    w.resize(dst_size);
+    for (size_t d = 0; d < dst_size; ++d)
+    {
+        if (info.interpolation == InterpolationPolicy::BILINEAR)
+        {
+            const float   coord = center ? std::max((d + 0.5f) * scale - 0.5f, 0.f) : d * scale;
+            const float   floor = std::floor(coord);
+            const int32_t first = std::min(static_cast<int32_t>(floor), last);
+            c0[d]               = first;
+            c1[d]               = std::min(first + 1, last);
+            w[d]                = coord - floor;
+        }
+        else
+        {
+            const float coord = center ? (d + 0.5f) * scale : d * scale;
+            c0[d]             = std::min(static_cast<int32_t>(std::floor(coord)), last);
+            c1[d]             = c0[d];
+            w[d]              = 0.f;
+        }
+    }
+}
+} // namespace
+
+void CpuImagePreprocessKernel::configure(const ITensorInfo         *src,
+                                         const ITensorInfo         *src_uv,
+                                         ITensorInfo               *dst,
+                                         const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuImagePreprocessKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, src_uv, dst, info));
+
+    const auto uk = CpuImagePreprocessKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    const DataLayout layout = dst->data_layout();
+    const size_t     dst_w  = dst->dimension(get_data_layout_dimension_index(layout, DataLayoutDimension::WIDTH));
+    const size_t     dst_h  = dst->dimension(get_data_layout_dimension_index(layout, DataLayoutDimension::HEIGHT));
+
+    _params               = Params{};
+    _params.format        = info.format;
+    _params.interpolation = info.interpolation;
+    if (info.bgr)
+    {
+        _params.channel_order = {{2, 1, 0}};
+    }
+
+    // Fold the normalization and the quantization of the destination into a single multiply-add per channel
+    const bool                    is_quantized = is_data_type_quantized_asymmetric(dst->data_type());
+    const UniformQuantizationInfo qinfo        = dst->quantization_info().uniform();
+    const float                   qscale       = is_quantized ? qinfo.scale : 1.f;
+    const float                   qoffset      = is_quantized ? static_cast<float>(qinfo.offset) : 0.f;
+    for (size_t c = 0; c < 3; ++c)
+    {
+        _params.scale[c]  = 1.f / (info.std_dev[c] * qscale);
+        _params.offset[c] = qoffset - info.mean[c] * _params.scale[c];
+    }
+
+    compute_resample_table(src->dimension(0), dst_w, info, _params.x0, _params.x1, _params.wx);
+    compute_resample_table(src->dimension(1), dst_h, info, _params.y0, _params.y1, _params.wy);
+
+    // Pad the column tables so that the micro-kernels can always read a full block of columns
+    const size_t padded_w = ceil_to_multiple(dst_w, column_block);
+    _params.x0.resize(padded_w, _params.x0.back());
+    _params.x1.resize(padded_w, _params.x1.back());
+    _params.wx.resize(padded_w, _params.wx.back());
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuImagePreprocessKernel/").append(uk->name);
+
+    // Every window iteration computes a full destination row
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, dst_h, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuImagePreprocessKernel::validate(const ITensorInfo         *src,
+                                          const ITensorInfo         *src_uv,
+                                          const ITensorInfo         *dst,
+                                          const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuImagePreprocessKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, src_uv, dst, info));
+    return Status{};
+}
+
+void CpuImagePreprocessKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuImagePreprocessKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *src_uv = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_ON(_params.format == Format::NV12 && src_uv == nullptr);
+
+    _run_method(src, src_uv, dst, _params, window);
+}
+
+const char *CpuImagePreprocessKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuImagePreprocessKernel::ImagePreprocessKernel> &CpuImagePreprocessKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUIMAGEPREPROCESSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUIMAGEPREPROCESSKERNEL_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <array>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to convert a camera frame to a normalized tensor in a single pass
+ *
+ * Every destination pixel is resampled from the source image, converting only the source pixels it reads to RGB.
+ * The normalization and the quantization of the destination are folded into a single multiply-add per channel.
+ * The resampling coordinates and weights are computed once at configure time. The window spans the destination rows.
+ *
+ * The tensors are passed to @ref run_op() as:
+ * - ACL_SRC_0: source image, or luma plane for NV12
+ * - ACL_SRC_1: interleaved chroma plane for NV12, unused otherwise
+ * - ACL_DST: destination
+ */
+class CpuImagePreprocessKernel : public ICpuKernel<CpuImagePreprocessKernel>
+{
+public:
+    /** Resampling tables and normalization parameters */
+    struct Params
+    {
+        Format               format{Format::RGB888};                      /**< Source format */
+        InterpolationPolicy  interpolation{InterpolationPolicy::BILINEAR}; /**< Resize policy */
+        std::array<int, 3>   channel_order{{0, 1, 2}}; /**< RGB component written to each destination channel */
+        std::array<float, 3> scale{{1.f, 1.f, 1.f}};   /**< Scale of each destination channel: 1 / (std_dev * qscale) */
+        std::array<float, 3> offset{{0.f, 0.f, 0.f}};  /**< Offset of each destination channel: offset - mean * scale */
+        std::vector<int32_t> x0{}; /**< Left source column of each destination column, padded to a multiple of 4 */
+        std::vector<int32_t> x1{}; /**< Right source column of each destination column, padded to a multiple of 4 */
+        std::vector<float>   wx{}; /**< Weight of the right column of each destination column */
+        std::vector<int32_t> y0{}; /**< Top source row of each destination row */
+        std::vector<int32_t> y1{}; /**< Bottom source row of each destination row */
+        std::vector<float>   wy{}; /**< Weight of the bottom row of each destination row */
+    };
+
+private:
+    using ImagePreprocessKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, ITensor *, const Params &, const Window &)>::type;
+
+public:
+    struct ImagePreprocessKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ImagePreprocessKernelPtr     ukernel;
+    };
+
+    CpuImagePreprocessKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuImagePreprocessKernel);
+    /** Initialize the kernel's inputs and output.
+     *
+     * Similar to @ref NEImagePreprocess::configure()
+     *
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *src_uv,
+                   ITensorInfo               *dst,
+                   const ImagePreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuImagePreprocessKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *src_uv,
+                           const ITensorInfo         *dst,
+                           const ImagePreprocessInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<ImagePreprocessKernel> &get_available_kernels();
+
+private:
+    Params                   _params{};
+    ImagePreprocessKernelPtr _run_method{nullptr};
+    std::string              _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUIMAGEPREPROCESSKERNEL_H
@@ -142,11 +142,15 @@ public:
      *
      * @param[in] kernel          Pointer to an assembly kernel implementation.
      * @param[in] kernel_name_tag Tag to be attacehd to the kernel's name.
+     * @param[in] flops           (Optional) Arithmetic operations of the whole GEMM, 0 if unknown.
      */
-    void configure(arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *kernel, std::string kernel_name_tag)
+    void configure(arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *kernel,
+                   std::string                                              kernel_name_tag,
+                   uint64_t                                                 flops = 0)
     {
         ARM_COMPUTE_ERROR_ON_NULLPTR((reinterpret_cast<void *>(kernel)));
         _kernel = kernel;
+        _flops  = flops;
 
         Window win = to_window(kernel->get_window_size());
 
@@ -171,10 +175,22 @@ public:
 
         return ICPPKernel::default_mws;
     }
+    /** Estimate of the arithmetic operations done on a window, as its share of the whole GEMM
+     *
+     * @param[in] window Region the kernel runs on.
+     *
+     * @return Number of arithmetic operations, 0 if unknown.
+     */
+    uint64_t flops_estimate(const Window &window) const override
+    {
+        const size_t total_iterations = ICPPKernel::window().num_iterations_total();
+        return total_iterations == 0 ? 0 : _flops * window.num_iterations_total() / total_iterations;
+    }
 
 private:
     arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *_kernel;
     std::string                                              _name;
+    uint64_t                                                 _flops{0};
 };
 } // namespace kernel
 } // namespace cpu
@@ -79,6 +79,16 @@ inline T roundup(const T a, const T b) {
     }
 }
 
+// Prefetch a block of memory into L2, one cache line at a time.  Used to stream
+// pretransposed weights ahead of the kernels which read them only once.
+inline void prefetch_l2(const void *ptr, size_t bytes) {
+    const char *p = reinterpret_cast<const char *>(ptr);
+
+    for (size_t offset=0; offset<bytes; offset+=64) {
+        __builtin_prefetch(p + offset, 0, 2);
+    }
+}
+
 enum class VLType {
     None,
     SVE,
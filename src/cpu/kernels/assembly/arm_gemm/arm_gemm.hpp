@@ -93,6 +93,8 @@ struct GemmConfig
     unsigned int inner_block_size = 0;
     unsigned int outer_block_size = 0;
     WeightFormat weight_format    = WeightFormat::ANY;
+    // Bytes of B to prefetch ahead of the kernels that stream it once (GEMV shapes), 0 leaves it to the hardware.
+    unsigned int weights_prefetch_distance = 0;
 
     GemmConfig()
     {
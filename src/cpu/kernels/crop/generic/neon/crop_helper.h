@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,7 +31,7 @@ namespace arm_compute
 namespace cpu
 {
 template <typename T>
-inline float32x4_t load_as_f32(T *ptr)
+inline float32x4_t load_as_f32(const T *ptr)
 {
     ARM_COMPUTE_UNUSED(ptr);
     ARM_COMPUTE_ERROR("Type not supported.");
@@ -39,44 +39,44 @@ inline float32x4_t load_as_f32(T *ptr)
 
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
 template <>
-inline float32x4_t load_as_f32(float16_t *ptr)
+inline float32x4_t load_as_f32(const float16_t *ptr)
 {
     return vcvt_f32_f16(wrapper::vload(ptr));
 }
 #endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
 
 template <>
-inline float32x4_t load_as_f32(float *ptr)
+inline float32x4_t load_as_f32(const float *ptr)
 {
     return wrapper::vloadq(ptr);
 }
 
 template <>
-inline float32x4_t load_as_f32(int32_t *ptr)
+inline float32x4_t load_as_f32(const int32_t *ptr)
 {
     return vcvtq_f32_s32(wrapper::vloadq(ptr));
 }
 
 template <>
-inline float32x4_t load_as_f32(uint32_t *ptr)
+inline float32x4_t load_as_f32(const uint32_t *ptr)
 {
     return vcvtq_f32_u32(wrapper::vloadq(ptr));
 }
 
 template <>
-inline float32x4_t load_as_f32(int16_t *ptr)
+inline float32x4_t load_as_f32(const int16_t *ptr)
 {
     return vcvtq_f32_s32(vmovl_s16(wrapper::vload(ptr)));
 }
 
 template <>
-inline float32x4_t load_as_f32(uint16_t *ptr)
+inline float32x4_t load_as_f32(const uint16_t *ptr)
 {
     return vcvtq_f32_u32(vmovl_u16(wrapper::vload(ptr)));
 }
 
 template <>
-inline float32x4_t load_as_f32(uint8_t *ptr)
+inline float32x4_t load_as_f32(const uint8_t *ptr)
 {
     return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(wrapper::vload(ptr)))));
 }
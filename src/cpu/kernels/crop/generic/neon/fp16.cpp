@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,19 +30,16 @@ namespace arm_compute
 {
 namespace cpu
 {
-void fp16_in_bounds_crop_window(const ITensor *input,
-                                const ITensor *output,
-                                float         *output_ptr,
-                                Coordinates    input_offset,
-                                int32_t        window_step_x,
-                                int32_t        output_width_start,
-                                int32_t        output_width_limit,
-                                bool           input_has_single_channel,
-                                bool           is_width_flipped)
+void fp16_crop_resize(const ITensor      *input,
+                      const ITensor      *boxes,
+                      const ITensor      *box_ind,
+                      ITensor            *output,
+                      InterpolationPolicy method,
+                      float               extrapolation_value,
+                      const Window       &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "fp16_in_bounds_crop_window");
-    in_bounds_crop_window<float16_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                     output_width_limit, input_has_single_channel, is_width_flipped);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "fp16_crop_resize");
+    crop_resize_window<float16_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
 }
 } // namespace cpu
 } // namespace arm_compute
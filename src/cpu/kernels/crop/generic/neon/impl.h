@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,96 +25,231 @@
 #define SRC_CORE_NEON_KERNELS_CROP_IMPL_H
 
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
 
 #include "src/core/common/Registrars.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/kernels/crop/generic/neon/crop_helper.h"
 
+#include <cmath>
+#include <cstdlib>
+#include <type_traits>
+
 namespace arm_compute
 {
 namespace cpu
 {
+/** Crop box of one output image, in pixels of the source image */
+struct CropBox
+{
+    int32_t start_x; /**< Source column of the first column of the crop */
+    int32_t start_y; /**< Source row of the first row of the crop */
+    int32_t step_x;  /**< Source column step between two columns of the crop: -1 if the box is flipped, 1 otherwise */
+    int32_t step_y;  /**< Source row step between two rows of the crop: -1 if the box is flipped, 1 otherwise */
+    int32_t width;   /**< Number of columns of the crop */
+    int32_t height;  /**< Number of rows of the crop */
+    int32_t batch;   /**< Batch of the source image */
+};
+
+/** Reads a crop box and rounds it to source pixels
+ *
+ * @param[in] input   Source tensor
+ * @param[in] boxes   Boxes tensor, in normalized coordinates [y0, x0, y1, x1]
+ * @param[in] box_ind Batch index of each box
+ * @param[in] idx     Index of the box
+ *
+ * @return The crop box
+ */
+inline CropBox read_crop_box(const ITensor *input, const ITensor *boxes, const ITensor *box_ind, int32_t idx)
+{
+    const auto *box   = reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(0, idx)));
+    const auto  max_x = static_cast<float>(input->info()->dimension(1) - 1);
+    const auto  max_y = static_cast<float>(input->info()->dimension(2) - 1);
+
+    // The normalized coordinates are scaled to the image size and rounded to the nearest pixel
+    const auto x0 = static_cast<int32_t>(std::floor(box[1] * max_x + 0.5f));
+    const auto y0 = static_cast<int32_t>(std::floor(box[0] * max_y + 0.5f));
+    const auto x1 = static_cast<int32_t>(std::floor(box[3] * max_x + 0.5f));
+    const auto y1 = static_cast<int32_t>(std::floor(box[2] * max_y + 0.5f));
+
+    CropBox crop_box{};
+    crop_box.start_x = x0;
+    crop_box.start_y = y0;
+    crop_box.step_x  = x1 < x0 ? -1 : 1;
+    crop_box.step_y  = y1 < y0 ? -1 : 1;
+    crop_box.width   = std::abs(x1 - x0) + 1;
+    crop_box.height  = std::abs(y1 - y0) + 1;
+    crop_box.batch   = *reinterpret_cast<const int32_t *>(box_ind->ptr_to_element(Coordinates(idx)));
+    return crop_box;
+}
+
+/** Offsets a pixel pointer by a number of channels, keeping out of bounds pixels null */
+template <typename T>
+inline const T *offset_or_null(const T *ptr, int32_t offset)
+{
+    return ptr != nullptr ? ptr + offset : ptr;
+}
+
+/** Loads 4 elements as float, or returns the extrapolation value if the pixel is out of bounds */
+template <typename T>
+inline float32x4_t load_or_extrapolate(const T *ptr, const float32x4_t &extrapolation)
+{
+    return ptr != nullptr ? load_as_f32(ptr) : extrapolation;
+}
+
+/** Loads one element as float, or returns the extrapolation value if the pixel is out of bounds */
+template <typename T>
+inline float load_or_extrapolate(const T *ptr, float extrapolation)
+{
+    return ptr != nullptr ? static_cast<float>(*ptr) : extrapolation;
+}
+
+/** Crops and resizes the rows of the output images in the window, in a single pass
+ *
+ * Each output pixel is sampled from the source image as if the box had been cropped first and the crop then scaled
+ * with top-left sampling and a constant border. Pixels of the crop that fall outside of the source image take the
+ * extrapolation value. The boxes are read from @p boxes every time the kernel runs.
+ *
+ * @param[in]  input               Source tensor, in NHWC
+ * @param[in]  boxes               Boxes tensor, in normalized coordinates [y0, x0, y1, x1]
+ * @param[in]  box_ind             Batch index of each box
+ * @param[out] output              Destination tensor, in NHWC, with one image per box
+ * @param[in]  method              Interpolation policy. Nearest neighbour or bilinear.
+ * @param[in]  extrapolation_value Value of the pixels outside of the source image
+ * @param[in]  window              Window whose Y dimension spans the rows of all the output images
+ */
 template <typename T>
-void in_bounds_crop_window(const ITensor *input,
-                           const ITensor *output,
-                           float         *output_ptr,
-                           Coordinates    input_offset,
-                           int32_t        window_step_x,
-                           int32_t        output_width_start,
-                           int32_t        output_width_limit,
-                           bool           input_has_single_channel,
-                           bool           is_width_flipped)
+void crop_resize_window(const ITensor      *input,
+                        const ITensor      *boxes,
+                        const ITensor      *box_ind,
+                        ITensor            *output,
+                        InterpolationPolicy method,
+                        float               extrapolation_value,
+                        const Window       &window)
 {
-    // Reverse elements if width flipped.
-    if (is_width_flipped)
+    // u8 vectors are loaded 8 elements at a time, so make sure the loads don't go past the end of the pixel
+    constexpr int32_t window_step_x = 4;
+    constexpr int32_t load_size     = std::is_same<T, uint8_t>::value ? 8 : window_step_x;
+
+    const int32_t num_channels = static_cast<int32_t>(input->info()->dimension(0));
+    const int32_t src_width    = static_cast<int32_t>(input->info()->dimension(1));
+    const int32_t src_height   = static_cast<int32_t>(input->info()->dimension(2));
+    const int32_t dst_width    = static_cast<int32_t>(output->info()->dimension(1));
+    const int32_t dst_height   = static_cast<int32_t>(output->info()->dimension(2));
+
+    const Strides &src_strides       = input->info()->strides_in_bytes();
+    const Strides &dst_strides       = output->info()->strides_in_bytes();
+    const uint8_t *src_base          = input->buffer() + input->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base          = output->buffer() + output->info()->offset_first_element_in_bytes();
+    const auto     extrapolation_vec = wrapper::vdup_n(extrapolation_value, wrapper::traits::vector_128_tag());
+
+    CropBox box{};
+    int32_t box_idx = -1;
+    for (int32_t id = window.y().start(); id < window.y().end(); ++id)
     {
-        // Collapse first dimension if possible.
-        if (input_has_single_channel)
+        const int32_t row = id % dst_height;
+        if (id / dst_height != box_idx)
         {
-            int32_t     x = output_width_start;
-            Coordinates negative_offset(input_offset);
-            negative_offset.set(1, negative_offset[1] - window_step_x + 1);
-            for (; x <= output_width_limit - window_step_x; x += window_step_x, negative_offset[1] -= window_step_x)
-            {
-                auto in = load_as_f32(reinterpret_cast<T *>(input->ptr_to_element(negative_offset)));
-
-                in = wrapper::vrev64(in);
-                in = wrapper::vcombine(wrapper::vgethigh(in), wrapper::vgetlow(in));
+            box_idx = id / dst_height;
+            box     = read_crop_box(input, boxes, box_ind, box_idx);
+        }
 
-                wrapper::vstore(output_ptr + x, in);
-            }
-            input_offset[1] = negative_offset[1] + window_step_x - 1;
-            for (; x < output_width_limit; ++x, --input_offset[1])
+        // Map a row or a column of the crop to the source image: nullptr or -1 if it is out of bounds
+        const auto src_row = [&](int32_t y) -> const uint8_t *
+        {
+            const int32_t sy = box.start_y + box.step_y * y;
+            if (y < 0 || y >= box.height || sy < 0 || sy >= src_height)
             {
-                *(output_ptr + x) = static_cast<float>(*reinterpret_cast<T *>(input->ptr_to_element(input_offset)));
+                return nullptr;
             }
-        }
-        else
+            return src_base + sy * src_strides[2] + box.batch * src_strides[3];
+        };
+        const auto src_col = [&](int32_t x) -> int32_t
+        {
+            const int32_t sx = box.start_x + box.step_x * x;
+            return (x < 0 || x >= box.width || sx < 0 || sx >= src_width) ? -1 : sx;
+        };
+        const auto src_pixel = [&](const uint8_t *row_ptr, int32_t col) -> const T *
         {
-            for (int32_t x = output_width_start; x < output_width_limit; ++x, --input_offset[1])
+            return (row_ptr == nullptr || col < 0) ? nullptr
+                                                   : reinterpret_cast<const T *>(row_ptr + col * src_strides[1]);
+        };
+
+        // Compute the ratio between the crop width/height and the destination width/height
+        const auto wr = static_cast<float>(box.width) / static_cast<float>(dst_width);
+        const auto hr = static_cast<float>(box.height) / static_cast<float>(dst_height);
+
+        uint8_t *dst_row = dst_base + row * dst_strides[2] + box_idx * dst_strides[3];
+        if (method == InterpolationPolicy::NEAREST_NEIGHBOR)
+        {
+            const uint8_t *row_ptr = src_row(static_cast<int32_t>(std::floor(row * hr)));
+            for (int32_t x = 0; x < dst_width; ++x)
             {
-                input_offset.set(0, 0);
+                const T *in  = src_pixel(row_ptr, src_col(static_cast<int32_t>(std::floor(x * wr))));
+                auto    *out = reinterpret_cast<float *>(dst_row + x * dst_strides[1]);
+
                 int32_t c = 0;
-                for (; c <= static_cast<int32_t>(input->info()->dimension(0)) - window_step_x;
-                     c += window_step_x, input_offset[0] += window_step_x)
+                for (; c <= num_channels - load_size; c += window_step_x)
                 {
-                    auto in = load_as_f32(reinterpret_cast<T *>(input->ptr_to_element(input_offset)));
-                    wrapper::vstore(output_ptr + x * output->info()->dimension(0) + c, in);
+                    wrapper::vstore(out + c, load_or_extrapolate(offset_or_null(in, c), extrapolation_vec));
                 }
-                for (; c < static_cast<int32_t>(input->info()->dimension(0)); ++c, ++input_offset[0])
+                for (; c < num_channels; ++c)
                 {
-                    *(output_ptr + x * output->info()->dimension(0) + c) =
-                        static_cast<float>(*reinterpret_cast<T *>(input->ptr_to_element(input_offset)));
+                    out[c] = load_or_extrapolate(offset_or_null(in, c), extrapolation_value);
                 }
             }
         }
-    }
-    else
-    {
-        // Use memcpy if the elements don't need converting to float.
-        if (std::is_same<T, float>::value)
-        {
-            memcpy(static_cast<void *>(output_ptr + output_width_start * output->info()->dimension(0)),
-                   reinterpret_cast<const void *>(input->ptr_to_element(input_offset)),
-                   (output_width_limit - output_width_start) * output->info()->dimension(0) *
-                       output->info()->element_size());
-        }
         else
         {
-            int32_t x = 0;
-            int32_t limit =
-                (output_width_limit - output_width_start) * static_cast<int32_t>(output->info()->dimension(0));
-            float *output_start_ptr = output_ptr + output_width_start * output->info()->dimension(0);
-            for (; x <= limit - window_step_x; x += window_step_x, input_offset[0] += window_step_x)
+            const float    y_src = row * hr;
+            const int32_t  y     = static_cast<int32_t>(std::floor(y_src));
+            const float    dy    = y_src - y;
+            const float    dy_1  = 1.f - dy;
+            const uint8_t *row0  = src_row(y);
+            const uint8_t *row1  = src_row(y + 1);
+            for (int32_t x = 0; x < dst_width; ++x)
             {
-                auto in = load_as_f32(reinterpret_cast<T *>(input->ptr_to_element(input_offset)));
-                wrapper::vstore(output_start_ptr + x, in);
-            }
-            for (; x < limit; ++x, ++input_offset[0])
-            {
-                *(output_start_ptr + x) =
-                    static_cast<float>(*reinterpret_cast<T *>(input->ptr_to_element(input_offset)));
+                const float   x_src = x * wr;
+                const int32_t xi    = static_cast<int32_t>(std::floor(x_src));
+                const float   dx    = x_src - xi;
+                const float   dx_1  = 1.f - dx;
+                const int32_t col0  = src_col(xi);
+                const int32_t col1  = src_col(xi + 1);
+
+                const T    *tl   = src_pixel(row0, col0);
+                const T    *tr   = src_pixel(row0, col1);
+                const T    *bl   = src_pixel(row1, col0);
+                const T    *br   = src_pixel(row1, col1);
+                const float w_tl = dx_1 * dy_1;
+                const float w_tr = dx * dy_1;
+                const float w_bl = dx_1 * dy;
+                const float w_br = dx * dy;
+                auto       *out  = reinterpret_cast<float *>(dst_row + x * dst_strides[1]);
+
+                const auto w_tl_vec = wrapper::vdup_n(w_tl, wrapper::traits::vector_128_tag());
+                const auto w_tr_vec = wrapper::vdup_n(w_tr, wrapper::traits::vector_128_tag());
+                const auto w_bl_vec = wrapper::vdup_n(w_bl, wrapper::traits::vector_128_tag());
+                const auto w_br_vec = wrapper::vdup_n(w_br, wrapper::traits::vector_128_tag());
+
+                int32_t c = 0;
+                for (; c <= num_channels - load_size; c += window_step_x)
+                {
+                    auto res = wrapper::vmul(load_or_extrapolate(offset_or_null(tl, c), extrapolation_vec), w_tl_vec);
+                    res = wrapper::vmla(res, load_or_extrapolate(offset_or_null(tr, c), extrapolation_vec), w_tr_vec);
+                    res = wrapper::vmla(res, load_or_extrapolate(offset_or_null(bl, c), extrapolation_vec), w_bl_vec);
+                    res = wrapper::vmla(res, load_or_extrapolate(offset_or_null(br, c), extrapolation_vec), w_br_vec);
+                    wrapper::vstore(out + c, res);
+                }
+                for (; c < num_channels; ++c)
+                {
+                    out[c] = load_or_extrapolate(offset_or_null(tl, c), extrapolation_value) * w_tl +
+                             load_or_extrapolate(offset_or_null(tr, c), extrapolation_value) * w_tr +
+                             load_or_extrapolate(offset_or_null(bl, c), extrapolation_value) * w_bl +
+                             load_or_extrapolate(offset_or_null(br, c), extrapolation_value) * w_br;
+                }
             }
         }
     }
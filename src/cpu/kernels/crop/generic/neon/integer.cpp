@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2025 Arm Limited.
+ * Copyright (c) 2021-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,94 +30,64 @@ namespace arm_compute
 {
 namespace cpu
 {
-void u8_in_bounds_crop_window(const ITensor *input,
-                              const ITensor *output,
-                              float         *output_ptr,
-                              Coordinates    input_offset,
-                              int32_t        window_step_x,
-                              int32_t        output_width_start,
-                              int32_t        output_width_limit,
-                              bool           input_has_single_channel,
-                              bool           is_width_flipped)
+void u8_crop_resize(const ITensor      *input,
+                    const ITensor      *boxes,
+                    const ITensor      *box_ind,
+                    ITensor            *output,
+                    InterpolationPolicy method,
+                    float               extrapolation_value,
+                    const Window       &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "u8_in_bounds_crop_window");
-    in_bounds_crop_window<uint8_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                   output_width_limit, input_has_single_channel, is_width_flipped);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "u8_crop_resize");
+    crop_resize_window<uint8_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
 }
 
-void u16_in_bounds_crop_window(const ITensor *input,
-                               const ITensor *output,
-                               float         *output_ptr,
-                               Coordinates    input_offset,
-                               int32_t        window_step_x,
-                               int32_t        output_width_start,
-                               int32_t        output_width_limit,
-                               bool           input_has_single_channel,
-                               bool           is_width_flipped)
+void u16_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "u16_in_bounds_crop_window");
-    in_bounds_crop_window<uint16_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                    output_width_limit, input_has_single_channel, is_width_flipped);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "u16_crop_resize");
+    crop_resize_window<uint16_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
 }
 
-void u32_in_bounds_crop_window(const ITensor *input,
-                               const ITensor *output,
-                               float         *output_ptr,
-                               Coordinates    input_offset,
-                               int32_t        window_step_x,
-                               int32_t        output_width_start,
-                               int32_t        output_width_limit,
-                               bool           input_has_single_channel,
-                               bool           is_width_flipped)
+void u32_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "u32_in_bounds_crop_window");
-    in_bounds_crop_window<uint32_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                    output_width_limit, input_has_single_channel, is_width_flipped);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "u32_crop_resize");
+    crop_resize_window<uint32_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
 }
 
-void s8_in_bounds_crop_window(const ITensor *input,
-                              const ITensor *output,
-                              float         *output_ptr,
-                              Coordinates    input_offset,
-                              int32_t        window_step_x,
-                              int32_t        output_width_start,
-                              int32_t        output_width_limit,
-                              bool           input_has_single_channel,
-                              bool           is_width_flipped)
+void s16_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "s8_in_bounds_crop_window");
-    in_bounds_crop_window<int8_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                  output_width_limit, input_has_single_channel, is_width_flipped);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "s16_crop_resize");
+    crop_resize_window<int16_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
 }
 
-void s16_in_bounds_crop_window(const ITensor *input,
-                               const ITensor *output,
-                               float         *output_ptr,
-                               Coordinates    input_offset,
-                               int32_t        window_step_x,
-                               int32_t        output_width_start,
-                               int32_t        output_width_limit,
-                               bool           input_has_single_channel,
-                               bool           is_width_flipped)
+void s32_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
 {
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "s16_in_bounds_crop_window");
-    in_bounds_crop_window<int16_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                   output_width_limit, input_has_single_channel, is_width_flipped);
-}
-
-void s32_in_bounds_crop_window(const ITensor *input,
-                               const ITensor *output,
-                               float         *output_ptr,
-                               Coordinates    input_offset,
-                               int32_t        window_step_x,
-                               int32_t        output_width_start,
-                               int32_t        output_width_limit,
-                               bool           input_has_single_channel,
-                               bool           is_width_flipped)
-{
-    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "s32_in_bounds_crop_window");
-    in_bounds_crop_window<int32_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
-                                   output_width_limit, input_has_single_channel, is_width_flipped);
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "s32_crop_resize");
+    crop_resize_window<int32_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,21 +35,19 @@ namespace arm_compute
 {
 namespace cpu
 {
-#define DECLARE_CROP_KERNEL(func_name)                                                                       \
-    void func_name(const ITensor *input, const ITensor *output, float *output_ptr, Coordinates input_offset, \
-                   int32_t window_step_x, int32_t output_width_start, int32_t output_width_limit,            \
-                   bool input_has_single_channel, bool is_width_flipped)
+#define DECLARE_CROP_RESIZE_KERNEL(func_name)                                                             \
+    void func_name(const ITensor *input, const ITensor *boxes, const ITensor *box_ind, ITensor *output, \
+                   InterpolationPolicy method, float extrapolation_value, const Window &window)
 
-DECLARE_CROP_KERNEL(fp16_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(fp32_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(s8_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(s16_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(s32_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(u8_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(u16_in_bounds_crop_window);
-DECLARE_CROP_KERNEL(u32_in_bounds_crop_window);
+DECLARE_CROP_RESIZE_KERNEL(fp16_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(fp32_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(s16_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(s32_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(u8_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(u16_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(u32_crop_resize);
 
-#undef DECLARE_CROP_KERNEL
+#undef DECLARE_CROP_RESIZE_KERNEL
 
 } // namespace cpu
 } // namespace arm_compute
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__aarch64__) && defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#include "src/cpu/kernels/depthwise_separable_conv2d/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_depthwise_separable_pack_weights(const ITensor                                  *dw_weights,
+                                                const ITensor                                  *dw_biases,
+                                                const ITensor                                  *pw_weights,
+                                                const ITensor                                  *pw_biases,
+                                                ITensor                                        *packed,
+                                                const QuantizationInfo                         &src_qinfo,
+                                                const QuantizationInfo                         &dst_qinfo,
+                                                const DepthwiseSeparableConv2dInfo             &info,
+                                                const depthwise_separable_conv2d::PackedLayout &layout)
+{
+    ARM_COMPUTE_UNUSED(src_qinfo, dst_qinfo, info);
+    depthwise_separable_conv2d::pack_weights_float<float16_t>(dw_weights, dw_biases, pw_weights, pw_biases, packed,
+                                                              layout);
+}
+
+void neon_fp16_depthwise_separable_conv2d(const ITensor                                  *src,
+                                          const ITensor                                  *packed,
+                                          ITensor                                        *dst,
+                                          ITensor                                        *workspace,
+                                          const DepthwiseSeparableConv2dInfo             &info,
+                                          const depthwise_separable_conv2d::PackedLayout &layout,
+                                          const Window                                   &window,
+                                          const ThreadInfo                               &thread_info)
+{
+    depthwise_separable_conv2d::depthwise_separable_conv2d_float<float16_t>(src, packed, dst, workspace, info, layout,
+                                                                            window, thread_info);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__aarch64__) && defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) */
@@ -0,0 +1,625 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_DEPTHWISE_SEPARABLE_CONV2D_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_DEPTHWISE_SEPARABLE_CONV2D_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/CpuDepthwiseSeparableConv2dKernel.h"
+#include "src/cpu/kernels/depthwise_separable_conv2d/list.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace depthwise_separable_conv2d
+{
+/** Number of output columns computed together by the pointwise micro-kernels */
+constexpr int pointwise_block_width = 4;
+/** Number of output channels accumulated together by the quantized pointwise micro-kernel */
+constexpr int pointwise_block_channels = 64;
+
+/** Range of the input rows or columns covered by the kernel taps for a single output row or column */
+struct KernelTaps
+{
+    int first_tap{0}; /**< First kernel tap that lands inside the input */
+    int last_tap{0};  /**< One past the last kernel tap that lands inside the input */
+    int start{0};     /**< Input coordinate of the first kernel tap, can be negative */
+};
+
+inline KernelTaps compute_kernel_taps(int out_coord, int stride, int pad, int dilation, int kernel_size, int input_size)
+{
+    KernelTaps taps;
+    taps.start     = out_coord * stride - pad;
+    taps.first_tap = 0;
+    taps.last_tap  = kernel_size;
+    while (taps.first_tap < kernel_size && taps.start + taps.first_tap * dilation < 0)
+    {
+        ++taps.first_tap;
+    }
+    while (taps.last_tap > taps.first_tap && taps.start + (taps.last_tap - 1) * dilation >= input_size)
+    {
+        --taps.last_tap;
+    }
+    return taps;
+}
+
+/** Bounds of the activations that can be fused as a clamp, in the float domain */
+inline std::pair<float, float> get_float_activation_bounds(const ActivationLayerInfo &act_info)
+{
+    float lower = -std::numeric_limits<float>::infinity();
+    float upper = std::numeric_limits<float>::infinity();
+    if (act_info.enabled())
+    {
+        switch (act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                lower = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                lower = 0.f;
+                upper = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                lower = act_info.b();
+                upper = act_info.a();
+                break;
+            default:
+                break;
+        }
+    }
+    return std::make_pair(lower, upper);
+}
+
+/** Bounds of the activations that can be fused as a clamp, in the quantized domain of @p qinfo */
+template <typename T>
+std::pair<T, T> get_quantized_activation_bounds(const ActivationLayerInfo &act_info, const QuantizationInfo &qinfo)
+{
+    const DataType data_type = std::is_same<T, uint8_t>::value ? DataType::QASYMM8 : DataType::QASYMM8_SIGNED;
+    int32_t        lower     = std::numeric_limits<T>::lowest();
+    int32_t        upper     = std::numeric_limits<T>::max();
+    if (act_info.enabled() && act_info.activation() != ActivationLayerInfo::ActivationFunction::IDENTITY)
+    {
+        std::tie(lower, upper) = get_quantized_activation_min_max(act_info, data_type, qinfo.uniform());
+    }
+    return std::make_pair(static_cast<T>(lower), static_cast<T>(upper));
+}
+
+template <typename T>
+T *packed_ptr(const ITensor *packed, size_t offset)
+{
+    return reinterpret_cast<T *>(packed->buffer() + packed->info()->offset_first_element_in_bytes() + offset);
+}
+
+template <typename T>
+void pack_weights_float(const ITensor      *dw_weights,
+                        const ITensor      *dw_biases,
+                        const ITensor      *pw_weights,
+                        const ITensor      *pw_biases,
+                        ITensor            *packed,
+                        const PackedLayout &layout)
+{
+    const int channels     = layout.channels;
+    const int out_channels = layout.out_channels;
+
+    T *dw_w = packed_ptr<T>(packed, layout.dw_weights_offset);
+    T *dw_b = packed_ptr<T>(packed, layout.dw_biases_offset);
+    T *pw_w = packed_ptr<T>(packed, layout.pw_weights_offset);
+    T *pw_b = packed_ptr<T>(packed, layout.pw_biases_offset);
+
+    // Depthwise weights are stored tap by tap, with the channels innermost
+    for (size_t ky = 0; ky < layout.kernel_height; ++ky)
+    {
+        for (size_t kx = 0; kx < layout.kernel_width; ++kx)
+        {
+            T *dst_tap = dw_w + (ky * layout.kernel_width + kx) * channels;
+            for (int c = 0; c < channels; ++c)
+            {
+                dst_tap[c] = *reinterpret_cast<const T *>(dw_weights->ptr_to_element(Coordinates(c, kx, ky)));
+            }
+        }
+    }
+    for (int c = 0; c < channels; ++c)
+    {
+        dw_b[c] = dw_biases != nullptr ? *reinterpret_cast<const T *>(dw_biases->ptr_to_element(Coordinates(c)))
+                                       : static_cast<T>(0);
+    }
+
+    // Pointwise weights are transposed so that the output channels are innermost
+    for (int c = 0; c < channels; ++c)
+    {
+        for (int oc = 0; oc < out_channels; ++oc)
+        {
+            pw_w[c * out_channels + oc] =
+                *reinterpret_cast<const T *>(pw_weights->ptr_to_element(Coordinates(c, 0, 0, oc)));
+        }
+    }
+    for (int oc = 0; oc < out_channels; ++oc)
+    {
+        pw_b[oc] = pw_biases != nullptr ? *reinterpret_cast<const T *>(pw_biases->ptr_to_element(Coordinates(oc)))
+                                        : static_cast<T>(0);
+    }
+}
+
+/** Reads a quantized weight with its offset removed */
+template <typename T>
+int32_t read_quantized_weight(const ITensor *weights, const Coordinates &coords, int32_t offset)
+{
+    if (weights->info()->data_type() == DataType::QSYMM8_PER_CHANNEL)
+    {
+        return *reinterpret_cast<const int8_t *>(weights->ptr_to_element(coords));
+    }
+    return static_cast<int32_t>(*reinterpret_cast<const T *>(weights->ptr_to_element(coords))) - offset;
+}
+
+/** Computes the requantization parameters of every channel of a stage */
+inline void compute_requantization(const QuantizationInfo &src_qinfo,
+                                   const QuantizationInfo &weights_qinfo,
+                                   const QuantizationInfo &dst_qinfo,
+                                   int                     num_channels,
+                                   int32_t                *multipliers,
+                                   int32_t                *shifts)
+{
+    const bool  per_channel = weights_qinfo.scale().size() > 1;
+    const float src_scale   = src_qinfo.uniform().scale;
+    const float dst_scale   = dst_qinfo.uniform().scale;
+    for (int c = 0; c < num_channels; ++c)
+    {
+        const float weights_scale = per_channel ? weights_qinfo.scale()[c] : weights_qinfo.uniform().scale;
+        quantization::calculate_quantized_multiplier(src_scale * weights_scale / dst_scale, multipliers + c,
+                                                     shifts + c);
+    }
+}
+
+template <typename T>
+void pack_weights_quantized(const ITensor                      *dw_weights,
+                            const ITensor                      *dw_biases,
+                            const ITensor                      *pw_weights,
+                            const ITensor                      *pw_biases,
+                            ITensor                            *packed,
+                            const QuantizationInfo             &src_qinfo,
+                            const QuantizationInfo             &dst_qinfo,
+                            const DepthwiseSeparableConv2dInfo &info,
+                            const PackedLayout                 &layout)
+{
+    const int channels     = layout.channels;
+    const int out_channels = layout.out_channels;
+
+    int32_t *dw_w     = packed_ptr<int32_t>(packed, layout.dw_weights_offset);
+    int32_t *dw_b     = packed_ptr<int32_t>(packed, layout.dw_biases_offset);
+    int32_t *dw_mult  = packed_ptr<int32_t>(packed, layout.dw_multipliers_offset);
+    int32_t *dw_shift = packed_ptr<int32_t>(packed, layout.dw_shifts_offset);
+    int16_t *pw_w     = packed_ptr<int16_t>(packed, layout.pw_weights_offset);
+    int32_t *pw_b     = packed_ptr<int32_t>(packed, layout.pw_biases_offset);
+    int32_t *pw_mult  = packed_ptr<int32_t>(packed, layout.pw_multipliers_offset);
+    int32_t *pw_shift = packed_ptr<int32_t>(packed, layout.pw_shifts_offset);
+
+    const int32_t dw_offset = dw_weights->info()->quantization_info().uniform().offset;
+    const int32_t pw_offset = pw_weights->info()->quantization_info().uniform().offset;
+
+    for (size_t ky = 0; ky < layout.kernel_height; ++ky)
+    {
+        for (size_t kx = 0; kx < layout.kernel_width; ++kx)
+        {
+            int32_t *dst_tap = dw_w + (ky * layout.kernel_width + kx) * channels;
+            for (int c = 0; c < channels; ++c)
+            {
+                dst_tap[c] = read_quantized_weight<T>(dw_weights, Coordinates(c, kx, ky), dw_offset);
+            }
+        }
+    }
+    for (int c = 0; c < channels; ++c)
+    {
+        dw_b[c] = dw_biases != nullptr ? *reinterpret_cast<const int32_t *>(dw_biases->ptr_to_element(Coordinates(c)))
+                                       : 0;
+    }
+    compute_requantization(src_qinfo, dw_weights->info()->quantization_info(), info.dw_output_qinfo, channels,
+                           dw_mult, dw_shift);
+
+    for (int c = 0; c < channels; ++c)
+    {
+        for (int oc = 0; oc < out_channels; ++oc)
+        {
+            pw_w[c * out_channels + oc] =
+                static_cast<int16_t>(read_quantized_weight<T>(pw_weights, Coordinates(c, 0, 0, oc), pw_offset));
+        }
+    }
+    for (int oc = 0; oc < out_channels; ++oc)
+    {
+        pw_b[oc] = pw_biases != nullptr
+                       ? *reinterpret_cast<const int32_t *>(pw_biases->ptr_to_element(Coordinates(oc)))
+                       : 0;
+    }
+    compute_requantization(info.dw_output_qinfo, pw_weights->info()->quantization_info(), dst_qinfo, out_channels,
+                           pw_mult, pw_shift);
+}
+
+/** Pointwise stage for a tile of depthwise outputs
+ *
+ * Every output channel block keeps its weights panel in the cache while it sweeps the tile,
+ * and every block of @ref pointwise_block_width columns is accumulated in registers.
+ */
+template <typename T>
+void pointwise_tile_float(const T *tile,
+                          int      tile_width,
+                          int      channels,
+                          int      out_channels,
+                          const T *weights,
+                          const T *biases,
+                          uint8_t *dst_row,
+                          size_t   dst_stride_w,
+                          T        act_lower,
+                          T        act_upper)
+{
+    using VectorType             = wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128>;
+    using TagType                = wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step           = 16 / sizeof(T);
+    const VectorType vlower      = wrapper::vdup_n(act_lower, TagType{});
+    const VectorType vupper      = wrapper::vdup_n(act_upper, TagType{});
+    const auto       dst_element = [&](int x, int oc)
+    { return reinterpret_cast<T *>(dst_row + x * dst_stride_w) + oc; };
+
+    int oc = 0;
+    for (; oc <= out_channels - step; oc += step)
+    {
+        const VectorType vbias = wrapper::vloadq(biases + oc);
+
+        int x = 0;
+        for (; x <= tile_width - pointwise_block_width; x += pointwise_block_width)
+        {
+            const T *t0 = tile + x * channels;
+            const T *t1 = t0 + channels;
+            const T *t2 = t1 + channels;
+            const T *t3 = t2 + channels;
+
+            VectorType acc0 = vbias;
+            VectorType acc1 = vbias;
+            VectorType acc2 = vbias;
+            VectorType acc3 = vbias;
+
+            const T *w = weights + oc;
+            for (int c = 0; c < channels; ++c, w += out_channels)
+            {
+                const VectorType vw = wrapper::vloadq(w);
+                acc0                = wrapper::vmla(acc0, vw, wrapper::vdup_n(t0[c], TagType{}));
+                acc1                = wrapper::vmla(acc1, vw, wrapper::vdup_n(t1[c], TagType{}));
+                acc2                = wrapper::vmla(acc2, vw, wrapper::vdup_n(t2[c], TagType{}));
+                acc3                = wrapper::vmla(acc3, vw, wrapper::vdup_n(t3[c], TagType{}));
+            }
+
+            wrapper::vstore(dst_element(x, oc), wrapper::vmin(wrapper::vmax(acc0, vlower), vupper));
+            wrapper::vstore(dst_element(x + 1, oc), wrapper::vmin(wrapper::vmax(acc1, vlower), vupper));
+            wrapper::vstore(dst_element(x + 2, oc), wrapper::vmin(wrapper::vmax(acc2, vlower), vupper));
+            wrapper::vstore(dst_element(x + 3, oc), wrapper::vmin(wrapper::vmax(acc3, vlower), vupper));
+        }
+        for (; x < tile_width; ++x)
+        {
+            const T   *t   = tile + x * channels;
+            VectorType acc = vbias;
+            const T   *w   = weights + oc;
+            for (int c = 0; c < channels; ++c, w += out_channels)
+            {
+                acc = wrapper::vmla(acc, wrapper::vloadq(w), wrapper::vdup_n(t[c], TagType{}));
+            }
+            wrapper::vstore(dst_element(x, oc), wrapper::vmin(wrapper::vmax(acc, vlower), vupper));
+        }
+    }
+
+    // Left-over output channels
+    for (; oc < out_channels; ++oc)
+    {
+        for (int x = 0; x < tile_width; ++x)
+        {
+            const T *t   = tile + x * channels;
+            T        acc = biases[oc];
+            for (int c = 0; c < channels; ++c)
+            {
+                acc += t[c] * weights[c * out_channels + oc];
+            }
+            *dst_element(x, oc) = std::min(std::max(acc, act_lower), act_upper);
+        }
+    }
+}
+
+template <typename T>
+void depthwise_separable_conv2d_float(const ITensor                      *src,
+                                      const ITensor                      *packed,
+                                      ITensor                            *dst,
+                                      ITensor                            *workspace,
+                                      const DepthwiseSeparableConv2dInfo &info,
+                                      const PackedLayout                 &layout,
+                                      const Window                        &window,
+                                      const ThreadInfo                   &thread_info)
+{
+    using VectorType   = wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128>;
+    using TagType      = wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step = 16 / sizeof(T);
+
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int channels      = layout.channels;
+    const int out_channels  = layout.out_channels;
+    const int kernel_width  = layout.kernel_width;
+    const int kernel_height = layout.kernel_height;
+    const int tile_width    = layout.tile_width;
+    const int src_width     = src_info->dimension(1);
+    const int src_height    = src_info->dimension(2);
+    const int dst_width     = dst_info->dimension(1);
+
+    const int stride_x   = info.dw_conv_info.stride().first;
+    const int stride_y   = info.dw_conv_info.stride().second;
+    const int pad_left   = info.dw_conv_info.pad_left();
+    const int pad_top    = info.dw_conv_info.pad_top();
+    const int dilation_x = info.dw_dilation.x();
+    const int dilation_y = info.dw_dilation.y();
+
+    const size_t src_stride_w = src_info->strides_in_bytes()[1];
+    const size_t src_stride_h = src_info->strides_in_bytes()[2];
+    const size_t src_stride_n = src_info->strides_in_bytes()[3];
+    const size_t dst_stride_w = dst_info->strides_in_bytes()[1];
+    const size_t dst_stride_h = dst_info->strides_in_bytes()[2];
+    const size_t dst_stride_n = dst_info->strides_in_bytes()[3];
+
+    const T *dw_weights = packed_ptr<T>(packed, layout.dw_weights_offset);
+    const T *dw_biases  = packed_ptr<T>(packed, layout.dw_biases_offset);
+    const T *pw_weights = packed_ptr<T>(packed, layout.pw_weights_offset);
+    const T *pw_biases  = packed_ptr<T>(packed, layout.pw_biases_offset);
+
+    T *tile = packed_ptr<T>(workspace, thread_info.thread_id * layout.workspace_size + layout.tile_offset);
+
+    const auto dw_bounds = get_float_activation_bounds(info.dw_act_info);
+    const auto pw_bounds = get_float_activation_bounds(info.pw_act_info);
+    const T    dw_lower  = static_cast<T>(dw_bounds.first);
+    const T    dw_upper  = static_cast<T>(dw_bounds.second);
+
+    const VectorType vdw_lower = wrapper::vdup_n(dw_lower, TagType{});
+    const VectorType vdw_upper = wrapper::vdup_n(dw_upper, TagType{});
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int      out_y = id.z();
+            const uint8_t *src_batch =
+                src->buffer() + src_info->offset_first_element_in_bytes() + id[3] * src_stride_n;
+            uint8_t *dst_row =
+                dst->buffer() + dst_info->offset_first_element_in_bytes() + out_y * dst_stride_h + id[3] * dst_stride_n;
+
+            const KernelTaps taps_y =
+                compute_kernel_taps(out_y, stride_y, pad_top, dilation_y, kernel_height, src_height);
+
+            for (int x_start = 0; x_start < dst_width; x_start += tile_width)
+            {
+                const int x_end = std::min(x_start + tile_width, dst_width);
+
+                // Depthwise stage: fill the tile with activated depthwise outputs
+                for (int out_x = x_start; out_x < x_end; ++out_x)
+                {
+                    const KernelTaps taps_x =
+                        compute_kernel_taps(out_x, stride_x, pad_left, dilation_x, kernel_width, src_width);
+                    T *tile_column = tile + (out_x - x_start) * channels;
+
+                    int c = 0;
+                    for (; c <= channels - step; c += step)
+                    {
+                        VectorType acc = wrapper::vloadq(dw_biases + c);
+                        for (int ky = taps_y.first_tap; ky < taps_y.last_tap; ++ky)
+                        {
+                            const uint8_t *src_row = src_batch + (taps_y.start + ky * dilation_y) * src_stride_h;
+                            for (int kx = taps_x.first_tap; kx < taps_x.last_tap; ++kx)
+                            {
+                                const T *in = reinterpret_cast<const T *>(
+                                    src_row + (taps_x.start + kx * dilation_x) * src_stride_w);
+                                const T *w = dw_weights + (ky * kernel_width + kx) * channels;
+                                acc        = wrapper::vmla(acc, wrapper::vloadq(in + c), wrapper::vloadq(w + c));
+                            }
+                        }
+                        wrapper::vstore(tile_column + c, wrapper::vmin(wrapper::vmax(acc, vdw_lower), vdw_upper));
+                    }
+                    for (; c < channels; ++c)
+                    {
+                        T acc = dw_biases[c];
+                        for (int ky = taps_y.first_tap; ky < taps_y.last_tap; ++ky)
+                        {
+                            const uint8_t *src_row = src_batch + (taps_y.start + ky * dilation_y) * src_stride_h;
+                            for (int kx = taps_x.first_tap; kx < taps_x.last_tap; ++kx)
+                            {
+                                const T *in = reinterpret_cast<const T *>(
+                                    src_row + (taps_x.start + kx * dilation_x) * src_stride_w);
+                                acc += in[c] * dw_weights[(ky * kernel_width + kx) * channels + c];
+                            }
+                        }
+                        tile_column[c] = std::min(std::max(acc, dw_lower), dw_upper);
+                    }
+                }
+
+                // Pointwise stage: consume the tile while it is still in the cache
+                pointwise_tile_float<T>(tile, x_end - x_start, channels, out_channels, pw_weights, pw_biases,
+                                        dst_row + x_start * dst_stride_w, dst_stride_w,
+                                        static_cast<T>(pw_bounds.first), static_cast<T>(pw_bounds.second));
+            }
+        });
+}
+
+template <typename T>
+void depthwise_separable_conv2d_quantized(const ITensor                      *src,
+                                          const ITensor                      *packed,
+                                          ITensor                            *dst,
+                                          ITensor                            *workspace,
+                                          const DepthwiseSeparableConv2dInfo &info,
+                                          const PackedLayout                 &layout,
+                                          const Window                       &window,
+                                          const ThreadInfo                   &thread_info)
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int channels      = layout.channels;
+    const int out_channels  = layout.out_channels;
+    const int kernel_width  = layout.kernel_width;
+    const int kernel_height = layout.kernel_height;
+    const int tile_width    = layout.tile_width;
+    const int src_width     = src_info->dimension(1);
+    const int src_height    = src_info->dimension(2);
+    const int dst_width     = dst_info->dimension(1);
+
+    const int stride_x   = info.dw_conv_info.stride().first;
+    const int stride_y   = info.dw_conv_info.stride().second;
+    const int pad_left   = info.dw_conv_info.pad_left();
+    const int pad_top    = info.dw_conv_info.pad_top();
+    const int dilation_x = info.dw_dilation.x();
+    const int dilation_y = info.dw_dilation.y();
+
+    const size_t src_stride_w = src_info->strides_in_bytes()[1];
+    const size_t src_stride_h = src_info->strides_in_bytes()[2];
+    const size_t src_stride_n = src_info->strides_in_bytes()[3];
+    const size_t dst_stride_w = dst_info->strides_in_bytes()[1];
+    const size_t dst_stride_h = dst_info->strides_in_bytes()[2];
+    const size_t dst_stride_n = dst_info->strides_in_bytes()[3];
+
+    const int32_t src_offset = src_info->quantization_info().uniform().offset;
+    const int32_t mid_offset = info.dw_output_qinfo.uniform().offset;
+    const int32_t dst_offset = dst_info->quantization_info().uniform().offset;
+
+    const int32_t *dw_weights     = packed_ptr<int32_t>(packed, layout.dw_weights_offset);
+    const int32_t *dw_biases      = packed_ptr<int32_t>(packed, layout.dw_biases_offset);
+    const int32_t *dw_multipliers = packed_ptr<int32_t>(packed, layout.dw_multipliers_offset);
+    const int32_t *dw_shifts      = packed_ptr<int32_t>(packed, layout.dw_shifts_offset);
+    const int16_t *pw_weights     = packed_ptr<int16_t>(packed, layout.pw_weights_offset);
+    const int32_t *pw_biases      = packed_ptr<int32_t>(packed, layout.pw_biases_offset);
+    const int32_t *pw_multipliers = packed_ptr<int32_t>(packed, layout.pw_multipliers_offset);
+    const int32_t *pw_shifts      = packed_ptr<int32_t>(packed, layout.pw_shifts_offset);
+
+    const size_t thread_offset = thread_info.thread_id * layout.workspace_size;
+    int16_t     *tile          = packed_ptr<int16_t>(workspace, thread_offset + layout.tile_offset);
+    int32_t     *dw_acc        = packed_ptr<int32_t>(workspace, thread_offset + layout.accumulators_offset);
+
+    const auto dw_bounds = get_quantized_activation_bounds<T>(info.dw_act_info, info.dw_output_qinfo);
+    const auto pw_bounds = get_quantized_activation_bounds<T>(info.pw_act_info, dst_info->quantization_info());
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int      out_y = id.z();
+            const uint8_t *src_batch =
+                src->buffer() + src_info->offset_first_element_in_bytes() + id[3] * src_stride_n;
+            uint8_t *dst_row =
+                dst->buffer() + dst_info->offset_first_element_in_bytes() + out_y * dst_stride_h + id[3] * dst_stride_n;
+
+            const KernelTaps taps_y =
+                compute_kernel_taps(out_y, stride_y, pad_top, dilation_y, kernel_height, src_height);
+
+            for (int x_start = 0; x_start < dst_width; x_start += tile_width)
+            {
+                const int x_end = std::min(x_start + tile_width, dst_width);
+
+                // Depthwise stage: the outputs are requantized to the intermediate quantization and stored in the tile
+                // with their offset removed, ready to be multiplied by the pointwise weights
+                for (int out_x = x_start; out_x < x_end; ++out_x)
+                {
+                    const KernelTaps taps_x =
+                        compute_kernel_taps(out_x, stride_x, pad_left, dilation_x, kernel_width, src_width);
+
+                    std::copy_n(dw_biases, channels, dw_acc);
+                    for (int ky = taps_y.first_tap; ky < taps_y.last_tap; ++ky)
+                    {
+                        const uint8_t *src_row = src_batch + (taps_y.start + ky * dilation_y) * src_stride_h;
+                        for (int kx = taps_x.first_tap; kx < taps_x.last_tap; ++kx)
+                        {
+                            const T *in =
+                                reinterpret_cast<const T *>(src_row + (taps_x.start + kx * dilation_x) * src_stride_w);
+                            const int32_t *w = dw_weights + (ky * kernel_width + kx) * channels;
+                            for (int c = 0; c < channels; ++c)
+                            {
+                                dw_acc[c] += (static_cast<int32_t>(in[c]) - src_offset) * w[c];
+                            }
+                        }
+                    }
+
+                    int16_t *tile_column = tile + (out_x - x_start) * channels;
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        const T out = finalize_quantization(dw_acc[c], dw_multipliers[c], dw_shifts[c], mid_offset,
+                                                            dw_bounds.first, dw_bounds.second, true);
+                        tile_column[c] = static_cast<int16_t>(static_cast<int32_t>(out) - mid_offset);
+                    }
+                }
+
+                // Pointwise stage: accumulate blocks of columns and output channels in a small local buffer
+                const int tile_len = x_end - x_start;
+                int32_t   acc[pointwise_block_width][pointwise_block_channels];
+                for (int oc_start = 0; oc_start < out_channels; oc_start += pointwise_block_channels)
+                {
+                    const int oc_len = std::min(pointwise_block_channels, out_channels - oc_start);
+                    for (int x = 0; x < tile_len; x += pointwise_block_width)
+                    {
+                        const int x_len = std::min(pointwise_block_width, tile_len - x);
+                        for (int i = 0; i < x_len; ++i)
+                        {
+                            std::copy_n(pw_biases + oc_start, oc_len, acc[i]);
+                        }
+                        for (int c = 0; c < channels; ++c)
+                        {
+                            const int16_t *w = pw_weights + c * out_channels + oc_start;
+                            for (int i = 0; i < x_len; ++i)
+                            {
+                                const int32_t in = tile[(x + i) * channels + c];
+                                for (int j = 0; j < oc_len; ++j)
+                                {
+                                    acc[i][j] += in * w[j];
+                                }
+                            }
+                        }
+                        for (int i = 0; i < x_len; ++i)
+                        {
+                            T *out = reinterpret_cast<T *>(dst_row + (x_start + x + i) * dst_stride_w) + oc_start;
+                            for (int j = 0; j < oc_len; ++j)
+                            {
+                                out[j] = finalize_quantization(acc[i][j], pw_multipliers[oc_start + j],
+                                                               pw_shifts[oc_start + j], dst_offset, pw_bounds.first,
+                                                               pw_bounds.second, true);
+                            }
+                        }
+                    }
+                }
+            }
+        });
+}
+} // namespace depthwise_separable_conv2d
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_DEPTHWISE_SEPARABLE_CONV2D_GENERIC_NEON_IMPL_H
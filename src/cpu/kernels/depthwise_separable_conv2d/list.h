@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_DEPTHWISE_SEPARABLE_CONV2D_LIST_H
+#define ACL_SRC_CPU_KERNELS_DEPTHWISE_SEPARABLE_CONV2D_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/cpu/kernels/CpuDepthwiseSeparableConv2dKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace depthwise_separable_conv2d
+{
+using PackedLayout = kernels::CpuDepthwiseSeparableConv2dKernel::PackedLayout;
+} // namespace depthwise_separable_conv2d
+
+#define DECLARE_DEPTHWISE_SEPARABLE_PACK_WEIGHTS(func_name)                                                          \
+    void func_name(const ITensor *dw_weights, const ITensor *dw_biases, const ITensor *pw_weights,                   \
+                   const ITensor *pw_biases, ITensor *packed, const QuantizationInfo &src_qinfo,                     \
+                   const QuantizationInfo &dst_qinfo, const DepthwiseSeparableConv2dInfo &info,                      \
+                   const depthwise_separable_conv2d::PackedLayout &layout)
+
+#define DECLARE_DEPTHWISE_SEPARABLE_CONV2D_KERNEL(func_name)                                                         \
+    void func_name(const ITensor *src, const ITensor *packed, ITensor *dst, ITensor *workspace,                      \
+                   const DepthwiseSeparableConv2dInfo &info, const depthwise_separable_conv2d::PackedLayout &layout, \
+                   const Window &window, const ThreadInfo &thread_info)
+
+DECLARE_DEPTHWISE_SEPARABLE_PACK_WEIGHTS(neon_fp32_depthwise_separable_pack_weights);
+DECLARE_DEPTHWISE_SEPARABLE_PACK_WEIGHTS(neon_fp16_depthwise_separable_pack_weights);
+DECLARE_DEPTHWISE_SEPARABLE_PACK_WEIGHTS(neon_qasymm8_depthwise_separable_pack_weights);
+DECLARE_DEPTHWISE_SEPARABLE_PACK_WEIGHTS(neon_qasymm8_signed_depthwise_separable_pack_weights);
+
+DECLARE_DEPTHWISE_SEPARABLE_CONV2D_KERNEL(neon_fp32_depthwise_separable_conv2d);
+DECLARE_DEPTHWISE_SEPARABLE_CONV2D_KERNEL(neon_fp16_depthwise_separable_conv2d);
+DECLARE_DEPTHWISE_SEPARABLE_CONV2D_KERNEL(neon_qasymm8_depthwise_separable_conv2d);
+DECLARE_DEPTHWISE_SEPARABLE_CONV2D_KERNEL(neon_qasymm8_signed_depthwise_separable_conv2d);
+
+#undef DECLARE_DEPTHWISE_SEPARABLE_PACK_WEIGHTS
+#undef DECLARE_DEPTHWISE_SEPARABLE_CONV2D_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_DEPTHWISE_SEPARABLE_CONV2D_LIST_H
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_DYNAMIC_QUANTIZE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_DYNAMIC_QUANTIZE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/dynamic_quantize/generic/neon/list.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+template <typename T>
+inline float32x4x4_t load_as_f32(const T *ptr);
+
+template <>
+inline float32x4x4_t load_as_f32<float>(const float *ptr)
+{
+    return {{wrapper::vloadq(ptr), wrapper::vloadq(ptr + 4), wrapper::vloadq(ptr + 8), wrapper::vloadq(ptr + 12)}};
+}
+
+template <typename T>
+inline void store_from_f32(T *ptr, const float32x4x2_t &v);
+
+template <>
+inline void store_from_f32<float>(float *ptr, const float32x4x2_t &v)
+{
+    wrapper::vstore(ptr, v.val[0]);
+    wrapper::vstore(ptr + 4, v.val[1]);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template <>
+inline float32x4x4_t load_as_f32<float16_t>(const float16_t *ptr)
+{
+    const float16x8_t lo = vld1q_f16(ptr);
+    const float16x8_t hi = vld1q_f16(ptr + 8);
+    return {{vcvt_f32_f16(vget_low_f16(lo)), vcvt_f32_f16(vget_high_f16(lo)), vcvt_f32_f16(vget_low_f16(hi)),
+             vcvt_f32_f16(vget_high_f16(hi))}};
+}
+
+template <>
+inline void store_from_f32<float16_t>(float16_t *ptr, const float32x4x2_t &v)
+{
+    vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+inline float32x4_t load_bias_as_f32(const float *ptr)
+{
+    return wrapper::vloadq(ptr);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_bias_as_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+/** Quantize each row of @p src to int8 with its own symmetric scale
+ *
+ * Every row is read twice: once to find its absolute maximum and once to quantize it.
+ * A row is a single token/sample, so the second pass hits the cache.
+ */
+template <typename T>
+void run_dynamic_quantization(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+{
+    const int window_step_x = 16;
+    const int width         = static_cast<int>(src->info()->dimension(0));
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in(src, win);
+    Iterator out(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto in_ptr  = reinterpret_cast<const T *>(in.ptr());
+            const auto out_ptr = reinterpret_cast<int8_t *>(out.ptr());
+
+            // Absolute maximum of the row
+            float32x4_t vmax = vdupq_n_f32(0.f);
+            int         x    = 0;
+            for (; x <= (width - window_step_x); x += window_step_x)
+            {
+                const float32x4x4_t v = load_as_f32(in_ptr + x);
+                vmax = vmaxq_f32(vmax, vmaxq_f32(vmaxq_f32(vabsq_f32(v.val[0]), vabsq_f32(v.val[1])),
+                                                 vmaxq_f32(vabsq_f32(v.val[2]), vabsq_f32(v.val[3]))));
+            }
+            float32x2_t vmax2  = vpmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
+            vmax2              = vpmax_f32(vmax2, vmax2);
+            float       absmax = vget_lane_f32(vmax2, 0);
+            for (; x < width; ++x)
+            {
+                absmax = std::max(absmax, std::abs(static_cast<float>(in_ptr[x])));
+            }
+
+            // A row of zeros can use any scale
+            const float                   scale = absmax > 0.f ? absmax / 127.f : 1.f;
+            const UniformQuantizationInfo qinfo(scale, 0);
+            *reinterpret_cast<float *>(scales->ptr_to_element(Coordinates(id.y()))) = scale;
+
+            // Quantize the row
+            for (x = 0; x <= (width - window_step_x); x += window_step_x)
+            {
+                wrapper::vstore(out_ptr + x, vquantize_signed(load_as_f32(in_ptr + x), qinfo));
+            }
+            for (; x < width; ++x)
+            {
+                out_ptr[x] = quantize_qasymm8_signed(static_cast<float>(in_ptr[x]), qinfo);
+            }
+        },
+        in, out);
+}
+
+/** Dequantize int32 accumulators using the per-row scales of the activations and the per-channel scales of the weights
+ *
+ * The bias, if any, is added in floating point and the result is clamped to [@p min_bound, @p max_bound].
+ */
+template <typename T>
+void run_dynamic_dequantization(const ITensor *src,
+                                const ITensor *src_scales,
+                                const float   *weights_scales,
+                                const ITensor *bias,
+                                ITensor       *dst,
+                                float          min_bound,
+                                float          max_bound,
+                                const Window  &window)
+{
+    const int window_step_x = 8;
+    const int width         = static_cast<int>(src->info()->dimension(0));
+
+    const float32x4_t vmin = vdupq_n_f32(min_bound);
+    const float32x4_t vmax = vdupq_n_f32(max_bound);
+
+    const T *bias_ptr =
+        bias != nullptr ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                        : nullptr;
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in(src, win);
+    Iterator out(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto  in_ptr    = reinterpret_cast<const int32_t *>(in.ptr());
+            const auto  out_ptr   = reinterpret_cast<T *>(out.ptr());
+            const float row_scale = *reinterpret_cast<const float *>(src_scales->ptr_to_element(Coordinates(id.y())));
+
+            int x = 0;
+            for (; x <= (width - window_step_x); x += window_step_x)
+            {
+                float32x4x2_t v = {{vcvtq_f32_s32(wrapper::vloadq(in_ptr + x)),
+                                    vcvtq_f32_s32(wrapper::vloadq(in_ptr + x + 4))}};
+
+                v.val[0] = vmulq_f32(v.val[0], vmulq_n_f32(wrapper::vloadq(weights_scales + x), row_scale));
+                v.val[1] = vmulq_f32(v.val[1], vmulq_n_f32(wrapper::vloadq(weights_scales + x + 4), row_scale));
+                if (bias_ptr != nullptr)
+                {
+                    v.val[0] = vaddq_f32(v.val[0], load_bias_as_f32(bias_ptr + x));
+                    v.val[1] = vaddq_f32(v.val[1], load_bias_as_f32(bias_ptr + x + 4));
+                }
+                v.val[0] = vminq_f32(vmaxq_f32(v.val[0], vmin), vmax);
+                v.val[1] = vminq_f32(vmaxq_f32(v.val[1], vmin), vmax);
+
+                store_from_f32(out_ptr + x, v);
+            }
+
+            // Compute left-over elements
+            for (; x < width; ++x)
+            {
+                float res = static_cast<float>(in_ptr[x]) * row_scale * weights_scales[x];
+                if (bias_ptr != nullptr)
+                {
+                    res += static_cast<float>(bias_ptr[x]);
+                }
+                out_ptr[x] = static_cast<T>(std::min(std::max(res, min_bound), max_bound));
+            }
+        },
+        in, out);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_DYNAMIC_QUANTIZE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ELEMENTWISE_FUSION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ELEMENTWISE_FUSION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseFusionInfo.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/CpuTypes.h"
+#include "src/cpu/kernels/activation/generic/neon/fp_impl.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace elementwise_fusion
+{
+/** Number of elements processed per tile. Every live value of a tile stays in L1 (max_values * 256 bytes) */
+constexpr int tile_size = 64;
+
+/** Activation parameters used when running activations on F32 tiles */
+constexpr ActFpImplParams act_params = {static_cast<float>(1e-24), 4};
+
+/** Load a tile from an F32 tensor row
+ *
+ * Non broadcast rows are not copied: the returned pointer aliases the source.
+ */
+inline const float *
+load_tile(const float *src, bool broadcast, int n, float *tile, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    if (!broadcast)
+    {
+        return src;
+    }
+    std::fill_n(tile, n, *src);
+    return tile;
+}
+
+/** Load and dequantize a tile from a QASYMM8 tensor row */
+inline const float *
+load_tile(const uint8_t *src, bool broadcast, int n, float *tile, const UniformQuantizationInfo &qinfo)
+{
+    if (broadcast)
+    {
+        std::fill_n(tile, n, dequantize_qasymm8(*src, qinfo));
+        return tile;
+    }
+    int x = 0;
+    for (; x <= n - 16; x += 16)
+    {
+        const float32x4x4_t v = vdequantize(wrapper::vloadq(src + x), qinfo);
+        vst1q_f32(tile + x, v.val[0]);
+        vst1q_f32(tile + x + 4, v.val[1]);
+        vst1q_f32(tile + x + 8, v.val[2]);
+        vst1q_f32(tile + x + 12, v.val[3]);
+    }
+    for (; x < n; ++x)
+    {
+        tile[x] = dequantize_qasymm8(src[x], qinfo);
+    }
+    return tile;
+}
+
+/** Load and dequantize a tile from a QASYMM8_SIGNED tensor row */
+inline const float *
+load_tile(const int8_t *src, bool broadcast, int n, float *tile, const UniformQuantizationInfo &qinfo)
+{
+    if (broadcast)
+    {
+        std::fill_n(tile, n, dequantize_qasymm8_signed(*src, qinfo));
+        return tile;
+    }
+    int x = 0;
+    for (; x <= n - 16; x += 16)
+    {
+        const float32x4x4_t v = vdequantize(wrapper::vloadq(src + x), qinfo);
+        vst1q_f32(tile + x, v.val[0]);
+        vst1q_f32(tile + x + 4, v.val[1]);
+        vst1q_f32(tile + x + 8, v.val[2]);
+        vst1q_f32(tile + x + 12, v.val[3]);
+    }
+    for (; x < n; ++x)
+    {
+        tile[x] = dequantize_qasymm8_signed(src[x], qinfo);
+    }
+    return tile;
+}
+
+/** Quantize and store a tile to a QASYMM8 tensor row */
+inline void store_tile(uint8_t *dst, int n, const float *tile, const UniformQuantizationInfo &qinfo)
+{
+    int x = 0;
+    for (; x <= n - 16; x += 16)
+    {
+        const float32x4x4_t v = {{vld1q_f32(tile + x), vld1q_f32(tile + x + 4), vld1q_f32(tile + x + 8),
+                                  vld1q_f32(tile + x + 12)}};
+        wrapper::vstore(dst + x, vquantize(v, qinfo));
+    }
+    for (; x < n; ++x)
+    {
+        dst[x] = quantize_qasymm8(tile[x], qinfo);
+    }
+}
+
+/** Quantize and store a tile to a QASYMM8_SIGNED tensor row */
+inline void store_tile(int8_t *dst, int n, const float *tile, const UniformQuantizationInfo &qinfo)
+{
+    int x = 0;
+    for (; x <= n - 16; x += 16)
+    {
+        const float32x4x4_t v = {{vld1q_f32(tile + x), vld1q_f32(tile + x + 4), vld1q_f32(tile + x + 8),
+                                  vld1q_f32(tile + x + 12)}};
+        wrapper::vstore(dst + x, vquantize_signed(v, qinfo));
+    }
+    for (; x < n; ++x)
+    {
+        dst[x] = quantize_qasymm8_signed(tile[x], qinfo);
+    }
+}
+
+/** Store a tile to an F32 tensor row */
+inline void store_tile(float *dst, int n, const float *tile, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    if (dst != tile)
+    {
+        std::copy_n(tile, n, dst);
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+/** Load and widen a tile from an F16 tensor row */
+inline const float *
+load_tile(const float16_t *src, bool broadcast, int n, float *tile, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    if (broadcast)
+    {
+        std::fill_n(tile, n, static_cast<float>(*src));
+        return tile;
+    }
+    int x = 0;
+    for (; x <= n - 4; x += 4)
+    {
+        vst1q_f32(tile + x, vcvt_f32_f16(vld1_f16(src + x)));
+    }
+    for (; x < n; ++x)
+    {
+        tile[x] = static_cast<float>(src[x]);
+    }
+    return tile;
+}
+
+/** Narrow and store a tile to an F16 tensor row */
+inline void store_tile(float16_t *dst, int n, const float *tile, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    int x = 0;
+    for (; x <= n - 4; x += 4)
+    {
+        vst1_f16(dst + x, vcvt_f16_f32(vld1q_f32(tile + x)));
+    }
+    for (; x < n; ++x)
+    {
+        dst[x] = static_cast<float16_t>(tile[x]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Convert a tile to a data type and back to F32 */
+inline void cast_tile(const float *src, float *dst, int n, DataType data_type, const UniformQuantizationInfo &qinfo)
+{
+    switch (data_type)
+    {
+        case DataType::QASYMM8:
+        {
+            uint8_t quantized[tile_size];
+            store_tile(quantized, n, src, qinfo);
+            load_tile(quantized, false, n, dst, qinfo);
+            break;
+        }
+        case DataType::QASYMM8_SIGNED:
+        {
+            int8_t quantized[tile_size];
+            store_tile(quantized, n, src, qinfo);
+            load_tile(quantized, false, n, dst, qinfo);
+            break;
+        }
+        case DataType::F16:
+        {
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+            float16_t narrowed[tile_size];
+            store_tile(narrowed, n, src, qinfo);
+            load_tile(narrowed, false, n, dst, qinfo);
+#else  /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+            for (int x = 0; x < n; ++x)
+            {
+                dst[x] = static_cast<float>(half(src[x]));
+            }
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+            break;
+        }
+        default:
+            if (dst != src)
+            {
+                std::copy_n(src, n, dst);
+            }
+            break;
+    }
+}
+
+/** Run a unary micro-op over a tile */
+template <typename VectorOp, typename ScalarOp>
+inline void unary_loop(const float *src, float *dst, int n, VectorOp &&vop, ScalarOp &&sop)
+{
+    int x = 0;
+    for (; x <= n - 4; x += 4)
+    {
+        vst1q_f32(dst + x, vop(vld1q_f32(src + x)));
+    }
+    for (; x < n; ++x)
+    {
+        dst[x] = sop(src[x]);
+    }
+}
+
+/** Run a binary micro-op over a tile */
+template <typename VectorOp, typename ScalarOp>
+inline void binary_loop(const float *lhs, const float *rhs, float *dst, int n, VectorOp &&vop, ScalarOp &&sop)
+{
+    int x = 0;
+    for (; x <= n - 4; x += 4)
+    {
+        vst1q_f32(dst + x, vop(vld1q_f32(lhs + x), vld1q_f32(rhs + x)));
+    }
+    for (; x < n; ++x)
+    {
+        dst[x] = sop(lhs[x], rhs[x]);
+    }
+}
+
+/** Run a node of the fusion program over a tile */
+inline void run_node(const ElementwiseFusionNode &node, const float *lhs, const float *rhs, float *dst, int n)
+{
+    switch (node.op)
+    {
+        case ElementwiseFusionOp::ADD:
+            binary_loop(
+                lhs, rhs, dst, n, [](float32x4_t a, float32x4_t b) { return vaddq_f32(a, b); },
+                [](float a, float b) { return a + b; });
+            break;
+        case ElementwiseFusionOp::SUB:
+            binary_loop(
+                lhs, rhs, dst, n, [](float32x4_t a, float32x4_t b) { return vsubq_f32(a, b); },
+                [](float a, float b) { return a - b; });
+            break;
+        case ElementwiseFusionOp::MUL:
+            binary_loop(
+                lhs, rhs, dst, n, [](float32x4_t a, float32x4_t b) { return vmulq_f32(a, b); },
+                [](float a, float b) { return a * b; });
+            break;
+        case ElementwiseFusionOp::DIV:
+            binary_loop(
+                lhs, rhs, dst, n, [](float32x4_t a, float32x4_t b) { return wrapper::vdiv(a, b); },
+                [](float a, float b) { return a / b; });
+            break;
+        case ElementwiseFusionOp::MAX:
+            binary_loop(
+                lhs, rhs, dst, n, [](float32x4_t a, float32x4_t b) { return vmaxq_f32(a, b); },
+                [](float a, float b) { return std::max(a, b); });
+            break;
+        case ElementwiseFusionOp::MIN:
+            binary_loop(
+                lhs, rhs, dst, n, [](float32x4_t a, float32x4_t b) { return vminq_f32(a, b); },
+                [](float a, float b) { return std::min(a, b); });
+            break;
+        case ElementwiseFusionOp::SQUARED_DIFF:
+            binary_loop(
+                lhs, rhs, dst, n,
+                [](float32x4_t a, float32x4_t b)
+                {
+                    const float32x4_t diff = vsubq_f32(a, b);
+                    return vmulq_f32(diff, diff);
+                },
+                [](float a, float b) { return (a - b) * (a - b); });
+            break;
+        case ElementwiseFusionOp::ACTIVATION:
+            dispatch_fp_neon_activation_function<float, act_params>(
+                node.act_info.activation(), node.act_info,
+                [&](auto activation_op_vec, auto activation_op_tail)
+                { unary_loop(lhs, dst, n, activation_op_vec, activation_op_tail); });
+            break;
+        case ElementwiseFusionOp::ABS:
+            unary_loop(
+                lhs, dst, n, [](float32x4_t a) { return vabsq_f32(a); }, [](float a) { return std::abs(a); });
+            break;
+        case ElementwiseFusionOp::NEG:
+            unary_loop(
+                lhs, dst, n, [](float32x4_t a) { return vnegq_f32(a); }, [](float a) { return -a; });
+            break;
+        case ElementwiseFusionOp::EXP:
+            unary_loop(
+                lhs, dst, n, [](float32x4_t a) { return vexpq_f32(a); }, [](float a) { return std::exp(a); });
+            break;
+        case ElementwiseFusionOp::RSQRT:
+            unary_loop(
+                lhs, dst, n, [](float32x4_t a) { return vinvsqrtq_f32(a); },
+                [](float a) { return 1.f / std::sqrt(a); });
+            break;
+        case ElementwiseFusionOp::CAST:
+            cast_tile(lhs, dst, n, node.data_type, node.qinfo.uniform());
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported elementwise fusion operation");
+    }
+}
+
+/** Run an elementwise fusion program
+ *
+ * The window is walked row by row and every row is cut into tiles of @ref tile_size elements.
+ * For each tile, the inputs are loaded (and dequantized / widened) into F32 tiles, every node of the
+ * program is run on the tiles, and the result is converted to the destination type and stored.
+ * All the intermediate values of a tile stay in L1, so the whole program costs a single pass over memory.
+ *
+ * @param[in]  srcs     Input tensors. Data type supported: all of type TIn
+ * @param[in]  num_srcs Number of input tensors
+ * @param[out] dst      Destination tensor. Data type supported: TOut
+ * @param[in]  info     Elementwise fusion program
+ * @param[in]  window   Execution window
+ */
+template <typename TIn, typename TOut>
+void elementwise_fusion(const ITensor *const        *srcs,
+                        size_t                       num_srcs,
+                        ITensor                     *dst,
+                        const ElementwiseFusionInfo &info,
+                        const Window                &window)
+{
+    constexpr unsigned int max_values     = ElementwiseFusionInfo::max_values;
+    const auto            &nodes          = info.nodes();
+    const unsigned int     num_values     = info.num_values();
+    const int              window_start_x = static_cast<int>(window.x().start());
+    const int              window_end_x   = static_cast<int>(window.x().end());
+
+    // Precompute the per-dimension strides of each input, with broadcast dimensions having a zero stride
+    std::array<const uint8_t *, max_values>                                 src_base{};
+    std::array<std::array<size_t, Coordinates::num_max_dimensions>, max_values> src_strides{};
+    std::array<bool, max_values>                                            src_broadcast_x{};
+    std::array<UniformQuantizationInfo, max_values>                         src_qinfo{};
+    for (size_t i = 0; i < num_srcs; ++i)
+    {
+        const ITensorInfo *src_info = srcs[i]->info();
+        src_base[i]        = srcs[i]->buffer() + src_info->offset_first_element_in_bytes();
+        src_broadcast_x[i] = src_info->dimension(0) == 1 && dst->info()->dimension(0) > 1;
+        src_qinfo[i]       = src_info->quantization_info().uniform();
+        for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+        {
+            src_strides[i][d] = src_info->tensor_shape()[d] > 1 ? src_info->strides_in_bytes()[d] : 0;
+        }
+    }
+    const UniformQuantizationInfo dst_qinfo = dst->info()->quantization_info().uniform();
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            alignas(16) float                 tiles[max_values][tile_size];
+            std::array<const float *, max_values> values{};
+            std::array<const TIn *, max_values>   rows{};
+            for (size_t i = 0; i < num_srcs; ++i)
+            {
+                size_t offset = 0;
+                for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+                {
+                    offset += id[d] * src_strides[i][d];
+                }
+                rows[i] = reinterpret_cast<const TIn *>(src_base[i] + offset);
+            }
+            const auto output_ptr = reinterpret_cast<TOut *>(output.ptr());
+
+            for (int x = window_start_x; x < window_end_x; x += tile_size)
+            {
+                const int n = std::min(tile_size, window_end_x - x);
+
+                for (size_t i = 0; i < num_srcs; ++i)
+                {
+                    values[i] = load_tile(rows[i] + (src_broadcast_x[i] ? 0 : x), src_broadcast_x[i], n, tiles[i],
+                                          src_qinfo[i]);
+                }
+                for (size_t k = 0; k < nodes.size(); ++k)
+                {
+                    const auto  &node = nodes[k];
+                    const size_t v    = num_srcs + k;
+                    // The last node of an F32 program writes straight to the destination
+                    float *result = (std::is_same<TOut, float>::value && v == num_values - 1)
+                                        ? reinterpret_cast<float *>(output_ptr + x)
+                                        : tiles[v];
+                    run_node(node, values[node.lhs], node.rhs >= 0 ? values[node.rhs] : nullptr, result, n);
+                    values[v] = result;
+                }
+                store_tile(output_ptr + x, n, values[num_values - 1], dst_qinfo);
+            }
+        },
+        output);
+}
+} // namespace elementwise_fusion
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ELEMENTWISE_FUSION_GENERIC_NEON_IMPL_H
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseFusionInfo.h"
+
+#include "src/cpu/kernels/elementwise_fusion/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_qasymm8_elementwise_fusion(const ITensor *const        *srcs,
+                                     size_t                       num_srcs,
+                                     ITensor                     *dst,
+                                     const ElementwiseFusionInfo &info,
+                                     const Window                &window)
+{
+    switch (dst->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            elementwise_fusion::elementwise_fusion<uint8_t, uint8_t>(srcs, num_srcs, dst, info, window);
+            break;
+        case DataType::F32:
+            elementwise_fusion::elementwise_fusion<uint8_t, float>(srcs, num_srcs, dst, info, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported destination data type");
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GROUPED_GEMM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GROUPED_GEMM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/CpuGroupedGemmKernel.h"
+#include "src/cpu/kernels/grouped_gemm/list.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace grouped_gemm
+{
+/** Number of destination rows computed together by the micro-kernels */
+constexpr int tile_rows = 4;
+/** Number of 128-bit vectors of destination columns computed together by the micro-kernels */
+constexpr int block_vectors = 4;
+
+/** Bounds of the activations that can be fused as a clamp */
+inline std::pair<float, float> get_activation_bounds(const ActivationLayerInfo &act_info)
+{
+    float lower = -std::numeric_limits<float>::infinity();
+    float upper = std::numeric_limits<float>::infinity();
+    if (act_info.enabled())
+    {
+        switch (act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                lower = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                lower = 0.f;
+                upper = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                lower = act_info.b();
+                upper = act_info.a();
+                break;
+            default:
+                break;
+        }
+    }
+    return std::make_pair(lower, upper);
+}
+
+template <typename T>
+T *packed_ptr(const ITensor *packed, size_t offset)
+{
+    return reinterpret_cast<T *>(packed->buffer() + packed->info()->offset_first_element_in_bytes() + offset);
+}
+
+template <typename T>
+void pack_weights_float(const ITensor *b, const ITensor *biases, ITensor *packed, const PackedLayout &layout)
+{
+    const size_t block_width = layout.block_width;
+
+    T *packed_w = packed_ptr<T>(packed, layout.weights_offset);
+    T *packed_b = packed_ptr<T>(packed, layout.biases_offset);
+
+    // Every block holds block_width consecutive columns of every row of the weights, padded with zeros past N
+    for (size_t g = 0; g < layout.num_groups; ++g)
+    {
+        for (size_t blk = 0; blk < layout.num_blocks; ++blk)
+        {
+            const size_t first_col = blk * block_width;
+            const size_t num_cols  = std::min(block_width, layout.n - first_col);
+            T           *w_block   = packed_w + (g * layout.num_blocks + blk) * layout.k * block_width;
+            T           *b_block   = packed_b + (g * layout.num_blocks + blk) * block_width;
+            for (size_t k = 0; k < layout.k; ++k)
+            {
+                const T *src = reinterpret_cast<const T *>(b->ptr_to_element(Coordinates(first_col, k, g)));
+                std::copy_n(src, num_cols, w_block + k * block_width);
+                std::fill(w_block + k * block_width + num_cols, w_block + (k + 1) * block_width, T(0));
+            }
+            std::fill_n(b_block, block_width, T(0));
+            if (biases != nullptr)
+            {
+                std::copy_n(reinterpret_cast<const T *>(biases->ptr_to_element(Coordinates(first_col, g))), num_cols,
+                            b_block);
+            }
+        }
+    }
+}
+
+/** Compute a tile of up to tile_rows rows and a block of columns of the destination
+ *
+ * @param[in]  a_rows   Rows of the left-hand side. Rows past @p num_rows repeat the last row.
+ * @param[out] d_rows   Rows of the destination, starting at the first column of the block
+ * @param[in]  num_rows Number of valid rows
+ * @param[in]  num_cols Number of valid columns in the block
+ * @param[in]  w        Packed weights of the block, [K][block_width]
+ * @param[in]  bias     Packed biases of the block, [block_width]
+ * @param[in]  k        Number of columns of the left-hand side
+ * @param[in]  lower    Lower bound of the fused activation
+ * @param[in]  upper    Upper bound of the fused activation
+ */
+template <typename T>
+void compute_tile(const T *const (&a_rows)[tile_rows],
+                  T *const (&d_rows)[tile_rows],
+                  int      num_rows,
+                  int      num_cols,
+                  const T *w,
+                  const T *bias,
+                  size_t   k,
+                  T        lower,
+                  T        upper)
+{
+    using VectorType          = wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128>;
+    using TagType             = wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int vector_size = 16 / sizeof(T);
+    constexpr int block_width = vector_size * block_vectors;
+
+    const VectorType vlower = wrapper::vdup_n(lower, TagType{});
+    const VectorType vupper = wrapper::vdup_n(upper, TagType{});
+
+    VectorType acc[tile_rows][block_vectors];
+    for (int v = 0; v < block_vectors; ++v)
+    {
+        const VectorType vbias = wrapper::vloadq(bias + v * vector_size);
+        for (int r = 0; r < tile_rows; ++r)
+        {
+            acc[r][v] = vbias;
+        }
+    }
+
+    for (size_t i = 0; i < k; ++i)
+    {
+        VectorType vw[block_vectors];
+        for (int v = 0; v < block_vectors; ++v)
+        {
+            vw[v] = wrapper::vloadq(w + i * block_width + v * vector_size);
+        }
+        for (int r = 0; r < tile_rows; ++r)
+        {
+            const VectorType va = wrapper::vdup_n(a_rows[r][i], TagType{});
+            for (int v = 0; v < block_vectors; ++v)
+            {
+                acc[r][v] = wrapper::vmla(acc[r][v], vw[v], va);
+            }
+        }
+    }
+
+    for (int r = 0; r < num_rows; ++r)
+    {
+        if (num_cols == block_width)
+        {
+            for (int v = 0; v < block_vectors; ++v)
+            {
+                wrapper::vstore(d_rows[r] + v * vector_size, wrapper::vmin(wrapper::vmax(acc[r][v], vlower), vupper));
+            }
+        }
+        else
+        {
+            T tmp[block_width];
+            for (int v = 0; v < block_vectors; ++v)
+            {
+                wrapper::vstore(tmp + v * vector_size, wrapper::vmin(wrapper::vmax(acc[r][v], vlower), vupper));
+            }
+            std::copy_n(tmp, num_cols, d_rows[r]);
+        }
+    }
+}
+
+template <typename T>
+void grouped_gemm_float(const ITensor         *a,
+                        const ITensor         *packed,
+                        const ITensor         *group_sizes,
+                        ITensor               *dst,
+                        const GroupedGemmInfo &info,
+                        const PackedLayout    &layout,
+                        const Window          &window)
+{
+    constexpr int block_width = (16 / sizeof(T)) * block_vectors;
+    ARM_COMPUTE_ERROR_ON(layout.block_width != static_cast<size_t>(block_width));
+    ARM_COMPUTE_ERROR_ON(layout.tile_rows != static_cast<size_t>(tile_rows));
+
+    const auto bounds = get_activation_bounds(info.act_info);
+    const T    lower  = static_cast<T>(bounds.first);
+    const T    upper  = static_cast<T>(bounds.second);
+
+    const int64_t num_rows   = a->info()->dimension(1);
+    const size_t  num_blocks = layout.num_blocks;
+    const size_t  a_stride   = a->info()->strides_in_bytes()[1] / sizeof(T);
+    const size_t  d_stride   = dst->info()->strides_in_bytes()[1] / sizeof(T);
+    const T      *a_ptr      = reinterpret_cast<const T *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    T            *d_ptr      = reinterpret_cast<T *>(dst->buffer() + dst->info()->offset_first_element_in_bytes());
+    const T      *weights    = packed_ptr<const T>(packed, layout.weights_offset);
+    const T      *biases     = packed_ptr<const T>(packed, layout.biases_offset);
+
+    // Negative sizes count as empty groups, and rows past the end of the left-hand side are dropped
+    const auto rows_of_group = [&](size_t g, int64_t group_start)
+    {
+        const int32_t size = *reinterpret_cast<const int32_t *>(group_sizes->ptr_to_element(Coordinates(g)));
+        return std::min<int64_t>(std::max<int32_t>(size, 0), num_rows - group_start);
+    };
+    const auto tiles_of = [](int64_t rows) { return static_cast<uint64_t>(DIV_CEIL(rows, int64_t(tile_rows))); };
+
+    // Count the tiles present in this run
+    uint64_t total_tiles = 0;
+    int64_t  group_start = 0;
+    for (size_t g = 0; g < layout.num_groups; ++g)
+    {
+        const int64_t rows = rows_of_group(g, group_start);
+        total_tiles += tiles_of(rows);
+        group_start += rows;
+    }
+
+    // Map the slice of the window onto the same fraction of the work items, one per tile and block of columns
+    const uint64_t total_items = total_tiles * num_blocks;
+    const uint64_t window_size = layout.max_tiles * num_blocks;
+    const uint64_t first       = static_cast<uint64_t>(window.x().start()) * total_items / window_size;
+    const uint64_t last        = static_cast<uint64_t>(window.x().end()) * total_items / window_size;
+    if (first >= last)
+    {
+        return;
+    }
+
+    // Walk the groups alongside the tiles, starting from the first group
+    size_t     group        = 0;
+    uint64_t   tiles_before = 0;
+    int64_t    group_rows   = 0;
+    uint64_t   group_tiles  = 0;
+    const auto enter_group  = [&]()
+    {
+        group_rows  = rows_of_group(group, group_start);
+        group_tiles = tiles_of(group_rows);
+    };
+    group_start = 0;
+    enter_group();
+    for (uint64_t item = first; item < last; ++item)
+    {
+        const uint64_t tile = item / num_blocks;
+        while (tile >= tiles_before + group_tiles)
+        {
+            tiles_before += group_tiles;
+            group_start += group_rows;
+            ++group;
+            enter_group();
+        }
+
+        const size_t  blk       = item % num_blocks;
+        const int64_t row       = group_start + static_cast<int64_t>(tile - tiles_before) * tile_rows;
+        const int     tile_size = static_cast<int>(std::min<int64_t>(tile_rows, group_start + group_rows - row));
+        const int     num_cols  = static_cast<int>(std::min<size_t>(block_width, layout.n - blk * block_width));
+
+        const T *a_rows[tile_rows];
+        T       *d_rows[tile_rows];
+        for (int r = 0; r < tile_rows; ++r)
+        {
+            const int64_t valid_row = row + std::min(r, tile_size - 1);
+            a_rows[r]               = a_ptr + valid_row * a_stride;
+            d_rows[r]               = d_ptr + valid_row * d_stride + blk * block_width;
+        }
+
+        const size_t block_idx = group * num_blocks + blk;
+        compute_tile<T>(a_rows, d_rows, tile_size, num_cols, weights + block_idx * layout.k * block_width,
+                        biases + block_idx * block_width, layout.k, lower, upper);
+    }
+}
+} // namespace grouped_gemm
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GROUPED_GEMM_GENERIC_NEON_IMPL_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GROUPED_GEMM_LIST_H
+#define ACL_SRC_CPU_KERNELS_GROUPED_GEMM_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/cpu/kernels/CpuGroupedGemmKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace grouped_gemm
+{
+using PackedLayout = kernels::CpuGroupedGemmKernel::PackedLayout;
+} // namespace grouped_gemm
+
+#define DECLARE_GROUPED_GEMM_PACK_WEIGHTS(func_name) \
+    void func_name(const ITensor *b, const ITensor *biases, ITensor *packed, const grouped_gemm::PackedLayout &layout)
+
+#define DECLARE_GROUPED_GEMM_KERNEL(func_name)                                                                      \
+    void func_name(const ITensor *a, const ITensor *packed, const ITensor *group_sizes, ITensor *dst,               \
+                   const GroupedGemmInfo &info, const grouped_gemm::PackedLayout &layout, const Window &window)
+
+DECLARE_GROUPED_GEMM_PACK_WEIGHTS(neon_fp32_grouped_gemm_pack_weights);
+DECLARE_GROUPED_GEMM_PACK_WEIGHTS(neon_fp16_grouped_gemm_pack_weights);
+
+DECLARE_GROUPED_GEMM_KERNEL(neon_fp32_grouped_gemm);
+DECLARE_GROUPED_GEMM_KERNEL(neon_fp16_grouped_gemm);
+
+#undef DECLARE_GROUPED_GEMM_PACK_WEIGHTS
+#undef DECLARE_GROUPED_GEMM_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GROUPED_GEMM_LIST_H
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_IMAGE_PREPROCESS_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_IMAGE_PREPROCESS_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/image_preprocess/list.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace image_preprocess
+{
+/** Number of destination pixels computed together */
+constexpr int32_t block_width = 4;
+
+/** BT.709 YUV to RGB coefficients, the same as the ones of the colour convert helpers */
+constexpr float bt709_rv = 1.5748f;
+constexpr float bt709_gu = -0.1873f;
+constexpr float bt709_gv = -0.4681f;
+constexpr float bt709_bu = 1.8556f;
+
+/** Distances in bytes between the destination elements */
+struct DstStrides
+{
+    size_t pixel{0};   /**< Distance between two consecutive pixels of a row */
+    size_t channel{0}; /**< Distance between two consecutive channels of a pixel */
+};
+
+/** Reads the three components of a source pixel: R, G and B for RGB888, Y, U and V for the YUV formats
+ *
+ * @param[in]  row    Source row, or luma row for NV12
+ * @param[in]  uv_row Chroma row for NV12, unused otherwise
+ * @param[in]  x      Source column
+ * @param[out] c0     First component
+ * @param[out] c1     Second component
+ * @param[out] c2     Third component
+ */
+template <Format F>
+inline void load_pixel(const uint8_t *row, const uint8_t *uv_row, int32_t x, float &c0, float &c1, float &c2);
+
+template <>
+inline void load_pixel<Format::RGB888>(
+    const uint8_t *row, const uint8_t *uv_row, int32_t x, float &c0, float &c1, float &c2)
+{
+    ARM_COMPUTE_UNUSED(uv_row);
+    const uint8_t *px = row + 3 * x;
+    c0                = px[0];
+    c1                = px[1];
+    c2                = px[2];
+}
+
+template <>
+inline void load_pixel<Format::YUYV422>(
+    const uint8_t *row, const uint8_t *uv_row, int32_t x, float &c0, float &c1, float &c2)
+{
+    ARM_COMPUTE_UNUSED(uv_row);
+    const uint8_t *pair = row + 4 * (x / 2);
+    c0                  = row[2 * x];
+    c1                  = pair[1];
+    c2                  = pair[3];
+}
+
+template <>
+inline void load_pixel<Format::NV12>(
+    const uint8_t *row, const uint8_t *uv_row, int32_t x, float &c0, float &c1, float &c2)
+{
+    const uint8_t *uv = uv_row + 2 * (x / 2);
+    c0                = row[x];
+    c1                = uv[0];
+    c2                = uv[1];
+}
+
+/** Converts four YUV pixels to RGB, clamped to [0, 255] */
+inline float32x4x3_t yuv_to_rgb(const float32x4x3_t &yuv)
+{
+    const float32x4_t c128 = vdupq_n_f32(128.f);
+    const float32x4_t c0   = vdupq_n_f32(0.f);
+    const float32x4_t c255 = vdupq_n_f32(255.f);
+    const float32x4_t y    = yuv.val[0];
+    const float32x4_t u    = vsubq_f32(yuv.val[1], c128);
+    const float32x4_t v    = vsubq_f32(yuv.val[2], c128);
+
+    float32x4x3_t rgb;
+    rgb.val[0] = vmlaq_n_f32(y, v, bt709_rv);
+    rgb.val[1] = vmlaq_n_f32(vmlaq_n_f32(y, u, bt709_gu), v, bt709_gv);
+    rgb.val[2] = vmlaq_n_f32(y, u, bt709_bu);
+    for (int c = 0; c < 3; ++c)
+    {
+        rgb.val[c] = vminq_f32(vmaxq_f32(rgb.val[c], c0), c255);
+    }
+    return rgb;
+}
+
+/** Reads four source pixels of a row as RGB
+ *
+ * @param[in] row    Source row, or luma row for NV12
+ * @param[in] uv_row Chroma row for NV12, unused otherwise
+ * @param[in] xs     Source columns of the four pixels
+ *
+ * @return The R, G and B components of the pixels
+ */
+template <Format F>
+inline float32x4x3_t load_rgb(const uint8_t *row, const uint8_t *uv_row, const int32_t *xs)
+{
+    float c[3][block_width];
+    for (int32_t i = 0; i < block_width; ++i)
+    {
+        load_pixel<F>(row, uv_row, xs[i], c[0][i], c[1][i], c[2][i]);
+    }
+    const float32x4x3_t pixels = {{vld1q_f32(c[0]), vld1q_f32(c[1]), vld1q_f32(c[2])}};
+    return F == Format::RGB888 ? pixels : yuv_to_rgb(pixels);
+}
+
+/** Linear interpolation between a and b */
+inline float32x4_t lerp(const float32x4_t &a, const float32x4_t &b, const float32x4_t &w)
+{
+    return vmlaq_f32(a, vsubq_f32(b, a), w);
+}
+
+/** Stores the first n of four destination pixels one element at a time */
+template <typename T, typename F>
+inline void store_lanes(const float32x4x3_t &values, int32_t n, uint8_t *dst, const DstStrides &strides, F &&convert)
+{
+    float lanes[3][block_width];
+    for (int c = 0; c < 3; ++c)
+    {
+        vst1q_f32(lanes[c], values.val[c]);
+    }
+    for (int32_t i = 0; i < n; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            *reinterpret_cast<T *>(dst + i * strides.pixel + c * strides.channel) = convert(lanes[c][i]);
+        }
+    }
+}
+
+/** Stores the first n of four destination pixels
+ *
+ * @param[in] values  Destination channels of the pixels
+ * @param[in] n       Number of pixels to store
+ * @param[in] dst     Destination of the first pixel
+ * @param[in] strides Destination strides
+ */
+template <typename T>
+inline void store_pixels(const float32x4x3_t &values, int32_t n, uint8_t *dst, const DstStrides &strides);
+
+template <>
+inline void store_pixels<float>(const float32x4x3_t &values, int32_t n, uint8_t *dst, const DstStrides &strides)
+{
+    if (n == block_width && strides.pixel == 3 * sizeof(float) && strides.channel == sizeof(float))
+    {
+        vst3q_f32(reinterpret_cast<float *>(dst), values);
+    }
+    else if (n == block_width && strides.pixel == sizeof(float))
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            vst1q_f32(reinterpret_cast<float *>(dst + c * strides.channel), values.val[c]);
+        }
+    }
+    else
+    {
+        store_lanes<float>(values, n, dst, strides, [](float v) { return v; });
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline void store_pixels<float16_t>(const float32x4x3_t &values, int32_t n, uint8_t *dst, const DstStrides &strides)
+{
+    if (n == block_width && strides.pixel == 3 * sizeof(float16_t) && strides.channel == sizeof(float16_t))
+    {
+        const float16x4x3_t halves = {
+            {vcvt_f16_f32(values.val[0]), vcvt_f16_f32(values.val[1]), vcvt_f16_f32(values.val[2])}};
+        vst3_f16(reinterpret_cast<float16_t *>(dst), halves);
+    }
+    else if (n == block_width && strides.pixel == sizeof(float16_t))
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            vst1_f16(reinterpret_cast<float16_t *>(dst + c * strides.channel), vcvt_f16_f32(values.val[c]));
+        }
+    }
+    else
+    {
+        store_lanes<float16_t>(values, n, dst, strides, [](float v) { return static_cast<float16_t>(v); });
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+template <>
+inline void store_pixels<uint8_t>(const float32x4x3_t &values, int32_t n, uint8_t *dst, const DstStrides &strides)
+{
+    store_lanes<uint8_t>(values, n, dst, strides, [](float v)
+                         { return utility::clamp<int32_t, uint8_t>(static_cast<int32_t>(std::lround(v))); });
+}
+
+template <>
+inline void store_pixels<int8_t>(const float32x4x3_t &values, int32_t n, uint8_t *dst, const DstStrides &strides)
+{
+    store_lanes<int8_t>(values, n, dst, strides, [](float v)
+                        { return utility::clamp<int32_t, int8_t>(static_cast<int32_t>(std::lround(v))); });
+}
+
+/** Converts, resizes and normalizes the destination rows of the window for a given source format */
+template <typename T, Format F>
+void image_preprocess_format(
+    const ITensor *src, const ITensor *src_uv, ITensor *dst, const Params &params, const Window &window)
+{
+    const ITensorInfo *dst_info       = dst->info();
+    const DataLayout   layout         = dst_info->data_layout();
+    const size_t       idx_w          = get_data_layout_dimension_index(layout, DataLayoutDimension::WIDTH);
+    const size_t       idx_h          = get_data_layout_dimension_index(layout, DataLayoutDimension::HEIGHT);
+    const size_t       idx_c          = get_data_layout_dimension_index(layout, DataLayoutDimension::CHANNEL);
+    const int32_t      dst_w          = static_cast<int32_t>(dst_info->dimension(idx_w));
+    const size_t       dst_row_stride = dst_info->strides_in_bytes()[idx_h];
+    const DstStrides   dst_strides{dst_info->strides_in_bytes()[idx_w], dst_info->strides_in_bytes()[idx_c]};
+    uint8_t           *dst_base = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    const uint8_t *src_base   = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const size_t   src_stride = src->info()->strides_in_bytes().y();
+    const uint8_t *uv_base    = nullptr;
+    size_t         uv_stride  = 0;
+    if (F == Format::NV12)
+    {
+        uv_base   = src_uv->buffer() + src_uv->info()->offset_first_element_in_bytes();
+        uv_stride = src_uv->info()->strides_in_bytes().y();
+    }
+
+    float32x4_t scale[3];
+    float32x4_t offset[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        scale[c]  = vdupq_n_f32(params.scale[c]);
+        offset[c] = vdupq_n_f32(params.offset[c]);
+    }
+
+    const bool bilinear = params.interpolation == InterpolationPolicy::BILINEAR;
+
+    for (int32_t y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const uint8_t    *row0    = src_base + params.y0[y] * src_stride;
+        const uint8_t    *row1    = src_base + params.y1[y] * src_stride;
+        const uint8_t    *uv_row0 = uv_base != nullptr ? uv_base + (params.y0[y] / 2) * uv_stride : nullptr;
+        const uint8_t    *uv_row1 = uv_base != nullptr ? uv_base + (params.y1[y] / 2) * uv_stride : nullptr;
+        const float32x4_t wy      = vdupq_n_f32(params.wy[y]);
+        uint8_t          *dst_row = dst_base + y * dst_row_stride;
+
+        for (int32_t x = 0; x < dst_w; x += block_width)
+        {
+            float32x4x3_t rgb = load_rgb<F>(row0, uv_row0, params.x0.data() + x);
+            if (bilinear)
+            {
+                const float32x4_t   wx = vld1q_f32(params.wx.data() + x);
+                const float32x4x3_t tr = load_rgb<F>(row0, uv_row0, params.x1.data() + x);
+                const float32x4x3_t bl = load_rgb<F>(row1, uv_row1, params.x0.data() + x);
+                const float32x4x3_t br = load_rgb<F>(row1, uv_row1, params.x1.data() + x);
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float32x4_t top    = lerp(rgb.val[c], tr.val[c], wx);
+                    const float32x4_t bottom = lerp(bl.val[c], br.val[c], wx);
+                    rgb.val[c]               = lerp(top, bottom, wy);
+                }
+            }
+
+            float32x4x3_t out;
+            for (int c = 0; c < 3; ++c)
+            {
+                out.val[c] = vmlaq_f32(offset[c], rgb.val[params.channel_order[c]], scale[c]);
+            }
+            store_pixels<T>(out, std::min(block_width, dst_w - x), dst_row + x * dst_strides.pixel, dst_strides);
+        }
+    }
+}
+
+/** Converts, resizes and normalizes the destination rows of the window */
+template <typename T>
+void image_preprocess(
+    const ITensor *src, const ITensor *src_uv, ITensor *dst, const Params &params, const Window &window)
+{
+    switch (params.format)
+    {
+        case Format::RGB888:
+            image_preprocess_format<T, Format::RGB888>(src, src_uv, dst, params, window);
+            break;
+        case Format::YUYV422:
+            image_preprocess_format<T, Format::YUYV422>(src, src_uv, dst, params, window);
+            break;
+        case Format::NV12:
+            image_preprocess_format<T, Format::NV12>(src, src_uv, dst, params, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported source format");
+    }
+}
+} // namespace image_preprocess
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_IMAGE_PREPROCESS_GENERIC_NEON_IMPL_H
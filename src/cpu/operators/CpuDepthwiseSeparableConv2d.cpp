@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuDepthwiseSeparableConv2d.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+CpuDepthwiseSeparableConv2d::CpuDepthwiseSeparableConv2d()
+    : _kernel(std::make_unique<kernels::CpuDepthwiseSeparableConv2dKernel>()),
+      _aux_mem(AuxTensorIdx::Count),
+      _packed_weights(),
+      _workspace(),
+      _is_prepared(false)
+{
+}
+
+CpuDepthwiseSeparableConv2d::~CpuDepthwiseSeparableConv2d() = default;
+
+void CpuDepthwiseSeparableConv2d::configure(const ITensorInfo                  *src,
+                                            const ITensorInfo                  *dw_weights,
+                                            const ITensorInfo                  *dw_biases,
+                                            const ITensorInfo                  *pw_weights,
+                                            const ITensorInfo                  *pw_biases,
+                                            ITensorInfo                        *dst,
+                                            const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2d::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dw_weights, pw_weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(
+        CpuDepthwiseSeparableConv2d::validate(src, dw_weights, dw_biases, pw_weights, pw_biases, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(src, dw_weights, dw_biases, pw_weights, pw_biases, dst);
+
+    _is_prepared = false;
+    _kernel->configure(src, dw_weights, dw_biases, pw_weights, pw_biases, dst, info);
+
+    // The packed weights live as long as the operator, while every thread gets its own slice of the workspace
+    const auto        &layout      = _kernel->packed_layout();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    _packed_weights                = TensorInfo(TensorShape(layout.packed_size), 1, DataType::U8);
+    _workspace                     = TensorInfo(TensorShape(layout.workspace_size * num_threads), 1, DataType::U8);
+
+    _aux_mem[PackedWeights] =
+        MemoryInfo(offset_int_vec(PackedWeights), MemoryLifetime::Persistent, _packed_weights.total_size());
+    _aux_mem[Workspace] = MemoryInfo(offset_int_vec(Workspace), MemoryLifetime::Temporary, _workspace.total_size());
+}
+
+Status CpuDepthwiseSeparableConv2d::validate(const ITensorInfo                  *src,
+                                             const ITensorInfo                  *dw_weights,
+                                             const ITensorInfo                  *dw_biases,
+                                             const ITensorInfo                  *pw_weights,
+                                             const ITensorInfo                  *pw_biases,
+                                             const ITensorInfo                  *dst,
+                                             const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDepthwiseSeparableConv2d::validate");
+    return kernels::CpuDepthwiseSeparableConv2dKernel::validate(src, dw_weights, dw_biases, pw_weights, pw_biases, dst,
+                                                                info);
+}
+
+void CpuDepthwiseSeparableConv2d::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDepthwiseSeparableConv2d::run");
+    prepare(tensors);
+
+    CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors);
+    CpuAuxTensorHandler workspace(offset_int_vec(Workspace), _workspace, tensors);
+
+    ITensorPack pack{{TensorType::ACL_SRC_0, tensors.get_const_tensor(TensorType::ACL_SRC_0)},
+                     {TensorType::ACL_SRC_1, packed_weights.get()},
+                     {TensorType::ACL_INT_0, workspace.get()},
+                     {TensorType::ACL_DST, tensors.get_tensor(TensorType::ACL_DST)}};
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimZ, _kernel->window(), pack);
+}
+
+void CpuDepthwiseSeparableConv2d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                                "CpuDepthwiseSeparableConv2d::prepare");
+        const ITensor *dw_weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        const ITensor *dw_biases  = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+        const ITensor *pw_weights = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+        const ITensor *pw_biases  = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(dw_weights, pw_weights);
+
+        CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors);
+        _kernel->pack_weights(dw_weights, dw_biases, pw_weights, pw_biases, packed_weights.get());
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuDepthwiseSeparableConv2d::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
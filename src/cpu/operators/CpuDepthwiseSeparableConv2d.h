@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUDEPTHWISESEPARABLECONV2D_H
+#define ACL_SRC_CPU_OPERATORS_CPUDEPTHWISESEPARABLECONV2D_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuDepthwiseSeparableConv2dKernel.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run a depthwise convolution followed by a 1x1 pointwise convolution as a single fused kernel
+ *
+ * The weights, biases and requantization parameters of both convolutions are packed once on the first run.
+ * The packed tensors are passed to the operator as:
+ * - ACL_SRC_0: source
+ * - ACL_SRC_1: depthwise weights
+ * - ACL_SRC_2: depthwise biases
+ * - ACL_SRC_3: pointwise weights
+ * - ACL_SRC_4: pointwise biases
+ * - ACL_DST: destination
+ */
+class CpuDepthwiseSeparableConv2d : public ICpuOperator
+{
+public:
+    CpuDepthwiseSeparableConv2d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDepthwiseSeparableConv2d);
+    ~CpuDepthwiseSeparableConv2d();
+    /** Initialize the function's source, destination, weights and convolution information.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src            |dw/pw weights                     |dw/pw biases |dst            |
+     * |:--------------|:---------------------------------|:------------|:--------------|
+     * |F16            |F16                               |F16          |F16            |
+     * |F32            |F32                               |F32          |F32            |
+     * |QASYMM8        |QASYMM8, QSYMM8_PER_CHANNEL       |S32          |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED, QSYMM8_PER_CHANNEL|S32          |QASYMM8_SIGNED |
+     *
+     * @param[in]  src        Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  dw_weights Depthwise weights tensor info [IFM, kernel_x, kernel_y].
+     *                        Data type supported: Same as @p src or QSYMM8_PER_CHANNEL when @p src is quantized.
+     * @param[in]  dw_biases  Depthwise biases tensor info [IFM]. Can be nullptr.
+     *                        Data type supported: Same as @p src, S32 when @p src is quantized.
+     * @param[in]  pw_weights Pointwise weights tensor info [IFM, 1, 1, OFM].
+     *                        Data type supported: Same as @p src or QSYMM8_PER_CHANNEL when @p src is quantized.
+     * @param[in]  pw_biases  Pointwise biases tensor info [OFM]. Can be nullptr.
+     *                        Data type supported: Same as @p src, S32 when @p src is quantized.
+     * @param[out] dst        Destination tensor info. Data type supported: Same as @p src.
+     * @param[in]  info       Depthwise convolution, activations and intermediate quantization information.
+     */
+    void configure(const ITensorInfo                  *src,
+                   const ITensorInfo                  *dw_weights,
+                   const ITensorInfo                  *dw_biases,
+                   const ITensorInfo                  *pw_weights,
+                   const ITensorInfo                  *pw_biases,
+                   ITensorInfo                        *dst,
+                   const DepthwiseSeparableConv2dInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDepthwiseSeparableConv2d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                  *src,
+                           const ITensorInfo                  *dw_weights,
+                           const ITensorInfo                  *dw_biases,
+                           const ITensorInfo                  *pw_weights,
+                           const ITensorInfo                  *pw_biases,
+                           const ITensorInfo                  *dst,
+                           const DepthwiseSeparableConv2dInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        PackedWeights = 0,
+        Workspace,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuDepthwiseSeparableConv2dKernel> _kernel;
+    experimental::MemoryRequirements                            _aux_mem;
+    TensorInfo                                                  _packed_weights;
+    TensorInfo                                                  _workspace;
+    bool                                                        _is_prepared;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUDEPTHWISESEPARABLECONV2D_H
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuDynamicDequantizeKernel.h"
+#include "src/cpu/kernels/CpuDynamicQuantizeKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+namespace
+{
+GEMMInfo get_gemmlowp_info(const GEMMInfo &gemm_info)
+{
+    // Plain int32 accumulation: the dequantization, bias and activation are applied afterwards
+    GEMMInfo info = gemm_info;
+    info.set_activation_info(ActivationLayerInfo());
+    return info;
+}
+} // namespace
+
+CpuDynamicQuantizedGemm::CpuDynamicQuantizedGemm()
+    : _quantize_kernel(),
+      _mm_gemmlowp(),
+      _dequantize_kernel(),
+      _activation_func(),
+      _quantized_a(),
+      _row_scales(),
+      _accumulators(),
+      _run_activation(false),
+      _is_prepared(false)
+{
+}
+
+CpuDynamicQuantizedGemm::~CpuDynamicQuantizedGemm() = default;
+
+bool CpuDynamicQuantizedGemm::is_dynamic_quantization(const ITensorInfo *a, const ITensorInfo *b)
+{
+    return is_data_type_float(a->data_type()) &&
+           (b->data_type() == DataType::QSYMM8_PER_CHANNEL || b->data_type() == DataType::QSYMM8);
+}
+
+void CpuDynamicQuantizedGemm::configure(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *dst, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizedGemm::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuDynamicQuantizedGemm::validate(a, b, c, dst, gemm_info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, c, dst, gemm_info);
+
+    _is_prepared = false;
+
+    // Quantize the rows of A
+    _quantize_kernel = std::make_unique<kernels::CpuDynamicQuantizeKernel>();
+    _quantize_kernel->configure(a, &_quantized_a, &_row_scales);
+
+    // Int8 matrix multiplication
+    _accumulators = TensorInfo(dst->tensor_shape(), 1, DataType::S32);
+    _mm_gemmlowp  = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
+    _mm_gemmlowp->configure(&_quantized_a, b, nullptr, &_accumulators, get_gemmlowp_info(gemm_info));
+
+    // Dequantize, add the bias and apply the activation when possible
+    const ActivationLayerInfo &act_info = gemm_info.activation_info();
+    _run_activation = act_info.enabled() && !kernels::CpuDynamicDequantizeKernel::is_activation_supported(act_info);
+
+    _dequantize_kernel = std::make_unique<kernels::CpuDynamicDequantizeKernel>();
+    _dequantize_kernel->configure(&_accumulators, &_row_scales, b, c, dst,
+                                  _run_activation ? ActivationLayerInfo() : act_info);
+
+    if (_run_activation)
+    {
+        _activation_func = std::make_unique<CpuActivation>();
+        _activation_func->configure(dst, nullptr, act_info);
+    }
+
+    // Auxiliary memory requirements
+    const auto gemm_mem_req = _mm_gemmlowp->workspace();
+    for (unsigned int i = 0; i < gemm_mem_req.size(); ++i)
+    {
+        _aux_mem[i] = gemm_mem_req[i];
+    }
+    _aux_mem[QuantizedA] =
+        MemoryInfo(offset_int_vec(QuantizedA), MemoryLifetime::Temporary, _quantized_a.total_size());
+    _aux_mem[RowScales] = MemoryInfo(offset_int_vec(RowScales), MemoryLifetime::Temporary, _row_scales.total_size());
+    _aux_mem[Accumulators] =
+        MemoryInfo(offset_int_vec(Accumulators), MemoryLifetime::Temporary, _accumulators.total_size());
+}
+
+Status CpuDynamicQuantizedGemm::validate(
+    const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *dst, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizedGemm::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QSYMM8_PER_CHANNEL, DataType::QSYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->num_dimensions() > 2 || b->num_dimensions() > 2,
+                                    "Only 2D matrices are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        a->dimension(0) != b->dimension(1),
+        "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped(), "Matrix A already reshaped is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_b_reshaped(), "Matrix B already reshaped is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.accumulate(), "Accumulation is not supported");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != b->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != a->dimension(1));
+    }
+
+    TensorInfo quantized_a{};
+    TensorInfo row_scales{};
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDynamicQuantizeKernel::validate(
+        a, &quantized_a.set_data_type(DataType::QASYMM8_SIGNED).set_tensor_shape(a->tensor_shape()),
+        &row_scales.set_data_type(DataType::F32).set_tensor_shape(TensorShape(a->dimension(1)))));
+    quantized_a.set_quantization_info(QuantizationInfo(1.f, 0));
+
+    const TensorInfo accumulators(TensorShape(b->dimension(0), a->dimension(1)), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        CpuGemmLowpMatrixMultiplyCore::validate(&quantized_a, b, nullptr, &accumulators, get_gemmlowp_info(gemm_info)));
+
+    const ActivationLayerInfo &act_info = gemm_info.activation_info();
+    const bool                 run_activation =
+        act_info.enabled() && !kernels::CpuDynamicDequantizeKernel::is_activation_supported(act_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDynamicDequantizeKernel::validate(
+        &accumulators, &row_scales, b, c, dst, run_activation ? ActivationLayerInfo() : act_info));
+    if (run_activation)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(dst, nullptr, act_info));
+    }
+
+    return Status{};
+}
+
+void CpuDynamicQuantizedGemm::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizedGemm::run");
+    prepare(tensors);
+
+    auto a   = tensors.get_const_tensor(ACL_SRC_0);
+    auto c   = tensors.get_const_tensor(ACL_SRC_2);
+    auto dst = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler quantized_a(offset_int_vec(QuantizedA), _quantized_a, tensors, true);
+    CpuAuxTensorHandler row_scales(offset_int_vec(RowScales), _row_scales, tensors, true);
+    CpuAuxTensorHandler accumulators(offset_int_vec(Accumulators), _accumulators, tensors, true);
+
+    ITensorPack quantize_pack{{ACL_SRC, a}, {ACL_DST_0, quantized_a.get()}, {ACL_DST_1, row_scales.get()}};
+    NEScheduler::get().schedule_op(_quantize_kernel.get(), Window::DimY, _quantize_kernel->window(), quantize_pack);
+
+    ITensorPack gemm_pack = tensors;
+    gemm_pack.add_const_tensor(ACL_SRC_0, quantized_a.get());
+    gemm_pack.remove_tensor(ACL_SRC_2);
+    gemm_pack.add_tensor(ACL_DST, accumulators.get());
+    _mm_gemmlowp->run(gemm_pack);
+
+    ITensorPack dequantize_pack{
+        {ACL_SRC_0, accumulators.get()}, {ACL_SRC_1, row_scales.get()}, {ACL_SRC_2, c}, {ACL_DST, dst}};
+    NEScheduler::get().schedule_op(_dequantize_kernel.get(), Window::DimY, _dequantize_kernel->window(),
+                                   dequantize_pack);
+
+    if (_run_activation)
+    {
+        ITensorPack activation_pack{{ACL_SRC, dst}, {ACL_DST, dst}};
+        _activation_func->run(activation_pack);
+    }
+}
+
+void CpuDynamicQuantizedGemm::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        // The bias is only used by the dequantization
+        ITensorPack gemm_pack = tensors;
+        gemm_pack.remove_tensor(ACL_SRC_2);
+        _mm_gemmlowp->prepare(gemm_pack);
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuDynamicQuantizedGemm::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
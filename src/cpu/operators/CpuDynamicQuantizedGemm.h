@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
+#define ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+class CpuDynamicQuantizeKernel;
+class CpuDynamicDequantizeKernel;
+} // namespace kernels
+class CpuGemmLowpMatrixMultiplyCore;
+class CpuActivation;
+
+/** Basic function to multiply floating-point activations by int8 weights. This function calls the following kernels:
+ *
+ *  -# @ref kernels::CpuDynamicQuantizeKernel
+ *  -# @ref CpuGemmLowpMatrixMultiplyCore
+ *  -# @ref kernels::CpuDynamicDequantizeKernel
+ *  -# @ref CpuActivation (if the activation cannot be fused in the dequantization)
+ *
+ * The activations are quantized at run time with one symmetric scale per row (i.e. per token/sample), so no
+ * calibration is needed and outliers in a row don't affect the precision of the other rows.
+ */
+class CpuDynamicQuantizedGemm : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuDynamicQuantizedGemm();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicQuantizedGemm);
+    /** Destructor */
+    ~CpuDynamicQuantizedGemm();
+    /** Initialise the kernel's inputs, output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0           |src1               |src2     |dst            |
+     * |:--------------|:------------------|:--------|:--------------|
+     * |F32            |QSYMM8_PER_CHANNEL |F32      |F32            |
+     * |F32            |QSYMM8             |F32      |F32            |
+     * |F16            |QSYMM8_PER_CHANNEL |F16      |F16            |
+     * |F16            |QSYMM8             |F16      |F16            |
+     *
+     * @param[in]  a         First input tensor info (Matrix A) of shape [K, M]. Data type supported: F16/F32.
+     * @param[in]  b         Second input tensor info (Matrix B) of shape [N, K], quantized per column.
+     *                       Data type supported: QSYMM8_PER_CHANNEL/QSYMM8.
+     * @param[in]  c         Third input tensor info (Bias) of shape [N]. It can be a nullptr.
+     *                       Data type supported: same as @p a.
+     * @param[out] dst       Output tensor info of shape [N, M]. Data type supported: same as @p a.
+     * @param[in]  gemm_info (Optional) Specifies the fused activation, fast math and
+     *                       if the reshape of matrix B should be executed only for the first run
+     */
+    void configure(const ITensorInfo *a,
+                   const ITensorInfo *b,
+                   const ITensorInfo *c,
+                   ITensorInfo       *dst,
+                   const GEMMInfo    &gemm_info = GEMMInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDynamicQuantizedGemm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a,
+                           const ITensorInfo *b,
+                           const ITensorInfo *c,
+                           const ITensorInfo *dst,
+                           const GEMMInfo    &gemm_info = GEMMInfo());
+    /** Whether the given data types select the dynamic quantization path
+     *
+     * @param[in] a Matrix A tensor info.
+     * @param[in] b Matrix B tensor info.
+     *
+     * @return True if @p a is floating-point and @p b is symmetrically quantized
+     */
+    static bool is_dynamic_quantization(const ITensorInfo *a, const ITensorInfo *b);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        /* Slots 0 - 9 reserved for CpuGemmLowpMatrixMultiplyCore */
+        QuantizedA = 10,
+        RowScales,
+        Accumulators,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuDynamicQuantizeKernel>   _quantize_kernel;
+    std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>       _mm_gemmlowp;
+    std::unique_ptr<kernels::CpuDynamicDequantizeKernel> _dequantize_kernel;
+    std::unique_ptr<CpuActivation>                       _activation_func;
+
+    TensorInfo _quantized_a;
+    TensorInfo _row_scales;
+    TensorInfo _accumulators;
+
+    bool                             _run_activation;
+    bool                             _is_prepared;
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@
 #include "src/core/utils/quantization/AsymmHelpers.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
 #include "src/cpu/operators/CpuFlatten.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
@@ -114,6 +115,13 @@ Status validate_mm(const ITensorInfo         *src,
         ARM_COMPUTE_RETURN_ON_ERROR(
             CpuGemmLowpMatrixMultiplyCore::validate(&src_info, &weights_info, biases, dst, gemm_info));
     }
+    else if (CpuDynamicQuantizedGemm::is_dynamic_quantization(src, weights))
+    {
+        GEMMInfo gemm_info;
+        gemm_info.set_fast_math(enable_fast_math);
+        gemm_info.set_activation_info(act);
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuDynamicQuantizedGemm::validate(src, weights, biases, dst, gemm_info));
+    }
     else
     {
         GEMMInfo gemm_info;
@@ -134,6 +142,7 @@ CpuFullyConnected::CpuFullyConnected()
       _transpose_weights(nullptr),
       _mm_gemm(nullptr),
       _mm_gemmlowp(nullptr),
+      _mm_dynamic_quantized(nullptr),
       _flattened_src(),
       _converted_weights(),
       _reshaped_weights(),
@@ -144,8 +153,10 @@ CpuFullyConnected::CpuFullyConnected()
       _needs_weights_reshape(false),
       _is_fc_after_conv(false),
       _is_quantized_asymmetric(false),
+      _is_dynamically_quantized(false),
       _is_prepared(false),
       _enable_fast_math(false),
+      _weights_prefetch_distance(0),
       _fixed_format(false),
       _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
       _dynamic_weights(false)
@@ -182,9 +193,19 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         gemm_info.set_gemmlowp_output_stage(gemmlowp_output_stage_info);
         gemm_info.set_activation_info(act);
         gemm_info.set_fast_math(_enable_fast_math);
+        gemm_info.set_weights_prefetch_distance(_weights_prefetch_distance);
         _mm_gemmlowp = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
         _mm_gemmlowp->configure(&src_info, &weights_info, biases, dst, gemm_info);
     }
+    else if (_is_dynamically_quantized)
+    {
+        // Quantize the activations on the fly and run an int8 matrix multiplication
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act);
+        gemm_info.set_fast_math(_enable_fast_math);
+        _mm_dynamic_quantized = std::make_unique<CpuDynamicQuantizedGemm>();
+        _mm_dynamic_quantized->configure(src, weights, biases, dst, gemm_info);
+    }
     else
     {
         // Configure matrix multiply kernel
@@ -193,6 +214,7 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         gemm_info.set_fast_math(_enable_fast_math);
         gemm_info.set_fixed_format(_fixed_format);
         gemm_info.set_weight_format(_weight_format);
+        gemm_info.set_weights_prefetch_distance(_weights_prefetch_distance);
         _mm_gemm = std::make_unique<CpuGemm>();
         _mm_gemm->configure(src, weights, biases, dst, 1.f, 1.0f, gemm_info);
     }
@@ -244,17 +266,19 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
         CpuFullyConnected::validate(src, weights, biases != nullptr ? biases : nullptr, dst, fc_info, weights_info));
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, fc_info);
 
-    _needs_weights_conversion = false;
-    _needs_weights_reshape    = fc_info.transpose_weights ? !fc_info.are_weights_reshaped : false;
-    _needs_weights_reshape    = _needs_weights_reshape && !fc_info.retain_internal_weights;
-    _is_fc_after_conv         = true;
-    _is_quantized_asymmetric  = is_data_type_quantized_asymmetric(src->data_type());
-    _is_prepared              = false;
-    _trans_weights_idx        = AuxTensorIdx::Count;
-    _enable_fast_math         = fc_info.enable_fast_math;
-    _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
-    _weight_format            = weights_info.weight_format();
-    _dynamic_weights          = !weights->are_values_constant() && _needs_weights_reshape;
+    _needs_weights_conversion  = false;
+    _needs_weights_reshape     = fc_info.transpose_weights ? !fc_info.are_weights_reshaped : false;
+    _needs_weights_reshape     = _needs_weights_reshape && !fc_info.retain_internal_weights;
+    _is_fc_after_conv          = true;
+    _is_quantized_asymmetric   = is_data_type_quantized_asymmetric(src->data_type());
+    _is_dynamically_quantized  = CpuDynamicQuantizedGemm::is_dynamic_quantization(src, weights);
+    _is_prepared               = false;
+    _trans_weights_idx         = AuxTensorIdx::Count;
+    _enable_fast_math          = fc_info.enable_fast_math;
+    _weights_prefetch_distance = fc_info.weights_prefetch_distance;
+    _fixed_format              = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
+    _weight_format             = weights_info.weight_format();
+    _dynamic_weights           = !weights->are_values_constant() && _needs_weights_reshape;
 
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -321,7 +345,9 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
 
     // Set auxiliary memory requirements
-    auto gemm_mem_req = (_is_quantized_asymmetric) ? _mm_gemmlowp->workspace() : _mm_gemm->workspace();
+    auto gemm_mem_req = (_is_quantized_asymmetric)    ? _mm_gemmlowp->workspace()
+                        : (_is_dynamically_quantized) ? _mm_dynamic_quantized->workspace()
+                                                      : _mm_gemm->workspace();
     for (unsigned int i = 0; i < gemm_mem_req.size(); ++i)
     {
         _aux_mem[i] = gemm_mem_req[i];
@@ -404,6 +430,10 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(weights, DataType::BFLOAT16);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(dst, DataType::F32);
     }
+    else if (CpuDynamicQuantizedGemm::is_dynamic_quantization(src, weights))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
     else
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights, dst);
@@ -534,6 +564,10 @@ void CpuFullyConnected::run(ITensorPack &tensors)
     {
         _mm_gemmlowp->run(gemm_pack);
     }
+    else if (_is_dynamically_quantized)
+    {
+        _mm_dynamic_quantized->run(gemm_pack);
+    }
     else
     {
         _mm_gemm->run(gemm_pack);
@@ -583,13 +617,17 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
         gemm_pack.add_const_tensor(ACL_SRC_1, cur_weights);
 
         // Prepare GEMM prepare and release unused weights
-        if (!_is_quantized_asymmetric)
+        if (_is_quantized_asymmetric)
         {
-            _mm_gemm->prepare(gemm_pack);
+            _mm_gemmlowp->prepare(gemm_pack);
+        }
+        else if (_is_dynamically_quantized)
+        {
+            _mm_dynamic_quantized->prepare(gemm_pack);
         }
         else
         {
-            _mm_gemmlowp->prepare(gemm_pack);
+            _mm_gemm->prepare(gemm_pack);
         }
 
         _is_prepared = true;
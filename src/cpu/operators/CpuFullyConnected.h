@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@ namespace cpu
 {
 // Forward declarations
 class CpuConvertFullyConnectedWeights;
+class CpuDynamicQuantizedGemm;
 class CpuFlatten;
 class CpuGemm;
 class CpuGemmLowpMatrixMultiplyCore;
@@ -48,6 +49,7 @@ class CpuTransposeKernel;
  *  -# @ref kernels::CpuIm2ColKernel (called when the input comes from a convolutional layer)
  *  -# @ref kernels::CpuTransposeKernel (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
  *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric)
+ *     or @ref CpuDynamicQuantizedGemm (if floating-point with int8 weights)
  *  -# @ref kernels::CpuGemmMatrixAdditionKernel or @ref CpuGemmLowpOutputStage (if quantized asymmetric) (if @p biases is not equal to nullptr)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
@@ -70,6 +72,8 @@ public:
      * |:--------------|:------------------|:------|:--------------|
      * |F16            |F16                |F16    |F16            |
      * |F32            |F32                |F32    |F32            |
+     * |F16            |QSYMM8_PER_CHANNEL |F16    |F16            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
      *
@@ -77,7 +81,8 @@ public:
      * @param[in]  weights      Weights tensor info. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p src.
+     *                          Data type supported: Same as @p src, QSYMM8_PER_CHANNEL if @p src is F16/F32
+     *                          (@p src is then quantized on the fly with one scale per row).
      * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
      * @param[out] dst          Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
@@ -153,7 +158,10 @@ private:
         GemmTemp6,
         GemmTemp7,
         GemmTemp8,
-        // Slots above (0-9) reserved for either CpuGemm or CpuGemmLowpMatrixMultiplyCore
+        GemmTemp9,
+        GemmTemp10,
+        GemmTemp11,
+        // Slots above (0-12) reserved for either CpuGemm, CpuGemmLowpMatrixMultiplyCore or CpuDynamicQuantizedGemm
         TransposedWeights,
         ConvertedWeights,
         FlattenedSrc,
@@ -165,6 +173,7 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel>     _transpose_weights;
     std::unique_ptr<CpuGemm>                         _mm_gemm;
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>   _mm_gemmlowp;
+    std::unique_ptr<CpuDynamicQuantizedGemm>         _mm_dynamic_quantized;
 
     TensorInfo   _flattened_src;
     TensorInfo   _converted_weights;
@@ -178,8 +187,10 @@ private:
     bool                      _needs_weights_reshape;
     bool                      _is_fc_after_conv;
     bool                      _is_quantized_asymmetric;
+    bool                      _is_dynamically_quantized;
     bool                      _is_prepared;
     bool                      _enable_fast_math;
+    unsigned int              _weights_prefetch_distance;
     bool                      _fixed_format;
     arm_compute::WeightFormat _weight_format;
     bool                      _dynamic_weights;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,14 +47,15 @@ namespace
 cpu::AsmGemmInfo init_assembly_metadata(const GEMMInfo &info)
 {
     cpu::AsmGemmInfo asm_info;
-    asm_info.method                  = cpu::AsmConvMethod::Im2Col;
-    asm_info.reinterpret_input_as_3d = info.reinterpret_input_as_3d();
-    asm_info.depth_output_gemm3d     = info.depth_output_gemm3d();
-    asm_info.activation_info         = info.activation_info();
-    asm_info.fast_mode               = info.fast_math();
-    asm_info.fixed_format            = info.fixed_format();
-    asm_info.weight_format           = info.weight_format();
-    asm_info.accumulate              = info.accumulate();
+    asm_info.method                    = cpu::AsmConvMethod::Im2Col;
+    asm_info.reinterpret_input_as_3d   = info.reinterpret_input_as_3d();
+    asm_info.depth_output_gemm3d       = info.depth_output_gemm3d();
+    asm_info.activation_info           = info.activation_info();
+    asm_info.fast_mode                 = info.fast_math();
+    asm_info.fixed_format              = info.fixed_format();
+    asm_info.weight_format             = info.weight_format();
+    asm_info.accumulate                = info.accumulate();
+    asm_info.weights_prefetch_distance = info.weights_prefetch_distance();
     asm_info.transpose_b =
         info.pretranspose_B(); // The "pretranspose_B" flag here is not the same as the pretranspose_B_array method. The flag here signals to pretranspose_B_array method if we want to perform additional transpose on B before the pretranspose_B_array method
 
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmConv3d.h"
+
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <set>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+GEMMLowpOutputStageInfo calculate_output_stage_metadata(const ITensorInfo         *src,
+                                                        const ITensorInfo         *weights,
+                                                        const ITensorInfo         *dst,
+                                                        const ActivationLayerInfo &act)
+{
+    const QuantizationInfo        iqinfo    = src->quantization_info();
+    const QuantizationInfo        wqinfo    = weights->quantization_info();
+    const QuantizationInfo        oqinfo    = (dst->total_size() == 0) ? iqinfo : dst->quantization_info();
+    const UniformQuantizationInfo uoqinfo   = oqinfo.uniform();
+    const DataType                data_type = src->data_type();
+    // Merge activation with output stage
+    const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = {
+        ActivationLayerInfo::ActivationFunction::RELU, ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+        ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU};
+    PixelValue type_min{};
+    PixelValue type_max{};
+    std::tie(type_min, type_max) = get_min_max(data_type);
+    int32_t min_activation       = type_min.get<int32_t>();
+    int32_t max_activation       = type_max.get<int32_t>();
+    if (supported_acts.count(act.activation()) != 0)
+    {
+        std::tie(min_activation, max_activation) = get_quantized_activation_min_max(act, data_type, uoqinfo);
+    }
+    GEMMLowpOutputStageInfo os_info;
+    os_info.type               = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    os_info.gemmlowp_offset    = uoqinfo.offset;
+    os_info.gemmlowp_min_bound = min_activation;
+    os_info.gemmlowp_max_bound = max_activation;
+    quantization::calculate_quantized_multipliers(iqinfo, wqinfo, oqinfo, os_info);
+    return os_info;
+}
+
+cpu::AsmGemmInfo init_assembly_metadata(const Conv3dInfo &conv_info)
+{
+    cpu::AsmGemmInfo asm_info;
+    asm_info.method          = cpu::AsmConvMethod::Indirect;
+    asm_info.ps_info         = PadStrideInfo(conv_info.stride.x(), conv_info.stride.y(), conv_info.padding.left,
+                                             conv_info.padding.right, conv_info.padding.top, conv_info.padding.bottom,
+                                             conv_info.round_type);
+    asm_info.activation_info = conv_info.act_info;
+    asm_info.conv3d          = true;
+    asm_info.padding_top     = conv_info.padding.top;
+    asm_info.padding_left    = conv_info.padding.left;
+    asm_info.padding_front   = conv_info.padding.front;
+    asm_info.stride_depth    = conv_info.stride.z();
+    asm_info.padding_value   = 0.f;
+    asm_info.negated_offsets = false;
+    asm_info.fast_mode       = conv_info.enable_fast_math;
+    return asm_info;
+}
+} // namespace
+
+CpuGemmConv3d::CpuGemmConv3d()
+    : _gemm_asm_func(std::make_unique<CpuGemmAssemblyDispatch>()),
+      _activation_func(std::make_unique<CpuActivation>()),
+      _run_activation(false)
+{
+}
+
+CpuGemmConv3d::~CpuGemmConv3d() = default;
+
+void CpuGemmConv3d::configure(const ITensorInfo *src,
+                              const ITensorInfo *weights,
+                              const ITensorInfo *biases,
+                              ITensorInfo       *dst,
+                              const Conv3dInfo  &conv_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmConv3d::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmConv3d::validate(src, weights, biases, dst, conv_info));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info);
+
+    // Output auto initialization if not yet initialized
+    const TensorShape output_shape =
+        misc::shape_calculator::compute_conv3d_shape(src->tensor_shape(), weights->tensor_shape(), conv_info);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(output_shape));
+
+    _run_activation = conv_info.act_info.enabled() && !_gemm_asm_func->is_activation_supported(conv_info.act_info);
+
+    // Configure assembly dispatch
+    cpu::AsmGemmInfo asm_info = init_assembly_metadata(conv_info);
+    if (is_data_type_quantized(src->data_type()))
+    {
+        asm_info.output_stage = calculate_output_stage_metadata(src, weights, dst, conv_info.act_info);
+    }
+    _gemm_asm_func->configure(src, weights, biases, dst, asm_info);
+
+    // Configure activation
+    if (_run_activation)
+    {
+        _activation_func->configure(dst, nullptr, conv_info.act_info);
+    }
+}
+
+Status CpuGemmConv3d::validate(const ITensorInfo *src,
+                               const ITensorInfo *weights,
+                               const ITensorInfo *biases,
+                               const ITensorInfo *dst,
+                               const Conv3dInfo  &conv_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmConv3d::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NDHWC, "Data layout supported is NDHWC");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(conv_info.dilation != Size3D(1U, 1U, 1U));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != src->dimension(0));
+
+    // Validate biases
+    if (biases != nullptr)
+    {
+        if (is_data_type_quantized(src->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, biases);
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(biases->dimension(0) != weights->dimension(0),
+                                        "Biases size and number of dst feature maps should match");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(biases->num_dimensions() > 1, "Biases should be one dimensional");
+    }
+
+    // Validate against the configured destination, or the one configure() would initialize
+    const TensorShape output_shape =
+        misc::shape_calculator::compute_conv3d_shape(src->tensor_shape(), weights->tensor_shape(), conv_info);
+    TensorInfo dst_info(*dst);
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
+    else
+    {
+        dst_info = TensorInfo(*src);
+        dst_info.set_tensor_shape(output_shape);
+    }
+
+    // Validate Activation
+    const bool run_activation =
+        conv_info.act_info.enabled() && !CpuGemmAssemblyDispatch::is_activation_supported(conv_info.act_info);
+    if (run_activation)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(&dst_info, nullptr, conv_info.act_info));
+    }
+
+    const cpu::AsmGemmInfo asm_info = init_assembly_metadata(conv_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(src, weights, biases, &dst_info, asm_info));
+    return Status{};
+}
+
+void CpuGemmConv3d::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGemmConv3d::run");
+    prepare(tensors);
+
+    _gemm_asm_func->run(tensors);
+    if (_run_activation)
+    {
+        ITensor    *io = tensors.get_tensor(ACL_DST);
+        ITensorPack pack{{ACL_SRC, io}, {ACL_DST, io}};
+        _activation_func->run(pack);
+    }
+}
+
+void CpuGemmConv3d::prepare(ITensorPack &tensors)
+{
+    // The weights are consumed in place, so there is nothing to transform before the assembly dispatch
+    _gemm_asm_func->prepare(tensors);
+}
+
+experimental::MemoryRequirements CpuGemmConv3d::workspace() const
+{
+    return _gemm_asm_func->workspace();
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMCONV3D_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMCONV3D_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+struct Conv3dInfo;
+namespace cpu
+{
+/** Function to run a 3d convolution as an indirect GEMM.
+ *
+ * An indirection buffer holding one pointer per output point and kernel tap is built over the NDHWC source, so the
+ * assembly GEMM reads the source rows in place and no im2col copy is made. Taps falling in the padding point at a
+ * row of zero points. The weights are used as they are, since [OFM, IFM, kernel_x, kernel_y, kernel_z] is already
+ * the layout of the GEMM right-hand side.
+ *
+ *  This function calls the following functions:
+ *
+ * -# @ref CpuGemmAssemblyDispatch
+ * -# @ref CpuActivation (if the activation cannot be fused in the GEMM)
+ */
+class CpuGemmConv3d : public ICpuOperator
+{
+public:
+    CpuGemmConv3d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmConv3d);
+    ~CpuGemmConv3d();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NDHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |
+     * |QASYMM8        |QASYMM8        |S32            |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32            |QASYMM8_SIGNED |
+     *
+     * @param[in]  src       Source tensor info. 4 lower dimensions represent a single input
+     *                       [IFM, width, height, depth], while every optional dimension from 5 and above represent
+     *                       a batch of inputs.
+     * @param[in]  weights   Weights tensor info. Weights are 5D tensor with dimensions
+     *                       [OFM, IFM, kernel_x, kernel_y, kernel_z].
+     * @param[in]  biases    Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                       Can be nullptr.
+     * @param[out] dst       Destination tensor info. 4 lower dimensions represent a single output
+     *                       [OFM, width, height, depth], while the rest represent batch of outputs.
+     * @param[in]  conv_info Contains padding, stride, activation information described in @ref Conv3dInfo.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *biases,
+                   ITensorInfo       *dst,
+                   const Conv3dInfo  &conv_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmConv3d
+     *
+     * Similar to CpuGemmConv3d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *biases,
+                           const ITensorInfo *dst,
+                           const Conv3dInfo  &conv_info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    std::unique_ptr<CpuGemmAssemblyDispatch> _gemm_asm_func;
+    std::unique_ptr<CpuActivation>           _activation_func;
+    bool                                     _run_activation;
+};
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMCONV3D_H
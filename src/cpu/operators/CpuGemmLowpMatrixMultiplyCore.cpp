@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,13 +66,14 @@ inline bool int8_dequantize_f32_path(DataType src, DataType dst)
 cpu::AsmGemmInfo init_assembly_metadata(const GEMMInfo &info)
 {
     cpu::AsmGemmInfo asm_info;
-    asm_info.method                  = cpu::AsmConvMethod::Im2Col;
-    asm_info.reinterpret_input_as_3d = info.reinterpret_input_as_3d();
-    asm_info.depth_output_gemm3d     = info.depth_output_gemm3d();
-    asm_info.activation_info         = info.activation_info();
-    asm_info.output_stage            = info.gemmlowp_output_stage();
-    asm_info.fast_mode               = info.fast_math();
-    asm_info.accumulate              = info.accumulate();
+    asm_info.method                    = cpu::AsmConvMethod::Im2Col;
+    asm_info.reinterpret_input_as_3d   = info.reinterpret_input_as_3d();
+    asm_info.depth_output_gemm3d       = info.depth_output_gemm3d();
+    asm_info.activation_info           = info.activation_info();
+    asm_info.output_stage              = info.gemmlowp_output_stage();
+    asm_info.fast_mode                 = info.fast_math();
+    asm_info.accumulate                = info.accumulate();
+    asm_info.weights_prefetch_distance = info.weights_prefetch_distance();
 
     return asm_info;
 }
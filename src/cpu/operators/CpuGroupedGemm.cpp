@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGroupedGemm.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+CpuGroupedGemm::CpuGroupedGemm()
+    : _kernel(std::make_unique<kernels::CpuGroupedGemmKernel>()),
+      _aux_mem(AuxTensorIdx::Count),
+      _packed_weights(),
+      _is_prepared(false)
+{
+}
+
+CpuGroupedGemm::~CpuGroupedGemm() = default;
+
+void CpuGroupedGemm::configure(const ITensorInfo     *a,
+                               const ITensorInfo     *b,
+                               const ITensorInfo     *biases,
+                               const ITensorInfo     *group_sizes,
+                               ITensorInfo           *dst,
+                               const GroupedGemmInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemm::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, group_sizes, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGroupedGemm::validate(a, b, biases, group_sizes, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, biases, group_sizes, dst);
+
+    _is_prepared = false;
+    _kernel->configure(a, b, biases, group_sizes, dst, info);
+
+    _packed_weights = TensorInfo(TensorShape(_kernel->packed_layout().packed_size), 1, DataType::U8);
+    _aux_mem[PackedWeights] =
+        MemoryInfo(offset_int_vec(PackedWeights), MemoryLifetime::Persistent, _packed_weights.total_size());
+}
+
+Status CpuGroupedGemm::validate(const ITensorInfo     *a,
+                                const ITensorInfo     *b,
+                                const ITensorInfo     *biases,
+                                const ITensorInfo     *group_sizes,
+                                const ITensorInfo     *dst,
+                                const GroupedGemmInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemm::validate");
+    return kernels::CpuGroupedGemmKernel::validate(a, b, biases, group_sizes, dst, info);
+}
+
+void CpuGroupedGemm::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemm::run");
+    prepare(tensors);
+
+    CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors);
+
+    // All the tiles of all the groups are dispatched in a single launch
+    ITensorPack pack{{TensorType::ACL_SRC_0, tensors.get_const_tensor(TensorType::ACL_SRC_0)},
+                     {TensorType::ACL_SRC_1, packed_weights.get()},
+                     {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_3)},
+                     {TensorType::ACL_DST, tensors.get_tensor(TensorType::ACL_DST)}};
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimX, _kernel->window(), pack);
+}
+
+void CpuGroupedGemm::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuGroupedGemm::prepare");
+        const ITensor *b      = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        const ITensor *biases = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(b);
+
+        CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors);
+        _kernel->pack_weights(b, biases, packed_weights.get());
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGroupedGemm::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGROUPEDGEMM_H
+#define ACL_SRC_CPU_OPERATORS_CPUGROUPEDGEMM_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuGroupedGemmKernel.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run a grouped GEMM, where every group of rows is multiplied by its own weights
+ *
+ * The weights and biases of all the groups are packed once on the first run, while the number of rows of every
+ * group is read on every run. The tensors are passed to the operator as:
+ * - ACL_SRC_0: left-hand side
+ * - ACL_SRC_1: weights
+ * - ACL_SRC_2: biases
+ * - ACL_SRC_3: group sizes
+ * - ACL_DST: destination
+ */
+class CpuGroupedGemm : public ICpuOperator
+{
+public:
+    CpuGroupedGemm();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGroupedGemm);
+    ~CpuGroupedGemm();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |a              |b              |biases         |group_sizes    |d              |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |S32            |F16            |
+     * |F32            |F32            |F32            |S32            |F32            |
+     *
+     * @param[in]  a           Left-hand side tensor info [K, rows], with the rows of every group stored contiguously.
+     *                         Data types supported: F16/F32.
+     * @param[in]  b           Weights tensor info [N, K, groups]. Data type supported: Same as @p a.
+     * @param[in]  biases      Biases tensor info [N, groups]. Can be nullptr. Data type supported: Same as @p a.
+     * @param[in]  group_sizes Number of rows of every group [groups]. Data type supported: S32.
+     * @param[out] dst         Destination tensor info [N, rows]. Data type supported: Same as @p a.
+     * @param[in]  info        Grouped GEMM information.
+     */
+    void configure(const ITensorInfo     *a,
+                   const ITensorInfo     *b,
+                   const ITensorInfo     *biases,
+                   const ITensorInfo     *group_sizes,
+                   ITensorInfo           *dst,
+                   const GroupedGemmInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGroupedGemm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *a,
+                           const ITensorInfo     *b,
+                           const ITensorInfo     *biases,
+                           const ITensorInfo     *group_sizes,
+                           const ITensorInfo     *dst,
+                           const GroupedGemmInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        PackedWeights = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuGroupedGemmKernel> _kernel;
+    experimental::MemoryRequirements               _aux_mem;
+    TensorInfo                                     _packed_weights;
+    bool                                           _is_prepared;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGROUPEDGEMM_H
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuImagePreprocess.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/CpuImagePreprocessKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuImagePreprocess::configure(const ITensorInfo         *src,
+                                   const ITensorInfo         *src_uv,
+                                   ITensorInfo               *dst,
+                                   const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuImagePreprocess::configure");
+    ARM_COMPUTE_LOG_PARAMS(src, src_uv, dst);
+    auto k = std::make_unique<kernels::CpuImagePreprocessKernel>();
+    k->configure(src, src_uv, dst, info);
+    _kernel = std::move(k);
+}
+
+Status CpuImagePreprocess::validate(const ITensorInfo         *src,
+                                    const ITensorInfo         *src_uv,
+                                    const ITensorInfo         *dst,
+                                    const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuImagePreprocess::validate");
+    return kernels::CpuImagePreprocessKernel::validate(src, src_uv, dst, info);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -87,6 +87,7 @@ CpuMatMul::CpuMatMul()
     : _transpose_kernel_lhs(),
       _transpose_kernel_rhs(),
       _asm_glue(),
+      _mm_dynamic_quantized(),
       _lhs_transposed(),
       _rhs_transposed(),
       _original_lhs_shape(),
@@ -103,9 +104,17 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                            const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuMatMul::validate");
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, rhs, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32, DataType::F16, DataType::BFLOAT16,
                                                          DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    const bool is_dynamically_quantized = CpuDynamicQuantizedGemm::is_dynamic_quantization(lhs, rhs);
+    if (is_dynamically_quantized)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, dst);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, rhs, dst);
+    }
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->are_values_constant(), "LHS Tensor must be dynamic.");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs->are_values_constant(), "RHS Tensor must be dynamic.");
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(lhs);
@@ -146,6 +155,22 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                                     "The product AB is defined only if the number of columns in A is equal to the "
                                     "number of rows in B (after transpose)");
 
+    if (is_dynamically_quantized)
+    {
+        // The int8 rhs is shared by all the batches, which are collapsed into the rows of a single GEMM
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(adj_lhs, "Transposed LHS is unsupported with dynamically quantized RHS.");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs_to_use->num_dimensions() > 2,
+                                        "Batched RHS is unsupported with dynamically quantized RHS.");
+
+        const TensorInfo lhs_2d = lhs->clone()->set_tensor_shape(lhs->tensor_shape().collapsed_from(1));
+        const TensorInfo dst_2d = dst->clone()->set_tensor_shape(dst->tensor_shape().collapsed_from(1));
+
+        GEMMInfo mm_info(false, false, false);
+        mm_info.set_activation_info(act_info);
+        mm_info.set_fast_math(settings.fast_math());
+        return CpuDynamicQuantizedGemm::validate(&lhs_2d, rhs_to_use, nullptr, &dst_2d, mm_info);
+    }
+
     // Iterate over dimensions to be collapsed in operator - check dimensions are equivalent between tensors
     for (unsigned int i = 2; i < Coordinates::num_max_dimensions; i++)
     {
@@ -189,9 +214,10 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     ARM_COMPUTE_LOG_PARAMS(lhs, rhs, dst, info, settings);
     ARM_COMPUTE_ERROR_THROW_ON(CpuMatMul::validate(lhs, rhs, dst, info, settings));
 
-    _adj_lhs   = info.adj_lhs();
-    _adj_rhs   = info.adj_rhs();
-    _fast_math = settings.fast_math();
+    _adj_lhs                  = info.adj_lhs();
+    _adj_rhs                  = info.adj_rhs();
+    _fast_math                = settings.fast_math();
+    _is_dynamically_quantized = CpuDynamicQuantizedGemm::is_dynamic_quantization(lhs, rhs);
 
     // 1. Create and reshape tensors
     // ------------------------------------------------------
@@ -207,6 +233,12 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     _original_dst_shape = dst_to_use.tensor_shape();
     _original_rhs_shape = rhs_to_use.tensor_shape();
 
+    if (_is_dynamically_quantized)
+    {
+        configure_dynamically_quantized(lhs_to_use, rhs_to_use, dst_to_use, settings, act_info);
+        return;
+    }
+
     // Reshape lhs for use with assembly kernels.
     lhs_to_use.set_tensor_shape(
         TensorShape(_original_lhs_shape.x(), _original_lhs_shape.y(), 1, _original_lhs_shape.collapsed_from(2).z()));
@@ -239,10 +271,11 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     // -----------------------------------------------------
     // Use transposed tensors if the corresponding transpose flags are set
     // Fill AsmGemmInfo class object before configuration
-    _gemm_info.activation_info = act_info;
-    _gemm_info.fast_mode       = settings.fast_math();
-    _gemm_info.fixed_format    = settings.fixed_format();
-    _gemm_info.negated_offsets = false;
+    _gemm_info.activation_info           = act_info;
+    _gemm_info.fast_mode                 = settings.fast_math();
+    _gemm_info.fixed_format              = settings.fixed_format();
+    _gemm_info.weights_prefetch_distance = settings.weights_prefetch_distance();
+    _gemm_info.negated_offsets           = false;
 
     lhs_to_use = (_adj_lhs) ? _lhs_transposed : lhs_to_use;
     rhs_to_use = (_adj_rhs) ? _rhs_transposed : rhs_to_use;
@@ -285,9 +318,51 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     }
 }
 
+void CpuMatMul::configure_dynamically_quantized(TensorInfo                &lhs_to_use,
+                                                TensorInfo                &rhs_to_use,
+                                                TensorInfo                &dst_to_use,
+                                                const CpuMatMulSettings   &settings,
+                                                const ActivationLayerInfo &act_info)
+{
+    // Collapse the batches of lhs/dst into rows so that a single GEMM is run against the 2D int8 rhs
+    lhs_to_use.set_tensor_shape(_original_lhs_shape.collapsed_from(1));
+    dst_to_use.set_tensor_shape(_original_dst_shape.collapsed_from(1));
+
+    if (_adj_rhs)
+    {
+        _transpose_kernel_rhs = std::make_unique<cpu::kernels::CpuTransposeKernel>();
+        _transpose_kernel_rhs->configure(&rhs_to_use, &_rhs_transposed);
+
+        _aux_mem[TransposeRHS] =
+            MemoryInfo(offset_int_vec(TransposeRHS), MemoryLifetime::Temporary, rhs_to_use.total_size());
+        rhs_to_use = _rhs_transposed;
+    }
+
+    // rhs is dynamic, so it is reshaped on every run
+    GEMMInfo mm_info(false, false, false);
+    mm_info.set_activation_info(act_info);
+    mm_info.set_fast_math(settings.fast_math());
+
+    _mm_dynamic_quantized = std::make_unique<CpuDynamicQuantizedGemm>();
+    _mm_dynamic_quantized->configure(&lhs_to_use, &rhs_to_use, nullptr, &dst_to_use, mm_info);
+
+    int idx = 0;
+    for (const auto &aux : _mm_dynamic_quantized->workspace())
+    {
+        _aux_mem[idx] = aux;
+        idx++;
+    }
+}
+
 void CpuMatMul::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuMatMul::run");
+    if (_is_dynamically_quantized)
+    {
+        run_dynamically_quantized(tensors);
+        return;
+    }
+
     // Retrieve tensors from tensor pack
     auto lhs = tensors.get_tensor(ACL_SRC_0);
     auto rhs = tensors.get_const_tensor(ACL_SRC_1);
@@ -335,6 +410,32 @@ void CpuMatMul::run(ITensorPack &tensors)
     rhs->info()->set_tensor_shape(_original_rhs_shape);
 }
 
+void CpuMatMul::run_dynamically_quantized(ITensorPack &tensors)
+{
+    auto lhs = tensors.get_tensor(ACL_SRC_0);
+    auto rhs = tensors.get_const_tensor(ACL_SRC_1);
+    auto dst = tensors.get_tensor(ACL_DST);
+
+    lhs->info()->set_tensor_shape(_original_lhs_shape.collapsed_from(1));
+    dst->info()->set_tensor_shape(_original_dst_shape.collapsed_from(1));
+
+    CpuAuxTensorHandler rhs_transposed(offset_int_vec(TransposeRHS), _rhs_transposed, tensors, true);
+
+    ITensorPack mm_tensors(tensors);
+    if (_adj_rhs)
+    {
+        ITensorPack rhs_transpose_pack = {{TensorType::ACL_SRC, rhs}, {TensorType::ACL_DST, rhs_transposed.get()}};
+        NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), Window::DimY, _transpose_kernel_rhs->window(),
+                                       rhs_transpose_pack);
+        mm_tensors.add_const_tensor(TensorType::ACL_SRC_1, rhs_transposed.get());
+    }
+    _mm_dynamic_quantized->run(mm_tensors);
+
+    // Undo reshape of tensors
+    dst->info()->set_tensor_shape(_original_dst_shape);
+    lhs->info()->set_tensor_shape(_original_lhs_shape);
+}
+
 experimental::MemoryRequirements CpuMatMul::workspace() const
 {
     return _aux_mem;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 namespace arm_compute
@@ -45,6 +46,8 @@ namespace cpu
  *  -# @ref cpu::kernels::CpuTransposeKernel
  * Then :
  *  -# @ref cpu::CpuGemmAssemblyDispatch
+ * Or, if lhs is F16/F32 and rhs is QSYMM8/QSYMM8_PER_CHANNEL :
+ *  -# @ref cpu::CpuDynamicQuantizedGemm
  */
 class CpuMatMul : public ICpuOperator
 {
@@ -62,7 +65,7 @@ public:
      *
      * @param[in]  lhs      Left-hand side tensor info.
      * @param[in]  rhs      Right-hand side tensor info.
-     * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
+     * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings The settings for matmul operation (i.e fast math)
      * @param[in]  act_info Class containing information about fused activation function.
@@ -93,16 +96,24 @@ public:
 private:
     enum InternalTensorIdx
     {
-        /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
-        TransposeLHS = 3,
+        /* Slots 0 - 12 reserved for CpuGemmAssemblyDispatch or CpuDynamicQuantizedGemm */
+        TransposeLHS = 13,
         TransposeRHS,
         Count
     };
 
+    void configure_dynamically_quantized(TensorInfo                &lhs_to_use,
+                                         TensorInfo                &rhs_to_use,
+                                         TensorInfo                &dst_to_use,
+                                         const CpuMatMulSettings   &settings,
+                                         const ActivationLayerInfo &act_info);
+    void run_dynamically_quantized(ITensorPack &tensors);
+
     // Define unique pointers to kernels/operators used by matmul
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
     std::unique_ptr<CpuGemmAssemblyDispatch>     _asm_glue{nullptr};
+    std::unique_ptr<CpuDynamicQuantizedGemm>     _mm_dynamic_quantized{nullptr};
 
     // TensorInfo for tensors stored in auxillary memory
     TensorInfo _lhs_transposed{};
@@ -117,6 +128,7 @@ private:
     bool                             _adj_lhs{false};
     bool                             _adj_rhs{false};
     bool                             _fast_math{false};
+    bool                             _is_dynamically_quantized{false};
     AsmGemmInfo                      _gemm_info{};
     experimental::MemoryRequirements _aux_mem{Count};
 };
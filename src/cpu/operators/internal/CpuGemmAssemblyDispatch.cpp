@@ -26,6 +26,8 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/SharedWeightsStore.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/CPP/Validate.h"
@@ -37,6 +39,7 @@
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 #include <arm_neon.h>
+#include <string>
 
 namespace arm_compute
 {
@@ -99,6 +102,37 @@ void run_parallel_pretranspose_B_array(arm_gemm::GemmCommon<TypeInput, TypeWeigh
     }
     NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/pretranspose_B_array");
 }
+
+/** Output stage parameters folded into the pretransposed B. Only the quantized kernels fold the offsets. */
+template <typename OutputStage>
+std::string pretranspose_output_stage_id(const OutputStage &)
+{
+    return std::string();
+}
+
+std::string pretranspose_output_stage_id(const arm_gemm::Requantize32 &os)
+{
+    return "_a" + std::to_string(os.a_offset) + "_b" + std::to_string(os.b_offset);
+}
+
+/** Checks if the rows of dimensions 1 to @p last_dim of a tensor are evenly spaced
+ *
+ * The 3D reinterpretations of the GEMM walk these rows with the stride of dimension 1 only, which strided views of a
+ * larger tensor and padding along Y don't allow.
+ */
+bool has_evenly_spaced_rows(const ITensorInfo &info, size_t last_dim)
+{
+    size_t row_span = info.dimension(1) * info.strides_in_bytes()[1];
+    for (size_t d = 2; d <= last_dim; ++d)
+    {
+        if (info.dimension(d) > 1 && info.strides_in_bytes()[d] != row_span)
+        {
+            return false;
+        }
+        row_span *= info.dimension(d);
+    }
+    return true;
+}
 } // namespace
 
 using namespace arm_compute::experimental;
@@ -131,6 +165,10 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     {
         p.indirect = true;
         p.sections = b->tensor_shape()[2] * b->tensor_shape()[3];
+        if (info.conv3d)
+        {
+            p.sections *= b->tensor_shape()[4];
+        }
     }
     else
     {
@@ -144,6 +182,12 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
         p.M       = d->tensor_shape().y() * d->tensor_shape().z();
         p.batches = d->tensor_shape().total_size_upper(3) / p.multis;
     }
+    // The rows of a 3D convolution span the output width, height and depth
+    else if (info.conv3d)
+    {
+        p.M       = d->tensor_shape()[1] * d->tensor_shape()[2] * d->tensor_shape()[3];
+        p.batches = d->tensor_shape().total_size_upper(4) / p.multis;
+    }
 
     return p;
 }
@@ -259,9 +303,22 @@ private:
      * @param[in]  info GEMM meta-data
      */
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
-    /** Prepare the indirect buffer */
+    /** Prepare the indirect buffer
+     *
+     * The buffer holds pointers into the source tensor, so it is rebuilt whenever the source buffer changes.
+     */
     void prepare_indirect_buffer(ITensorPack &tensors);
 
+    /** Depth parameters of an indirect 3D convolution. They are all 1 (and the padding 0) for 2D convolutions */
+    struct IndirectDepth
+    {
+        int64_t input{1};
+        int64_t kernel{1};
+        int64_t output{1};
+        int64_t stride{1};
+        int64_t padding{0};
+    };
+
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
     /** Assembly Gemm kernel */
@@ -288,13 +345,21 @@ private:
     std::vector<const TypeInput *const *> _indirect_arg{};
     std::vector<const TypeInput *>        _indirect_buf{};
     std::vector<TypeInput>                _indirect_pad{};
+    const TypeInput                      *_indirect_src{nullptr};
     arm_gemm::ConvolutionParameters       _cp{};
+    IndirectDepth                         _depth{};
     experimental::MemoryRequirements      _aux_mem{Count};
     bool                                  _B_pretranspose_required{false};
     bool                                  _is_b_constant{true};
     bool                                  _is_c_constant{true};
     bool                                  _run_pre_pretranspose_b{false};
     bool                                  _B_pre_pretranspose_required{false};
+    /** Whether the pretransposed B is held by the @ref SharedWeightsStore rather than by the Pretranspose tensor */
+    bool _share_pretranspose{false};
+    /** Identity of the pretransposition, used with the hash of B as key of the shared pretransposed B */
+    std::string _shared_transform{};
+    /** Shared pretransposed B, kept alive for as long as this function runs */
+    std::shared_ptr<IMemoryRegion> _shared_pretranspose{nullptr};
 };
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -320,48 +385,55 @@ Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::set_requantize_data(co
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_buffer(ITensorPack &tensors)
 {
-    auto             a              = tensors.get_const_tensor(TensorType::ACL_SRC_0);
-    const TypeInput *A_ptr          = reinterpret_cast<TypeInput *>(a->buffer());
-    const int        multis         = 1;
-    const int        batches        = a->info()->tensor_shape().total_size_upper(3);
-    const size_t     stride_A       = a->info()->strides_in_bytes().y() / sizeof(TypeInput);
-    const size_t     batch_stride_A = a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
-    const size_t     multi_stride_A = a->info()->strides_in_bytes()[4] / sizeof(TypeInput);
-
-    const size_t output_hw    = _cp.output_height * _cp.output_width;
-    const int    batch_size   = _cp.kernel_height * _cp.kernel_width * output_hw * sizeof(TypeInput);
-    const size_t batch_stride = batch_size / sizeof(TypeInput);
-    const int    multi_size   = batch_size * batches;
-    const size_t multi_stride = multi_size / sizeof(TypeInput);
-
-    for (int64_t m = 0; m < multis; m++)
+    auto             a         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const uint8_t   *a_buffer  = a->buffer() + a->info()->offset_first_element_in_bytes();
+    const TypeInput *A_ptr     = reinterpret_cast<const TypeInput *>(a_buffer);
+    const size_t     batch_idx = _gemm_info.conv3d ? 4 : 3;
+    const int        batches   = a->info()->tensor_shape().total_size_upper(batch_idx);
+    const Strides   &strides   = a->info()->strides_in_bytes();
+    const size_t     stride_x  = strides[1] / sizeof(TypeInput);
+    const size_t     stride_y  = strides[2] / sizeof(TypeInput);
+    const size_t     stride_z  = strides[3] / sizeof(TypeInput);
+    const size_t     stride_b  = strides[batch_idx] / sizeof(TypeInput);
+
+    const size_t output_size  = _cp.output_height * _cp.output_width * _depth.output;
+    const size_t kernel_size  = _cp.kernel_height * _cp.kernel_width * _depth.kernel;
+    const size_t batch_stride = kernel_size * output_size;
+
+    for (int64_t b = 0; b < batches; b++)
     {
-        for (int64_t b = 0; b < batches; b++)
+        for (int64_t output_z = 0; output_z < _depth.output; output_z++)
         {
             for (int64_t output_y = 0; output_y < _cp.output_height; output_y++)
             {
                 for (int64_t output_x = 0; output_x < _cp.output_width; output_x++)
                 {
-                    int64_t output_xy = (output_y * _cp.output_width) + output_x;
+                    const int64_t output_xyz = (output_z * _cp.output_height + output_y) * _cp.output_width + output_x;
 
-                    for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
+                    for (int64_t kernel_z = 0; kernel_z < _depth.kernel; kernel_z++)
                     {
-                        for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
+                        for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
                         {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
-                            int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
-                            int64_t input_xy  = (input_y * _cp.input_width) + input_x;
-
-                            if (input_x < 0 || input_x >= _cp.input_width || input_y < 0 || input_y >= _cp.input_height)
+                            for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
                             {
-                                _indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    _indirect_pad.data();
-                            }
-                            else
-                            {
-                                _indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    A_ptr + (m * multi_stride_A + b * batch_stride_A + input_xy * stride_A);
+                                const int64_t input_x = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
+                                const int64_t input_y = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
+                                const int64_t input_z = (output_z * _depth.stride) + kernel_z - _depth.padding;
+                                const int64_t kernel_xyz =
+                                    (kernel_z * _cp.kernel_height + kernel_y) * _cp.kernel_width + kernel_x;
+
+                                const TypeInput *&ptr =
+                                    _indirect_buf[b * batch_stride + kernel_xyz * output_size + output_xyz];
+                                if (input_x < 0 || input_x >= _cp.input_width || input_y < 0 ||
+                                    input_y >= _cp.input_height || input_z < 0 || input_z >= _depth.input)
+                                {
+                                    ptr = _indirect_pad.data();
+                                }
+                                else
+                                {
+                                    ptr = A_ptr + (b * stride_b + input_z * stride_z + input_y * stride_y +
+                                                   input_x * stride_x);
+                                }
                             }
                         }
                     }
@@ -369,6 +441,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_
             }
         }
     }
+    _indirect_src = A_ptr;
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -415,31 +488,33 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
 
     if (info.method == AsmConvMethod::Indirect)
     {
-        const unsigned int multis    = 1;
-        const unsigned int batches   = a->tensor_shape().total_size_upper(3);
-        const unsigned int kernel_hw = _cp.kernel_width * _cp.kernel_height;
-        const unsigned int output_hw = _cp.output_width * _cp.output_height;
-
-        using TypeInputPtr        = TypeInput *;
-        const int    batch_size   = kernel_hw * output_hw * sizeof(TypeInputPtr);
-        const size_t batch_stride = batch_size / sizeof(TypeInputPtr);
-        const int    multi_size   = batch_size * batches;
-        const size_t multi_stride = multi_size / sizeof(TypeInputPtr);
-
-        _indirect_buf = std::vector<const TypeInput *>(multi_size * multis);
-        _indirect_arg = std::vector<const TypeInput *const *>(sizeof(TypeInput **) * kernel_hw * multis * batches);
+        if (info.conv3d)
+        {
+            _depth.input   = static_cast<int64_t>(a->tensor_shape()[3]);
+            _depth.kernel  = static_cast<int64_t>(b->tensor_shape()[4]);
+            _depth.output  = static_cast<int64_t>(d->tensor_shape()[3]);
+            _depth.stride  = info.stride_depth;
+            _depth.padding = info.padding_front;
+        }
+
+        const unsigned int batches     = a->tensor_shape().total_size_upper(info.conv3d ? 4 : 3);
+        const unsigned int kernel_size = _cp.kernel_width * _cp.kernel_height * _depth.kernel;
+        const unsigned int output_size = _cp.output_width * _cp.output_height * _depth.output;
+
+        const size_t batch_stride = kernel_size * output_size;
+
+        _indirect_buf = std::vector<const TypeInput *>(batch_stride * batches);
+        _indirect_arg = std::vector<const TypeInput *const *>(kernel_size * batches);
         _indirect_pad = std::vector<TypeInput>(_cp.input_channels, TypeInput(zeropad));
+        _indirect_src = nullptr;
 
         // Set indirect argument
         int64_t pos = 0;
-        for (int64_t m = 0; m < multis; m++)
+        for (int64_t b = 0; b < batches; b++)
         {
-            for (int64_t b = 0; b < batches; b++)
+            for (int64_t kernel_xyz = 0; kernel_xyz < kernel_size; kernel_xyz++)
             {
-                for (int64_t kernel_xy = 0; kernel_xy < kernel_hw; kernel_xy++)
-                {
-                    _indirect_arg[pos++] = &_indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw];
-                }
+                _indirect_arg[pos++] = &_indirect_buf[b * batch_stride + kernel_xyz * output_size];
             }
         }
 
@@ -471,7 +546,9 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
     // arm_compute wrapper for the Gemm object (see above)
     auto acl_gemm_wrapper = std::make_unique<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
     ARM_COMPUTE_ERROR_ON(acl_gemm_wrapper == nullptr);
-    acl_gemm_wrapper->configure(_gemm_kernel_asm.get(), gemm_cfg.filter);
+    const uint64_t flops = 2ULL * args._Msize * args._Nsize * args._Ksize * args._Ksections * args._nbatches *
+                           args._nmulti;
+    acl_gemm_wrapper->configure(_gemm_kernel_asm.get(), gemm_cfg.filter, flops);
     const size_t       workspace_size = _gemm_kernel_asm->get_working_size();
     const unsigned int alignment      = 4096;
     _workspace_info                   = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
@@ -540,8 +617,24 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         const unsigned int alignment           = 128;
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         _pretranspose_info                     = TensorInfo(TensorShape(B_pretranspose_size), 1, DataType::U8);
+
+        // Constant weights can be pretransposed once for all the functions using them. The biases of the quantized
+        // kernels are folded into the pretransposed B, so they must be constant as well.
+        const bool has_s32_bias = c != nullptr && c->data_type() == DataType::S32;
+        _share_pretranspose     = SharedWeightsStore::get().is_enabled() && _is_b_constant &&
+                              !(has_s32_bias && !_is_c_constant);
+        if (_share_pretranspose)
+        {
+            _shared_transform = std::string(gemm_cfg.filter) + "_n" + std::to_string(args._Nsize) + "_k" +
+                                std::to_string(args._Ksize) + "_s" + std::to_string(args._Ksections) + "_m" +
+                                std::to_string(args._nmulti) + "_t" + std::to_string(_B_pre_pretranspose_required) +
+                                pretranspose_output_stage_id(os);
+        }
+
+        // The shared pretransposed B does not belong to the function, so it needs no auxiliary memory
+        const size_t   aux_size = _share_pretranspose ? 0 : B_pretranspose_size;
         MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
-        _aux_mem[Pretranspose]  = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+        _aux_mem[Pretranspose]  = MemoryInfo(offset_int_vec(Pretranspose), lifetime, aux_size, alignment);
     }
 
     // Handle indirect GEMM convolution
@@ -602,25 +695,52 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
                 b_to_use->buffer() + b_to_use->info()->offset_first_element_in_bytes());
             const int multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
 
-            CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
+            const bool kernel_supports_transpose = _gemm_kernel_asm->B_pretranspose_supports_transpose();
+            const bool transpose                 = _B_pre_pretranspose_required && kernel_supports_transpose;
 
-            ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
+            if (_share_pretranspose)
+            {
+                // The pretransposed B depends on the source B, as given by the user, and on the quantized biases
+                SharedWeightsStore::Key key{SharedWeightsStore::hash(*b),
+                                            b->info()->tensor_shape().total_size() * b->info()->element_size(),
+                                            SharedWeightsStore::sample(*b), _shared_transform};
+                if (c && c->info()->data_type() == DataType::S32)
+                {
+                    key.content_hash = SharedWeightsStore::hash(*c, key.content_hash);
+                    key.source_size += c->info()->tensor_shape().total_size() * c->info()->element_size();
+                }
 
-            const bool kernel_supports_transpose = _gemm_kernel_asm->B_pretranspose_supports_transpose();
-            run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
-                _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
-                NEScheduler::get().num_threads(), _B_pre_pretranspose_required && kernel_supports_transpose);
+                _shared_pretranspose = SharedWeightsStore::get().acquire(
+                    key, _pretranspose_info.total_size(), 128,
+                    [&](void *buffer)
+                    {
+                        Tensor pretranspose;
+                        pretranspose.allocator()->init(_pretranspose_info);
+                        pretranspose.allocator()->import_memory(buffer);
+                        run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
+                            _gemm_kernel_asm.get(), &pretranspose, in1_ptr, ldb, multi_stride_b,
+                            NEScheduler::get().num_threads(), transpose);
+                    });
+
+                // Point the kernel at the shared copy, whether this function produced it or not
+                _gemm_kernel_asm->set_pretransposed_B_data(_shared_pretranspose->buffer());
+            }
+            else
+            {
+                CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
+
+                ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
+
+                run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
+                    _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
+                    NEScheduler::get().num_threads(), transpose);
+            }
 
             b->mark_as_unused();
             // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b,
             // its memory will be auto-managed by the handler
         }
 
-        if (_gemm_info.method == AsmConvMethod::Indirect)
-        {
-            prepare_indirect_buffer(tensors);
-        }
-
         _is_prepared = true;
     }
 }
@@ -661,7 +781,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     const size_t a_batch_idx = _gemm_info.reinterpret_input_as_3d != 0 ? 3 : 2;
     const size_t a_multi_idx = a_batch_idx + 1;
-    const size_t d_batch_idx = _gemm_info.depth_output_gemm3d != 0 ? 3 : 2;
+    const size_t d_batch_idx = _gemm_info.conv3d ? 4 : (_gemm_info.depth_output_gemm3d != 0 ? 3 : 2);
     const size_t d_multi_idx = d_batch_idx + 1;
 
     int       batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
@@ -784,6 +904,11 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     if (_gemm_info.method == AsmConvMethod::Indirect)
     {
+        // The indirect buffer points into the source, rebuild it if the source has moved since the last run
+        if (in0_ptr != _indirect_src)
+        {
+            prepare_indirect_buffer(tensors);
+        }
         in0_ptr        = nullptr;
         lda            = 0;
         batch_stride_a = 0;
@@ -856,7 +981,8 @@ void create_arm_gemm(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &arm_ge
     bool fast_mode = info.fast_mode || (is_fp16 && !info.use_fp32_acc);
 
     arm_gemm::GemmConfig cfg;
-    cfg.weight_format = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
+    cfg.weight_format             = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
+    cfg.weights_prefetch_distance = info.weights_prefetch_distance;
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
                             info.fixed_format, fast_mode, info.accumulate, &cfg);
 
@@ -882,7 +1008,8 @@ void create_arm_gemm_dequant(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback>
     const unsigned int num_threads = NEScheduler::get().num_threads();
 
     arm_gemm::GemmConfig cfg;
-    cfg.weight_format = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
+    cfg.weight_format             = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
+    cfg.weights_prefetch_distance = info.weights_prefetch_distance;
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
                             info.fixed_format, info.fast_mode, info.accumulate, &cfg);
 
@@ -914,7 +1041,8 @@ void create_arm_gemm_quant(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &
     const unsigned int num_threads = NEScheduler::get().num_threads();
 
     arm_gemm::GemmConfig cfg;
-    cfg.weight_format = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
+    cfg.weight_format             = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
+    cfg.weights_prefetch_distance = info.weights_prefetch_distance;
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
                             info.fixed_format, info.fast_mode, info.accumulate, &cfg);
 
@@ -1090,6 +1218,11 @@ Status CpuGemmAssemblyDispatch::validate(
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run),
                                     "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.reinterpret_input_as_3d && !has_evenly_spaced_rows(*a, 2),
+                                    "The rows of the 3D input must be evenly spaced");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->total_size() != 0 && (info.depth_output_gemm3d || info.conv3d) &&
+                                        !has_evenly_spaced_rows(*d, info.conv3d ? 3 : 2),
+                                    "The rows of the 3D output must be evenly spaced");
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,12 @@ struct AsmGemmInfo
     bool                      depth_output_gemm3d{false};
     int64_t                   padding_top{0};
     int64_t                   padding_left{0};
+    /** Whether the indirect convolution is 3D. The source is then NDHWC, the weights are [OFM, IFM, W, H, D] and
+     * ps_info, padding_top and padding_left give the width and height parameters.
+     */
+    bool                      conv3d{false};
+    int64_t                   padding_front{0};
+    unsigned int              stride_depth{1};
     float                     padding_value{0.f};
     bool                      fast_mode{false};
     bool                      fixed_format{false};
@@ -66,6 +72,8 @@ struct AsmGemmInfo
      *       fixed format kernels do not accept weights (B) with any prior transformations
      */
     bool transpose_b{false};
+    /** Number of bytes of the pretransposed weights to prefetch ahead of the kernel in GEMV shapes. 0 disables it */
+    unsigned int weights_prefetch_distance{0};
 };
 
 /** Assembly kernel glue */
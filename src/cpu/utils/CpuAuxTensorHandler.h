@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,9 @@ namespace cpu
  *          tensor_pack.add_tensor(aux_handler.get());
  *      }
  *      op.run(tensor_pack);
+ *
+ * @note Handlers are created on every run of the operators. Importing a tensor from the tensor pack, which is what
+ *       happens in steady state when the workspace is managed by the runtime function, doesn't allocate any memory.
  */
 class CpuAuxTensorHandler
 {
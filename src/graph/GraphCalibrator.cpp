@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphCalibrator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Workload.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Restores the task executor when going out of scope */
+class ExecuteFunctionGuard final
+{
+public:
+    ExecuteFunctionGuard() : _execute_function(TaskExecutor::get().execute_function)
+    {
+    }
+    ~ExecuteFunctionGuard()
+    {
+        TaskExecutor::get().execute_function = _execute_function;
+    }
+    const std::function<decltype(execute_task)> &execute_function() const
+    {
+        return _execute_function;
+    }
+
+private:
+    std::function<decltype(execute_task)> _execute_function;
+};
+} // namespace
+
+void CalibrationData::update(TensorID tid, float min, float max)
+{
+    auto it = _ranges.find(tid);
+    if (it == _ranges.end())
+    {
+        _ranges.emplace(tid, std::make_pair(min, max));
+    }
+    else
+    {
+        it->second.first  = std::min(it->second.first, min);
+        it->second.second = std::max(it->second.second, max);
+    }
+}
+
+bool CalibrationData::range(TensorID tid, float &min, float &max) const
+{
+    const auto it = _ranges.find(tid);
+    if (it == _ranges.end())
+    {
+        return false;
+    }
+    min = it->second.first;
+    max = it->second.second;
+    return true;
+}
+
+size_t CalibrationData::size() const
+{
+    return _ranges.size();
+}
+
+void CalibrationData::load(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        std::istringstream ss(line);
+        TensorID           tid = NullTensorID;
+        float              min = 0.f;
+        float              max = 0.f;
+        if (!(ss >> tid >> min >> max) || min > max)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        update(tid, min, max);
+    }
+}
+
+void CalibrationData::save(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    fs.open(filename, std::ios::out);
+    fs.precision(std::numeric_limits<float>::max_digits10);
+    for (const auto &range : _ranges)
+    {
+        fs << range.first << " " << range.second.first << " " << range.second.second << std::endl;
+    }
+}
+
+GraphCalibrator::GraphCalibrator() : _data()
+{
+}
+
+void GraphCalibrator::calibrate(Graph &g, Target target, const GraphConfig &config)
+{
+    // Disable the options that would alter or bypass the floating-point graph
+    GraphConfig calibration_config        = config;
+    calibration_config.use_synthetic_type = false;
+    calibration_config.calibration_file.clear();
+    calibration_config.plan_file.clear();
+
+    GraphContext ctx;
+    ctx.set_config(calibration_config);
+
+    // Only fall back to valid execution methods: any other pass would change the tensors of the graph
+    PassManager pm;
+    pm.append(std::make_unique<NodeExecutionMethodMutator>());
+
+    GraphManager manager;
+    manager.finalize_graph(g, ctx, pm, target);
+
+    {
+        // Observe the inputs and outputs of every task, while the transition buffers are valid
+        ExecuteFunctionGuard guard;
+        const auto           execute_function = guard.execute_function();
+        TaskExecutor::get().execute_function  = [&](ExecutionTask &task)
+        {
+            for (size_t i = 0; i < task.node->num_inputs(); ++i)
+            {
+                // Constant inputs are quantized from their actual contents
+                const Edge *edge = task.node->input_edge(i);
+                if (edge != nullptr && edge->producer()->type() != NodeType::Const)
+                {
+                    observe(edge->tensor());
+                }
+            }
+            execute_function(task);
+            for (size_t i = 0; i < task.node->num_outputs(); ++i)
+            {
+                observe(task.node->output(i));
+            }
+        };
+
+        manager.execute_graph(g);
+    }
+
+    manager.invalidate_graph(g);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Collected the ranges of " << _data.size() << " tensors" << std::endl);
+}
+
+const CalibrationData &GraphCalibrator::data() const
+{
+    return _data;
+}
+
+void GraphCalibrator::observe(Tensor *tensor)
+{
+    if (tensor == nullptr || tensor->handle() == nullptr || tensor->desc().data_type != DataType::F32)
+    {
+        return;
+    }
+
+    ITensorHandle *handle = tensor->handle();
+    handle->map(true);
+
+    const arm_compute::ITensor &backing = handle->tensor();
+    const TensorShape          &shape   = backing.info()->tensor_shape();
+
+    Window win;
+    win.use_tensor_dimensions(shape);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    float    min = std::numeric_limits<float>::max();
+    float    max = std::numeric_limits<float>::lowest();
+    Iterator it(&backing, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto *row = reinterpret_cast<const float *>(it.ptr());
+            for (size_t x = 0; x < shape[0]; ++x)
+            {
+                min = std::min(min, row[x]);
+                max = std::max(max, row[x]);
+            }
+        },
+        it);
+
+    handle->unmap();
+
+    _data.update(tensor->id(), min, max);
+}
+} // namespace graph
+} // namespace arm_compute
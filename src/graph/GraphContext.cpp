@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
@@ -100,7 +102,9 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Every pipeline stage runs its functions concurrently with the other stages, so it needs its own pool. The graph
+    // manager sets pipeline_stages to the number of stages actually run, 1 when pipelining is ignored.
+    const size_t num_pools = std::max(1U, _config.pipeline_stages);
     for (auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,10 +28,12 @@
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphPlan.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/PassManager.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/SharedWeightsStore.h"
 
 #include "src/common/utils/Log.h"
 
@@ -39,7 +41,7 @@ namespace arm_compute
 {
 namespace graph
 {
-GraphManager::GraphManager() : _workloads()
+GraphManager::GraphManager() : _workloads(), _pipelines()
 {
 }
 
@@ -89,22 +91,82 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Perform topological sort
     std::vector<NodeID> topological_sorted_nodes = dfs(graph);
 
-    // Validate all nodes
-    detail::validate_all_nodes(graph);
+    // Split the graph into pipeline stages
+    std::unique_ptr<GraphPipeline> pipeline = nullptr;
+    if (ctx.config().pipeline_stages > 1)
+    {
+        if (forced_target != Target::NEON)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Pipelined execution is only supported on the NEON target, ignoring it"
+                                       << std::endl);
+        }
+        else if (!GraphPipeline::is_supported())
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Pipelined execution needs a library built with "
+                                       "ARM_COMPUTE_THREAD_LOCAL_SCHEDULER, ignoring it"
+                                       << std::endl);
+        }
+        else
+        {
+            pipeline = std::make_unique<GraphPipeline>();
+            pipeline->partition(graph, topological_sorted_nodes, ctx.config().pipeline_stages);
+        }
+
+        // The memory managers get one pool per stage actually run
+        GraphConfig config     = ctx.config();
+        config.pipeline_stages = (pipeline != nullptr) ? pipeline->num_stages() : 1U;
+        ctx.set_config(config);
+    }
+
+    // Use a plan saved by a previous finalization of the same graph if available
+    const std::string &plan_file = ctx.config().plan_file;
+    GraphPlan          plan;
+    const bool         use_plan = !plan_file.empty() && plan.load(plan_file) && plan.matches(graph);
+    if (use_plan)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Restoring graph from plan " << plan_file << std::endl);
+    }
+    else
+    {
+        // Validate all nodes
+        detail::validate_all_nodes(graph);
+    }
 
-    // Configure all nodes
-    auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
+    // Configure all nodes, sharing the prepared weights with the other instances of the network if requested
+    ExecutionWorkload workload;
+    {
+        const SharedWeightsStore::Scope share_weights(ctx.config().share_weights);
+        workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
+    }
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
+    if (pipeline != nullptr)
+    {
+        pipeline->configure(workload);
+    }
 
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
-    detail::call_all_const_node_accessors(graph);
+    if (use_plan)
+    {
+        plan.restore_const_tensors(graph);
+    }
+    else
+    {
+        detail::call_all_const_node_accessors(graph);
+        if (!plan_file.empty())
+        {
+            // Record the constant tensors before preparation releases them
+            plan.record(graph);
+            plan.save(plan_file);
+        }
+    }
 
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if (ctx.config().use_transition_memory_manager)
+    // The stages of a pipeline run concurrently, so their tensors cannot share the same memory
+    if (ctx.config().use_transition_memory_manager && pipeline == nullptr)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -112,6 +174,11 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     {
         detail::allocate_all_tensors(graph);
     }
+    if (pipeline != nullptr)
+    {
+        pipeline->allocate();
+        _pipelines.insert(std::make_pair(graph.id(), std::move(pipeline)));
+    }
 
     // Finalize Graph context
     ctx.finalize();
@@ -129,6 +196,14 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Stream the inputs through the pipeline stages
+    auto pipeline = _pipelines.find(graph.id());
+    if (pipeline != std::end(_pipelines))
+    {
+        pipeline->second->run(it->second);
+        return;
+    }
+
     while (true)
     {
         // Call input accessors
@@ -153,6 +228,7 @@ void GraphManager::invalidate_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    _pipelines.erase(graph.id());
     _workloads.erase(it);
 }
 } // namespace graph
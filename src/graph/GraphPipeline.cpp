@@ -0,0 +1,697 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphPipeline.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Cast.h"
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+constexpr unsigned int invalid_stage        = std::numeric_limits<unsigned int>::max();
+constexpr float        little_core_capacity = 0.5f; /**< Compute capacity of a little core relative to a big core */
+constexpr size_t       buffer_alignment     = 64;
+
+bool is_little_core(CPUModel model)
+{
+    switch (model)
+    {
+        case CPUModel::A35:
+        case CPUModel::A53:
+        case CPUModel::A55r0:
+        case CPUModel::A55r1:
+        case CPUModel::A510:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Appends @p num_groups groups of contiguous cores, whose sizes differ by at most one, to @p groups */
+void split_cores(const std::vector<unsigned int>        &cpus,
+                 size_t                                  num_groups,
+                 std::vector<std::vector<unsigned int>> &groups)
+{
+    auto first = cpus.begin();
+    for (size_t i = 0; i < num_groups; ++i)
+    {
+        const size_t size = cpus.size() / num_groups + (i < cpus.size() % num_groups ? 1 : 0);
+        groups.emplace_back(first, first + size);
+        first += size;
+    }
+}
+
+/** Index of the weights input of the nodes doing one multiply-accumulate per weight and output channel, -1 otherwise */
+int weights_input_idx(NodeType type)
+{
+    switch (type)
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FullyConnectedLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            return 1;
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            // The pointwise weights dominate
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+/** Estimates the cost of a node as the number of values it computes times the work per value */
+uint64_t estimate_cost(const INode &node)
+{
+    uint64_t cost = 0;
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        const Tensor *output = node.output(i);
+        cost += (output != nullptr) ? output->desc().shape.total_size() : 0;
+    }
+
+    const int     w_idx = weights_input_idx(node.type());
+    const Tensor *weights =
+        (w_idx >= 0 && static_cast<size_t>(w_idx) < node.num_inputs()) ? node.input(w_idx) : nullptr;
+    if (weights != nullptr && node.output(0) != nullptr)
+    {
+        const TensorDescriptor &out_desc     = node.output(0)->desc();
+        const size_t            out_channels = (out_desc.shape.num_dimensions() > 2)
+                                                   ? get_dimension_size(out_desc, DataLayoutDimension::CHANNEL)
+                                                   : out_desc.shape[0];
+        cost *= std::max<uint64_t>(1, weights->desc().shape.total_size() / std::max<size_t>(1, out_channels));
+    }
+    return std::max<uint64_t>(cost, 1);
+}
+
+std::shared_ptr<IScheduler> create_stage_scheduler(const std::vector<unsigned int> &cpus)
+{
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+    auto scheduler = std::make_shared<CPPScheduler>();
+    scheduler->set_num_threads_with_affinity(static_cast<unsigned int>(cpus.size()), [cpus](int thread_idx, int)
+                                             { return static_cast<int>(cpus[thread_idx % cpus.size()]); });
+    return scheduler;
+#else  /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+    ARM_COMPUTE_UNUSED(cpus);
+    return std::make_shared<SingleThreadScheduler>();
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+}
+
+/** Whether all the edges bound to a tensor come from the same node, i.e. no node updates the tensor in place */
+bool has_single_producer(const Graph &g, const Tensor &tensor)
+{
+    NodeID producer = EmptyNodeID;
+    for (const EdgeID eid : tensor.bound_edges())
+    {
+        const NodeID edge_producer = g.edge(eid)->producer_id();
+        if (producer != EmptyNodeID && edge_producer != producer)
+        {
+            return false;
+        }
+        producer = edge_producer;
+    }
+    return true;
+}
+
+arm_compute::Tensor &backing_tensor(Tensor &tensor)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.handle() == nullptr);
+    return *utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&tensor.handle()->tensor());
+}
+} // namespace
+
+GraphPipeline::GraphPipeline()
+    : _graph(nullptr),
+      _workload(nullptr),
+      _node_stages(),
+      _stages(),
+      _boundaries(),
+      _mtx(),
+      _start_cv(),
+      _done_cv(),
+      _step(0),
+      _pending(0),
+      _stop(false),
+      _error()
+{
+}
+
+GraphPipeline::~GraphPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _start_cv.notify_all();
+    for (auto &stage : _stages)
+    {
+        if (stage.thread.joinable())
+        {
+            stage.thread.join();
+        }
+    }
+}
+
+bool GraphPipeline::is_supported()
+{
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    return true;
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    return false;
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+}
+
+std::vector<std::vector<unsigned int>> GraphPipeline::make_core_groups(unsigned int num_stages)
+{
+    const CPUInfo            &cpu_info = CPUInfo::get();
+    std::vector<unsigned int> big_cpus;
+    std::vector<unsigned int> little_cpus;
+    for (unsigned int cpu = 0; cpu < std::max(cpu_info.get_cpu_num(), 1U); ++cpu)
+    {
+        (is_little_core(cpu_info.get_cpu_model(cpu)) ? little_cpus : big_cpus).push_back(cpu);
+    }
+    // Systems made of little cores only are homogeneous
+    if (big_cpus.empty())
+    {
+        std::swap(big_cpus, little_cpus);
+    }
+
+    const size_t num_cpus = big_cpus.size() + little_cpus.size();
+    num_stages            = std::max(1U, std::min(num_stages, static_cast<unsigned int>(num_cpus)));
+
+    std::vector<std::vector<unsigned int>> groups;
+    if (little_cpus.empty() || num_stages == 1)
+    {
+        big_cpus.insert(big_cpus.end(), little_cpus.begin(), little_cpus.end());
+        split_cores(big_cpus, num_stages, groups);
+    }
+    else
+    {
+        // Share the stages between the clusters in proportion to their capacity, with at least one stage each
+        const float  big_capacity    = static_cast<float>(big_cpus.size());
+        const float  little_capacity = static_cast<float>(little_cpus.size()) * little_core_capacity;
+        const long   big_share       = std::lround(num_stages * big_capacity / (big_capacity + little_capacity));
+        const size_t num_little_cpus = std::min<size_t>(num_stages, little_cpus.size());
+        const size_t min_big_stages  = std::max<size_t>(1, num_stages - num_little_cpus);
+        const size_t max_big_stages  = std::min<size_t>(num_stages - 1, big_cpus.size());
+        const size_t num_big_stages =
+            std::max(min_big_stages, std::min(static_cast<size_t>(std::max(big_share, 1L)), max_big_stages));
+        split_cores(big_cpus, num_big_stages, groups);
+        split_cores(little_cpus, num_stages - num_big_stages, groups);
+    }
+    return groups;
+}
+
+void GraphPipeline::partition(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_stages.empty(), "Pipeline is already partitioned!");
+    ARM_COMPUTE_ERROR_ON_MSG(!is_supported(), "Pipelined execution needs ARM_COMPUTE_THREAD_LOCAL_SCHEDULER!");
+    _graph = &g;
+
+    // Nodes computing something, in execution order
+    std::vector<INode *> nodes;
+    for (const NodeID nid : node_order)
+    {
+        INode *node = g.node(nid);
+        if (node != nullptr && node->type() != NodeType::Input && node->type() != NodeType::Output &&
+            node->type() != NodeType::Const)
+        {
+            nodes.push_back(node);
+        }
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(nodes.empty(), "Graph has no node to run!");
+
+    const std::vector<std::vector<unsigned int>> groups =
+        make_core_groups(std::min(num_stages, static_cast<unsigned int>(nodes.size())));
+    const size_t num_nodes = nodes.size();
+
+    // Position of every node in the execution order. Inputs come before the first node and outputs after the last one.
+    constexpr int    unplaced = std::numeric_limits<int>::min();
+    std::vector<int> position(g.nodes().size(), unplaced);
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == NodeType::Input)
+        {
+            position[node->id()] = -1;
+        }
+        else if (node != nullptr && node->type() == NodeType::Output)
+        {
+            position[node->id()] = static_cast<int>(num_nodes);
+        }
+    }
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+        position[nodes[i]->id()] = static_cast<int>(i);
+    }
+
+    // Tensors sharing their memory with other tensors, or updated in place by a node, cannot be given their own
+    // buffers, so the stages must not be cut across them. Cut c separates nodes[c - 1] from nodes[c].
+    std::set<const ITensorHandle *>             parent_handles;
+    std::map<const arm_compute::ITensor *, int> backing_uses;
+    for (auto &tensor : g.tensors())
+    {
+        if (tensor != nullptr && tensor->handle() != nullptr)
+        {
+            if (tensor->handle()->parent_handle() != tensor->handle())
+            {
+                parent_handles.insert(tensor->handle()->parent_handle());
+            }
+            ++backing_uses[&tensor->handle()->tensor()];
+        }
+    }
+    std::vector<bool> allowed_cut(num_nodes + 1, true);
+    for (auto &tensor : g.tensors())
+    {
+        if (tensor == nullptr || tensor->handle() == nullptr || tensor->bound_edges().empty())
+        {
+            continue;
+        }
+        ITensorHandle *handle = tensor->handle();
+        if (handle->parent_handle() == handle && parent_handles.count(handle) == 0 &&
+            backing_uses[&handle->tensor()] == 1 && has_single_producer(g, *tensor))
+        {
+            continue;
+        }
+        int first = std::numeric_limits<int>::max();
+        int end   = unplaced;
+        for (const EdgeID eid : tensor->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            first            = std::min(first, position[edge->producer_id()]);
+            end              = std::max(end, position[edge->consumer_id()]);
+        }
+        if (first == unplaced)
+        {
+            // Constant
+            continue;
+        }
+        for (int c = std::max(first + 1, 1); c <= std::min(end, static_cast<int>(num_nodes) - 1); ++c)
+        {
+            allowed_cut[c] = false;
+        }
+    }
+
+    // Cut the execution order so that the cost of every stage is proportional to the capacity of its cores. When no
+    // cut is allowed in the range left for a stage, the stage is merged with the previous one, which takes its cores.
+    std::vector<uint64_t> prefix_cost(num_nodes + 1, 0);
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+        prefix_cost[i + 1] = prefix_cost[i] + estimate_cost(*nodes[i]);
+    }
+    std::vector<float> group_capacity(groups.size(), 0.f);
+    float              total_capacity = 0.f;
+    for (size_t s = 0; s < groups.size(); ++s)
+    {
+        for (const unsigned int cpu : groups[s])
+        {
+            group_capacity[s] += is_little_core(CPUInfo::get().get_cpu_model(cpu)) ? little_core_capacity : 1.f;
+        }
+        total_capacity += group_capacity[s];
+    }
+    std::vector<size_t> cuts{0};
+    _stages.resize(1);
+    _stages[0].cpus     = groups[0];
+    _stages[0].capacity = group_capacity[0];
+    float capacity      = 0.f;
+    for (size_t s = 1; s < groups.size(); ++s)
+    {
+        capacity += group_capacity[s - 1];
+        const double target = static_cast<double>(prefix_cost[num_nodes]) * capacity / total_capacity;
+        size_t       best   = 0;
+        for (size_t c = cuts.back() + 1; c <= num_nodes - (groups.size() - s); ++c)
+        {
+            if (allowed_cut[c] &&
+                (best == 0 || std::fabs(prefix_cost[c] - target) < std::fabs(prefix_cost[best] - target)))
+            {
+                best = c;
+            }
+        }
+        if (best == 0)
+        {
+            _stages.back().cpus.insert(_stages.back().cpus.end(), groups[s].begin(), groups[s].end());
+            _stages.back().capacity += group_capacity[s];
+            continue;
+        }
+        cuts.push_back(best);
+        _stages.emplace_back();
+        _stages.back().cpus     = groups[s];
+        _stages.back().capacity = group_capacity[s];
+    }
+    cuts.push_back(num_nodes);
+    if (_stages.size() < groups.size())
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Graph can only be cut into " << _stages.size() << " pipeline stages instead of "
+                                                                    << groups.size() << std::endl);
+    }
+    const size_t last = _stages.size() - 1;
+
+    _node_stages.assign(g.nodes().size(), invalid_stage);
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == NodeType::Input)
+        {
+            _node_stages[node->id()] = 0;
+        }
+        else if (node != nullptr && node->type() == NodeType::Output)
+        {
+            _node_stages[node->id()] = last;
+        }
+    }
+    for (size_t s = 0; s < _stages.size(); ++s)
+    {
+        for (size_t i = cuts[s]; i < cuts[s + 1]; ++i)
+        {
+            _node_stages[nodes[i]->id()] = s;
+        }
+        ARM_COMPUTE_LOG_GRAPH_INFO("Pipeline stage " << s << " runs " << nodes[cuts[s]]->name() << " to "
+                                                     << nodes[cuts[s + 1] - 1]->name() << " on "
+                                                     << _stages[s].cpus.size() << " cores" << std::endl);
+    }
+
+    // Give every boundary tensor a consumer-side tensor per later stage it is read in
+    const size_t num_tensors = g.tensors().size();
+    for (TensorID tid = 0; tid < num_tensors; ++tid)
+    {
+        Tensor *tensor = g.tensor(tid);
+        if (tensor == nullptr || tensor->bound_edges().empty())
+        {
+            continue;
+        }
+        const std::set<EdgeID> edges    = tensor->bound_edges();
+        const INode           *producer = g.edge(*edges.begin())->producer();
+        if (producer == nullptr || _node_stages[producer->id()] == invalid_stage)
+        {
+            continue;
+        }
+
+        Boundary boundary;
+        boundary.producer = tid;
+        for (const EdgeID eid : edges)
+        {
+            Edge              *edge           = g.edge(eid);
+            const unsigned int consumer_stage = _node_stages[edge->consumer_id()];
+            if (consumer_stage == invalid_stage || consumer_stage <= _node_stages[producer->id()])
+            {
+                continue;
+            }
+
+            const unsigned int delay = consumer_stage - _node_stages[producer->id()];
+            auto               it    = std::find_if(boundary.consumers.begin(), boundary.consumers.end(),
+                                                    [&](const std::pair<unsigned int, TensorID> &c)
+                                                    { return c.first == delay; });
+            if (it == boundary.consumers.end())
+            {
+                boundary.consumers.emplace_back(delay, g.create_tensor(tensor->desc()));
+                it = boundary.consumers.end() - 1;
+            }
+            Tensor *consumer_tensor = g.tensor(it->second);
+            edge->update_bound_tensor(consumer_tensor);
+            tensor->unbind_edge(eid);
+            consumer_tensor->bind_edge(eid);
+
+            // The output accessors are called by the last stage on the consumer-side tensor
+            if (edge->consumer()->type() == NodeType::Output)
+            {
+                consumer_tensor->set_accessor(tensor->extract_accessor());
+            }
+        }
+        if (!boundary.consumers.empty())
+        {
+            _boundaries.push_back(std::move(boundary));
+        }
+    }
+
+    // Create the backend handles of the consumer-side tensors
+    detail::configure_all_tensors(g);
+}
+
+void GraphPipeline::configure(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(_graph == nullptr);
+    _workload = &workload;
+
+    for (auto &task : workload.tasks)
+    {
+        const unsigned int stage = _node_stages[task.node->id()];
+        ARM_COMPUTE_ERROR_ON(stage == invalid_stage);
+        _stages[stage].tasks.push_back(&task);
+    }
+
+    // Tensors exchanging buffers must have the same strides
+    for (const auto &boundary : _boundaries)
+    {
+        std::vector<ITensorInfo *> infos{backing_tensor(*_graph->tensor(boundary.producer)).info()};
+        for (const auto &consumer : boundary.consumers)
+        {
+            infos.push_back(backing_tensor(*_graph->tensor(consumer.second)).info());
+        }
+
+        PaddingSize padding;
+        for (const ITensorInfo *info : infos)
+        {
+            padding.top    = std::max(padding.top, info->padding().top);
+            padding.right  = std::max(padding.right, info->padding().right);
+            padding.bottom = std::max(padding.bottom, info->padding().bottom);
+            padding.left   = std::max(padding.left, info->padding().left);
+        }
+        for (ITensorInfo *info : infos)
+        {
+            if (info->padding() != padding)
+            {
+                info->extend_padding(padding);
+            }
+        }
+    }
+}
+
+void GraphPipeline::allocate()
+{
+    ARM_COMPUTE_ERROR_ON(_graph == nullptr);
+
+    Allocator allocator;
+    for (auto &boundary : _boundaries)
+    {
+        unsigned int max_delay = 0;
+        for (const auto &consumer : boundary.consumers)
+        {
+            max_delay = std::max(max_delay, consumer.first);
+        }
+        const size_t size = backing_tensor(*_graph->tensor(boundary.producer)).info()->total_size();
+        for (unsigned int i = 0; i <= max_delay; ++i)
+        {
+            boundary.buffers.emplace_back(allocator.make_region(size, buffer_alignment));
+        }
+        boundary.head = 0;
+    }
+    import_buffers();
+
+    for (unsigned int s = 0; s < _stages.size(); ++s)
+    {
+        _stages[s].thread = std::thread(&GraphPipeline::stage_loop, this, s);
+    }
+}
+
+void GraphPipeline::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_stages.empty(), "Pipeline is not partitioned!");
+    _workload = &workload;
+
+    const size_t      last = _stages.size() - 1;
+    std::vector<bool> in_flight(_stages.size(), false);
+    bool              feeding = true;
+    while (true)
+    {
+        // Every input moves on to the next stage
+        bool has_input = false;
+        for (size_t s = 0; s < _stages.size(); ++s)
+        {
+            _stages[s].has_input = (s == 0) ? feeding : in_flight[s - 1];
+            has_input            = has_input || _stages[s].has_input;
+        }
+        if (!has_input)
+        {
+            return;
+        }
+
+        // Run one step on all the stages
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _pending = static_cast<unsigned int>(_stages.size());
+            ++_step;
+            _start_cv.notify_all();
+            _done_cv.wait(lock, [&] { return _pending == 0; });
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            if (_error != nullptr)
+            {
+                std::exception_ptr error = _error;
+                _error                   = nullptr;
+                std::rethrow_exception(error);
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        }
+
+        for (size_t s = 0; s < _stages.size(); ++s)
+        {
+            in_flight[s] = _stages[s].has_input && (s != 0 || _stages[s].accepted);
+        }
+        feeding = feeding && _stages[0].accepted;
+        if (_stages[last].has_input && !_stages[last].more)
+        {
+            return;
+        }
+
+        // What was written in this step is read one stage further in the next one
+        for (auto &boundary : _boundaries)
+        {
+            boundary.head = (boundary.head + 1) % boundary.buffers.size();
+        }
+        import_buffers();
+    }
+}
+
+unsigned int GraphPipeline::num_stages() const
+{
+    return static_cast<unsigned int>(_stages.size());
+}
+
+void GraphPipeline::stage_loop(unsigned int idx)
+{
+    // The scheduler is local to the stage thread and released when the thread exits
+    Scheduler::set(create_stage_scheduler(_stages[idx].cpus));
+
+    unsigned int                 step = 0;
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (true)
+    {
+        _start_cv.wait(lock, [&] { return _stop || _step != step; });
+        if (_stop)
+        {
+            break;
+        }
+        step = _step;
+        lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        std::exception_ptr error = nullptr;
+        try
+        {
+            process(idx);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+#else  /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        process(idx);
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        if (error != nullptr && _error == nullptr)
+        {
+            _error = error;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        if (--_pending == 0)
+        {
+            _done_cv.notify_one();
+        }
+    }
+}
+
+void GraphPipeline::process(unsigned int idx)
+{
+    Stage &stage = _stages[idx];
+    if (!stage.has_input)
+    {
+        return;
+    }
+
+    if (idx == 0)
+    {
+        stage.accepted = detail::call_all_input_node_accessors(*_workload);
+        if (!stage.accepted)
+        {
+            return;
+        }
+    }
+
+    for (ExecutionTask *task : stage.tasks)
+    {
+        (*task)();
+    }
+
+    if (idx == _stages.size() - 1)
+    {
+        stage.more = detail::call_all_output_node_accessors(*_workload);
+    }
+}
+
+void GraphPipeline::import_buffers()
+{
+    // The imports must also run in release builds, so they are not made within the assertion macros
+    for (const auto &boundary : _boundaries)
+    {
+        const size_t         num_buffers = boundary.buffers.size();
+        arm_compute::Tensor &producer    = backing_tensor(*_graph->tensor(boundary.producer));
+        Status               status = producer.allocator()->import_memory(boundary.buffers[boundary.head]->buffer());
+        ARM_COMPUTE_ERROR_THROW_ON(status);
+        for (const auto &consumer : boundary.consumers)
+        {
+            const size_t         buffer          = (boundary.head + num_buffers - consumer.first) % num_buffers;
+            arm_compute::Tensor &consumer_tensor = backing_tensor(*_graph->tensor(consumer.second));
+            status = consumer_tensor.allocator()->import_memory(boundary.buffers[buffer]->buffer());
+            ARM_COMPUTE_ERROR_THROW_ON(status);
+        }
+        ARM_COMPUTE_UNUSED(status);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphPlan.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/Version.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+constexpr char     plan_magic[8] = {'A', 'C', 'L', 'P', 'L', 'A', 'N', '\0'};
+constexpr uint32_t plan_version  = 2;
+
+/** FNV-1a hash accumulator */
+class Hasher
+{
+public:
+    void add(const void *data, size_t size)
+    {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            _hash = (_hash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    }
+    template <typename T>
+    void add(const T &value)
+    {
+        add(&value, sizeof(T));
+    }
+    void add(const std::string &str)
+    {
+        add(str.size());
+        add(str.data(), str.size());
+    }
+    uint64_t value() const
+    {
+        return _hash;
+    }
+
+private:
+    uint64_t _hash{0xcbf29ce484222325ULL};
+};
+
+/** Checks if a node is a constant node whose accessor is called during finalization */
+bool is_bound_const_node(const INode &node)
+{
+    return node.type() == NodeType::Const && node.num_outputs() != 0 && node.output(0) != nullptr &&
+           !node.output(0)->bound_edges().empty();
+}
+
+/** Returns the identifier of the data filling a constant node, empty if unknown */
+std::string const_data_id(const INode &node)
+{
+    const ITensorAccessor *accessor = node.output(0)->accessor();
+    return accessor != nullptr ? accessor->data_id() : "";
+}
+
+template <typename T>
+void write_value(std::ofstream &fs, const T &value)
+{
+    fs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_value(std::ifstream &fs, T &value)
+{
+    return static_cast<bool>(fs.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+} // namespace
+
+GraphPlan::GraphPlan() : _fingerprint(0), _blobs()
+{
+}
+
+uint64_t GraphPlan::fingerprint(const Graph &g)
+{
+    Hasher hasher;
+
+    // Plans are only portable across processes running the same library build
+    hasher.add(build_information());
+
+    // Nodes are not validated when a plan is used, so plans are only portable across CPUs with the same features
+    const CPUInfo &cpu_info = CPUInfo::get();
+    for (const bool feature :
+         {cpu_info.has_fp16(), cpu_info.has_bf16(), cpu_info.has_svebf16(), cpu_info.has_dotprod(),
+          cpu_info.has_svef32mm(), cpu_info.has_i8mm(), cpu_info.has_svei8mm(), cpu_info.has_fhm(), cpu_info.has_sve(),
+          cpu_info.has_sve2(), cpu_info.has_sme(), cpu_info.has_sme2(), cpu_info.has_sme_i8i32(),
+          cpu_info.has_sme_f16f32(), cpu_info.has_sme_f32f32(), cpu_info.has_sme_b16f32()})
+    {
+        hasher.add(feature);
+    }
+
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            hasher.add(EmptyNodeID);
+            continue;
+        }
+
+        hasher.add(node->id());
+        hasher.add(node->type());
+        hasher.add(node->name());
+        hasher.add(node->assigned_target());
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            hasher.add(node->input_id(i));
+        }
+        for (size_t i = 0; i < node->num_outputs(); ++i)
+        {
+            hasher.add(node->output_id(i));
+        }
+
+        // Execution methods picked by the mutating passes
+        if (node->type() == NodeType::ConvolutionLayer)
+        {
+            const auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node.get());
+            hasher.add(conv_node->convolution_method());
+            hasher.add(conv_node->fast_math_hint());
+        }
+        else if (node->type() == NodeType::DepthwiseConvolutionLayer)
+        {
+            const auto *dwc_node =
+                arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node.get());
+            hasher.add(dwc_node->depthwise_convolution_method());
+        }
+
+        // Data the constant tensors are filled with
+        if (is_bound_const_node(*node))
+        {
+            hasher.add(const_data_id(*node));
+        }
+    }
+
+    for (const auto &tensor : g.tensors())
+    {
+        if (tensor == nullptr)
+        {
+            hasher.add(NullTensorID);
+            continue;
+        }
+
+        const TensorDescriptor &desc = tensor->desc();
+        hasher.add(tensor->id());
+        hasher.add(desc.target);
+        hasher.add(desc.data_type);
+        hasher.add(desc.layout);
+        for (size_t d = 0; d < desc.shape.num_dimensions(); ++d)
+        {
+            hasher.add(desc.shape[d]);
+        }
+        for (const float scale : desc.quant_info.scale())
+        {
+            hasher.add(scale);
+        }
+        for (const int32_t offset : desc.quant_info.offset())
+        {
+            hasher.add(offset);
+        }
+    }
+
+    return hasher.value();
+}
+
+void GraphPlan::record(const Graph &g)
+{
+    _fingerprint = fingerprint(g);
+    _blobs.clear();
+
+    for (const auto &node : g.nodes())
+    {
+        // Tensors filled with unidentified data are filled through their accessor when the plan is restored
+        if (node == nullptr || !is_bound_const_node(*node) || const_data_id(*node).empty())
+        {
+            continue;
+        }
+
+        Tensor        *tensor = node->output(0);
+        ITensorHandle *handle = tensor->handle();
+        ARM_COMPUTE_ERROR_ON(handle == nullptr);
+
+        handle->map(true);
+        const arm_compute::ITensor &backing = handle->tensor();
+        const uint8_t              *src     = backing.buffer();
+        _blobs.push_back(TensorBlob{tensor->id(), std::vector<uint8_t>(src, src + backing.info()->total_size())});
+        handle->unmap();
+    }
+}
+
+bool GraphPlan::matches(const Graph &g) const
+{
+    if (_fingerprint == 0 || _fingerprint != fingerprint(g))
+    {
+        return false;
+    }
+
+    // Every blob must belong to a constant tensor of the graph and hold at least its elements
+    for (const auto &blob : _blobs)
+    {
+        const Tensor *tensor = g.tensor(blob.tensor_id);
+        if (tensor == nullptr || tensor->bound_edges().empty())
+        {
+            return false;
+        }
+        const Edge *edge = g.edge(*tensor->bound_edges().begin());
+        if (edge == nullptr || edge->producer() == nullptr || edge->producer()->type() != NodeType::Const)
+        {
+            return false;
+        }
+        const TensorDescriptor &desc = tensor->desc();
+        if (blob.data.size() < desc.shape.total_size() * data_size_from_type(desc.data_type))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void GraphPlan::restore_const_tensors(Graph &g) const
+{
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || !is_bound_const_node(*node))
+        {
+            continue;
+        }
+
+        Tensor        *tensor = node->output(0);
+        ITensorHandle *handle = tensor->handle();
+        ARM_COMPUTE_ERROR_ON(handle == nullptr);
+
+        const auto blob = std::find_if(_blobs.begin(), _blobs.end(),
+                                       [&](const TensorBlob &b) { return b.tensor_id == tensor->id(); });
+
+        handle->map(true);
+        arm_compute::ITensor &backing = handle->tensor();
+        const bool            found   = blob != _blobs.end() && blob->data.size() == backing.info()->total_size();
+        if (found)
+        {
+            std::memcpy(backing.buffer(), blob->data.data(), blob->data.size());
+        }
+        handle->unmap();
+
+        if (!found)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Constant tensor of node " << node->name()
+                                                                  << " is not part of the plan, calling its accessor"
+                                                                  << std::endl);
+            detail::call_tensor_accessor(tensor);
+        }
+    }
+}
+
+bool GraphPlan::load(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!fs.is_open())
+    {
+        return false;
+    }
+    const uint64_t file_size = static_cast<uint64_t>(fs.tellg());
+    fs.seekg(0);
+
+    char     magic[sizeof(plan_magic)] = {};
+    uint32_t version                   = 0;
+    uint64_t fingerprint               = 0;
+    uint64_t num_blobs                 = 0;
+    if (!fs.read(magic, sizeof(magic)) || std::memcmp(magic, plan_magic, sizeof(magic)) != 0 ||
+        !read_value(fs, version) || version != plan_version || !read_value(fs, fingerprint) ||
+        !read_value(fs, num_blobs))
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring invalid graph plan " << filename << std::endl);
+        return false;
+    }
+
+    // Sizes read from the file are checked against the rest of the file before allocating anything
+    constexpr uint64_t blob_header_size = sizeof(TensorID) + sizeof(uint64_t);
+    if (num_blobs > (file_size - static_cast<uint64_t>(fs.tellg())) / blob_header_size)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan " << filename << std::endl);
+        return false;
+    }
+
+    std::vector<TensorBlob> blobs(num_blobs);
+    for (auto &blob : blobs)
+    {
+        uint64_t size = 0;
+        if (!read_value(fs, blob.tensor_id) || !read_value(fs, size) ||
+            size > file_size - static_cast<uint64_t>(fs.tellg()))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan " << filename << std::endl);
+            return false;
+        }
+        blob.data.resize(size);
+        if (!fs.read(reinterpret_cast<char *>(blob.data.data()), size))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan " << filename << std::endl);
+            return false;
+        }
+    }
+
+    _fingerprint = fingerprint;
+    _blobs       = std::move(blobs);
+    return true;
+}
+
+bool GraphPlan::save(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    fs.write(plan_magic, sizeof(plan_magic));
+    write_value(fs, plan_version);
+    write_value(fs, _fingerprint);
+    write_value(fs, static_cast<uint64_t>(_blobs.size()));
+    for (const auto &blob : _blobs)
+    {
+        write_value(fs, blob.tensor_id);
+        write_value(fs, static_cast<uint64_t>(blob.data.size()));
+        fs.write(reinterpret_cast<const char *>(blob.data.data()), blob.data.size());
+    }
+    fs.close();
+
+    if (!fs)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Could not save graph plan " << filename << std::endl);
+        return false;
+    }
+    return true;
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/ITensorHandle.h"
 #include "arm_compute/graph/mutators/GraphMutators.h"
 
 namespace arm_compute
@@ -94,13 +95,20 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
-    pm.append(std::make_unique<NodeFusionMutator>());
+    if (!cfg.calibration_file.empty())
+    {
+        CalibrationData calibration_data;
+        calibration_data.load(cfg.calibration_file);
+        pm.append(std::make_unique<CalibratedQuantizationMutator>(std::move(calibration_data)));
+    }
+    pm.append(std::make_unique<NodeFusionMutator>(cfg.fuse_depthwise_separable, cfg.fuse_residual_additions));
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
     // Passes that mutate backend information
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(std::make_unique<SliceLayerSubTensorMutator>());
     pm.append(std::make_unique<NodeExecutionMethodMutator>());
 
     return pm;
@@ -229,5 +237,10 @@ void configure_tensor(Tensor *tensor)
     }
 }
 
+bool has_evenly_spaced_rows(const ITensorHandle &handle)
+{
+    const ITensorInfo &info = *handle.tensor().info();
+    return info.dimension(2) <= 1 || info.strides_in_bytes()[2] == info.dimension(1) * info.strides_in_bytes()[1];
+}
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,15 +59,20 @@ void execute_task(ExecutionTask &task)
 #endif // ARM_COMPUTE_ASSERTS_ENABLED
 }
 
-void ExecutionTask::prepare()
+void prepare_task(ExecutionTask &task)
 {
-    if (task)
+    if (task.task)
     {
-        task->prepare();
+        task.task->prepare();
     }
 }
 
-TaskExecutor::TaskExecutor() : execute_function(execute_task)
+void ExecutionTask::prepare()
+{
+    TaskExecutor::get().prepare_function(*this);
+}
+
+TaskExecutor::TaskExecutor() : execute_function(execute_task), prepare_function(prepare_task)
 {
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -189,6 +189,17 @@ CLDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<CLSubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle>
+CLDeviceBackend::create_strided_subtensor(ITensorHandle *parent,
+                                         TensorShape    shape,
+                                         Coordinates    coords,
+                                         Coordinates    steps)
+{
+    // OpenCL kernels vectorise their loads assuming a padded parent, hence views are only created on the CPU
+    ARM_COMPUTE_UNUSED(parent, shape, coords, steps);
+    return nullptr;
+}
+
 std::unique_ptr<arm_compute::IFunction> CLDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CL node with ID : " << node.id() << std::endl);
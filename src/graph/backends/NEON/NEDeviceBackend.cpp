@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -133,6 +133,20 @@ NEDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<NESubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle>
+NEDeviceBackend::create_strided_subtensor(ITensorHandle *parent,
+                                         TensorShape    shape,
+                                         Coordinates    coords,
+                                         Coordinates    steps)
+{
+    if (parent == nullptr)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<NESubTensorHandle>(parent, shape, coords, steps);
+}
+
 std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CPU node with ID : " << node.id() << std::endl);
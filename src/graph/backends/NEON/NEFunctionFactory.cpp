@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023,2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,8 @@
 #include "arm_compute/runtime/CPP/CPPFunctions.h"
 #include "arm_compute/runtime/NEON/NEFunctions.h"
 
+#include "src/graph/backends/NEON/NEFusionHelpers.h"
+
 using namespace arm_compute::utils::cast;
 
 namespace arm_compute
@@ -113,6 +115,154 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return func;
 }
+
+/** Function running a convolution followed by its fused residual addition and activation
+ *
+ * The residual epilogue runs in place on the output of the convolution, right after it is produced. It is a separate
+ * pass over the output rather than part of the GEMM or depthwise output stage, which have no input for a second tensor,
+ * but it saves the intermediate tensor and the separate activation pass of the unfused graph.
+ */
+class NEFusedResidualFunction final : public IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] func     Function producing @p output
+     * @param[in] output   Output of @p func, updated in place
+     * @param[in] residual Residual tensor to add to @p output
+     * @param[in] act_info Activation to run after the residual addition
+     */
+    NEFusedResidualFunction(std::unique_ptr<IFunction> func,
+                            ITensor                   *output,
+                            const ITensor             *residual,
+                            const ActivationLayerInfo &act_info)
+        : _func(std::move(func)), _epilogue()
+    {
+        _epilogue.configure({output, residual}, output, make_fused_eltwise_info(EltwiseOperation::Add, act_info));
+    }
+
+    // Inherited methods overridden:
+    void prepare() override
+    {
+        _func->prepare();
+    }
+    void run() override
+    {
+        _func->run();
+        _epilogue.run();
+    }
+
+private:
+    std::unique_ptr<IFunction> _func;
+    NEElementwiseFusion        _epilogue;
+};
+
+/** Wraps the function of a node with its fused residual addition, if any
+ *
+ * @tparam N Type of the node
+ *
+ * @param[in] func Function of the node
+ * @param[in] node Node the function was created for
+ *
+ * @return The function, followed by the residual epilogue if the node has a fused residual
+ */
+template <typename N>
+std::unique_ptr<IFunction> add_fused_residual(std::unique_ptr<IFunction> func, INode *node)
+{
+    auto *n_node = polymorphic_downcast<N *>(node);
+    if (func == nullptr || !n_node->has_fused_residual())
+    {
+        return func;
+    }
+
+    NETargetInfo::TensorType *output   = get_backing_tensor<NETargetInfo>(n_node->output(0));
+    NETargetInfo::TensorType *residual = get_backing_tensor<NETargetInfo>(n_node->input(N::residual_input_idx));
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+    ARM_COMPUTE_ERROR_ON(residual == nullptr);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Fused residual addition into " << n_node->name() << " Activation: "
+                                                               << n_node->residual_activation().activation()
+                                                               << std::endl);
+
+    return std::make_unique<NEFusedResidualFunction>(std::move(func), output, residual,
+                                                     n_node->residual_activation());
+}
+
+/** Creates a fused element-wise operation and activation function
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused element-wise function
+ */
+std::unique_ptr<IFunction> create_fused_eltwise_layer(EltwiseLayerNode &node)
+{
+    validate_node<NETargetInfo>(node, 2 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input1 = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *input2 = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *output = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input1 == nullptr);
+    ARM_COMPUTE_ERROR_ON(input2 == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<NEElementwiseFusion>();
+    func->configure({input1, input2}, output,
+                    make_fused_eltwise_info(node.eltwise_operation(), node.fused_activation()));
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Operation: ElementwiseFusion Data Type: " << input1->info()->data_type()
+                               << " Shape: " << input1->info()->tensor_shape()
+                               << " Activation: " << node.fused_activation().activation() << std::endl);
+
+    return func;
+}
+
+/** Creates a fused depthwise and pointwise convolution function
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused depthwise separable convolution function
+ */
+std::unique_ptr<IFunction>
+create_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 5 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input      = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *dw_weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *dw_biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *pw_weights = get_backing_tensor<NETargetInfo>(node.input(3));
+    NETargetInfo::TensorType *pw_biases  = get_backing_tensor<NETargetInfo>(node.input(4));
+    NETargetInfo::TensorType *output     = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(dw_weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(pw_weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    const DepthwiseSeparableConv2dInfo &info = node.depthwise_separable_info();
+
+    // Create and configure function
+    auto func =
+        std::make_unique<NEDepthwiseSeparableConvolutionLayer>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, dw_weights, dw_biases, pw_weights, pw_biases, output, info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Depthwise weights shape: " << dw_weights->info()->tensor_shape()
+                               << " Pointwise weights shape: " << pw_weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -138,8 +288,10 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
-            return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+            return detail::add_fused_residual<ConvolutionLayerNode>(
+                detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(
+                    *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx),
+                node);
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -150,8 +302,10 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_concatenate_layer<NEConcatenateLayer, NETargetInfo>(
                 *polymorphic_downcast<ConcatenateLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
-            return detail::create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(
-                *polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
+            return detail::add_fused_residual<DepthwiseConvolutionLayerNode>(
+                detail::create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(
+                    *polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node)),
+                node);
         case NodeType::DequantizationLayer:
             return detail::create_dequantization_layer<NEDequantizationLayer, NETargetInfo>(
                 *polymorphic_downcast<DequantizationLayerNode *>(node));
@@ -162,8 +316,15 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_detection_post_process_layer<NEDetectionPostProcessLayer, NETargetInfo>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
         case NodeType::EltwiseLayer:
-            return detail::create_eltwise_layer<NEEltwiseFunctions, NETargetInfo>(
-                *polymorphic_downcast<EltwiseLayerNode *>(node));
+        {
+            auto *eltwise_node = polymorphic_downcast<EltwiseLayerNode *>(node);
+            // Element-wise functions cannot run activations, fused ones are run by the elementwise fusion engine
+            if (eltwise_node->fused_activation().enabled())
+            {
+                return detail::create_fused_eltwise_layer(*eltwise_node);
+            }
+            return detail::create_eltwise_layer<NEEltwiseFunctions, NETargetInfo>(*eltwise_node);
+        }
         case NodeType::UnaryEltwiseLayer:
             return detail::create_unary_eltwise_layer<NEUnaryEltwiseFunctions, NETargetInfo>(
                 *polymorphic_downcast<UnaryEltwiseLayerNode *>(node));
@@ -174,12 +335,19 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(
                 *polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::FusedConvolutionBatchNormalizationLayer:
-            return detail::create_fused_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(
-                *polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node), ctx);
+            return detail::add_fused_residual<FusedConvolutionBatchNormalizationNode>(
+                detail::create_fused_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(
+                    *polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node), ctx),
+                node);
         case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
-            return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
-                                                                                        NETargetInfo>(
-                *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+            return detail::add_fused_residual<FusedDepthwiseConvolutionBatchNormalizationNode>(
+                detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
+                                                                                    NETargetInfo>(
+                    *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx),
+                node);
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return detail::create_fused_depthwise_separable_convolution_layer(
+                *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node), ctx);
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
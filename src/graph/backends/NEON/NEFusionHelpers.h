@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GRAPH_BACKENDS_NEON_NEFUSIONHELPERS_H
+#define ACL_SRC_GRAPH_BACKENDS_NEON_NEFUSIONHELPERS_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/ElementwiseFusionInfo.h"
+#include "arm_compute/graph/Types.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+namespace detail
+{
+/** Converts a graph element-wise operation to an elementwise fusion operation
+ *
+ * @param[in] op Element-wise operation to convert
+ *
+ * @return The corresponding elementwise fusion operation
+ */
+inline ElementwiseFusionOp to_elementwise_fusion_op(EltwiseOperation op)
+{
+    switch (op)
+    {
+        case EltwiseOperation::Add:
+            return ElementwiseFusionOp::ADD;
+        case EltwiseOperation::Sub:
+            return ElementwiseFusionOp::SUB;
+        case EltwiseOperation::Mul:
+            return ElementwiseFusionOp::MUL;
+        case EltwiseOperation::Max:
+            return ElementwiseFusionOp::MAX;
+        case EltwiseOperation::Div:
+            return ElementwiseFusionOp::DIV;
+        case EltwiseOperation::Min:
+            return ElementwiseFusionOp::MIN;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation!");
+    }
+}
+
+/** Creates the program of a binary element-wise operation followed by an activation
+ *
+ * @param[in] op       Element-wise operation
+ * @param[in] act_info Activation to run after the operation. Ignored if not enabled
+ *
+ * @return Elementwise fusion program with two inputs
+ */
+inline ElementwiseFusionInfo make_fused_eltwise_info(EltwiseOperation op, const ActivationLayerInfo &act_info)
+{
+    ElementwiseFusionInfo info(2);
+    const int             result = info.add_binary(to_elementwise_fusion_op(op), info.input(0), info.input(1));
+    if (act_info.enabled())
+    {
+        info.add_activation(result, act_info);
+    }
+    return info;
+}
+} // namespace detail
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_SRC_GRAPH_BACKENDS_NEON_NEFUSIONHELPERS_H
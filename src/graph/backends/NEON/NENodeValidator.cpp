@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/runtime/CPP/CPPFunctions.h"
 #include "arm_compute/runtime/NEON/NEFunctions.h"
 
+#include "src/graph/backends/NEON/NEFusionHelpers.h"
 #include "support/Cast.h"
 
 using namespace arm_compute::utils::cast;
@@ -54,6 +55,56 @@ struct NEUnaryEltwiseLayerFunctions
     using ExpLayer = NEExpLayer;
 };
 
+namespace
+{
+/** Validates an element-wise node with a fused activation, run by the elementwise fusion engine */
+Status validate_fused_eltwise_layer(EltwiseLayerNode &node)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    const ITensorInfo *input1 = detail::get_backing_tensor_info(node.input(0));
+    const ITensorInfo *input2 = detail::get_backing_tensor_info(node.input(1));
+    const ITensorInfo *output = detail::get_backing_tensor_info(node.output(0));
+
+    return NEElementwiseFusion::validate(
+        {input1, input2}, output, detail::make_fused_eltwise_info(node.eltwise_operation(), node.fused_activation()));
+}
+
+/** Validates the residual addition fused into a node, if any */
+template <typename N>
+Status validate_fused_residual(N &node)
+{
+    if (!node.has_fused_residual())
+    {
+        return Status{};
+    }
+
+    const ITensorInfo *output   = detail::get_backing_tensor_info(node.output(0));
+    const ITensorInfo *residual = detail::get_backing_tensor_info(node.input(N::residual_input_idx));
+
+    return NEElementwiseFusion::validate(
+        {output, residual}, output, detail::make_fused_eltwise_info(EltwiseOperation::Add, node.residual_activation()));
+}
+
+/** Validates a depthwise convolution fused with the pointwise convolution that consumes it */
+Status validate_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    const ITensorInfo *input      = detail::get_backing_tensor_info(node.input(0));
+    const ITensorInfo *dw_weights = detail::get_backing_tensor_info(node.input(1));
+    const ITensorInfo *dw_biases  = detail::get_backing_tensor_info(node.input(2));
+    const ITensorInfo *pw_weights = detail::get_backing_tensor_info(node.input(3));
+    const ITensorInfo *pw_biases  = detail::get_backing_tensor_info(node.input(4));
+    const ITensorInfo *output     = detail::get_backing_tensor_info(node.output(0));
+
+    return NEDepthwiseSeparableConvolutionLayer::validate(input, dw_weights, dw_biases, pw_weights, pw_biases, output,
+                                                          node.depthwise_separable_info());
+}
+} // namespace
+
 Status NENodeValidator::validate(INode *node)
 {
     if (node == nullptr)
@@ -74,15 +125,21 @@ Status NENodeValidator::validate(INode *node)
             return detail::validate_channel_shuffle_layer<NEChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_fused_residual(*conv_node));
             return detail::validate_convolution_layer<NEConvolutionLayer, NEDirectConvolutionLayer,
-                                                      NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node));
+                                                      NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(*conv_node);
+        }
         case NodeType::DepthToSpaceLayer:
             return detail::validate_depth_to_space_layer<NEDepthToSpaceLayer>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
-            return detail::validate_depthwise_convolution_layer<NEDepthwiseConvolutionLayer>(
-                *polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
+        {
+            auto *dwc_node = polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node);
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_fused_residual(*dwc_node));
+            return detail::validate_depthwise_convolution_layer<NEDepthwiseConvolutionLayer>(*dwc_node);
+        }
         case NodeType::DequantizationLayer:
             return detail::validate_dequantization_layer<NEDequantizationLayer>(
                 *polymorphic_downcast<DequantizationLayerNode *>(node));
@@ -128,11 +185,25 @@ Status NENodeValidator::validate(INode *node)
             return detail::validate_strided_slice_layer<NEStridedSlice>(
                 *polymorphic_downcast<StridedSliceLayerNode *>(node));
         case NodeType::EltwiseLayer:
-            return detail::validate_eltwise_Layer<NEEltwiseLayerFunctions>(
-                *polymorphic_downcast<EltwiseLayerNode *>(node));
+        {
+            auto *eltwise_node = polymorphic_downcast<EltwiseLayerNode *>(node);
+            if (eltwise_node->fused_activation().enabled())
+            {
+                return validate_fused_eltwise_layer(*eltwise_node);
+            }
+            return detail::validate_eltwise_Layer<NEEltwiseLayerFunctions>(*eltwise_node);
+        }
         case NodeType::UnaryEltwiseLayer:
             return detail::validate_unary_eltwise_layer<NEUnaryEltwiseLayerFunctions>(
                 *polymorphic_downcast<UnaryEltwiseLayerNode *>(node));
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+            return validate_fused_residual(*polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node));
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            return validate_fused_residual(
+                *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node));
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return validate_fused_depthwise_separable_convolution_layer(
+                *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node));
         default:
             return Status{};
     }
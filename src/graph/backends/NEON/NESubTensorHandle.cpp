@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,17 @@ NESubTensorHandle::NESubTensorHandle(ITensorHandle     *parent_handle,
     _parent_handle = parent_handle;
 }
 
+NESubTensorHandle::NESubTensorHandle(ITensorHandle     *parent_handle,
+                                     const TensorShape &shape,
+                                     const Coordinates &coords,
+                                     const Coordinates &steps)
+    : _sub_tensor(), _parent_handle(nullptr)
+{
+    ARM_COMPUTE_ERROR_ON(!parent_handle);
+    _sub_tensor    = arm_compute::SubTensor(&parent_handle->tensor(), shape, coords, steps);
+    _parent_handle = parent_handle;
+}
+
 void NESubTensorHandle::allocate()
 {
     // noop
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/frontend/RequestBatcher.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+namespace
+{
+/** Writes sample @p idx of a tensor whose outermost dimension holds @p num_samples samples
+ *
+ * @param[in] sample Dense sample to copy, or nullptr to zero the entry
+ */
+void write_sample(ITensor &tensor, size_t idx, size_t num_samples, const uint8_t *sample)
+{
+    const ITensorInfo &info         = *tensor.info();
+    const size_t       element_size = info.element_size();
+    const size_t       sample_elems = info.tensor_shape().total_size() / num_samples;
+
+    if (info.padding().empty())
+    {
+        // The samples are contiguous in memory
+        uint8_t *dst = tensor.buffer() + info.offset_first_element_in_bytes() + idx * sample_elems * element_size;
+        if (sample != nullptr)
+        {
+            std::memcpy(dst, sample, sample_elems * element_size);
+        }
+        else
+        {
+            std::memset(dst, 0, sample_elems * element_size);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < sample_elems; ++i)
+    {
+        uint8_t *dst = tensor.ptr_to_element(index2coords(info.tensor_shape(), idx * sample_elems + i));
+        if (sample != nullptr)
+        {
+            std::memcpy(dst, sample + i * element_size, element_size);
+        }
+        else
+        {
+            std::memset(dst, 0, element_size);
+        }
+    }
+}
+
+/** Reads sample @p idx of a tensor whose outermost dimension holds @p num_samples samples into a dense buffer */
+void read_sample(ITensor &tensor, size_t idx, size_t num_samples, uint8_t *sample)
+{
+    const ITensorInfo &info         = *tensor.info();
+    const size_t       element_size = info.element_size();
+    const size_t       sample_elems = info.tensor_shape().total_size() / num_samples;
+
+    if (info.padding().empty())
+    {
+        const uint8_t *src = tensor.buffer() + info.offset_first_element_in_bytes() + idx * sample_elems * element_size;
+        std::memcpy(sample, src, sample_elems * element_size);
+        return;
+    }
+
+    for (size_t i = 0; i < sample_elems; ++i)
+    {
+        const uint8_t *src = tensor.ptr_to_element(index2coords(info.tensor_shape(), idx * sample_elems + i));
+        std::memcpy(sample + i * element_size, src, element_size);
+    }
+}
+} // namespace
+
+class RequestBatcher::InputAccessor final : public ITensorAccessor
+{
+public:
+    explicit InputAccessor(RequestBatcher &batcher) : _batcher(batcher)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        return _batcher.gather(tensor);
+    }
+
+private:
+    RequestBatcher &_batcher;
+};
+
+class RequestBatcher::OutputAccessor final : public ITensorAccessor
+{
+public:
+    explicit OutputAccessor(RequestBatcher &batcher) : _batcher(batcher)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        return _batcher.scatter(tensor);
+    }
+
+private:
+    RequestBatcher &_batcher;
+};
+
+RequestBatcher::RequestBatcher(const RequestBatcherInfo &info)
+    : _info(info),
+      _queue(),
+      _batch(),
+      _batch_start(),
+      _avg_batch_time(Clock::duration::zero()),
+      _stopped(false),
+      _stats(),
+      _mtx(),
+      _cv()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_info.max_batch_size == 0, "The maximum batch size must be at least 1");
+    _batch.reserve(_info.max_batch_size);
+}
+
+RequestBatcher::~RequestBatcher()
+{
+    stop();
+}
+
+std::future<void> RequestBatcher::submit(const void *input, void *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    std::future<void> future;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ARM_COMPUTE_ERROR_ON_MSG(_stopped, "Requests cannot be submitted to a stopped batcher");
+        _queue.push_back(Request{input, output, Clock::now(), std::promise<void>()});
+        future = _queue.back().done.get_future();
+    }
+    _cv.notify_one();
+
+    return future;
+}
+
+void RequestBatcher::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stopped = true;
+    }
+    _cv.notify_all();
+}
+
+ITensorAccessorUPtr RequestBatcher::input_accessor()
+{
+    return std::make_unique<InputAccessor>(*this);
+}
+
+ITensorAccessorUPtr RequestBatcher::output_accessor()
+{
+    return std::make_unique<OutputAccessor>(*this);
+}
+
+RequestBatcherStats RequestBatcher::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    RequestBatcherStats stats = _stats;
+    if (stats.num_batches != 0)
+    {
+        stats.batch_fill_ratio =
+            static_cast<float>(stats.num_requests) / static_cast<float>(stats.num_batches * _info.max_batch_size);
+    }
+    return stats;
+}
+
+RequestBatcher::Clock::time_point RequestBatcher::dispatch_deadline(Clock::time_point arrival) const
+{
+    Clock::time_point deadline = arrival + std::chrono::duration_cast<Clock::duration>(_info.max_queue_delay);
+    if (_info.latency_slo.count() != 0)
+    {
+        // Leave enough time to run the batch within the latency target
+        const Clock::time_point slo_deadline =
+            arrival + std::chrono::duration_cast<Clock::duration>(_info.latency_slo) - _avg_batch_time;
+        deadline = std::min(deadline, slo_deadline);
+    }
+    return deadline;
+}
+
+bool RequestBatcher::gather(ITensor &tensor)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensor.info()->tensor_shape().total_size() % _info.max_batch_size != 0,
+                             "The input's outermost dimension must match the maximum batch size");
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [this]() { return _stopped || !_queue.empty(); });
+        if (_queue.empty())
+        {
+            // Stopped and drained: end the graph execution
+            return false;
+        }
+
+        // Wait for the batch to fill up until the oldest request has to be dispatched
+        const Clock::time_point deadline = dispatch_deadline(_queue.front().arrival);
+        _cv.wait_until(lock, deadline, [this]() { return _stopped || _queue.size() >= _info.max_batch_size; });
+
+        const size_t batch_size = std::min(_queue.size(), _info.max_batch_size);
+        _batch_start            = Clock::now();
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            const auto queueing_delay =
+                std::chrono::duration_cast<std::chrono::microseconds>(_batch_start - _queue.front().arrival);
+            _stats.total_queueing_delay += queueing_delay;
+            _stats.max_queueing_delay = std::max(_stats.max_queueing_delay, queueing_delay);
+
+            _batch.emplace_back(std::move(_queue.front()));
+            _queue.pop_front();
+        }
+    }
+
+    for (size_t i = 0; i < _info.max_batch_size; ++i)
+    {
+        write_sample(tensor, i, _info.max_batch_size,
+                     i < _batch.size() ? static_cast<const uint8_t *>(_batch[i].input) : nullptr);
+    }
+
+    return true;
+}
+
+bool RequestBatcher::scatter(ITensor &tensor)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensor.info()->tensor_shape().total_size() % _info.max_batch_size != 0,
+                             "The output's outermost dimension must match the maximum batch size");
+
+    for (size_t i = 0; i < _batch.size(); ++i)
+    {
+        read_sample(tensor, i, _info.max_batch_size, static_cast<uint8_t *>(_batch[i].output));
+    }
+
+    const Clock::time_point now = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+
+        // Exponential moving average of the batch execution time
+        const Clock::duration batch_time = now - _batch_start;
+        _avg_batch_time = _stats.num_batches == 0 ? batch_time : (_avg_batch_time * 7 + batch_time) / 8;
+
+        ++_stats.num_batches;
+        _stats.total_batch_time += std::chrono::duration_cast<std::chrono::microseconds>(batch_time);
+        _stats.num_requests += _batch.size();
+        if (_info.latency_slo.count() != 0)
+        {
+            _stats.num_slo_violations +=
+                std::count_if(_batch.begin(), _batch.end(),
+                              [&](const Request &request) { return now - request.arrival > _info.latency_slo; });
+        }
+    }
+
+    for (auto &request : _batch)
+    {
+        request.done.set_value();
+    }
+    _batch.clear();
+
+    return true;
+}
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,808 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/CalibratedQuantizationMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+using Activation = ActivationLayerInfo::ActivationFunction;
+
+/** Accessor filling a constant tensor with precomputed data */
+class ConstDataAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data Tensor elements in linear order
+     */
+    explicit ConstDataAccessor(std::vector<uint8_t> data) : _data(std::move(data))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const ITensorInfo &info         = *tensor.info();
+        const size_t       element_size = info.element_size();
+        ARM_COMPUTE_ERROR_ON(_data.size() != info.tensor_shape().total_size() * element_size);
+
+        if (info.padding().empty())
+        {
+            std::memcpy(tensor.buffer() + info.offset_first_element_in_bytes(), _data.data(), _data.size());
+        }
+        else
+        {
+            for (size_t i = 0; i < info.tensor_shape().total_size(); ++i)
+            {
+                std::memcpy(tensor.ptr_to_element(index2coords(info.tensor_shape(), i)),
+                            _data.data() + i * element_size, element_size);
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> _data;
+};
+
+/** Calibrated ranges, updated as nodes get folded into their producers */
+class RangeTable
+{
+public:
+    explicit RangeTable(const CalibrationData &data) : _data(data), _overrides()
+    {
+    }
+    bool get(const Tensor *tensor, float &min, float &max) const
+    {
+        if (tensor == nullptr)
+        {
+            return false;
+        }
+        const auto it = _overrides.find(tensor->id());
+        if (it != _overrides.end())
+        {
+            min = it->second.first;
+            max = it->second.second;
+            return true;
+        }
+        return _data.range(tensor->id(), min, max);
+    }
+    bool has(const Tensor *tensor) const
+    {
+        float min = 0.f;
+        float max = 0.f;
+        return get(tensor, min, max);
+    }
+    /** Makes @p dst use the range of @p src */
+    void transfer(const Tensor *src, const Tensor *dst)
+    {
+        float min = 0.f;
+        float max = 0.f;
+        if (get(src, min, max))
+        {
+            _overrides[dst->id()] = std::make_pair(min, max);
+        }
+    }
+
+private:
+    const CalibrationData                      &_data;
+    std::map<TensorID, std::pair<float, float>> _overrides;
+};
+
+/** Batch normalization folded into the weights and biases of a convolution */
+struct BatchNormFold
+{
+    std::vector<float> scale{}; /**< Per channel weights multiplier */
+    std::vector<float> shift{}; /**< Per channel bias offset */
+};
+
+template <typename T>
+std::vector<uint8_t> to_bytes(const std::vector<T> &values)
+{
+    std::vector<uint8_t> bytes(values.size() * sizeof(T));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+}
+
+/** Computes the asymmetric quantization information covering a range and zero */
+QuantizationInfo compute_asymmetric_qinfo(float min, float max)
+{
+    min = std::min(min, 0.f);
+    max = std::max(max, 0.f);
+
+    const float scale  = (max > min) ? (max - min) / 255.f : 1.f;
+    const int   offset = static_cast<int>(std::round(-128.f - min / scale));
+    return QuantizationInfo(scale, std::max(-128, std::min(127, offset)));
+}
+
+/** Loads a floating-point constant tensor through its accessor
+ *
+ * @return The tensor elements in linear order. Tensors without accessor are zero-filled.
+ */
+std::vector<float> load_const_tensor(Tensor &tensor)
+{
+    const TensorDescriptor &desc = tensor.desc();
+    ARM_COMPUTE_ERROR_ON(desc.data_type != DataType::F32);
+
+    std::vector<float> data(desc.shape.total_size(), 0.f);
+
+    std::unique_ptr<ITensorAccessor> accessor = tensor.extract_accessor();
+    if (accessor != nullptr)
+    {
+        TensorInfo info(desc.shape, 1, desc.data_type);
+        info.set_data_layout(desc.layout);
+
+        arm_compute::Tensor staging;
+        staging.allocator()->init(info);
+        staging.allocator()->allocate();
+        accessor->access_tensor(staging);
+        std::memcpy(data.data(), staging.buffer(), data.size() * sizeof(float));
+    }
+    return data;
+}
+
+/** Checks if an input of a node is a constant tensor that only feeds this node */
+bool is_exclusive_const_input(const INode &node, size_t idx)
+{
+    const Edge *edge = node.input_edge(idx);
+    return edge != nullptr && edge->producer()->type() == NodeType::Const && edge->tensor()->bound_edges().size() == 1;
+}
+
+bool is_relu_activation(Activation act)
+{
+    return act == Activation::RELU || act == Activation::BOUNDED_RELU || act == Activation::LU_BOUNDED_RELU;
+}
+
+bool is_weighted_node(NodeType type)
+{
+    return type == NodeType::ConvolutionLayer || type == NodeType::DepthwiseConvolutionLayer ||
+           type == NodeType::FullyConnectedLayer;
+}
+
+/** Checks if a node can run on QASYMM8_SIGNED tensors */
+bool is_quantizable(const INode &node, const RangeTable &ranges)
+{
+    // Data inputs and outputs must be calibrated, constant inputs are quantized from their contents
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if (edge == nullptr)
+        {
+            continue;
+        }
+        if (edge->producer()->type() == NodeType::Const)
+        {
+            if (!is_exclusive_const_input(node, i) || edge->tensor()->desc().data_type != DataType::F32)
+            {
+                return false;
+            }
+        }
+        else if (!ranges.has(edge->tensor()))
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        if (!ranges.has(node.output(i)))
+        {
+            return false;
+        }
+    }
+
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        {
+            const auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node);
+            return conv_node->num_groups() == 1 && !conv_node->has_fused_residual() &&
+                   is_exclusive_const_input(node, 1);
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            const auto *dwc_node =
+                arm_compute::utils::cast::polymorphic_downcast<const DepthwiseConvolutionLayerNode *>(&node);
+            return !dwc_node->has_fused_residual() && is_exclusive_const_input(node, 1);
+        }
+        case NodeType::FullyConnectedLayer:
+            return is_exclusive_const_input(node, 1);
+        case NodeType::ActivationLayer:
+        {
+            const auto *act_node = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node);
+            const Activation act = act_node->activation_info().activation();
+            if (is_relu_activation(act))
+            {
+                return true;
+            }
+            // Other activations must not follow a node they could later be fused into, as the 8-bit kernels of
+            // these nodes only support ReLU-like epilogues
+            return (act == Activation::LOGISTIC || act == Activation::TANH || act == Activation::HARD_SWISH) &&
+                   !is_weighted_node(node.input_edge(0)->producer()->type());
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            const EltwiseOperation op = eltwise_node->eltwise_operation();
+            return op == EltwiseOperation::Add || op == EltwiseOperation::Sub || op == EltwiseOperation::Mul;
+        }
+        case NodeType::ConcatenateLayer:
+        case NodeType::FlattenLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::PoolingLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::SoftmaxLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Makes @p node produce the output of @p old_node, which gets removed from the graph */
+void take_over_output(Graph &g, INode *node, INode *old_node)
+{
+    const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*old_node);
+    std::unique_ptr<ITensorAccessor> accessor      = old_node->output(0)->extract_accessor();
+
+    g.remove_node(old_node->id());
+    for (const auto &driving_node : driving_nodes)
+    {
+        g.add_connection(node->id(), 0, driving_node.node_id, driving_node.index);
+    }
+    if (accessor != nullptr)
+    {
+        node->output(0)->set_accessor(std::move(accessor));
+    }
+}
+
+/** Folds the batch normalizations that follow quantized convolutions into them */
+std::map<NodeID, BatchNormFold> fold_batch_normalizations(Graph &g, const std::set<NodeID> &qnodes, RangeTable &ranges)
+{
+    std::map<NodeID, BatchNormFold> folds;
+    for (const NodeID nid : qnodes)
+    {
+        INode *node = g.node(nid);
+        if (node->type() != NodeType::ConvolutionLayer && node->type() != NodeType::DepthwiseConvolutionLayer)
+        {
+            continue;
+        }
+        if (node->output_edges().size() != 1 || node->output(0)->accessor() != nullptr)
+        {
+            continue;
+        }
+
+        INode *consumer = g.edge(*node->output_edges().begin())->consumer();
+        if (consumer->type() != NodeType::BatchNormalizationLayer)
+        {
+            continue;
+        }
+
+        auto *bn_node = arm_compute::utils::cast::polymorphic_downcast<BatchNormalizationLayerNode *>(consumer);
+        bool  can_fold = ranges.has(bn_node->output(0)) && !bn_node->fused_activation().enabled();
+        for (size_t i = 1; i < bn_node->num_inputs(); ++i)
+        {
+            can_fold = can_fold && (bn_node->input_edge(i) == nullptr || is_exclusive_const_input(*bn_node, i));
+        }
+        if (!can_fold || bn_node->input_edge(1) == nullptr || bn_node->input_edge(2) == nullptr)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding batch normalization node with ID : "
+                                      << bn_node->id() << " into node with ID : " << nid << std::endl);
+
+        const std::vector<float> mean = load_const_tensor(*bn_node->input(1));
+        const std::vector<float> var  = load_const_tensor(*bn_node->input(2));
+        const std::vector<float> beta =
+            bn_node->input(3) != nullptr ? load_const_tensor(*bn_node->input(3)) : std::vector<float>(mean.size(), 0.f);
+        const std::vector<float> gamma =
+            bn_node->input(4) != nullptr ? load_const_tensor(*bn_node->input(4)) : std::vector<float>(mean.size(), 1.f);
+
+        BatchNormFold fold;
+        fold.scale.resize(mean.size());
+        fold.shift.resize(mean.size());
+        for (size_t c = 0; c < mean.size(); ++c)
+        {
+            fold.scale[c] = gamma[c] / std::sqrt(var[c] + bn_node->epsilon());
+            fold.shift[c] = beta[c] - mean[c] * fold.scale[c];
+        }
+        folds.emplace(nid, std::move(fold));
+
+        std::vector<NodeID> param_nodes;
+        for (size_t i = 1; i < bn_node->num_inputs(); ++i)
+        {
+            if (bn_node->input_edge(i) != nullptr)
+            {
+                param_nodes.push_back(bn_node->input_edge(i)->producer_id());
+            }
+        }
+
+        ranges.transfer(bn_node->output(0), node->output(0));
+        take_over_output(g, node, bn_node);
+        for (const NodeID param_nid : param_nodes)
+        {
+            g.remove_node(param_nid);
+        }
+    }
+    return folds;
+}
+
+/** Fuses the ReLU-like activations that follow quantized nodes with weights into them */
+void fuse_activations(Graph &g, std::set<NodeID> &qnodes, RangeTable &ranges)
+{
+    const std::vector<NodeID> act_nodes = g.nodes(NodeType::ActivationLayer);
+    for (const NodeID nid : act_nodes)
+    {
+        auto *act_node = arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(g.node(nid));
+        if (act_node == nullptr || qnodes.count(nid) == 0 ||
+            !is_relu_activation(act_node->activation_info().activation()))
+        {
+            continue;
+        }
+
+        INode *producer = act_node->input_edge(0)->producer();
+        if (qnodes.count(producer->id()) == 0 || !is_weighted_node(producer->type()) ||
+            producer->output_edges().size() != 1 || producer->output(0)->accessor() != nullptr)
+        {
+            continue;
+        }
+
+        const ActivationLayerInfo act_info = act_node->activation_info();
+        switch (producer->type())
+        {
+            case NodeType::ConvolutionLayer:
+            {
+                auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(producer);
+                if (conv_node->fused_activation().enabled())
+                {
+                    continue;
+                }
+                conv_node->set_fused_activation(act_info);
+                break;
+            }
+            case NodeType::DepthwiseConvolutionLayer:
+            {
+                auto *dwc_node =
+                    arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(producer);
+                if (dwc_node->fused_activation().enabled())
+                {
+                    continue;
+                }
+                dwc_node->set_fused_activation(act_info);
+                break;
+            }
+            default:
+            {
+                auto *fc_node = arm_compute::utils::cast::polymorphic_downcast<FullyConnectedLayerNode *>(producer);
+                if (fc_node->info().activation_info.enabled())
+                {
+                    continue;
+                }
+                fc_node->set_fused_activation(act_info);
+                break;
+            }
+        }
+
+        ranges.transfer(act_node->output(0), producer->output(0));
+        take_over_output(g, producer, act_node);
+        qnodes.erase(nid);
+    }
+}
+
+/** Computes the quantization information of the tensors produced or consumed by quantized nodes */
+std::map<TensorID, QuantizationInfo>
+compute_quantization_info(Graph &g, const std::set<NodeID> &qnodes, const RangeTable &ranges)
+{
+    std::map<TensorID, QuantizationInfo> qinfos;
+
+    auto tensor_qinfo = [&](const Tensor *tensor)
+    {
+        auto it = qinfos.find(tensor->id());
+        if (it == qinfos.end())
+        {
+            float min = 0.f;
+            float max = 0.f;
+            ranges.get(tensor, min, max);
+            it = qinfos.emplace(tensor->id(), compute_asymmetric_qinfo(min, max)).first;
+        }
+        return it->second;
+    };
+
+    for (const NodeID nid : dfs(g))
+    {
+        const INode *node = g.node(nid);
+        if (node == nullptr || qnodes.count(nid) == 0)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge != nullptr && edge->producer()->type() != NodeType::Const)
+            {
+                tensor_qinfo(edge->tensor());
+            }
+        }
+
+        QuantizationInfo out_qinfo;
+        switch (node->type())
+        {
+            case NodeType::FlattenLayer:
+            case NodeType::PermuteLayer:
+            case NodeType::PoolingLayer:
+            case NodeType::ReshapeLayer:
+                // Data movement keeps the quantization of the input
+                out_qinfo = tensor_qinfo(node->input(0));
+                break;
+            case NodeType::SoftmaxLayer:
+                out_qinfo = QuantizationInfo(1.f / 256.f, -128);
+                break;
+            case NodeType::ActivationLayer:
+            {
+                const auto *act_node =
+                    arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(node);
+                const Activation act = act_node->activation_info().activation();
+                if (act == Activation::LOGISTIC)
+                {
+                    out_qinfo = QuantizationInfo(1.f / 256.f, -128);
+                }
+                else if (act == Activation::TANH)
+                {
+                    out_qinfo = QuantizationInfo(1.f / 128.f, 0);
+                }
+                else
+                {
+                    out_qinfo = tensor_qinfo(node->output(0));
+                }
+                break;
+            }
+            default:
+                out_qinfo = tensor_qinfo(node->output(0));
+                break;
+        }
+        qinfos[node->output_id(0)] = out_qinfo;
+    }
+
+    return qinfos;
+}
+
+/** Inserts quantization and dequantization nodes between quantized and floating-point nodes
+ *
+ * @return The IDs of the tensors to quantize
+ */
+std::set<TensorID> insert_conversions(Graph                                &g,
+                                      const std::set<NodeID>               &qnodes,
+                                      std::map<TensorID, QuantizationInfo> &qinfos)
+{
+    std::set<TensorID> qtensors;
+
+    // Conversions add nodes, so collect the outputs to visit first
+    std::vector<NodeIdxPair> outputs;
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr || node->type() == NodeType::Const)
+        {
+            continue;
+        }
+        for (size_t i = 0; i < node->num_outputs(); ++i)
+        {
+            if (node->output(i) != nullptr)
+            {
+                outputs.push_back(NodeIdxPair{node->id(), i});
+            }
+        }
+    }
+
+    for (const auto &output : outputs)
+    {
+        INode     *producer  = g.node(output.node_id);
+        Tensor    *tensor    = producer->output(output.index);
+        const bool quantized = qnodes.count(producer->id()) != 0;
+        if (quantized)
+        {
+            qtensors.insert(tensor->id());
+        }
+
+        std::vector<NodeIdxPair> mismatched;
+        for (const EdgeID eid : tensor->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if ((qnodes.count(edge->consumer_id()) != 0) != quantized)
+            {
+                mismatched.push_back(NodeIdxPair{edge->consumer_id(), edge->consumer_idx()});
+            }
+        }
+        if (mismatched.empty())
+        {
+            continue;
+        }
+
+        NodeParams params = producer->common_node_params();
+        NodeID     cvt_nid;
+        if (quantized)
+        {
+            cvt_nid     = g.add_node<DequantizationLayerNode>();
+            params.name = params.name.empty() ? "" : params.name + "/Dequantize";
+        }
+        else
+        {
+            cvt_nid     = g.add_node<QuantizationLayerNode>(qinfos.at(tensor->id()), DataType::QASYMM8_SIGNED);
+            params.name = params.name.empty() ? "" : params.name + "/Quantize";
+        }
+        g.node(cvt_nid)->set_common_node_parameters(params);
+
+        g.add_connection(producer->id(), output.index, cvt_nid, 0);
+        for (const auto &consumer : mismatched)
+        {
+            g.remove_connection(g.node(consumer.node_id)->input_edge_id(consumer.index));
+            g.add_connection(cvt_nid, 0, consumer.node_id, consumer.index);
+        }
+
+        Tensor *converted = g.node(cvt_nid)->output(0);
+        if (quantized)
+        {
+            // Output accessors expect floating-point data
+            std::unique_ptr<ITensorAccessor> accessor = tensor->extract_accessor();
+            if (accessor != nullptr)
+            {
+                converted->set_accessor(std::move(accessor));
+            }
+        }
+        else
+        {
+            qinfos[converted->id()] = qinfos.at(tensor->id());
+            qtensors.insert(converted->id());
+        }
+    }
+
+    return qtensors;
+}
+
+/** Quantizes the weights of a node per output channel (or per tensor) and its biases to S32 */
+void quantize_weights_and_biases(Graph &g, INode &node, const QuantizationInfo &input_qinfo, const BatchNormFold *fold)
+{
+    Tensor                *weights = node.input(1);
+    const TensorDescriptor w_desc  = weights->desc();
+
+    // Fully connected weights are quantized per tensor
+    int    channel_dim  = -1;
+    size_t num_channels = node.output(0)->desc().shape[0];
+    if (node.type() != NodeType::FullyConnectedLayer)
+    {
+        channel_dim = static_cast<int>(get_dimension_idx(
+            w_desc.layout, node.type() == NodeType::ConvolutionLayer ? DataLayoutDimension::BATCHES
+                                                                    : DataLayoutDimension::CHANNEL));
+        num_channels = w_desc.shape[channel_dim];
+    }
+
+    size_t stride = 1;
+    for (int d = 0; d < channel_dim; ++d)
+    {
+        stride *= w_desc.shape[d];
+    }
+    auto channel_of = [&](size_t idx) { return channel_dim < 0 ? 0 : (idx / stride) % num_channels; };
+
+    std::vector<float> w_data = load_const_tensor(*weights);
+    if (fold != nullptr)
+    {
+        for (size_t i = 0; i < w_data.size(); ++i)
+        {
+            w_data[i] *= fold->scale[channel_of(i)];
+        }
+    }
+
+    // Symmetric quantization
+    std::vector<float> w_scales(channel_dim < 0 ? 1 : num_channels, 0.f);
+    for (size_t i = 0; i < w_data.size(); ++i)
+    {
+        float &scale = w_scales[channel_of(i)];
+        scale        = std::max(scale, std::abs(w_data[i]));
+    }
+    for (auto &scale : w_scales)
+    {
+        scale = scale > 0.f ? scale / 127.f : 1.f;
+    }
+
+    std::vector<int8_t> w_quantized(w_data.size());
+    for (size_t i = 0; i < w_data.size(); ++i)
+    {
+        const float value = std::round(w_data[i] / w_scales[channel_of(i)]);
+        w_quantized[i]    = static_cast<int8_t>(std::max(-127.f, std::min(127.f, value)));
+    }
+
+    if (channel_dim < 0)
+    {
+        weights->desc().data_type  = DataType::QASYMM8_SIGNED;
+        weights->desc().quant_info = QuantizationInfo(w_scales[0], 0);
+    }
+    else
+    {
+        weights->desc().data_type  = DataType::QSYMM8_PER_CHANNEL;
+        weights->desc().quant_info = QuantizationInfo(w_scales);
+    }
+    weights->set_accessor(std::make_unique<ConstDataAccessor>(to_bytes(w_quantized)));
+
+    // Biases accumulate in the scale of the input times the one of the weights
+    Tensor            *biases = node.input(2);
+    std::vector<float> b_data = biases != nullptr ? load_const_tensor(*biases) : std::vector<float>(num_channels, 0.f);
+    ARM_COMPUTE_ERROR_ON(b_data.size() != num_channels);
+
+    std::vector<int32_t> b_quantized(num_channels);
+    for (size_t c = 0; c < num_channels; ++c)
+    {
+        const float  value = fold != nullptr ? b_data[c] * fold->scale[c] + fold->shift[c] : b_data[c];
+        const double scale = static_cast<double>(input_qinfo.uniform().scale) * w_scales[channel_dim < 0 ? 0 : c];
+        const double q     = std::round(value / scale);
+        b_quantized[c]     = static_cast<int32_t>(utility::clamp<double>(q, std::numeric_limits<int32_t>::lowest(),
+                                                                         std::numeric_limits<int32_t>::max()));
+    }
+
+    auto accessor = std::make_unique<ConstDataAccessor>(to_bytes(b_quantized));
+    if (biases != nullptr)
+    {
+        biases->desc().data_type  = DataType::S32;
+        biases->desc().quant_info = QuantizationInfo();
+        biases->set_accessor(std::move(accessor));
+    }
+    else
+    {
+        NodeParams params = node.common_node_params();
+        params.name       = params.name.empty() ? "" : params.name + "Bias";
+
+        TensorDescriptor b_desc = w_desc;
+        b_desc.shape            = TensorShape(num_channels);
+        b_desc.data_type        = DataType::S32;
+        b_desc.quant_info       = QuantizationInfo();
+
+        const NodeID b_nid = GraphBuilder::add_const_node(g, params, b_desc, std::move(accessor));
+        g.add_connection(b_nid, 0, node.id(), 2);
+    }
+}
+
+/** Quantizes a constant tensor per tensor from its contents */
+void quantize_const_tensor(Tensor &tensor)
+{
+    const std::vector<float> data = load_const_tensor(tensor);
+
+    const auto             minmax = std::minmax_element(data.begin(), data.end());
+    const QuantizationInfo qinfo =
+        data.empty() ? QuantizationInfo(1.f, 0) : compute_asymmetric_qinfo(*minmax.first, *minmax.second);
+
+    std::vector<int8_t> quantized(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        quantized[i] = quantize_qasymm8_signed(data[i], qinfo);
+    }
+
+    tensor.desc().data_type  = DataType::QASYMM8_SIGNED;
+    tensor.desc().quant_info = qinfo;
+    tensor.set_accessor(std::make_unique<ConstDataAccessor>(to_bytes(quantized)));
+}
+} // namespace
+
+CalibratedQuantizationMutator::CalibratedQuantizationMutator(CalibrationData calibration_data)
+    : _calibration_data(std::move(calibration_data))
+{
+}
+
+const char *CalibratedQuantizationMutator::name()
+{
+    return "CalibratedQuantizationMutator";
+}
+
+IGraphMutator::MutationType CalibratedQuantizationMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void CalibratedQuantizationMutator::mutate(Graph &g)
+{
+    // Only floating-point graphs are quantized
+    for (const auto &tensor : g.tensors())
+    {
+        if (tensor != nullptr && tensor->desc().data_type != DataType::F32)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Calibrated quantization mutator couldn't be applied" << std::endl);
+            return;
+        }
+    }
+
+    RangeTable       ranges(_calibration_data);
+    std::set<NodeID> qnodes;
+    for (const auto &node : g.nodes())
+    {
+        if (node != nullptr && is_quantizable(*node, ranges))
+        {
+            qnodes.insert(node->id());
+        }
+    }
+    if (qnodes.empty())
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("No node of the graph can be quantized" << std::endl);
+        return;
+    }
+
+    // Remove the nodes that get optimized out
+    const std::map<NodeID, BatchNormFold> folds = fold_batch_normalizations(g, qnodes, ranges);
+    fuse_activations(g, qnodes, ranges);
+
+    std::map<TensorID, QuantizationInfo> qinfos   = compute_quantization_info(g, qnodes, ranges);
+    const std::set<TensorID>             qtensors = insert_conversions(g, qnodes, qinfos);
+
+    // Quantize the constant inputs of the quantized nodes
+    for (const NodeID nid : qnodes)
+    {
+        INode *node = g.node(nid);
+        if (is_weighted_node(node->type()))
+        {
+            const auto fold = folds.find(nid);
+            quantize_weights_and_biases(g, *node, qinfos.at(node->input_id(0)),
+                                        fold != folds.end() ? &fold->second : nullptr);
+            continue;
+        }
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge != nullptr && edge->producer()->type() == NodeType::Const)
+            {
+                quantize_const_tensor(*edge->tensor());
+            }
+        }
+    }
+
+    // Convert the tensors once the graph doesn't change anymore, as adding connections recomputes descriptors
+    for (const TensorID tid : qtensors)
+    {
+        Tensor *tensor             = g.tensor(tid);
+        tensor->desc().data_type  = DataType::QASYMM8_SIGNED;
+        tensor->desc().quant_info = qinfos.at(tid);
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Quantized " << qnodes.size() << " nodes of the graph" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
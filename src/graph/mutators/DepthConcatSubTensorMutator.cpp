@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,10 +67,15 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
             // Get output tensor
             auto output_tensor = node->output(0);
 
-            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2)
+            // Check concatenation axis (OpenCL sub-tensor optimization is supported for concatenation axis >=2,
+            // while CPU kernels honour the strides of the tensors they write to and can use any axis)
             auto *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
-            if (output_tensor == nullptr ||
-                get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis()) < 2)
+            if (output_tensor == nullptr)
+            {
+                continue;
+            }
+            const size_t axis = get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis());
+            if (axis < 2 && output_tensor->desc().target != Target::NEON)
             {
                 continue;
             }
@@ -88,22 +93,37 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
             // Create subtensors
             if (is_valid && is_target_supported(output_tensor->desc().target))
             {
-                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
-                                              << node->id() << " and name : " << node->name() << std::endl);
                 // Create sub-tensor handles
-                unsigned depth = 0;
+                std::vector<std::unique_ptr<ITensorHandle>> handles;
+                unsigned                                    offset = 0;
                 for (unsigned int i = 0; i < node->input_edges().size(); ++i)
                 {
                     auto       input_tensor = node->input(i);
                     const auto input_shape  = input_tensor->desc().shape;
 
+                    Coordinates coords(0, 0, 0);
+                    coords.set(axis, offset);
+
                     backends::IDeviceBackend &backend =
                         backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
-                    std::unique_ptr<ITensorHandle> handle =
-                        backend.create_subtensor(output_tensor->handle(), input_shape, Coordinates(0, 0, depth), false);
-                    input_tensor->set_handle(std::move(handle));
+                    handles.push_back(backend.create_subtensor(output_tensor->handle(), input_shape, coords, false));
+
+                    offset += input_shape[axis];
+                }
+
+                // Concatenating along dimension 1 breaks the row spacing the GEMM based producers rely on
+                if (!std::all_of(handles.cbegin(), handles.cend(),
+                                 [](const std::unique_ptr<ITensorHandle> &handle)
+                                 { return handle != nullptr && has_evenly_spaced_rows(*handle); }))
+                {
+                    continue;
+                }
 
-                    depth += input_shape.z();
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
+                                              << node->id() << " and name : " << node->name() << std::endl);
+                for (unsigned int i = 0; i < handles.size(); ++i)
+                {
+                    node->input(i)->set_handle(std::move(handles[i]));
                 }
 
                 auto *dc_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
 
 #include "src/graph/mutators/MutatorUtils.h"
 #include "support/Cast.h"
@@ -231,6 +232,113 @@ void fuse_depthwise_convolution_with_batch_normalization(Graph &g, const Edge *o
     }
 }
 
+bool is_clamp_activation(const ActivationLayerInfo &act_info)
+{
+    if (!act_info.enabled())
+    {
+        return true;
+    }
+    switch (act_info.activation())
+    {
+        case Activation::IDENTITY:
+        case Activation::RELU:
+        case Activation::BOUNDED_RELU:
+        case Activation::LU_BOUNDED_RELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void fuse_depthwise_with_pointwise_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *dw_node =
+        arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(output_edge->producer());
+    auto *pw_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->consumer());
+
+    ARM_COMPUTE_ERROR_ON(dw_node->output(0) == nullptr || pw_node->output(0) == nullptr);
+
+    const Edge *dw_weights_edge = dw_node->input_edge(1);
+    const Edge *pw_weights_edge = pw_node->input_edge(1);
+    if (output_edge->consumer_idx() != 0 || dw_weights_edge == nullptr || pw_weights_edge == nullptr ||
+        dw_weights_edge->tensor() == nullptr || pw_weights_edge->tensor() == nullptr)
+    {
+        return;
+    }
+
+    // The fused kernel only covers NHWC, a depth multiplier of 1, a 1x1 unpadded pointwise convolution with unit
+    // stride and activations that can be applied as a clamp
+    const TensorDescriptor &dw_out_desc     = dw_node->output(0)->desc();
+    const TensorDescriptor &dw_weights_desc = dw_weights_edge->tensor()->desc();
+    const TensorDescriptor &pw_weights_desc = pw_weights_edge->tensor()->desc();
+    const PadStrideInfo     pw_info         = pw_node->convolution_info();
+    const DataType          data_type       = dw_out_desc.data_type;
+
+    const bool is_nhwc = dw_out_desc.layout == DataLayout::NHWC && dw_weights_desc.layout == DataLayout::NHWC &&
+                         pw_weights_desc.layout == DataLayout::NHWC;
+    const bool is_pointwise =
+        pw_node->num_groups() == 1 && get_dimension_size(pw_weights_desc, DataLayoutDimension::WIDTH) == 1 &&
+        get_dimension_size(pw_weights_desc, DataLayoutDimension::HEIGHT) == 1 &&
+        pw_info.stride() == std::make_pair(1U, 1U) && !pw_info.has_padding();
+    const bool is_supported_type = data_type == DataType::F32 || data_type == DataType::F16 ||
+                                   data_type == DataType::QASYMM8 || data_type == DataType::QASYMM8_SIGNED;
+    if (!is_nhwc || !is_pointwise || !is_supported_type || dw_node->depth_multiplier() != 1 ||
+        dw_node->has_fused_residual() || pw_node->has_fused_residual() ||
+        !is_clamp_activation(dw_node->fused_activation()) || !is_clamp_activation(pw_node->fused_activation()))
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing depthwise convolution node with ID : "
+                                  << output_edge->producer_id() << " with pointwise Convolution Layer node with ID : "
+                                  << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if the depthwise output has an accessor, as it is never written to memory
+    if (dw_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = pw_node->assigned_target();
+
+        const DepthwiseSeparableConv2dInfo info(dw_node->convolution_info(), Size2D(1U, 1U),
+                                                dw_node->fused_activation(), pw_node->fused_activation(),
+                                                dw_out_desc.quant_info);
+
+        // Create the fused node
+        const NodeID fused_id =
+            g.add_node<FusedDepthwiseSeparableConvolutionNode>(info, pw_node->output(0)->desc().quant_info);
+
+        // Add connections from the depthwise/pointwise inputs to the fused node
+        g.add_connection(dw_node->input_edge(0)->producer_id(), dw_node->input_edge(0)->producer_idx(), fused_id, 0);
+        g.add_connection(dw_weights_edge->producer_id(), 0, fused_id, 1);
+        if (dw_node->input_edge(2) != nullptr)
+        {
+            g.add_connection(dw_node->input_edge(2)->producer_id(), 0, fused_id, 2);
+        }
+        g.add_connection(pw_weights_edge->producer_id(), 0, fused_id, 3);
+        if (pw_node->input_edge(2) != nullptr)
+        {
+            g.add_connection(pw_node->input_edge(2)->producer_id(), 0, fused_id, 4);
+        }
+
+        auto              fused_node   = g.node(fused_id);
+        const std::string pw_node_name = pw_node->name();
+
+        transfer_driving_nodes_and_remove_old_node(g, fused_node, pw_node, true);
+
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{dw_node->name() + "+" + pw_node_name, assigned_target});
+
+        // Remove depthwise convolution node
+        g.remove_node(dw_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of depthwise convolution with pointwise convolution due to the "
+                                      "presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph                      &g,
                                const Edge                 *output_edge,
@@ -274,6 +382,59 @@ void fuse_node_with_activation(Graph                      &g,
     }
 }
 
+template <typename N>
+void fuse_node_with_residual_addition(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *n_node       = arm_compute::utils::cast::polymorphic_downcast<N *>(output_edge->producer());
+    auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(output_edge->consumer());
+
+    ARM_COMPUTE_ERROR_ON(eltwise_node->output(0) == nullptr || n_node->output(0) == nullptr);
+
+    // Only an addition of a float residual can be fused. A quantized addition requantizes to its own output
+    // quantization info, which the in-place epilogue can't do on the output of the node. A fused activation of the node
+    // itself is run by the node before the epilogue, as in the unfused graph.
+    if (eltwise_node->eltwise_operation() != EltwiseOperation::Add || n_node->has_fused_residual() ||
+        !is_data_type_float(n_node->output(0)->desc().data_type))
+    {
+        return;
+    }
+
+    // The residual is the other operand of the addition and must not need broadcasting
+    const Edge *residual_edge = eltwise_node->input_edge(output_edge->consumer_idx() == 0 ? 1 : 0);
+    if (residual_edge == nullptr || residual_edge->tensor() == nullptr ||
+        residual_edge->tensor()->desc().shape != n_node->output(0)->desc().shape ||
+        residual_edge->tensor()->desc().data_type != n_node->output(0)->desc().data_type)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing node with ID : " << output_edge->producer_id()
+                                                           << " with residual Eltwise Layer node with ID : "
+                                                           << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if fused node has an output accessor
+    if (n_node->output(0)->accessor() == nullptr)
+    {
+        const NodeID residual_id  = residual_edge->producer_id();
+        const size_t residual_idx = residual_edge->producer_idx();
+
+        n_node->set_fused_residual(eltwise_node->fused_activation());
+        g.add_connection(residual_id, residual_idx, n_node->id(), N::residual_input_idx);
+
+        const std::string eltwise_node_name = eltwise_node->name();
+        transfer_driving_nodes_and_remove_old_node(g, n_node, eltwise_node, false);
+        n_node->set_common_node_parameters(
+            NodeParams{n_node->name() + "+" + eltwise_node_name, n_node->assigned_target()});
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+            "Prevented fusion of node with residual addition due to the presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_pad_with_convolution(Graph &g, const Edge *output_edge)
 {
@@ -366,6 +527,11 @@ void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse
 }
 } // namespace detail
 
+NodeFusionMutator::NodeFusionMutator(bool fuse_depthwise_separable, bool fuse_residual_additions)
+    : _fuse_depthwise_separable(fuse_depthwise_separable), _fuse_residual_additions(fuse_residual_additions)
+{
+}
+
 const char *NodeFusionMutator::name()
 {
     return "NodeFusionMutator";
@@ -387,9 +553,11 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::SQUARE,     Activation::TANH};
 
     // Preconditions
-    auto empty_prec     = [](INode &) { return true; };
-    auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
-    auto qs8_prec       = [&g](INode &n)
+    auto empty_prec       = [](INode &) { return true; };
+    auto neon_target_prec = [](INode &n) { return n.assigned_target() == Target::NEON; };
+    auto eltwise_act_prec = [](INode &n)
+    { return n.assigned_target() == Target::CL || n.assigned_target() == Target::NEON; };
+    auto qs8_prec         = [&g](INode &n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
 
@@ -417,12 +585,35 @@ void NodeFusionMutator::mutate(Graph &g)
     detail::fuse_layer<FullyConnectedLayerNode, ActivationLayerNode>(
         g, empty_prec, detail::fuse_node_with_activation<FullyConnectedLayerNode>, supported_fused_activations);
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(
-        g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
+        g, eltwise_act_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
     // The fusion of BatchNormalizationLayer must occur after the fusion of ActivationLayer. Because FusedConvolutionBatchNormalizationNode assumes the BatchNormalization is already fused with activation, if any
     detail::fuse_layer<ConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Residual additions are fused last so that they can follow both plain and batch normalization fused convolutions.
+    // On NEON the addition and its fused activation run as an epilogue of the convolution. The epilogue is a separate
+    // pass over the convolution output rather than part of its output stage, so it is only used on request.
+    if (_fuse_residual_additions)
+    {
+        detail::fuse_layer<ConvolutionLayerNode, EltwiseLayerNode>(
+            g, neon_target_prec, detail::fuse_node_with_residual_addition<ConvolutionLayerNode>);
+        detail::fuse_layer<DepthwiseConvolutionLayerNode, EltwiseLayerNode>(
+            g, neon_target_prec, detail::fuse_node_with_residual_addition<DepthwiseConvolutionLayerNode>);
+        detail::fuse_layer<FusedConvolutionBatchNormalizationNode, EltwiseLayerNode>(
+            g, neon_target_prec, detail::fuse_node_with_residual_addition<FusedConvolutionBatchNormalizationNode>);
+        detail::fuse_layer<FusedDepthwiseConvolutionBatchNormalizationNode, EltwiseLayerNode>(
+            g, neon_target_prec,
+            detail::fuse_node_with_residual_addition<FusedDepthwiseConvolutionBatchNormalizationNode>);
+    }
+    // Depthwise separable blocks are fused once the activations have been fused into both convolutions. Pairs that
+    // absorbed a residual addition are left alone. The fused kernel doesn't use the assembly depthwise and GEMM
+    // kernels, so it is only used on request.
+    if (_fuse_depthwise_separable)
+    {
+        detail::fuse_layer<DepthwiseConvolutionLayerNode, ConvolutionLayerNode>(
+            g, neon_target_prec, detail::fuse_depthwise_with_pointwise_convolution);
+    }
 }
 } // namespace graph
 } // namespace arm_compute
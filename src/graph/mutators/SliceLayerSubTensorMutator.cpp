@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/SliceLayerSubTensorMutator.h"
+
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/SliceLayerNode.h"
+#include "arm_compute/graph/nodes/StridedSliceLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+#include "support/Iterable.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Compute the starting coordinates and steps of the view a slice node aliases
+ *
+ * @param[in]  node   Slice or strided slice node
+ * @param[out] coords Starting coordinates of the view inside the slice input
+ * @param[out] steps  Steps of the view along each dimension
+ *
+ * @return True if the slice can be expressed as a view of its input
+ */
+bool compute_view(INode *node, Coordinates &coords, Coordinates &steps)
+{
+    using namespace arm_compute::helpers::tensor_transform;
+
+    const TensorShape &input_shape = node->input(0)->desc().shape;
+    if (node->type() == NodeType::SliceLayer)
+    {
+        auto *slice_node = arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(node);
+        std::tie(coords, std::ignore, steps) =
+            calculate_strided_slice_coords(input_shape, slice_node->starts(), slice_node->ends(), BiStrides(), 0,
+                                           construct_slice_end_mask(slice_node->ends()));
+        return true;
+    }
+
+    auto *strided_slice_node = arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(node);
+    const StridedSliceLayerInfo info = strided_slice_node->strided_slice_info();
+
+    // Shrinking axes changes the rank of the output, so its dimensions no longer map onto the input ones
+    if (info.shrink_axis_mask() != 0)
+    {
+        return false;
+    }
+
+    std::tie(coords, std::ignore, steps) =
+        calculate_strided_slice_coords(input_shape, strided_slice_node->starts(), strided_slice_node->ends(),
+                                       strided_slice_node->strides(), info.begin_mask(), info.end_mask());
+
+    // Reversed views are not expressible through unsigned strides
+    for (unsigned int i = 0; i < steps.num_dimensions(); ++i)
+    {
+        if (steps[i] < 1)
+        {
+            return false;
+        }
+    }
+
+    // Keep the innermost dimension dense
+    return steps[0] == 1;
+}
+
+/** Check that no consumer of a tensor writes to it in-place
+ *
+ * @param[in] g      Graph
+ * @param[in] tensor Tensor to check
+ *
+ * @return True if the tensor is only read by its consumers
+ */
+bool is_read_only(Graph &g, const Tensor *tensor)
+{
+    for (const EdgeID &eid : tensor->bound_edges())
+    {
+        const Edge *edge = g.edge(eid);
+        if (edge == nullptr || edge->consumer() == nullptr)
+        {
+            continue;
+        }
+        const INode *consumer = edge->consumer();
+        for (unsigned int i = 0; i < consumer->num_outputs(); ++i)
+        {
+            if (consumer->output(i) == tensor)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+const char *SliceLayerSubTensorMutator::name()
+{
+    return "SliceLayerSubTensorMutator";
+}
+
+IGraphMutator::MutationType SliceLayerSubTensorMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void SliceLayerSubTensorMutator::mutate(Graph &g)
+{
+    // Early exit if no Slice layers exist in graph
+    if (g.nodes(NodeType::SliceLayer).empty() && g.nodes(NodeType::StridedSliceLayer).empty())
+    {
+        return;
+    }
+
+    // Perform topological sort
+    std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+
+    // Should be in reverse order of execution
+    for (auto &node_id : arm_compute::utils::iterable::reverse_iterate(topological_sorted_node_ids))
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr ||
+            (node->type() != NodeType::SliceLayer && node->type() != NodeType::StridedSliceLayer) ||
+            node->input(0) == nullptr || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        Tensor *input_tensor  = node->input(0);
+        Tensor *output_tensor = node->output(0);
+
+        // Check that both tensors share the same target and metadata, that the output is not already a view
+        // and that nobody overwrites it, as this would corrupt the input
+        const bool is_valid = (input_tensor->handle() != nullptr) && (output_tensor->handle() != nullptr) &&
+                              (output_tensor->handle()->parent_handle() == output_tensor->handle()) &&
+                              (input_tensor->desc().target == output_tensor->desc().target) &&
+                              (input_tensor->desc().data_type == output_tensor->desc().data_type) &&
+                              (input_tensor->desc().quant_info == output_tensor->desc().quant_info) &&
+                              is_read_only(g, output_tensor);
+
+        Coordinates coords;
+        Coordinates steps;
+        if (!is_valid || !is_target_supported(output_tensor->desc().target) || !compute_view(node, coords, steps))
+        {
+            continue;
+        }
+
+        backends::IDeviceBackend &backend =
+            backends::BackendRegistry::get().get_backend(output_tensor->desc().target);
+        std::unique_ptr<ITensorHandle> handle =
+            backend.create_strided_subtensor(input_tensor->handle(), output_tensor->desc().shape, coords, steps);
+        if (handle == nullptr || !has_evenly_spaced_rows(*handle))
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : " << node->id() << " and name : "
+                                                                                 << node->name() << std::endl);
+        output_tensor->set_handle(std::move(handle));
+
+        if (node->type() == NodeType::SliceLayer)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(node)->set_enabled(false);
+        }
+        else
+        {
+            arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(node)->set_enabled(false);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
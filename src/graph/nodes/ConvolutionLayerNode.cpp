@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,6 +88,23 @@ void ConvolutionLayerNode::set_fused_activation(ActivationLayerInfo fused_activa
     _fused_activation = fused_activation;
 }
 
+void ConvolutionLayerNode::set_fused_residual(ActivationLayerInfo residual_activation)
+{
+    _fused_residual      = true;
+    _residual_activation = residual_activation;
+    _input_edges.resize(residual_input_idx + 1, EmptyEdgeID);
+}
+
+bool ConvolutionLayerNode::has_fused_residual() const
+{
+    return _fused_residual;
+}
+
+ActivationLayerInfo ConvolutionLayerNode::residual_activation() const
+{
+    return _residual_activation;
+}
+
 void ConvolutionLayerNode::set_convolution_info(PadStrideInfo info)
 {
     _info = info;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,23 @@ void DepthwiseConvolutionLayerNode::set_fused_activation(ActivationLayerInfo fus
     _fused_activation = fused_activation;
 }
 
+void DepthwiseConvolutionLayerNode::set_fused_residual(ActivationLayerInfo residual_activation)
+{
+    _fused_residual      = true;
+    _residual_activation = residual_activation;
+    _input_edges.resize(residual_input_idx + 1, EmptyEdgeID);
+}
+
+bool DepthwiseConvolutionLayerNode::has_fused_residual() const
+{
+    return _fused_residual;
+}
+
+ActivationLayerInfo DepthwiseConvolutionLayerNode::residual_activation() const
+{
+    return _residual_activation;
+}
+
 void DepthwiseConvolutionLayerNode::set_convolution_info(PadStrideInfo info)
 {
     _info = info;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Arm Limited.
+ * Copyright (c) 2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,23 @@ void FusedConvolutionBatchNormalizationNode::set_fused_activation(ActivationLaye
     _fused_activation = fused_activation;
 }
 
+void FusedConvolutionBatchNormalizationNode::set_fused_residual(ActivationLayerInfo residual_activation)
+{
+    _fused_residual      = true;
+    _residual_activation = residual_activation;
+    _input_edges.resize(residual_input_idx + 1, EmptyEdgeID);
+}
+
+bool FusedConvolutionBatchNormalizationNode::has_fused_residual() const
+{
+    return _fused_residual;
+}
+
+ActivationLayerInfo FusedConvolutionBatchNormalizationNode::residual_activation() const
+{
+    return _residual_activation;
+}
+
 TensorDescriptor FusedConvolutionBatchNormalizationNode::compute_output_descriptor(
     const TensorDescriptor &input_descriptor, const TensorDescriptor &weights_descriptor, const PadStrideInfo &info)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Arm Limited.
+ * Copyright (c) 2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,6 +84,23 @@ void FusedDepthwiseConvolutionBatchNormalizationNode::set_fused_activation(Activ
     _fused_activation = fused_activation;
 }
 
+void FusedDepthwiseConvolutionBatchNormalizationNode::set_fused_residual(ActivationLayerInfo residual_activation)
+{
+    _fused_residual      = true;
+    _residual_activation = residual_activation;
+    _input_edges.resize(residual_input_idx + 1, EmptyEdgeID);
+}
+
+bool FusedDepthwiseConvolutionBatchNormalizationNode::has_fused_residual() const
+{
+    return _fused_residual;
+}
+
+ActivationLayerInfo FusedDepthwiseConvolutionBatchNormalizationNode::residual_activation() const
+{
+    return _residual_activation;
+}
+
 TensorDescriptor
 FusedDepthwiseConvolutionBatchNormalizationNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                            const TensorDescriptor &weights_descriptor,
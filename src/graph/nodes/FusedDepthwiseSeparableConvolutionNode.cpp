@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedDepthwiseSeparableConvolutionNode.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/Utils.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedDepthwiseSeparableConvolutionNode::FusedDepthwiseSeparableConvolutionNode(DepthwiseSeparableConv2dInfo info,
+                                                                               QuantizationInfo out_quant_info)
+    : _info(std::move(info)), _out_quant_info(std::move(out_quant_info))
+{
+    _input_edges.resize(5, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+const DepthwiseSeparableConv2dInfo &FusedDepthwiseSeparableConvolutionNode::depthwise_separable_info() const
+{
+    return _info;
+}
+
+TensorDescriptor
+FusedDepthwiseSeparableConvolutionNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                                  const TensorDescriptor &dw_weights_descriptor,
+                                                                  const TensorDescriptor &pw_weights_descriptor,
+                                                                  const PadStrideInfo    &info)
+{
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+
+    const unsigned int input_width     = get_dimension_size(input_descriptor, DataLayoutDimension::WIDTH);
+    const unsigned int input_height    = get_dimension_size(input_descriptor, DataLayoutDimension::HEIGHT);
+    const unsigned int kernel_width    = get_dimension_size(dw_weights_descriptor, DataLayoutDimension::WIDTH);
+    const unsigned int kernel_height   = get_dimension_size(dw_weights_descriptor, DataLayoutDimension::HEIGHT);
+    const unsigned int output_channels = get_dimension_size(pw_weights_descriptor, DataLayoutDimension::BATCHES);
+
+    std::tie(output_width, output_height) =
+        scaled_dimensions(input_width, input_height, kernel_width, kernel_height, info);
+
+    TensorDescriptor output_descriptor = input_descriptor;
+    output_descriptor.shape.set(get_dimension_idx(output_descriptor.layout, DataLayoutDimension::WIDTH), output_width);
+    output_descriptor.shape.set(get_dimension_idx(output_descriptor.layout, DataLayoutDimension::HEIGHT),
+                                output_height);
+    output_descriptor.shape.set(get_dimension_idx(output_descriptor.layout, DataLayoutDimension::CHANNEL),
+                                output_channels);
+
+    return output_descriptor;
+}
+
+bool FusedDepthwiseSeparableConvolutionNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID) && (input_id(3) != NullTensorID) &&
+        (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedDepthwiseSeparableConvolutionNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    const Tensor *src        = input(0);
+    const Tensor *dw_weights = input(1);
+    const Tensor *pw_weights = input(3);
+
+    ARM_COMPUTE_ERROR_ON(src == nullptr || dw_weights == nullptr || pw_weights == nullptr);
+
+    TensorDescriptor output_info =
+        compute_output_descriptor(src->desc(), dw_weights->desc(), pw_weights->desc(), _info.dw_conv_info);
+    if (!_out_quant_info.empty())
+    {
+        output_info.quant_info = _out_quant_info;
+    }
+
+    return output_info;
+}
+
+NodeType FusedDepthwiseSeparableConvolutionNode::type() const
+{
+    return FusedDepthwiseSeparableConvolutionNode::node_type;
+}
+
+void FusedDepthwiseSeparableConvolutionNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,7 +36,7 @@ StridedSliceLayerNode::StridedSliceLayerNode(const Coordinates    &starts,
                                              const Coordinates    &ends,
                                              const BiStrides      &strides,
                                              StridedSliceLayerInfo info)
-    : _starts(starts), _ends(ends), _strides(strides), _info(std::move(info))
+    : _starts(starts), _ends(ends), _strides(strides), _info(std::move(info)), _is_enabled(true)
 {
     _input_edges.resize(1, EmptyEdgeID);
     _outputs.resize(1, NullTensorID);
@@ -62,6 +62,16 @@ StridedSliceLayerInfo StridedSliceLayerNode::strided_slice_info() const
     return _info;
 }
 
+void StridedSliceLayerNode::set_enabled(bool is_enabled)
+{
+    _is_enabled = is_enabled;
+}
+
+bool StridedSliceLayerNode::is_enabled() const
+{
+    return _is_enabled;
+}
+
 TensorDescriptor StridedSliceLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                   const Coordinates      &starts,
                                                                   const Coordinates      &ends,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "arm_compute/runtime/Types.h"
 
+#include "src/common/utils/profile/acl_profile.h"
+
 #include <vector>
 
 using namespace arm_compute;
@@ -74,6 +76,16 @@ std::unique_ptr<IMemoryPool> BlobMemoryPool::duplicate()
     return std::make_unique<BlobMemoryPool>(_allocator, _blob_info);
 }
 
+size_t BlobMemoryPool::size() const
+{
+    size_t total_size = 0;
+    for (const auto &bi : _blob_info)
+    {
+        total_size += bi.size;
+    }
+    return total_size;
+}
+
 void BlobMemoryPool::allocate_blobs(const std::vector<BlobInfo> &blob_info)
 {
     ARM_COMPUTE_ERROR_ON(!_allocator);
@@ -81,10 +93,17 @@ void BlobMemoryPool::allocate_blobs(const std::vector<BlobInfo> &blob_info)
     for (const auto &bi : blob_info)
     {
         _blobs.push_back(_allocator->make_region(bi.size, bi.alignment));
+        ARM_COMPUTE_TRACE_COUNTER_ADD(ARM_COMPUTE_PROF_CAT_MEMORY, ARM_COMPUTE_PROF_LVL_CPU, "Memory pools bytes",
+                                      bi.size);
     }
 }
 
 void BlobMemoryPool::free_blobs()
 {
+    for (const auto &blob : _blobs)
+    {
+        ARM_COMPUTE_TRACE_COUNTER_ADD(ARM_COMPUTE_PROF_CAT_MEMORY, ARM_COMPUTE_PROF_LVL_CPU, "Memory pools bytes",
+                                      -static_cast<int64_t>(blob->size()));
+    }
     _blobs.clear();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,8 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/runtime/SchedulerUtils.h"
 #include "support/Mutex.h"
 
 #include <atomic>
@@ -51,10 +53,12 @@ class ThreadFeeder
 public:
     /** Constructor
      *
-     * @param[in] start First value that will be returned by the feeder
-     * @param[in] end   End condition (The last value returned by get_next() will be end - 1)
+     * @param[in] start     First value that will be returned by the feeder
+     * @param[in] end       End condition (The last value returned by get_next() will be end - 1)
+     * @param[in] flow_base (Optional) Identifier of the trace flow leading to the first workload
      */
-    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0) : _atomic_counter(start), _end(end)
+    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0, uint64_t flow_base = 0)
+        : _atomic_counter(start), _end(end), _flow_base(flow_base)
     {
     }
     /** Return the next element in the range if there is one.
@@ -68,10 +72,21 @@ public:
         next = atomic_fetch_add_explicit(&_atomic_counter, 1u, std::memory_order_relaxed);
         return next < _end;
     }
+    /** Identifier of the trace flow leading to a workload
+     *
+     * @param[in] workload_index Index of the workload
+     *
+     * @return The flow identifier
+     */
+    uint64_t flow_id(unsigned int workload_index) const
+    {
+        return _flow_base + workload_index;
+    }
 
 private:
     std::atomic_uint   _atomic_counter;
     const unsigned int _end;
+    const uint64_t     _flow_base;
 };
 
 /** Execute workloads[info.thread_id] first, then call the feeder to get the index of the next workload to run.
@@ -88,6 +103,8 @@ void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeede
     do
     {
         ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
+        ARM_COMPUTE_TRACE_EVENT_FLOW_END(ARM_COMPUTE_PROF_CAT_SCHEDULER, ARM_COMPUTE_PROF_LVL_CPU,
+                                         "CPPScheduler::workload", feeder.flow_id(workload_index));
         workloads[workload_index](info);
     } while (feeder.get_next(workload_index));
 }
@@ -254,6 +271,7 @@ std::exception_ptr Thread::wait()
 void Thread::worker_thread()
 {
     set_thread_affinity(_core_pin);
+    ARM_COMPUTE_TRACE_THREAD_NAME("CPPScheduler worker");
 
     while (true)
     {
@@ -487,7 +505,11 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
             break;
         }
     }
-    ThreadFeeder feeder(num_threads_to_use, workloads.size());
+    // Every workload is linked in traces to this launch by its own flow, whichever thread runs it
+    const uint64_t flow_base = ARM_COMPUTE_TRACE_NEW_FLOW_IDS(workloads.size());
+    ARM_COMPUTE_TRACE_EVENT_WITH_FLOWS(ARM_COMPUTE_PROF_CAT_SCHEDULER, ARM_COMPUTE_PROF_LVL_CPU,
+                                       "CPPScheduler::run_workloads", flow_base, workloads.size());
+    ThreadFeeder feeder(num_threads_to_use, workloads.size(), flow_base);
     ThreadInfo   info;
     info.cpu_info          = &cpu_info();
     info.num_threads       = num_threads_to_use;
@@ -546,12 +568,14 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 
 void CPPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
+    const scheduler_utils::KernelTelemetryScope telemetry(kernel, window, tensors, num_threads());
     schedule_common(kernel, hints, window, tensors);
 }
 
 void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
-    ITensorPack tensors;
+    ITensorPack                                 tensors;
+    const scheduler_utils::KernelTelemetryScope telemetry(kernel, kernel->window(), tensors, num_threads());
     schedule_common(kernel, hints, kernel->window(), tensors);
 }
 } // namespace arm_compute
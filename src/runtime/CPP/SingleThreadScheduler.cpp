@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
 
+#include "src/runtime/SchedulerUtils.h"
+
 namespace arm_compute
 {
 void SingleThreadScheduler::set_num_threads(unsigned int num_threads)
@@ -48,7 +50,9 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
         }
     }
 
-    ThreadInfo info;
+    ITensorPack                                 tensors;
+    const scheduler_utils::KernelTelemetryScope telemetry(kernel, max_window, tensors, 1);
+    ThreadInfo                                  info;
     info.cpu_info = &cpu_info();
     kernel->run(kernel->window(), info);
 }
@@ -59,7 +63,8 @@ void SingleThreadScheduler::schedule_op(ICPPKernel   *kernel,
                                         ITensorPack  &tensors)
 {
     ARM_COMPUTE_UNUSED(hints);
-    ThreadInfo info;
+    const scheduler_utils::KernelTelemetryScope telemetry(kernel, window, tensors, 1);
+    ThreadInfo                                  info;
     info.cpu_info = &cpu_info();
     kernel->run_op(tensors, window, info);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/DetectionPostProcessHelpers.h"
 
 #include <cstddef>
 #include <ios>
@@ -117,149 +118,6 @@ Status validate_arguments(const ITensorInfo            *input_box_encoding,
 
     return Status{};
 }
-
-inline void
-DecodeBoxCorner(BBox &box_centersize, BBox &anchor, Iterator &decoded_it, DetectionPostProcessLayerInfo info)
-{
-    const float half_factor = 0.5f;
-
-    // BBox is equavalent to CenterSizeEncoding [y,x,h,w]
-    const float y_center = box_centersize[0] / info.scale_value_y() * anchor[2] + anchor[0];
-    const float x_center = box_centersize[1] / info.scale_value_x() * anchor[3] + anchor[1];
-    const float half_h =
-        half_factor * static_cast<float>(std::exp(box_centersize[2] / info.scale_value_h())) * anchor[2];
-    const float half_w =
-        half_factor * static_cast<float>(std::exp(box_centersize[3] / info.scale_value_w())) * anchor[3];
-
-    // Box Corner encoding boxes are saved as [xmin, ymin, xmax, ymax]
-    auto decoded_ptr   = reinterpret_cast<float *>(decoded_it.ptr());
-    *(decoded_ptr)     = x_center - half_w; // xmin
-    *(1 + decoded_ptr) = y_center - half_h; // ymin
-    *(2 + decoded_ptr) = x_center + half_w; // xmax
-    *(3 + decoded_ptr) = y_center + half_h; // ymax
-}
-
-/** Decode a bbox according to a anchors and scale info.
- *
- * @param[in]  input_box_encoding The input prior bounding boxes.
- * @param[in]  input_anchors      The corresponding input variance.
- * @param[in]  info               The detection informations
- * @param[out] decoded_boxes      The decoded bboxes.
- */
-void DecodeCenterSizeBoxes(const ITensor                *input_box_encoding,
-                           const ITensor                *input_anchors,
-                           DetectionPostProcessLayerInfo info,
-                           Tensor                       *decoded_boxes)
-{
-    const QuantizationInfo &qi_box     = input_box_encoding->info()->quantization_info();
-    const QuantizationInfo &qi_anchors = input_anchors->info()->quantization_info();
-    BBox                    box_centersize{{}};
-    BBox                    anchor{{}};
-
-    Window win;
-    win.use_tensor_dimensions(input_box_encoding->info()->tensor_shape());
-    win.set_dimension_step(0U, 4U);
-    win.set_dimension_step(1U, 1U);
-    Iterator box_it(input_box_encoding, win);
-    Iterator anchor_it(input_anchors, win);
-    Iterator decoded_it(decoded_boxes, win);
-
-    if (input_box_encoding->info()->data_type() == DataType::QASYMM8)
-    {
-        execute_window_loop(
-            win,
-            [&](const Coordinates &)
-            {
-                const auto box_ptr    = reinterpret_cast<const qasymm8_t *>(box_it.ptr());
-                const auto anchor_ptr = reinterpret_cast<const qasymm8_t *>(anchor_it.ptr());
-                box_centersize =
-                    BBox({dequantize_qasymm8(*box_ptr, qi_box), dequantize_qasymm8(*(box_ptr + 1), qi_box),
-                          dequantize_qasymm8(*(2 + box_ptr), qi_box), dequantize_qasymm8(*(3 + box_ptr), qi_box)});
-                anchor = BBox({dequantize_qasymm8(*anchor_ptr, qi_anchors),
-                               dequantize_qasymm8(*(anchor_ptr + 1), qi_anchors),
-                               dequantize_qasymm8(*(2 + anchor_ptr), qi_anchors),
-                               dequantize_qasymm8(*(3 + anchor_ptr), qi_anchors)});
-                DecodeBoxCorner(box_centersize, anchor, decoded_it, info);
-            },
-            box_it, anchor_it, decoded_it);
-    }
-    else if (input_box_encoding->info()->data_type() == DataType::QASYMM8_SIGNED)
-    {
-        execute_window_loop(
-            win,
-            [&](const Coordinates &)
-            {
-                const auto box_ptr    = reinterpret_cast<const qasymm8_signed_t *>(box_it.ptr());
-                const auto anchor_ptr = reinterpret_cast<const qasymm8_signed_t *>(anchor_it.ptr());
-                box_centersize        = BBox({dequantize_qasymm8_signed(*box_ptr, qi_box),
-                                              dequantize_qasymm8_signed(*(box_ptr + 1), qi_box),
-                                              dequantize_qasymm8_signed(*(2 + box_ptr), qi_box),
-                                              dequantize_qasymm8_signed(*(3 + box_ptr), qi_box)});
-                anchor                = BBox({dequantize_qasymm8_signed(*anchor_ptr, qi_anchors),
-                                              dequantize_qasymm8_signed(*(anchor_ptr + 1), qi_anchors),
-                                              dequantize_qasymm8_signed(*(2 + anchor_ptr), qi_anchors),
-                                              dequantize_qasymm8_signed(*(3 + anchor_ptr), qi_anchors)});
-                DecodeBoxCorner(box_centersize, anchor, decoded_it, info);
-            },
-            box_it, anchor_it, decoded_it);
-    }
-    else
-    {
-        execute_window_loop(
-            win,
-            [&](const Coordinates &)
-            {
-                const auto box_ptr    = reinterpret_cast<const float *>(box_it.ptr());
-                const auto anchor_ptr = reinterpret_cast<const float *>(anchor_it.ptr());
-                box_centersize        = BBox({*box_ptr, *(box_ptr + 1), *(2 + box_ptr), *(3 + box_ptr)});
-                anchor                = BBox({*anchor_ptr, *(anchor_ptr + 1), *(2 + anchor_ptr), *(3 + anchor_ptr)});
-                DecodeBoxCorner(box_centersize, anchor, decoded_it, info);
-            },
-            box_it, anchor_it, decoded_it);
-    }
-}
-
-void SaveOutputs(const Tensor              *decoded_boxes,
-                 const std::vector<int>    &result_idx_boxes_after_nms,
-                 const std::vector<float>  &result_scores_after_nms,
-                 const std::vector<int>    &result_classes_after_nms,
-                 std::vector<unsigned int> &sorted_indices,
-                 const unsigned int         num_output,
-                 const unsigned int         max_detections,
-                 ITensor                   *output_boxes,
-                 ITensor                   *output_classes,
-                 ITensor                   *output_scores,
-                 ITensor                   *num_detection)
-{
-    // xmin,ymin,xmax,ymax -> ymin,xmin,ymax,xmax
-    unsigned int i = 0;
-    for (; i < num_output; ++i)
-    {
-        const unsigned int box_in_idx = result_idx_boxes_after_nms[sorted_indices[i]];
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(0, i)))) =
-            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(1, box_in_idx))));
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(1, i)))) =
-            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(0, box_in_idx))));
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(2, i)))) =
-            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(3, box_in_idx))));
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(3, i)))) =
-            *(reinterpret_cast<float *>(decoded_boxes->ptr_to_element(Coordinates(2, box_in_idx))));
-        *(reinterpret_cast<float *>(output_classes->ptr_to_element(Coordinates(i)))) =
-            static_cast<float>(result_classes_after_nms[sorted_indices[i]]);
-        *(reinterpret_cast<float *>(output_scores->ptr_to_element(Coordinates(i)))) =
-            result_scores_after_nms[sorted_indices[i]];
-    }
-    for (; i < max_detections; ++i)
-    {
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(1, i)))) = 0.0f;
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(0, i)))) = 0.0f;
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(3, i)))) = 0.0f;
-        *(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(2, i)))) = 0.0f;
-        *(reinterpret_cast<float *>(output_classes->ptr_to_element(Coordinates(i))))  = 0.0f;
-        *(reinterpret_cast<float *>(output_scores->ptr_to_element(Coordinates(i))))   = 0.0f;
-    }
-    *(reinterpret_cast<float *>(num_detection->ptr_to_element(Coordinates(0)))) = num_output;
-}
 } // namespace
 
 CPPDetectionPostProcessLayer::CPPDetectionPostProcessLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -392,7 +250,8 @@ void CPPDetectionPostProcessLayer::run()
     const unsigned int num_classes    = _info.num_classes();
     const unsigned int max_detections = _info.max_detections();
 
-    DecodeCenterSizeBoxes(_input_box_encoding, _input_anchors, _info, &_decoded_boxes);
+    detection_post_process_helpers::decode_center_size_boxes(_input_box_encoding, _input_anchors, _info,
+                                                             &_decoded_boxes);
 
     // Decode scores if necessary
     if (_dequantize_scores)
@@ -474,9 +333,10 @@ void CPPDetectionPostProcessLayer::run()
                           [&](unsigned int first, unsigned int second)
                           { return result_scores_after_nms[first] > result_scores_after_nms[second]; });
 
-        SaveOutputs(&_decoded_boxes, result_idx_boxes_after_nms, result_scores_after_nms, result_classes_after_nms,
-                    sorted_indices, num_output, max_detections, _output_boxes, _output_classes, _output_scores,
-                    _num_detection);
+        detection_post_process_helpers::save_outputs(&_decoded_boxes, result_idx_boxes_after_nms,
+                                                     result_scores_after_nms, result_classes_after_nms, sorted_indices,
+                                                     num_output, max_detections, _output_boxes, _output_classes,
+                                                     _output_scores, _num_detection);
     }
     // Fast NMS
     else
@@ -531,8 +391,9 @@ void CPPDetectionPostProcessLayer::run()
         // We select the max detection numbers of the highest score of all classes
         const auto num_output = std::min<unsigned int>(_info.max_detections(), selected_indices.size());
 
-        SaveOutputs(&_decoded_boxes, box_indices, max_scores, max_score_classes, selected_indices, num_output,
-                    max_detections, _output_boxes, _output_classes, _output_scores, _num_detection);
+        detection_post_process_helpers::save_outputs(&_decoded_boxes, box_indices, max_scores, max_score_classes,
+                                                     selected_indices, num_output, max_detections, _output_boxes,
+                                                     _output_classes, _output_scores, _num_detection);
     }
 }
 } // namespace arm_compute
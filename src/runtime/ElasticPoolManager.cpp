@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ElasticPoolManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IMemoryPool.h"
+
+#include <algorithm>
+#include <list>
+#include <utility>
+
+namespace arm_compute
+{
+ElasticPoolManager::ElasticPoolManager(size_t                    memory_budget,
+                                       std::chrono::milliseconds idle_timeout,
+                                       ClockFunction             clock)
+    : _memory_budget(memory_budget),
+      _idle_timeout(idle_timeout),
+      _clock(clock != nullptr ? std::move(clock) : ClockFunction(&Clock::now)),
+      _free_pools(),
+      _occupied_pools(),
+      _stats(),
+      _mtx()
+{
+}
+
+IMemoryPool *ElasticPoolManager::lock_pool()
+{
+    arm_compute::unique_lock<arm_compute::Mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ++_stats.num_locks;
+
+    if (_free_pools.empty() && !can_grow())
+    {
+#ifndef NO_MULTI_THREADING
+        // Wait until a pool is unlocked or enough memory is released to create a new one
+        const auto start = _clock();
+        _cv.wait(lock, [this]() { return !_free_pools.empty() || can_grow(); });
+        const auto wait_time = std::chrono::duration_cast<std::chrono::nanoseconds>(_clock() - start);
+
+        ++_stats.num_waits;
+        _stats.total_wait_time += wait_time;
+        _stats.max_wait_time = std::max(_stats.max_wait_time, wait_time);
+#else  /* NO_MULTI_THREADING */
+        ARM_COMPUTE_ERROR("All the pools are occupied and the memory budget is exhausted!");
+#endif /* NO_MULTI_THREADING */
+    }
+
+    if (_free_pools.empty())
+    {
+        // All the pools are occupied: create a new one from any of them
+        IMemoryPool *prototype = _occupied_pools.front().get();
+        _occupied_pools.push_front(prototype->duplicate());
+        _stats.memory_size += prototype->size();
+        ++_stats.num_pools_created;
+        update_high_water_marks();
+        return _occupied_pools.front().get();
+    }
+
+    // Most recently used pool first, so that idle pools accumulate at the back
+    _occupied_pools.push_front(std::move(_free_pools.front().pool));
+    _free_pools.pop_front();
+    return _occupied_pools.front().get();
+}
+
+void ElasticPoolManager::unlock_pool(IMemoryPool *pool)
+{
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+
+        auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools),
+                               [pool](const std::unique_ptr<IMemoryPool> &pool_it) { return pool_it.get() == pool; });
+        ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
+
+        const auto now = _clock();
+        _free_pools.push_front(FreePool{std::move(*it), now});
+        _occupied_pools.erase(it);
+        trim_idle_pools_locked(now);
+    }
+#ifndef NO_MULTI_THREADING
+    _cv.notify_one();
+#endif /* NO_MULTI_THREADING */
+}
+
+void ElasticPoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
+{
+    ARM_COMPUTE_ERROR_ON(pool == nullptr);
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        _stats.memory_size += pool->size();
+        _free_pools.push_front(FreePool{std::move(pool), _clock()});
+        update_high_water_marks();
+    }
+#ifndef NO_MULTI_THREADING
+    _cv.notify_one();
+#endif /* NO_MULTI_THREADING */
+}
+
+std::unique_ptr<IMemoryPool> ElasticPoolManager::release_pool()
+{
+    std::unique_ptr<IMemoryPool> pool = nullptr;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+        if (!_free_pools.empty())
+        {
+            // Release the least recently used pool
+            pool = std::move(_free_pools.back().pool);
+            _free_pools.pop_back();
+            _stats.memory_size -= pool->size();
+        }
+    }
+#ifndef NO_MULTI_THREADING
+    if (pool != nullptr)
+    {
+        // The released memory may allow waiting callers to create a new pool
+        _cv.notify_all();
+    }
+#endif /* NO_MULTI_THREADING */
+
+    return pool;
+}
+
+void ElasticPoolManager::clear_pools()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to clear the PoolManager!");
+    _free_pools.clear();
+    _stats.memory_size = 0;
+}
+
+size_t ElasticPoolManager::num_pools() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    return _free_pools.size() + _occupied_pools.size();
+}
+
+size_t ElasticPoolManager::trim_idle_pools()
+{
+    size_t num_trimmed = 0;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        num_trimmed = trim_idle_pools_locked(_clock());
+    }
+#ifndef NO_MULTI_THREADING
+    if (num_trimmed > 0)
+    {
+        // The released memory may allow waiting callers to create a new pool
+        _cv.notify_all();
+    }
+#endif /* NO_MULTI_THREADING */
+
+    return num_trimmed;
+}
+
+ElasticPoolManagerStats ElasticPoolManager::stats() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    ElasticPoolManagerStats stats = _stats;
+    stats.num_pools               = _free_pools.size() + _occupied_pools.size();
+    return stats;
+}
+
+void ElasticPoolManager::reset_stats()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    const size_t memory_size = _stats.memory_size;
+    _stats                   = ElasticPoolManagerStats();
+    _stats.memory_size       = memory_size;
+    update_high_water_marks();
+}
+
+bool ElasticPoolManager::can_grow() const
+{
+    if (_occupied_pools.empty())
+    {
+        return false;
+    }
+    const size_t size = _occupied_pools.front()->size();
+    return _memory_budget == 0 || _stats.memory_size + size <= _memory_budget;
+}
+
+void ElasticPoolManager::update_high_water_marks()
+{
+    const size_t num_pools           = _free_pools.size() + _occupied_pools.size();
+    _stats.num_pools_high_water_mark = std::max(_stats.num_pools_high_water_mark, num_pools);
+    _stats.memory_high_water_mark    = std::max(_stats.memory_high_water_mark, _stats.memory_size);
+}
+
+size_t ElasticPoolManager::trim_idle_pools_locked(Clock::time_point now)
+{
+    if (_idle_timeout.count() == 0)
+    {
+        return 0;
+    }
+
+    // Free pools are sorted from the most to the least recently used. The last pool is kept to create new ones.
+    size_t num_trimmed = 0;
+    while (!_free_pools.empty() && (_free_pools.size() + _occupied_pools.size()) > 1 &&
+           now - _free_pools.back().last_used > _idle_timeout)
+    {
+        _stats.memory_size -= _free_pools.back().pool->size();
+        _free_pools.pop_back();
+        ++num_trimmed;
+    }
+    _stats.num_pools_trimmed += num_trimmed;
+
+    return num_trimmed;
+}
+} // namespace arm_compute
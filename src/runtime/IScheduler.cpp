@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,20 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Kernel launch shared by all its workloads */
+struct LaunchInfo
+{
+    ICPPKernel   *kernel;          /**< Kernel to run */
+    ITensorPack  *tensors;         /**< Tensors to run the kernel on */
+    const Window *window;          /**< Window to split between the workloads */
+    size_t        split_dimension; /**< Dimension to split the window along */
+    unsigned int  num_windows;     /**< Number of windows along the split dimension (DimX when splitting in 2D) */
+    unsigned int  num_windows_y;   /**< Number of windows along DimY when splitting in 2D */
+};
+} // namespace
+
 IScheduler::IScheduler()
 {
     // Work out the best possible number of execution threads
@@ -50,6 +64,26 @@ void IScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFun
     ARM_COMPUTE_ERROR("Feature for affinity setting is not implemented");
 }
 
+void IScheduler::set_num_threads_on_numa_node(unsigned int num_threads, unsigned int node)
+{
+    const std::vector<unsigned int> cpus = cpu_info().get_numa_node_cpus(node);
+    if (cpus.empty())
+    {
+        ARM_COMPUTE_ERROR("Invalid NUMA node or node without CPUs");
+    }
+
+    const unsigned int num_threads_to_use = num_threads == 0 ? static_cast<unsigned int>(cpus.size()) : num_threads;
+    set_num_threads_with_affinity(num_threads_to_use,
+                                  [cpus](int thread_index, int)
+                                  { return static_cast<int>(cpus[thread_index % cpus.size()]); });
+    _numa_node = static_cast<int>(node);
+}
+
+int IScheduler::numa_node() const
+{
+    return _numa_node;
+}
+
 unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
@@ -84,33 +118,38 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             n_threads = std::min<unsigned int>(n, n_threads);
         }
 
-        std::vector<IScheduler::Workload> workloads;
+        const LaunchInfo launch{kernel, &tensors, &max_window, Window::DimX, m_threads, n_threads};
+
+        scheduler_utils::ThreadWorkloads   thread_workloads;
+        std::vector<IScheduler::Workload> &workloads = thread_workloads.get();
         for (unsigned int ni = 0; ni != n_threads; ++ni)
         {
             for (unsigned int mi = 0; mi != m_threads; ++mi)
             {
+                // Only capture the indices and the launch info so that the workload fits in the small buffer of
+                // std::function
                 workloads.push_back(
-                    [ni, mi, m_threads, n_threads, &max_window, &kernel, &tensors](const ThreadInfo &info)
+                    [ni, mi, &launch](const ThreadInfo &info)
                     {
                         //narrow the window to our mi-ni workload
-                        Window win = max_window.split_window(Window::DimX, mi, m_threads)
-                                         .split_window(Window::DimY, ni, n_threads);
+                        Window win = launch.window->split_window(Window::DimX, mi, launch.num_windows)
+                                         .split_window(Window::DimY, ni, launch.num_windows_y);
 
                         win.validate();
 
                         Window thread_locator;
-                        thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
-                        thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
+                        thread_locator.set(Window::DimX, Window::Dimension(mi, launch.num_windows));
+                        thread_locator.set(Window::DimY, Window::Dimension(ni, launch.num_windows_y));
 
                         thread_locator.validate();
 
-                        if (tensors.empty())
+                        if (launch.tensors->empty())
                         {
-                            kernel->run_nd(win, info, thread_locator);
+                            launch.kernel->run_nd(win, info, thread_locator);
                         }
                         else
                         {
-                            kernel->run_op(tensors, win, info);
+                            launch.kernel->run_op(*launch.tensors, win, info);
                         }
                     });
             }
@@ -162,22 +201,26 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
 
-            std::vector<IScheduler::Workload> workloads(num_windows);
+            const LaunchInfo launch{kernel, &tensors, &max_window, hints.split_dimension(), num_windows, 1};
+
+            scheduler_utils::ThreadWorkloads   thread_workloads;
+            std::vector<IScheduler::Workload> &workloads = thread_workloads.get();
+            workloads.resize(num_windows);
             for (unsigned int t = 0; t < num_windows; ++t)
             {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
+                //Capture 't' by copy and the launch info by reference, so that the workload needs no allocation
+                workloads[t] = [t, &launch](const ThreadInfo &info)
                 {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                    Window win = launch.window->split_window(launch.split_dimension, t, launch.num_windows);
                     win.validate();
 
-                    if (tensors.empty())
+                    if (launch.tensors->empty())
                     {
-                        kernel->run(win, info);
+                        launch.kernel->run(win, info);
                     }
                     else
                     {
-                        kernel->run_op(tensors, win, info);
+                        launch.kernel->run_op(*launch.tensors, win, info);
                     }
                 };
             }
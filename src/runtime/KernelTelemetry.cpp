@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KernelTelemetry.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+KernelTelemetry &KernelTelemetry::get()
+{
+    static KernelTelemetry telemetry;
+    return telemetry;
+}
+
+void KernelTelemetry::set_callback(Callback callback)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _callback = callback ? std::make_shared<const Callback>(std::move(callback)) : nullptr;
+    update_enabled();
+}
+
+void KernelTelemetry::set_ring_buffer_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _ring.clear();
+    _ring.shrink_to_fit();
+    _ring.reserve(capacity);
+    _capacity = capacity;
+    _head     = 0;
+    _dropped  = 0;
+    update_enabled();
+}
+
+std::vector<KernelTelemetryRecord> KernelTelemetry::drain()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Once the buffer has wrapped around, the oldest record is the one to be replaced next
+    std::vector<KernelTelemetryRecord> records;
+    records.reserve(_capacity);
+    for (size_t i = 0; i < _ring.size(); ++i)
+    {
+        records.push_back(std::move(_ring[(_head + i) % _ring.size()]));
+    }
+    _ring.clear();
+    _head = 0;
+    return records;
+}
+
+size_t KernelTelemetry::num_dropped() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _dropped;
+}
+
+void KernelTelemetry::record(KernelTelemetryRecord &&record)
+{
+    std::shared_ptr<const Callback> callback;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        callback = _callback;
+        if (_capacity != 0)
+        {
+            if (_ring.size() < _capacity)
+            {
+                _ring.push_back(callback ? record : std::move(record));
+            }
+            else
+            {
+                _ring[_head] = callback ? record : std::move(record);
+                _head        = (_head + 1) % _capacity;
+                ++_dropped;
+            }
+        }
+    }
+
+    // The callback runs without the lock, so that it can query the telemetry and does not serialize the threads
+    if (callback)
+    {
+        (*callback)(record);
+    }
+}
+
+void KernelTelemetry::update_enabled()
+{
+    _enabled = _callback != nullptr || _capacity != 0;
+}
+} // namespace arm_compute
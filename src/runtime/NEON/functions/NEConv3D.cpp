@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,10 +26,13 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv3d.h"
+#include "src/cpu/operators/CpuGemmConv3d.h"
 
 namespace arm_compute
 {
@@ -37,12 +40,19 @@ using namespace arm_compute::experimental;
 
 struct NEConv3D::Impl
 {
+    const ITensor                     *weights{nullptr};
     std::unique_ptr<cpu::ICpuOperator> op{nullptr};
     ITensorPack                        run_pack{};
+    ITensorPack                        prep_pack{};
+    WorkspaceData<Tensor>              workspace{};
+    MemoryGroup                        memory_group{};
+    bool                               is_prepared{false};
+    experimental::MemoryRequirements   aux_mem_req{};
 };
 
-NEConv3D::NEConv3D() : _impl(std::make_unique<Impl>())
+NEConv3D::NEConv3D(const std::shared_ptr<IMemoryManager> &memory_manager) : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group = MemoryGroup(memory_manager);
 }
 
 NEConv3D::~NEConv3D() = default;
@@ -53,19 +63,32 @@ void NEConv3D::configure(
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEConv3D::configure");
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_ERROR_THROW_ON(cpu::CpuDirectConv3d::validate(
-        input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info));
+    ARM_COMPUTE_ERROR_THROW_ON(NEConv3D::validate(input->info(), weights->info(),
+                                                  ((biases != nullptr) ? biases->info() : nullptr), output->info(),
+                                                  conv_info));
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info);
 
-    auto f = std::make_unique<cpu::CpuDirectConv3d>();
-    f->configure(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(),
-                 conv_info);
-    _impl->op = std::move(f);
-
-    if (_impl->op != nullptr)
+    const ITensorInfo *biases_info = (biases != nullptr) ? biases->info() : nullptr;
+    if (bool(cpu::CpuGemmConv3d::validate(input->info(), weights->info(), biases_info, output->info(), conv_info)))
+    {
+        auto f = std::make_unique<cpu::CpuGemmConv3d>();
+        f->configure(input->info(), weights->info(), biases_info, output->info(), conv_info);
+        _impl->op = std::move(f);
+    }
+    else
     {
-        _impl->run_pack = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+        auto f = std::make_unique<cpu::CpuDirectConv3d>();
+        f->configure(input->info(), weights->info(), biases_info, output->info(), conv_info);
+        _impl->op = std::move(f);
     }
+
+    _impl->weights     = weights;
+    _impl->is_prepared = false;
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+    _impl->prep_pack   = {{ACL_SRC_1, weights}, {ACL_SRC_2, biases}};
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                  _impl->prep_pack, /* allocate_now */ false);
 }
 
 Status NEConv3D::validate(const ITensorInfo *input,
@@ -76,7 +99,10 @@ Status NEConv3D::validate(const ITensorInfo *input,
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEConv3D::validate");
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
-    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuDirectConv3d::validate(input, weights, biases, output, conv_info));
+    if (!bool(cpu::CpuGemmConv3d::validate(input, weights, biases, output, conv_info)))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuDirectConv3d::validate(input, weights, biases, output, conv_info));
+    }
 
     return Status{};
 }
@@ -84,9 +110,35 @@ Status NEConv3D::validate(const ITensorInfo *input,
 void NEConv3D::run()
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEConv3D::run");
-    if (_impl->op != nullptr)
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEConv3D::prepare()
+{
+    if (!_impl->is_prepared)
     {
-        _impl->op->run(_impl->run_pack);
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace);
+        _impl->op->prepare(_impl->prep_pack);
+
+        auto has_reshape =
+            std::find_if(_impl->aux_mem_req.begin(), _impl->aux_mem_req.end(),
+                         [](const MemoryInfo &m) -> bool { return m.lifetime == MemoryLifetime::Persistent; });
+
+        if (has_reshape != std::end(_impl->aux_mem_req))
+        {
+            _impl->weights->mark_as_unused();
+        }
+        else
+        {
+            _impl->run_pack.add_const_tensor(ACL_SRC_1, _impl->weights);
+        }
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
     }
 }
 } // namespace arm_compute
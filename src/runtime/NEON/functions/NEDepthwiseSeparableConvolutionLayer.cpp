@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuDepthwiseSeparableConv2d.h"
+
+namespace arm_compute
+{
+using OperatorType = cpu::CpuDepthwiseSeparableConv2d;
+using namespace arm_compute::experimental;
+
+struct NEDepthwiseSeparableConvolutionLayer::Impl
+{
+    const ITensor                   *dw_weights{nullptr};
+    const ITensor                   *pw_weights{nullptr};
+    std::unique_ptr<OperatorType>    op{nullptr};
+    ITensorPack                      run_pack{};
+    ITensorPack                      prep_pack{};
+    WorkspaceData<Tensor>            workspace{};
+    MemoryGroup                      memory_group{};
+    bool                             is_prepared{false};
+    experimental::MemoryRequirements aux_mem_req{};
+};
+
+NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer(
+    std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEDepthwiseSeparableConvolutionLayer::~NEDepthwiseSeparableConvolutionLayer() = default;
+
+void NEDepthwiseSeparableConvolutionLayer::configure(ITensor                            *input,
+                                                     const ITensor                      *dw_weights,
+                                                     const ITensor                      *dw_biases,
+                                                     const ITensor                      *pw_weights,
+                                                     const ITensor                      *pw_biases,
+                                                     ITensor                            *output,
+                                                     const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "NEDepthwiseSeparableConvolutionLayer::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, dw_weights, pw_weights, output);
+
+    _impl->dw_weights  = dw_weights;
+    _impl->pw_weights  = pw_weights;
+    _impl->is_prepared = false;
+    _impl->op          = std::make_unique<OperatorType>();
+
+    _impl->op->configure(input->info(), dw_weights->info(), dw_biases != nullptr ? dw_biases->info() : nullptr,
+                         pw_weights->info(), pw_biases != nullptr ? pw_biases->info() : nullptr, output->info(), info);
+
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->run_pack    = {{TensorType::ACL_SRC_0, input}, {TensorType::ACL_DST, output}};
+    _impl->prep_pack   = {{TensorType::ACL_SRC_1, dw_weights},
+                          {TensorType::ACL_SRC_2, dw_biases},
+                          {TensorType::ACL_SRC_3, pw_weights},
+                          {TensorType::ACL_SRC_4, pw_biases}};
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                  _impl->prep_pack, /* allocate_now */ false);
+}
+
+Status NEDepthwiseSeparableConvolutionLayer::validate(const ITensorInfo                  *input,
+                                                      const ITensorInfo                  *dw_weights,
+                                                      const ITensorInfo                  *dw_biases,
+                                                      const ITensorInfo                  *pw_weights,
+                                                      const ITensorInfo                  *pw_biases,
+                                                      const ITensorInfo                  *output,
+                                                      const DepthwiseSeparableConv2dInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "NEDepthwiseSeparableConvolutionLayer::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, dw_weights, dw_biases, pw_weights, pw_biases, output);
+    return OperatorType::validate(input, dw_weights, dw_biases, pw_weights, pw_biases, output, info);
+}
+
+void NEDepthwiseSeparableConvolutionLayer::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "NEDepthwiseSeparableConvolutionLayer::run");
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEDepthwiseSeparableConvolutionLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace);
+        _impl->op->prepare(_impl->prep_pack);
+
+        // The original weights are no longer needed once packed
+        _impl->dw_weights->mark_as_unused();
+        _impl->pw_weights->mark_as_unused();
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
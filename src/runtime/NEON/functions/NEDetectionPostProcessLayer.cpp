@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,21 +26,57 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CPP/functions/CPPDetectionPostProcessLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/DetectionPostProcessHelpers.h"
+#include "src/core/NEON/kernels/NENonMaximumSuppressionKernel.h"
 
+#include <algorithm>
 #include <cstddef>
-#include <ios>
-#include <list>
+#include <numeric>
 
 namespace arm_compute
 {
+namespace
+{
+constexpr unsigned int kNumCoordBox = 4;
+
+inline float &element_f32(ITensor *tensor, const Coordinates &coords)
+{
+    return *reinterpret_cast<float *>(tensor->ptr_to_element(coords));
+}
+
+inline float element_f32(const ITensor *tensor, const Coordinates &coords)
+{
+    return *reinterpret_cast<const float *>(tensor->ptr_to_element(coords));
+}
+} // namespace
+
+NEDetectionPostProcessLayer::~NEDetectionPostProcessLayer() = default;
+
 NEDetectionPostProcessLayer::NEDetectionPostProcessLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)),
       _dequantize(),
-      _detection_post_process(),
+      _nms_kernel(),
+      _input_box_encoding(nullptr),
+      _input_scores_to_use(nullptr),
+      _input_anchors(nullptr),
+      _output_boxes(nullptr),
+      _output_classes(nullptr),
+      _output_scores(nullptr),
+      _num_detection(nullptr),
+      _info(),
+      _num_boxes(0),
+      _num_classes_per_box(0),
       _decoded_scores(),
+      _decoded_boxes(),
+      _nms_boxes(),
+      _class_scores(),
+      _selected_indices(),
       _run_dequantize(false)
 {
 }
@@ -64,9 +100,24 @@ void NEDetectionPostProcessLayer::configure(const ITensor                *input_
     ARM_COMPUTE_LOG_PARAMS(input_box_encoding, input_scores, input_anchors, output_boxes, output_classes, output_scores,
                            num_detection, info);
 
-    const ITensor                *input_scores_to_use = input_scores;
-    DetectionPostProcessLayerInfo info_to_use         = info;
-    _run_dequantize                                   = is_data_type_quantized(input_box_encoding->info()->data_type());
+    const unsigned int num_max_detected_boxes = info.max_detections() * info.max_classes_per_detection();
+    auto_init_if_empty(*output_boxes->info(),
+                       TensorInfo(TensorShape(kNumCoordBox, num_max_detected_boxes, 1U), 1, DataType::F32));
+    auto_init_if_empty(*output_classes->info(), TensorInfo(TensorShape(num_max_detected_boxes, 1U), 1, DataType::F32));
+    auto_init_if_empty(*output_scores->info(), TensorInfo(TensorShape(num_max_detected_boxes, 1U), 1, DataType::F32));
+    auto_init_if_empty(*num_detection->info(), TensorInfo(TensorShape(1U), 1, DataType::F32));
+
+    _input_box_encoding  = input_box_encoding;
+    _input_scores_to_use = input_scores;
+    _input_anchors       = input_anchors;
+    _output_boxes        = output_boxes;
+    _output_classes      = output_classes;
+    _output_scores       = output_scores;
+    _num_detection       = num_detection;
+    _info                = info;
+    _num_boxes           = input_box_encoding->info()->dimension(1);
+    _num_classes_per_box = std::min(info.max_classes_per_detection(), info.num_classes());
+    _run_dequantize      = is_data_type_quantized(input_box_encoding->info()->data_type());
 
     if (_run_dequantize)
     {
@@ -74,20 +125,39 @@ void NEDetectionPostProcessLayer::configure(const ITensor                *input_
 
         _dequantize.configure(input_scores, &_decoded_scores);
 
-        input_scores_to_use = &_decoded_scores;
+        _input_scores_to_use = &_decoded_scores;
+    }
+
+    // Regular NMS suppresses every class on its own, one class per kernel window step.
+    // Fast NMS suppresses the best classes of all boxes at once, so the boxes are repeated for each of these classes.
+    const bool         use_regular_nms = info.use_regular_nms();
+    const unsigned int num_nms_boxes   = use_regular_nms ? _num_boxes : _num_boxes * _num_classes_per_box;
+    const unsigned int num_nms_classes = use_regular_nms ? info.num_classes() : 1U;
+    const unsigned int max_output_size = use_regular_nms ? info.detection_per_class() : info.max_detections();
 
-        // Create a new info struct to avoid dequantizing in the CPP layer
-        std::array<float, 4>          scales_values{info.scale_value_y(), info.scale_value_x(), info.scale_value_h(),
-                                           info.scale_value_w()};
-        DetectionPostProcessLayerInfo info_quantized(
-            info.max_detections(), info.max_classes_per_detection(), info.nms_score_threshold(), info.iou_threshold(),
-            info.num_classes(), scales_values, info.use_regular_nms(), info.detection_per_class(), false);
-        info_to_use = info_quantized;
+    _decoded_boxes.allocator()->init(TensorInfo(TensorShape(kNumCoordBox, _num_boxes), 1, DataType::F32));
+    _class_scores.allocator()->init(TensorInfo(TensorShape(num_nms_boxes, num_nms_classes), 1, DataType::F32));
+    _memory_group.manage(&_decoded_boxes);
+    _memory_group.manage(&_class_scores);
+    _memory_group.manage(&_selected_indices);
+
+    const ITensor *nms_boxes = &_decoded_boxes;
+    if (num_nms_boxes != _num_boxes)
+    {
+        _nms_boxes.allocator()->init(TensorInfo(TensorShape(kNumCoordBox, num_nms_boxes), 1, DataType::F32));
+        _memory_group.manage(&_nms_boxes);
+        nms_boxes = &_nms_boxes;
     }
 
-    _detection_post_process.configure(input_box_encoding, input_scores_to_use, input_anchors, output_boxes,
-                                      output_classes, output_scores, num_detection, info_to_use);
+    _nms_kernel = std::make_unique<NENonMaximumSuppressionKernel>();
+    _nms_kernel->configure(nms_boxes, &_class_scores, &_selected_indices, max_output_size, info.nms_score_threshold(),
+                           info.iou_threshold());
+
     _decoded_scores.allocator()->allocate();
+    _decoded_boxes.allocator()->allocate();
+    _nms_boxes.allocator()->allocate();
+    _class_scores.allocator()->allocate();
+    _selected_indices.allocator()->allocate();
 }
 
 Status NEDetectionPostProcessLayer::validate(const ITensorInfo            *input_box_encoding,
@@ -113,6 +183,15 @@ Status NEDetectionPostProcessLayer::validate(const ITensorInfo            *input
                                                                        output_boxes, output_classes, output_scores,
                                                                        num_detection, info));
 
+    const unsigned int num_boxes     = input_box_encoding->dimension(1);
+    const TensorInfo   boxes_info    = TensorInfo(TensorShape(kNumCoordBox, num_boxes), 1, DataType::F32);
+    const TensorInfo   scores_info   = TensorInfo(TensorShape(num_boxes), 1, DataType::F32);
+    const TensorInfo   selected_info = TensorInfo(TensorShape(info.max_detections()), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(NENonMaximumSuppressionKernel::validate(&boxes_info, &scores_info, &selected_info,
+                                                                        info.max_detections(),
+                                                                        info.nms_score_threshold(),
+                                                                        info.iou_threshold()));
+
     return Status{};
 }
 
@@ -121,11 +200,134 @@ void NEDetectionPostProcessLayer::run()
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEDetectionPostProcessLayer::run");
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    const unsigned int num_classes    = _info.num_classes();
+    const unsigned int max_detections = _info.max_detections();
+
     // Decode scores if necessary
     if (_run_dequantize)
     {
         _dequantize.run();
     }
-    _detection_post_process.run();
+
+    detection_post_process_helpers::decode_center_size_boxes(_input_box_encoding, _input_anchors, _info,
+                                                             &_decoded_boxes);
+
+    // Regular NMS
+    if (_info.use_regular_nms())
+    {
+        // Row c of the class scores holds the scores of all the boxes for the class c
+        for (unsigned int c = 0; c < num_classes; ++c)
+        {
+            for (unsigned int i = 0; i < _num_boxes; ++i)
+            {
+                element_f32(&_class_scores, Coordinates(i, c)) =
+                    element_f32(_input_scores_to_use, Coordinates(c + 1, i));
+            }
+        }
+
+        // Run Non-maxima Suppression for all the classes in parallel
+        NEScheduler::get().schedule(_nms_kernel.get(), Window::DimY);
+
+        std::vector<int>          result_idx_boxes_after_nms;
+        std::vector<int>          result_classes_after_nms;
+        std::vector<float>        result_scores_after_nms;
+        std::vector<unsigned int> sorted_indices;
+        for (unsigned int c = 0; c < num_classes; ++c)
+        {
+            for (unsigned int i = 0; i < _info.detection_per_class(); ++i)
+            {
+                const auto selected_index =
+                    *(reinterpret_cast<int *>(_selected_indices.ptr_to_element(Coordinates(i, c))));
+                if (selected_index == -1)
+                {
+                    // Nms will return -1 for all the last M-elements not valid
+                    break;
+                }
+                result_idx_boxes_after_nms.emplace_back(selected_index);
+                result_scores_after_nms.emplace_back(element_f32(&_class_scores, Coordinates(selected_index, c)));
+                result_classes_after_nms.emplace_back(c);
+            }
+        }
+
+        // We select the max detection numbers of the highest score of all classes
+        const auto num_selected = result_scores_after_nms.size();
+        const auto num_output   = std::min<unsigned int>(max_detections, num_selected);
+
+        // Sort selected indices based on result scores
+        sorted_indices.resize(num_selected);
+        std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+        std::partial_sort(sorted_indices.data(), sorted_indices.data() + num_output,
+                          sorted_indices.data() + num_selected,
+                          [&](unsigned int first, unsigned int second)
+                          { return result_scores_after_nms[first] > result_scores_after_nms[second]; });
+
+        detection_post_process_helpers::save_outputs(&_decoded_boxes, result_idx_boxes_after_nms,
+                                                     result_scores_after_nms, result_classes_after_nms, sorted_indices,
+                                                     num_output, max_detections, _output_boxes, _output_classes,
+                                                     _output_scores, _num_detection);
+    }
+    // Fast NMS
+    else
+    {
+        std::vector<float>        max_scores;
+        std::vector<int>          box_indices;
+        std::vector<int>          max_score_classes;
+        std::vector<float>        box_scores(num_classes);
+        std::vector<unsigned int> max_score_indices(num_classes);
+
+        for (unsigned int b = 0; b < _num_boxes; ++b)
+        {
+            for (unsigned int c = 0; c < num_classes; ++c)
+            {
+                box_scores[c] = element_f32(_input_scores_to_use, Coordinates(c + 1, b));
+            }
+
+            std::iota(max_score_indices.begin(), max_score_indices.end(), 0);
+            std::partial_sort(max_score_indices.data(), max_score_indices.data() + _num_classes_per_box,
+                              max_score_indices.data() + num_classes,
+                              [&](unsigned int first, unsigned int second)
+                              { return box_scores[first] > box_scores[second]; });
+
+            for (unsigned int i = 0; i < _num_classes_per_box; ++i)
+            {
+                const float score_to_add = box_scores[max_score_indices[i]];
+                element_f32(&_class_scores, Coordinates(b * _num_classes_per_box + i)) = score_to_add;
+                max_scores.emplace_back(score_to_add);
+                box_indices.emplace_back(b);
+                max_score_classes.emplace_back(max_score_indices[i]);
+
+                // Each candidate is suppressed against the box it was scored for
+                if (_num_classes_per_box > 1)
+                {
+                    for (unsigned int k = 0; k < kNumCoordBox; ++k)
+                    {
+                        element_f32(&_nms_boxes, Coordinates(k, b * _num_classes_per_box + i)) =
+                            element_f32(&_decoded_boxes, Coordinates(k, b));
+                    }
+                }
+            }
+        }
+
+        // Run Non-maxima Suppression
+        NEScheduler::get().schedule(_nms_kernel.get(), Window::DimY);
+
+        std::vector<unsigned int> selected_indices;
+        for (unsigned int i = 0; i < max_detections; ++i)
+        {
+            const auto selected_index = *(reinterpret_cast<int *>(_selected_indices.ptr_to_element(Coordinates(i))));
+            if (selected_index == -1)
+            {
+                // Nms will return -1 for all the last M-elements not valid
+                break;
+            }
+            selected_indices.emplace_back(selected_index);
+        }
+        // We select the max detection numbers of the highest score of all classes
+        const auto num_output = std::min<unsigned int>(max_detections, selected_indices.size());
+
+        detection_post_process_helpers::save_outputs(&_decoded_boxes, box_indices, max_scores, max_score_classes,
+                                                     selected_indices, num_output, max_detections, _output_boxes,
+                                                     _output_classes, _output_scores, _num_detection);
+    }
 }
 } // namespace arm_compute
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEElementwiseFusion.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/operators/CpuElementwiseFusion.h"
+
+namespace arm_compute
+{
+struct NEElementwiseFusion::Impl
+{
+    std::unique_ptr<cpu::CpuElementwiseFusion> op{nullptr};
+    ITensorPack                                run_pack{};
+};
+
+NEElementwiseFusion::NEElementwiseFusion() : _impl(std::make_unique<Impl>())
+{
+}
+NEElementwiseFusion::NEElementwiseFusion(NEElementwiseFusion &&)            = default;
+NEElementwiseFusion &NEElementwiseFusion::operator=(NEElementwiseFusion &&) = default;
+NEElementwiseFusion::~NEElementwiseFusion()                                 = default;
+
+void NEElementwiseFusion::configure(const std::vector<const ITensor *> &srcs,
+                                    ITensor                            *dst,
+                                    const ElementwiseFusionInfo        &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEElementwiseFusion::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+
+    std::vector<const ITensorInfo *> srcs_info;
+    srcs_info.reserve(srcs.size());
+    _impl->run_pack = ITensorPack();
+    for (size_t i = 0; i < srcs.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(srcs[i]);
+        srcs_info.emplace_back(srcs[i]->info());
+        _impl->run_pack.add_const_tensor(TensorType::ACL_SRC_VEC + i, srcs[i]);
+    }
+    _impl->run_pack.add_tensor(TensorType::ACL_DST, dst);
+
+    _impl->op = std::make_unique<cpu::CpuElementwiseFusion>();
+    _impl->op->configure(srcs_info, dst->info(), info);
+}
+
+Status NEElementwiseFusion::validate(const std::vector<const ITensorInfo *> &srcs,
+                                     const ITensorInfo                      *dst,
+                                     const ElementwiseFusionInfo            &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEElementwiseFusion::validate");
+    for (const ITensorInfo *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src);
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(dst);
+    return cpu::CpuElementwiseFusion::validate(srcs, dst, info);
+}
+
+void NEElementwiseFusion::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEElementwiseFusion::run");
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,25 +29,51 @@
 
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/kernels/NEFFTBluesteinKernel.h"
 #include "src/core/NEON/kernels/NEFFTDigitReverseKernel.h"
 #include "src/core/NEON/kernels/NEFFTRadixStageKernel.h"
+#include "src/core/NEON/kernels/NEFFTRealSpectrumKernel.h"
 #include "src/core/NEON/kernels/NEFFTScaleKernel.h"
 #include "src/core/utils/helpers/fft.h"
 
+#include <algorithm>
+#include <numeric>
+
 namespace arm_compute
 {
 NEFFT1D::~NEFFT1D() = default;
 
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)),
+    : _memory_group(memory_manager),
+      _memory_manager(std::move(memory_manager)),
       _digit_reverse_kernel(),
       _fft_kernels(),
       _scale_kernel(),
+      _real_spectrum_kernel(),
+      _chirp_kernel(),
+      _filter_kernel(),
+      _dechirp_kernel(),
+      _convolution_fft(),
+      _convolution_ifft(),
+      _filter_fft(),
+      _half_fft(),
       _digit_reversed_input(),
       _digit_reverse_indices(),
+      _packed_spectrum(),
+      _chirp(),
+      _filter(),
+      _filter_spectrum(),
+      _chirped_input(),
+      _convolution_spectrum(),
+      _convolution(),
       _num_ffts(0),
       _axis(0),
-      _run_scale(false)
+      _run_scale(false),
+      _run_merge(false),
+      _run_split(false),
+      _is_bluestein(false),
+      _is_prepared(false)
 {
 }
 
@@ -58,32 +84,78 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT1D::validate(input->info(), output->info(), config));
     ARM_COMPUTE_LOG_PARAMS(input, output, config);
 
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_num_channels(2));
+
+    _axis = config.axis;
+
+    const bool is_inverse = config.direction == FFTDirection::Inverse;
+    const bool is_r2c     = input->info()->num_channels() == 1;
+    const bool is_c2r     = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
+
+    // A real signal of even length along axis 0 is transformed as a complex signal of half its length, unless only
+    // the full length can be decomposed into the supported radices (e.g. a length of 2)
+    const auto         supported_radix = NEFFTRadixStageKernel::supported_radix();
+    const unsigned int N               = input->info()->tensor_shape()[config.axis];
+    const bool         is_packed       = (config.axis == 0) && (N % 2 == 0) &&
+                               ((is_r2c && !is_inverse) || (is_c2r && is_inverse)) &&
+                               (!arm_compute::helpers::fft::decompose_stages(N / 2, supported_radix).empty() ||
+                                arm_compute::helpers::fft::decompose_stages(N, supported_radix).empty());
+
     // Decompose size to radix factors
-    const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->info()->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
-    ARM_COMPUTE_ERROR_ON(decomposed_vector.empty());
+    const unsigned int fft_size          = is_packed ? N / 2 : N;
+    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(fft_size, supported_radix);
+    if (decomposed_vector.empty())
+    {
+        is_packed ? configure_packed_bluestein(input, output, config) : configure_bluestein(input, output, config);
+        return;
+    }
 
     // Flags
-    _run_scale = config.direction == FFTDirection::Inverse;
+    _run_merge = is_packed && is_c2r;
+    _run_split = is_packed && is_r2c;
+
+    // The last radix stage writes a complex F32 output, any other output is written by a later kernel
+    const bool is_output_direct =
+        !_run_split && output->info()->num_channels() == 2 && output->info()->data_type() == DataType::F32;
+    _run_scale = is_inverse || (!is_output_direct && !_run_split);
 
-    const bool is_c2r = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
+    // Shape of the complex signal the radix stages run on
+    TensorShape fft_shape = input->info()->tensor_shape();
+    fft_shape.set(config.axis, fft_size);
+
+    // Merge the spectrum of the real output into the spectrum of the packed signal
+    const ITensor *fft_input = input;
+    if (_run_merge)
+    {
+        FFTRealSpectrumKernelInfo merge_config;
+        merge_config.inverse = true;
+        _packed_spectrum.allocator()->init(TensorInfo(fft_shape, 2, DataType::F32));
+        _memory_group.manage(&_packed_spectrum);
+        _real_spectrum_kernel = std::make_unique<NEFFTRealSpectrumKernel>();
+        _real_spectrum_kernel->configure(input, &_packed_spectrum, merge_config);
+        fft_input = &_packed_spectrum;
+    }
 
     // Configure digit reverse
     FFTDigitReverseKernelInfo digit_reverse_config;
     digit_reverse_config.axis      = config.axis;
-    digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
-    TensorInfo digit_reverse_indices_info(TensorShape(input->info()->tensor_shape()[config.axis]), 1, DataType::U32);
+    digit_reverse_config.conjugate = is_inverse;
+    TensorInfo digit_reverse_indices_info(TensorShape(fft_size), 1, DataType::U32);
     _digit_reverse_indices.allocator()->init(digit_reverse_indices_info);
+    _digit_reversed_input.allocator()->init(TensorInfo(fft_shape, 2, DataType::F32));
     _memory_group.manage(&_digit_reversed_input);
     _digit_reverse_kernel = std::make_unique<NEFFTDigitReverseKernel>();
-    _digit_reverse_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    _digit_reverse_kernel->configure(fft_input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    if (_run_merge)
+    {
+        _packed_spectrum.allocator()->allocate();
+    }
 
     // Create and configure FFT kernels
     unsigned int Nx = 1;
     _num_ffts       = decomposed_vector.size();
     _fft_kernels.resize(_num_ffts);
-    _axis = config.axis;
 
     for (unsigned int i = 0; i < _num_ffts; ++i)
     {
@@ -95,21 +167,28 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         fft_kernel_info.Nx             = Nx;
         fft_kernel_info.is_first_stage = (i == 0);
         _fft_kernels[i]                = std::make_unique<NEFFTRadixStageKernel>();
-        _fft_kernels[i]->configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r) ? output : nullptr,
-                                   fft_kernel_info);
+        _fft_kernels[i]->configure(&_digit_reversed_input,
+                                   ((i == (_num_ffts - 1)) && is_output_direct) ? output : nullptr, fft_kernel_info);
 
         Nx *= radix_for_stage;
     }
 
+    // Split the spectrum of the packed signal into the spectrum of the real input
+    if (_run_split)
+    {
+        _real_spectrum_kernel = std::make_unique<NEFFTRealSpectrumKernel>();
+        _real_spectrum_kernel->configure(&_digit_reversed_input, output, FFTRealSpectrumKernelInfo());
+    }
+
     // Configure scale kernel
     if (_run_scale)
     {
         FFTScaleKernelInfo scale_config;
-        scale_config.scale     = static_cast<float>(N);
-        scale_config.conjugate = config.direction == FFTDirection::Inverse;
+        scale_config.scale     = is_inverse ? static_cast<float>(fft_size) : 1.f;
+        scale_config.conjugate = is_inverse;
         _scale_kernel          = std::make_unique<NEFFTScaleKernel>();
-        is_c2r ? _scale_kernel->configure(&_digit_reversed_input, output, scale_config)
-                        : _scale_kernel->configure(output, nullptr, scale_config);
+        is_output_direct ? _scale_kernel->configure(output, nullptr, scale_config)
+                         : _scale_kernel->configure(&_digit_reversed_input, output, scale_config);
     }
 
     // Allocate tensors
@@ -117,8 +196,151 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     _digit_reverse_indices.allocator()->allocate();
 
     // Init digit reverse indices
-    const auto digit_reverse_cpu = arm_compute::helpers::fft::digit_reverse_indices(N, decomposed_vector);
-    std::copy_n(digit_reverse_cpu.data(), N, reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
+    const auto digit_reverse_cpu = arm_compute::helpers::fft::digit_reverse_indices(fft_size, decomposed_vector);
+    std::copy_n(digit_reverse_cpu.data(), fft_size, reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
+}
+
+void NEFFT1D::configure_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config)
+{
+    const bool         is_inverse = config.direction == FFTDirection::Inverse;
+    const unsigned int N          = input->info()->tensor_shape()[config.axis];
+
+    // The FFT is the convolution of the chirped input with the chirp filter, computed by FFTs of a supported length
+    const unsigned int M =
+        arm_compute::helpers::fft::next_decomposable_size(2 * N - 1, NEFFTRadixStageKernel::supported_radix());
+
+    TensorShape convolution_shape = input->info()->tensor_shape();
+    convolution_shape.set(config.axis, M);
+    _chirp.allocator()->init(TensorInfo(TensorShape(N), 2, DataType::F32));
+    _filter.allocator()->init(TensorInfo(TensorShape(M), 2, DataType::F32));
+    _filter_spectrum.allocator()->init(TensorInfo(TensorShape(M), 2, DataType::F32));
+    _chirped_input.allocator()->init(TensorInfo(convolution_shape, 2, DataType::F32));
+    _convolution_spectrum.allocator()->init(TensorInfo(convolution_shape, 2, DataType::F32));
+    _convolution.allocator()->init(TensorInfo(convolution_shape, 2, DataType::F32));
+
+    FFTBluesteinKernelInfo chirp_config;
+    chirp_config.axis = config.axis;
+
+    FFT1DInfo convolution_config;
+    convolution_config.axis = config.axis;
+
+    // Multiply the input by the chirp and zero pad it
+    _memory_group.manage(&_chirped_input);
+    _chirp_kernel = std::make_unique<NEFFTBluesteinKernel>();
+    _chirp_kernel->configure(input, &_chirp, &_chirped_input, chirp_config);
+
+    // Transform the chirped input
+    _memory_group.manage(&_convolution_spectrum);
+    _convolution_fft = std::make_unique<NEFFT1D>(_memory_manager);
+    _convolution_fft->configure(&_chirped_input, &_convolution_spectrum, convolution_config);
+    _chirped_input.allocator()->allocate();
+
+    // Multiply by the spectrum of the chirp filter
+    _filter_kernel = std::make_unique<NEFFTBluesteinKernel>();
+    _filter_kernel->configure(&_convolution_spectrum, &_filter_spectrum, &_convolution_spectrum, chirp_config);
+
+    // Inverse transform the product
+    _memory_group.manage(&_convolution);
+    convolution_config.direction = FFTDirection::Inverse;
+    _convolution_ifft            = std::make_unique<NEFFT1D>(_memory_manager);
+    _convolution_ifft->configure(&_convolution_spectrum, &_convolution, convolution_config);
+    _convolution_spectrum.allocator()->allocate();
+
+    // Multiply the first values of the convolution by the chirp
+    chirp_config.scale = is_inverse ? 1.f / static_cast<float>(N) : 1.f;
+    _dechirp_kernel    = std::make_unique<NEFFTBluesteinKernel>();
+    _dechirp_kernel->configure(&_convolution, &_chirp, output, chirp_config);
+    _convolution.allocator()->allocate();
+
+    // The spectrum of the chirp filter is computed once in prepare()
+    _filter_fft = std::make_unique<NEFFT1D>();
+    _filter_fft->configure(&_filter, &_filter_spectrum, FFT1DInfo());
+
+    _chirp.allocator()->allocate();
+    _filter.allocator()->allocate();
+    _filter_spectrum.allocator()->allocate();
+
+    // The chirp filter is the conjugate of the chirp, for both positive and negative offsets
+    const auto chirp        = arm_compute::helpers::fft::bluestein_chirp(N, is_inverse);
+    auto      *chirp_ptr    = reinterpret_cast<float *>(_chirp.buffer());
+    auto      *filter_ptr   = reinterpret_cast<float *>(_filter.buffer());
+    std::copy(chirp.begin(), chirp.end(), chirp_ptr);
+    std::fill_n(filter_ptr, 2 * M, 0.f);
+    for (unsigned int n = 0; n < N; ++n)
+    {
+        const unsigned int idx  = (n == 0) ? 0 : M - n;
+        filter_ptr[2 * n]       = chirp[2 * n];
+        filter_ptr[2 * n + 1]   = -chirp[2 * n + 1];
+        filter_ptr[2 * idx]     = chirp[2 * n];
+        filter_ptr[2 * idx + 1] = -chirp[2 * n + 1];
+    }
+
+    _is_bluestein = true;
+}
+
+void NEFFT1D::configure_packed_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config)
+{
+    const bool         is_inverse = config.direction == FFTDirection::Inverse;
+    const unsigned int fft_size   = input->info()->tensor_shape()[0] / 2;
+
+    TensorShape fft_shape = input->info()->tensor_shape();
+    fft_shape.set(0, fft_size);
+    _digit_reversed_input.allocator()->init(TensorInfo(fft_shape, 2, DataType::F32));
+    _packed_spectrum.allocator()->init(TensorInfo(fft_shape, 2, DataType::F32));
+
+    // The packed signal is transformed by a nested function, which uses Bluestein's algorithm for its length
+    FFT1DInfo half_config;
+    half_config.direction = config.direction;
+    _half_fft             = std::make_unique<NEFFT1D>(_memory_manager);
+
+    if (is_inverse)
+    {
+        _run_merge = true;
+        _run_scale = true;
+
+        // Merge the spectrum of the real output into the spectrum of the packed signal
+        FFTRealSpectrumKernelInfo merge_config;
+        merge_config.inverse = true;
+        _memory_group.manage(&_packed_spectrum);
+        _real_spectrum_kernel = std::make_unique<NEFFTRealSpectrumKernel>();
+        _real_spectrum_kernel->configure(input, &_packed_spectrum, merge_config);
+
+        _memory_group.manage(&_digit_reversed_input);
+        _half_fft->configure(&_packed_spectrum, &_digit_reversed_input, half_config);
+        _packed_spectrum.allocator()->allocate();
+
+        // The nested inverse transform is already scaled, so the scale kernel only unpacks the real output
+        FFTScaleKernelInfo unpack_config;
+        unpack_config.scale     = 1.f;
+        unpack_config.conjugate = false;
+        _scale_kernel           = std::make_unique<NEFFTScaleKernel>();
+        _scale_kernel->configure(&_digit_reversed_input, output, unpack_config);
+        _digit_reversed_input.allocator()->allocate();
+    }
+    else
+    {
+        _run_split = true;
+
+        // Pack the real input into a complex signal of half its length, in order
+        _digit_reverse_indices.allocator()->init(TensorInfo(TensorShape(fft_size), 1, DataType::U32));
+        _memory_group.manage(&_digit_reversed_input);
+        _digit_reverse_kernel = std::make_unique<NEFFTDigitReverseKernel>();
+        _digit_reverse_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices,
+                                         FFTDigitReverseKernelInfo());
+
+        _memory_group.manage(&_packed_spectrum);
+        _half_fft->configure(&_digit_reversed_input, &_packed_spectrum, half_config);
+        _digit_reversed_input.allocator()->allocate();
+
+        // Split the spectrum of the packed signal into the spectrum of the real input
+        _real_spectrum_kernel = std::make_unique<NEFFTRealSpectrumKernel>();
+        _real_spectrum_kernel->configure(&_packed_spectrum, output, FFTRealSpectrumKernelInfo());
+        _packed_spectrum.allocator()->allocate();
+
+        _digit_reverse_indices.allocator()->allocate();
+        auto *indices_ptr = reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer());
+        std::iota(indices_ptr, indices_ptr + fft_size, 0U);
+    }
 }
 
 Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, const FFT1DInfo &config)
@@ -126,15 +348,12 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEFFT1D::validate");
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
-    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
 
-    // Check if FFT is decomposable
-    const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
-    ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty());
+    // Any size is supported: sizes that cannot be decomposed into the supported radices use Bluestein's algorithm
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] == 0);
 
     // Checks performed when output is configured
     if ((output != nullptr) && (output->total_size() != 0))
@@ -152,13 +371,48 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
 void NEFFT1D::run()
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEFFT1D::run");
+    prepare();
+
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
+    if (_is_bluestein)
+    {
+        const unsigned int split_dimension = (_axis == 0 ? Window::DimY : Window::DimZ);
+        NEScheduler::get().schedule(_chirp_kernel.get(), split_dimension);
+        _convolution_fft->run();
+        NEScheduler::get().schedule(_filter_kernel.get(), split_dimension);
+        _convolution_ifft->run();
+        NEScheduler::get().schedule(_dechirp_kernel.get(), split_dimension);
+        return;
+    }
 
-    for (unsigned int i = 0; i < _num_ffts; ++i)
+    if (_run_merge)
+    {
+        NEScheduler::get().schedule(_real_spectrum_kernel.get(), Window::DimY);
+    }
+
+    if (_half_fft != nullptr)
+    {
+        // The packed signal is transformed by the nested function
+        if (_run_split)
+        {
+            NEScheduler::get().schedule(_digit_reverse_kernel.get(), Window::DimY);
+        }
+        _half_fft->run();
+    }
+    else
+    {
+        NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
+
+        for (unsigned int i = 0; i < _num_ffts; ++i)
+        {
+            NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
+        }
+    }
+
+    if (_run_split)
     {
-        NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
+        NEScheduler::get().schedule(_real_spectrum_kernel.get(), Window::DimY);
     }
 
     // Run output scaling
@@ -167,4 +421,20 @@ void NEFFT1D::run()
         NEScheduler::get().schedule(_scale_kernel.get(), Window::DimY);
     }
 }
+
+void NEFFT1D::prepare()
+{
+    if (!_is_prepared)
+    {
+        if (_is_bluestein)
+        {
+            // Transform the chirp filter to the frequency domain
+            _filter_fft->run();
+            _filter_fft.reset();
+            _filter.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,16 +49,20 @@ void NEFFT2D::configure(const ITensor *input, ITensor *output, const FFT2DInfo &
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT2D::validate(input->info(), output->info(), config));
     ARM_COMPUTE_LOG_PARAMS(input, output, config);
 
+    // The passes commute, so a real output is computed by the pass along axis 0 which handles real signals faster
+    const bool is_real_output = (output->info()->total_size() != 0) && (output->info()->num_channels() == 1);
+    const bool swap_passes    = is_real_output && (config.axis0 == 0);
+
     // Setup first pass
     FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axis0;
+    first_pass_config.axis      = swap_passes ? config.axis1 : config.axis0;
     first_pass_config.direction = config.direction;
     _memory_group.manage(&_first_pass_tensor);
     _first_pass_func.configure(input, &_first_pass_tensor, first_pass_config);
 
     // Setup second pass
     FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axis1;
+    second_pass_config.axis      = swap_passes ? config.axis0 : config.axis1;
     second_pass_config.direction = config.direction;
     _second_pass_func.configure(&_first_pass_tensor, output, second_pass_config);
     _first_pass_tensor.allocator()->allocate();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,6 +59,14 @@ int pad_decomposable(int N)
     }
     return pad;
 }
+
+/** Padding of a real signal along axis 0 to an even size whose half is decomposable, so its FFT runs on half the size */
+int pad_real_decomposable(int N)
+{
+    const auto supported_radix = NEFFTRadixStageKernel::supported_radix();
+    const auto half_size       = arm_compute::helpers::fft::next_decomposable_size((N + 1) / 2, supported_radix);
+    return 2 * static_cast<int>(half_size) - N;
+}
 } // namespace
 
 NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -132,7 +140,7 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
         Size2D(input->info()->tensor_shape()[idx_width], input->info()->tensor_shape()[idx_height]);
     const Size2D kernel_size =
         Size2D(weights->info()->tensor_shape()[idx_width], weights->info()->tensor_shape()[idx_height]);
-    const Size2D pad_valid = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1),
+    const Size2D pad_valid = Size2D(pad_real_decomposable(input_dims.x() + kernel_size.x() - 1),
                                     pad_decomposable(input_dims.y() + kernel_size.y() - 1));
     // Tensors to use
     ITensor       *input_to_use   = input;
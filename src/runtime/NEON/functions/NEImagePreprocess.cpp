@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEImagePreprocess.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/operators/CpuImagePreprocess.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+struct NEImagePreprocess::Impl
+{
+    const ITensor                           *src{nullptr};
+    const ITensor                           *src_uv{nullptr};
+    ITensor                                 *dst{nullptr};
+    std::unique_ptr<cpu::CpuImagePreprocess> op{nullptr};
+};
+
+NEImagePreprocess::NEImagePreprocess() : _impl(std::make_unique<Impl>())
+{
+}
+NEImagePreprocess::NEImagePreprocess(NEImagePreprocess &&)            = default;
+NEImagePreprocess &NEImagePreprocess::operator=(NEImagePreprocess &&) = default;
+NEImagePreprocess::~NEImagePreprocess()                               = default;
+
+void NEImagePreprocess::configure(const ITensor             *src,
+                                  const ITensor             *src_uv,
+                                  ITensor                   *dst,
+                                  const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEImagePreprocess::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    _impl->src    = src;
+    _impl->src_uv = src_uv;
+    _impl->dst    = dst;
+    _impl->op     = std::make_unique<cpu::CpuImagePreprocess>();
+    _impl->op->configure(src->info(), src_uv != nullptr ? src_uv->info() : nullptr, dst->info(), info);
+}
+
+Status NEImagePreprocess::validate(const ITensorInfo         *src,
+                                   const ITensorInfo         *src_uv,
+                                   const ITensorInfo         *dst,
+                                   const ImagePreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuImagePreprocess::validate(src, src_uv, dst, info));
+
+    return Status{};
+}
+
+void NEImagePreprocess::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEImagePreprocess::run");
+    ITensorPack pack;
+    pack.add_const_tensor(TensorType::ACL_SRC_0, _impl->src);
+    pack.add_const_tensor(TensorType::ACL_SRC_1, _impl->src_uv);
+    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NUMAAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#if !defined(BARE_METAL) && defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+namespace arm_compute
+{
+namespace
+{
+#if !defined(BARE_METAL) && defined(__linux__)
+/** Memory policy preferring a node, matching MPOL_PREFERRED in linux/mempolicy.h */
+constexpr int numa_mpol_preferred = 1;
+
+/** Bind a page aligned range to a NUMA node
+ *
+ * @param[in] ptr  Start of the range
+ * @param[in] size Size of the range in bytes
+ * @param[in] node NUMA node to bind the range to
+ *
+ * @return True if the memory policy was applied
+ */
+bool bind_to_node(void *ptr, size_t size, unsigned int node)
+{
+#if defined(SYS_mbind)
+    constexpr size_t           bits_per_word = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> node_mask(node / bits_per_word + 1, 0UL);
+    node_mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+    return syscall(SYS_mbind, ptr, size, numa_mpol_preferred, node_mask.data(), node_mask.size() * bits_per_word + 1,
+                   0U) == 0;
+#else  /* defined(SYS_mbind) */
+    ARM_COMPUTE_UNUSED(ptr, size, node);
+    return false;
+#endif /* defined(SYS_mbind) */
+}
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+
+void *numa_allocate(size_t size, size_t alignment, unsigned int node)
+{
+#if !defined(BARE_METAL) && defined(__linux__)
+    // Mappings are page aligned, so a larger alignment cannot be honoured
+    if (alignment > static_cast<size_t>(sysconf(_SC_PAGESIZE)))
+    {
+        ARM_COMPUTE_ERROR("Alignment larger than the page size is not supported");
+    }
+
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Failed to map memory");
+    }
+    if (!bind_to_node(ptr, size, node))
+    {
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Unable to bind memory to NUMA node %u, using the default policy",
+                                                  node);
+    }
+    return ptr;
+#else  /* !defined(BARE_METAL) && defined(__linux__) */
+    ARM_COMPUTE_UNUSED(alignment, node);
+    return ::operator new(size);
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+}
+
+void numa_free(void *ptr, size_t size)
+{
+#if !defined(BARE_METAL) && defined(__linux__)
+    munmap(ptr, size);
+#else  /* !defined(BARE_METAL) && defined(__linux__) */
+    ARM_COMPUTE_UNUSED(size);
+    ::operator delete(ptr);
+#endif /* !defined(BARE_METAL) && defined(__linux__) */
+}
+
+/** Memory region backed by NUMA node local memory */
+class NUMAMemoryRegion final : public IMemoryRegion
+{
+public:
+    NUMAMemoryRegion(size_t size, size_t alignment, unsigned int node) : IMemoryRegion(size), _ptr(nullptr)
+    {
+        if (size != 0)
+        {
+            _ptr = numa_allocate(size, alignment, node);
+        }
+    }
+    ~NUMAMemoryRegion()
+    {
+        if (_ptr != nullptr)
+        {
+            numa_free(_ptr, _size);
+        }
+    }
+    NUMAMemoryRegion(const NUMAMemoryRegion &)            = delete;
+    NUMAMemoryRegion &operator=(const NUMAMemoryRegion &) = delete;
+
+    // Inherited methods overridden :
+    void *buffer() override
+    {
+        return _ptr;
+    }
+    const void *buffer() const override
+    {
+        return _ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        if (_ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return std::make_unique<MemoryRegion>(static_cast<uint8_t *>(_ptr) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    void *_ptr;
+};
+} // namespace
+
+NUMAAllocator::NUMAAllocator(unsigned int node) : _node(node), _mtx(), _allocations()
+{
+}
+
+NUMAAllocator::~NUMAAllocator()
+{
+    for (auto &allocation : _allocations)
+    {
+        numa_free(allocation.first, allocation.second);
+    }
+}
+
+unsigned int NUMAAllocator::node() const
+{
+    return _node;
+}
+
+void *NUMAAllocator::allocate(size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON(size == 0);
+    void *ptr = numa_allocate(size, alignment, _node);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _allocations.emplace(ptr, size);
+    return ptr;
+}
+
+void NUMAAllocator::free(void *ptr)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto                        it = _allocations.find(ptr);
+    ARM_COMPUTE_ERROR_ON_MSG(it == _allocations.end(), "Memory was not allocated by this allocator");
+    if (it != _allocations.end())
+    {
+        numa_free(it->first, it->second);
+        _allocations.erase(it);
+    }
+}
+
+std::unique_ptr<IMemoryRegion> NUMAAllocator::make_region(size_t size, size_t alignment)
+{
+    return std::make_unique<NUMAMemoryRegion>(size, alignment, _node);
+}
+} // namespace arm_compute
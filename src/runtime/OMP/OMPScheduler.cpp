@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,10 +29,25 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 
+#include "src/runtime/SchedulerUtils.h"
+
 #include <omp.h>
 
 namespace arm_compute
 {
+namespace
+{
+/** Kernel launch shared by all its workloads */
+struct LaunchInfo
+{
+    ICPPKernel   *kernel;          /**< Kernel to run */
+    ITensorPack  *tensors;         /**< Tensors to run the kernel on */
+    const Window *window;          /**< Window to split between the workloads */
+    size_t        split_dimension; /**< Dimension to split the window along */
+    unsigned int  num_windows;     /**< Number of windows */
+};
+} // namespace
+
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)
 OMPScheduler::OMPScheduler() // NOLINT
@@ -70,12 +85,15 @@ void OMPScheduler::set_num_threads(unsigned int num_threads)
 
 void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
-    ITensorPack tensors;
+    ITensorPack                                 tensors;
+    const scheduler_utils::KernelTelemetryScope telemetry(kernel, kernel->window(), tensors, _num_threads);
     schedule_common(kernel, hints, kernel->window(), tensors);
 }
 
 void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
+    const scheduler_utils::KernelTelemetryScope telemetry(kernel, window, tensors, _num_threads);
+
     // The rest of the logic in this function does not handle the
     // split_dimensions_all case so we defer to IScheduler::schedule_common()
     if (hints.split_dimension() == IScheduler::split_dimensions_all)
@@ -105,16 +123,19 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
     }
     else
     {
-        const unsigned int                num_windows = num_threads;
-        std::vector<IScheduler::Workload> workloads(num_windows);
-        for (unsigned int t = 0; t < num_windows; t++)
+        const LaunchInfo launch{kernel, &tensors, &max_window, hints.split_dimension(), num_threads};
+
+        scheduler_utils::ThreadWorkloads   thread_workloads;
+        std::vector<IScheduler::Workload> &workloads = thread_workloads.get();
+        workloads.resize(launch.num_windows);
+        for (unsigned int t = 0; t < launch.num_windows; t++)
         {
-            //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
+            //Capture 't' by copy and the launch info by reference, so that the workload needs no allocation
+            workloads[t] = [t, &launch](const ThreadInfo &info)
             {
-                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                Window win = launch.window->split_window(launch.split_dimension, t, launch.num_windows);
                 win.validate();
-                kernel->run_op(tensors, win, info);
+                launch.kernel->run_op(*launch.tensors, win, info);
             };
         }
         run_workloads(workloads);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,8 @@
 #include "arm_compute/runtime/MemoryRegion.h"
 #include "arm_compute/runtime/Types.h"
 
+#include "src/common/utils/profile/acl_profile.h"
+
 #include <algorithm>
 
 namespace arm_compute
@@ -38,6 +40,18 @@ OffsetMemoryPool::OffsetMemoryPool(IAllocator *allocator, BlobInfo blob_info)
 {
     ARM_COMPUTE_ERROR_ON(!allocator);
     _blob = _allocator->make_region(blob_info.size, blob_info.alignment);
+    ARM_COMPUTE_TRACE_COUNTER_ADD(ARM_COMPUTE_PROF_CAT_MEMORY, ARM_COMPUTE_PROF_LVL_CPU, "Memory pools bytes",
+                                  blob_info.size);
+}
+
+OffsetMemoryPool::~OffsetMemoryPool()
+{
+    // Moved-from pools do not own a blob
+    if (_blob != nullptr)
+    {
+        ARM_COMPUTE_TRACE_COUNTER_ADD(ARM_COMPUTE_PROF_CAT_MEMORY, ARM_COMPUTE_PROF_LVL_CPU, "Memory pools bytes",
+                                      -static_cast<int64_t>(_blob->size()));
+    }
 }
 
 const BlobInfo &OffsetMemoryPool::info() const
@@ -76,4 +90,9 @@ std::unique_ptr<IMemoryPool> OffsetMemoryPool::duplicate()
     ARM_COMPUTE_ERROR_ON(!_allocator);
     return std::make_unique<OffsetMemoryPool>(_allocator, _blob_info);
 }
+
+size_t OffsetMemoryPool::size() const
+{
+    return _blob_info.size;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IMemoryPool.h"
 
+#include "src/common/utils/profile/acl_profile.h"
+
 #include <algorithm>
 #include <list>
 
@@ -43,6 +45,7 @@ IMemoryPool *PoolManager::lock_pool()
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
     ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
     _occupied_pools.splice(std::begin(_occupied_pools), _free_pools, std::begin(_free_pools));
+    ARM_COMPUTE_TRACE_COUNTER_ADD(ARM_COMPUTE_PROF_CAT_MEMORY, ARM_COMPUTE_PROF_LVL_CPU, "Occupied memory pools", 1);
     return _occupied_pools.front().get();
 }
 
@@ -55,6 +58,7 @@ void PoolManager::unlock_pool(IMemoryPool *pool)
                            [pool](const std::unique_ptr<IMemoryPool> &pool_it) { return pool_it.get() == pool; });
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
     _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
+    ARM_COMPUTE_TRACE_COUNTER_ADD(ARM_COMPUTE_PROF_CAT_MEMORY, ARM_COMPUTE_PROF_LVL_CPU, "Occupied memory pools", -1);
     _sem->signal();
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,15 @@
  */
 #include "src/runtime/SchedulerUtils.h"
 
+#include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/KernelTelemetry.h"
 
 #include <cmath>
+#include <utility>
 
 namespace arm_compute
 {
@@ -77,6 +83,104 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
         return {1, std::min<unsigned>(n, max_threads)};
     }
 }
+
+namespace
+{
+struct ThreadWorkloadList
+{
+    std::vector<IScheduler::Workload> workloads{};
+    bool                              in_use{false};
+};
+
+ThreadWorkloadList &thread_workload_list()
+{
+    static thread_local ThreadWorkloadList list;
+    return list;
+}
+} // namespace
+
+ThreadWorkloads::ThreadWorkloads() : _workloads(&_nested), _owner(!thread_workload_list().in_use)
+{
+    if (_owner)
+    {
+        ThreadWorkloadList &list = thread_workload_list();
+        list.in_use              = true;
+        list.workloads.clear();
+        _workloads = &list.workloads;
+    }
+}
+
+ThreadWorkloads::~ThreadWorkloads()
+{
+    if (_owner)
+    {
+        thread_workload_list().in_use = false;
+    }
+}
+
+std::vector<IScheduler::Workload> &ThreadWorkloads::get()
+{
+    return *_workloads;
+}
 #endif /* #ifndef BARE_METAL */
+
+namespace
+{
+/** Size in bytes of the tensors of a pack within the range of ids [first, last] */
+uint64_t bytes_of(const ITensorPack &tensors, int first, int last)
+{
+    uint64_t bytes = 0;
+    for (int id = first; id <= last; ++id)
+    {
+        const ITensor *tensor = tensors.get_const_tensor(id);
+        if (tensor != nullptr)
+        {
+            bytes += tensor->info()->total_size();
+        }
+    }
+    return bytes;
+}
+
+uint64_t to_ns(std::chrono::steady_clock::duration duration)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+} // namespace
+
+KernelTelemetryScope::KernelTelemetryScope(const ICPPKernel  *kernel,
+                                           const Window      &window,
+                                           const ITensorPack &tensors,
+                                           unsigned int       num_threads)
+    : _kernel(KernelTelemetry::get().is_enabled() ? kernel : nullptr),
+      _window(&window),
+      _tensors(&tensors),
+      _num_threads(num_threads)
+{
+    if (_kernel != nullptr)
+    {
+        _start = std::chrono::steady_clock::now();
+    }
+}
+
+KernelTelemetryScope::~KernelTelemetryScope()
+{
+    if (_kernel == nullptr)
+    {
+        return;
+    }
+    const auto     end = std::chrono::steady_clock::now();
+    const uint64_t bytes =
+        bytes_of(*_tensors, ACL_SRC, ACL_SRC_END) + bytes_of(*_tensors, ACL_DST, ACL_DST_END);
+
+    KernelTelemetryRecord record;
+    record.kernel_name = _kernel->name();
+    record.window_size = _window->num_iterations_total();
+    record.num_threads = _kernel->is_parallelisable() ? _num_threads : 1U;
+    record.start_ns    = to_ns(_start.time_since_epoch());
+    record.duration_ns = to_ns(end - _start);
+    record.bytes       = bytes;
+    record.flops       = _kernel->flops_estimate(*_window);
+    KernelTelemetry::get().record(std::move(record));
+}
 } // namespace scheduler_utils
 } // namespace arm_compute
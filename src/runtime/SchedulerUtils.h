@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,12 @@
 #ifndef SRC_COMPUTE_SCHEDULER_UTILS_H
 #define SRC_COMPUTE_SCHEDULER_UTILS_H
 
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <chrono>
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -40,6 +44,70 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Scoped access to the workload list of the calling thread
+ *
+ * Kernel launches fill this list instead of a new one so that, once the largest launch has been seen, scheduling a
+ * kernel no longer allocates memory. Each thread has its own list so that concurrent launches don't interfere.
+ *
+ * A launch nested in another one on the same thread, for example from a workload run by the calling thread, can't
+ * reuse the list while the outer launch is iterating over it, so it gets a list of its own instead.
+ */
+class ThreadWorkloads
+{
+public:
+    /** Constructor: acquires the list of the calling thread, emptied but keeping its capacity */
+    ThreadWorkloads();
+    /** Destructor: releases the list of the calling thread */
+    ~ThreadWorkloads();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ThreadWorkloads(const ThreadWorkloads &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ThreadWorkloads &operator=(const ThreadWorkloads &) = delete;
+    /** Workload list to fill
+     *
+     * @return The list of the calling thread, or a local one when nested in another launch
+     */
+    std::vector<IScheduler::Workload> &get();
+
+private:
+    std::vector<IScheduler::Workload> *_workloads; /**< List in use */
+    std::vector<IScheduler::Workload>  _nested{};  /**< Local list used when nested in another launch */
+    bool                               _owner;     /**< Whether the list of the calling thread was acquired */
+};
+
+/** Records the run of a kernel in @ref KernelTelemetry, from its construction to its destruction
+ *
+ * Does nothing beyond checking that the telemetry is enabled if it is not.
+ */
+class KernelTelemetryScope final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] kernel      Kernel about to run
+     * @param[in] window      Window the kernel runs on
+     * @param[in] tensors     Tensors the kernel runs on. Empty for the kernels owning their tensors.
+     * @param[in] num_threads Number of threads the scheduler can split the window between
+     */
+    KernelTelemetryScope(const ICPPKernel  *kernel,
+                         const Window      &window,
+                         const ITensorPack &tensors,
+                         unsigned int       num_threads);
+    /** Prevent instances of this class from being copied */
+    KernelTelemetryScope(const KernelTelemetryScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    KernelTelemetryScope &operator=(const KernelTelemetryScope &) = delete;
+    /** Destructor, records the run */
+    ~KernelTelemetryScope();
+
+private:
+    const ICPPKernel                     *_kernel;
+    const Window                         *_window;
+    const ITensorPack                    *_tensors;
+    unsigned int                          _num_threads;
+    std::chrono::steady_clock::time_point _start{};
+};
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SharedWeightsStore.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr uint64_t hash_multiplier = 0x9e3779b97f4a7c15ULL;
+constexpr size_t   max_samples     = 32;
+
+/** Number of @ref SharedWeightsStore::Scope alive in the calling thread */
+thread_local unsigned int num_scopes = 0;
+
+/** Final mix of 64-bit values, from MurmurHash3 */
+inline uint64_t mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+uint64_t hash_bytes(const uint8_t *data, size_t size, uint64_t seed)
+{
+    uint64_t h = seed ^ (size * hash_multiplier);
+    size_t   i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        h = (h ^ mix(word)) * hash_multiplier;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, data + i, size - i);
+    return mix(h ^ mix(tail));
+}
+} // namespace
+
+SharedWeightsStore::Scope::Scope(bool enabled) : _enabled(enabled)
+{
+    if (_enabled)
+    {
+        ++num_scopes;
+    }
+}
+
+SharedWeightsStore::Scope::~Scope()
+{
+    if (_enabled)
+    {
+        --num_scopes;
+    }
+}
+
+SharedWeightsStore &SharedWeightsStore::get()
+{
+    static SharedWeightsStore store;
+    return store;
+}
+
+void SharedWeightsStore::set_enabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+bool SharedWeightsStore::is_enabled() const
+{
+    return _enabled || num_scopes > 0;
+}
+
+std::shared_ptr<IMemoryRegion>
+SharedWeightsStore::acquire(const Key &key, size_t size, size_t alignment, const Producer &producer)
+{
+    ARM_COMPUTE_ERROR_ON(!producer);
+
+    std::shared_ptr<Slot> slot;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+
+        // Drop the entries released by all their users, unless another thread is about to produce them
+        for (auto it = _slots.begin(); it != _slots.end();)
+        {
+            it = (it->second.use_count() == 1 && it->second->region.expired()) ? _slots.erase(it) : std::next(it);
+        }
+
+        auto &entry = _slots[key];
+        if (entry == nullptr)
+        {
+            entry = std::make_shared<Slot>();
+        }
+        slot = entry;
+    }
+
+    // Only the slot is locked while producing, so that unrelated weights can be prepared concurrently
+    std::lock_guard<std::mutex>    lock(slot->mtx);
+    std::shared_ptr<IMemoryRegion> region = slot->region.lock();
+    if (region == nullptr)
+    {
+        region = std::make_shared<MemoryRegion>(size, alignment);
+        producer(region->buffer());
+        slot->region = region;
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(region->size() != size, "Prepared weights of the same key must have the same size");
+    return region;
+}
+
+size_t SharedWeightsStore::num_entries() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    size_t                      count = 0;
+    for (const auto &entry : _slots)
+    {
+        count += entry.second->region.expired() ? 0 : 1;
+    }
+    return count;
+}
+
+size_t SharedWeightsStore::total_size() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    size_t                      size = 0;
+    for (const auto &entry : _slots)
+    {
+        const auto region = entry.second->region.lock();
+        size += region != nullptr ? region->size() : 0;
+    }
+    return size;
+}
+
+uint64_t SharedWeightsStore::hash(const ITensor &tensor, uint64_t seed)
+{
+    const ITensorInfo *info      = tensor.info();
+    const size_t       row_bytes = info->dimension(0) * info->element_size();
+
+    uint64_t h = mix(seed ^ static_cast<uint64_t>(info->data_type()));
+    for (size_t d = 0; d < info->num_dimensions(); ++d)
+    {
+        h = (h ^ mix(info->dimension(d))) * hash_multiplier;
+    }
+
+    // Hash row by row so that the padding of the tensor does not change the result
+    Window win;
+    win.use_tensor_dimensions(info->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator it(&tensor, win);
+    execute_window_loop(
+        win, [&](const Coordinates &) { h = hash_bytes(it.ptr(), row_bytes, h); }, it);
+    return h;
+}
+
+std::vector<uint8_t> SharedWeightsStore::sample(const ITensor &tensor)
+{
+    const ITensorInfo *info         = tensor.info();
+    const TensorShape &shape        = info->tensor_shape();
+    const size_t       num_elements = shape.total_size();
+    const size_t       num_samples  = std::min(num_elements, max_samples);
+    const size_t       element_size = info->element_size();
+
+    std::vector<uint8_t> samples(num_samples * element_size);
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        const size_t index = num_samples > 1 ? i * (num_elements - 1) / (num_samples - 1) : 0;
+        std::memcpy(samples.data() + i * element_size,
+                    tensor.ptr_to_element(index2coords(shape, static_cast<int>(index))), element_size);
+    }
+    return samples;
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 Arm Limited.
+ * Copyright (c) 2017-2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,17 @@ SubTensor::SubTensor(ITensor *parent, const TensorShape &tensor_shape, const Coo
     _parent = parent;
 }
 
+SubTensor::SubTensor(ITensor           *parent,
+                     const TensorShape &tensor_shape,
+                     const Coordinates &coords,
+                     const Coordinates &steps)
+    : _parent(nullptr), _info()
+{
+    ARM_COMPUTE_ERROR_ON(parent == nullptr);
+    _info   = SubTensorInfo(parent->info(), tensor_shape, coords, steps);
+    _parent = parent;
+}
+
 ITensorInfo *SubTensor::info() const
 {
     return &_info;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2020, 2024 Arm Limited.
+ * Copyright (c) 2016-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,7 +65,8 @@ bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &c
 }
 } // namespace
 
-TensorAllocator::TensorAllocator(IMemoryManageable *owner) : _owner(owner), _associated_memory_group(nullptr), _memory()
+TensorAllocator::TensorAllocator(IMemoryManageable *owner)
+    : _owner(owner), _associated_memory_group(nullptr), _memory(), _imported_region(nullptr, 0)
 {
 }
 
@@ -78,8 +79,14 @@ TensorAllocator::TensorAllocator(TensorAllocator &&o) noexcept
     : ITensorAllocator(std::move(o)),
       _owner(o._owner),
       _associated_memory_group(o._associated_memory_group),
-      _memory(std::move(o._memory))
+      _memory(std::move(o._memory)),
+      _imported_region(std::move(o._imported_region))
 {
+    // Imported memory is referenced through the region embedded in the allocator
+    if (_memory.region() == &o._imported_region)
+    {
+        _memory.set_region(&_imported_region);
+    }
     o._owner                   = nullptr;
     o._associated_memory_group = nullptr;
     o._memory                  = Memory();
@@ -95,7 +102,12 @@ TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
         _associated_memory_group   = o._associated_memory_group;
         o._associated_memory_group = nullptr;
 
-        _memory   = std::move(o._memory);
+        _memory          = std::move(o._memory);
+        _imported_region = std::move(o._imported_region);
+        if (_memory.region() == &o._imported_region)
+        {
+            _memory.set_region(&_imported_region);
+        }
         o._memory = Memory();
 
         ITensorAllocator::operator=(std::move(o));
@@ -162,7 +174,9 @@ Status TensorAllocator::import_memory(void *memory)
     ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
     ARM_COMPUTE_RETURN_ERROR_ON(alignment() != 0 && !arm_compute::utility::check_aligned(memory, alignment()));
 
-    _memory.set_owned_region(std::make_unique<MemoryRegion>(memory, info().total_size()));
+    // Reuse the embedded region rather than allocating a new one
+    _imported_region = MemoryRegion(memory, info().total_size());
+    _memory.set_region(&_imported_region);
     info().set_is_resizable(false);
 
     return Status{};
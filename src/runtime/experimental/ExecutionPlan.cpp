@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/ExecutionPlan.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PoolManager.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace experimental
+{
+struct ExecutionPlan::Impl
+{
+    /** An operator of the plan with its tensors and workspace */
+    struct Step
+    {
+        IOperator                           *op{nullptr};
+        ITensorPack                          pack{};
+        std::vector<std::unique_ptr<Tensor>> workspace{};
+        std::vector<int>                     prepare_slots{};
+    };
+
+    Impl()
+        : lifetime_mgr(std::make_shared<OffsetLifetimeManager>()),
+          pool_mgr(std::make_shared<PoolManager>()),
+          memory_mgr(std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr)),
+          memory_group(memory_mgr)
+    {
+    }
+
+    std::shared_ptr<OffsetLifetimeManager> lifetime_mgr;
+    std::shared_ptr<PoolManager>           pool_mgr;
+    std::shared_ptr<MemoryManagerOnDemand> memory_mgr;
+    MemoryGroup                            memory_group;
+    Allocator                              default_allocator{};
+    std::vector<Step>                      steps{};
+    ExecutionPlanMemoryStats               stats{};
+    bool                                   is_finalized{false};
+    bool                                   is_prepared{false};
+};
+
+ExecutionPlan::ExecutionPlan() : impl_(std::make_unique<Impl>())
+{
+}
+
+ExecutionPlan::ExecutionPlan(ExecutionPlan &&)            = default;
+ExecutionPlan &ExecutionPlan::operator=(ExecutionPlan &&) = default;
+ExecutionPlan::~ExecutionPlan()                           = default;
+
+void ExecutionPlan::manage(Tensor *tensor)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(tensor);
+    ARM_COMPUTE_ERROR_ON_MSG(impl_->is_finalized, "Tensors cannot be managed once the plan is finalized");
+    ARM_COMPUTE_ERROR_ON_MSG(tensor->allocator()->is_allocated(), "Managed tensors must not be allocated");
+
+    impl_->memory_group.manage(tensor);
+    impl_->stats.naive_size += tensor->info()->total_size();
+}
+
+void ExecutionPlan::add_operator(IOperator *op, const ITensorPack &pack)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(op);
+    ARM_COMPUTE_ERROR_ON_MSG(impl_->is_finalized, "Operators cannot be added once the plan is finalized");
+
+    Impl::Step step{op, pack, {}, {}};
+
+    // All the workspace buffers of the operator start their lifetime together ...
+    for (const auto &req : op->workspace())
+    {
+        if (req.size == 0)
+        {
+            continue;
+        }
+
+        auto tensor = std::make_unique<Tensor>();
+        tensor->allocator()->init(TensorInfo(TensorShape(req.size), 1, DataType::U8), req.alignment);
+
+        switch (req.lifetime)
+        {
+            case MemoryLifetime::Temporary:
+                impl_->memory_group.manage(tensor.get());
+                impl_->stats.naive_size += req.size;
+                break;
+            case MemoryLifetime::Prepare:
+                step.prepare_slots.push_back(req.slot);
+                impl_->stats.prepare_size += req.size;
+                break;
+            case MemoryLifetime::Persistent:
+            default:
+                impl_->stats.persistent_size += req.size;
+                break;
+        }
+
+        step.pack.add_tensor(req.slot, tensor.get());
+        step.workspace.emplace_back(std::move(tensor));
+    }
+
+    // ... and the temporary ones end it with the operator
+    for (auto &tensor : step.workspace)
+    {
+        tensor->allocator()->allocate();
+    }
+
+    impl_->steps.emplace_back(std::move(step));
+}
+
+void ExecutionPlan::finalize(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(impl_->is_finalized, "The plan is already finalized");
+    ARM_COMPUTE_ERROR_ON_MSG(!impl_->lifetime_mgr->are_all_finalized(),
+                             "The lifetime of all the managed tensors must have ended");
+
+    impl_->memory_mgr->populate(allocator != nullptr ? *allocator : impl_->default_allocator, 1 /* num_pools */);
+    impl_->stats.arena_size = impl_->lifetime_mgr->info().size;
+    impl_->is_finalized     = true;
+}
+
+void ExecutionPlan::prepare()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!impl_->is_finalized, "The plan must be finalized before being prepared");
+    if (impl_->is_prepared)
+    {
+        return;
+    }
+
+    MemoryGroupResourceScope scope_mg(impl_->memory_group);
+    for (auto &step : impl_->steps)
+    {
+        step.op->prepare(step.pack);
+
+        // Release the workspace only needed by prepare
+        for (const int slot : step.prepare_slots)
+        {
+            auto tensor = static_cast<Tensor *>(step.pack.get_tensor(slot));
+            tensor->allocator()->free();
+            step.pack.remove_tensor(slot);
+        }
+    }
+    impl_->is_prepared = true;
+}
+
+void ExecutionPlan::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(impl_->memory_group);
+    for (auto &step : impl_->steps)
+    {
+        step.op->run(step.pack);
+    }
+}
+
+ExecutionPlanMemoryStats ExecutionPlan::memory_stats() const
+{
+    return impl_->stats;
+}
+} // namespace experimental
+} // namespace arm_compute
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_NEON_GRAPHACCESSORS_H
+#define ACL_TESTS_NEON_GRAPHACCESSORS_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/SimpleTensor.h"
+#include "tests/Utils.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+/** Graph accessor filling a tensor with uniformly distributed values
+ *
+ * Streams @p num_runs different inputs, the n-th one being filled with the seed @p seed + n, and returns false once
+ * they have all been provided. Constant tensors are only accessed once, so the default of a single run suits them.
+ */
+class UniformGraphAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] seed     Seed of the first fill
+     * @param[in] lower    Lowest value of the distribution
+     * @param[in] upper    Highest value of the distribution
+     * @param[in] num_runs (Optional) Number of inputs to provide
+     */
+    UniformGraphAccessor(std::random_device::result_type seed, float lower, float upper, unsigned int num_runs = 1)
+        : _seed(seed), _lower(lower), _upper(upper), _num_runs(num_runs), _run(0)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        if (_run == _num_runs)
+        {
+            return false;
+        }
+        library->fill_tensor_uniform(Accessor(tensor), _seed + _run++, _lower, _upper);
+        return true;
+    }
+
+    std::string data_id() const override
+    {
+        return "uniform:" + std::to_string(_seed) + ":" + std::to_string(_lower) + ":" + std::to_string(_upper) +
+               ":" + std::to_string(_num_runs);
+    }
+
+private:
+    std::random_device::result_type _seed;
+    float                           _lower;
+    float                           _upper;
+    unsigned int                    _num_runs;
+    unsigned int                    _run;
+};
+
+/** Graph accessor copying every output of an F32 tensor
+ *
+ * Returns false once @p max_outputs outputs have been copied, which stops the graph.
+ */
+class CaptureGraphAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] outputs     Copies of the outputs, in the order they are produced
+     * @param[in]  max_outputs (Optional) Number of outputs after which the graph is stopped. 0 to never stop it.
+     */
+    explicit CaptureGraphAccessor(std::vector<SimpleTensor<float>> &outputs, unsigned int max_outputs = 0)
+        : _outputs(outputs), _max_outputs(max_outputs)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        const TensorShape  &shape = tensor.info()->tensor_shape();
+        SimpleTensor<float> copy(shape, DataType::F32);
+        Accessor            src(tensor);
+        for (int i = 0; i < copy.num_elements(); ++i)
+        {
+            copy[i] = *reinterpret_cast<const float *>(src(index2coord(shape, i)));
+        }
+        _outputs.push_back(std::move(copy));
+        return _max_outputs == 0 || _outputs.size() < _max_outputs;
+    }
+
+private:
+    std::vector<SimpleTensor<float>> &_outputs;
+    unsigned int                      _max_outputs;
+};
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_NEON_GRAPHACCESSORS_H
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NECast.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/CastFixture.h"
+#include "tests/datasets/NumThreadsDataset.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto u8_to_f32 = combine(framework::dataset::make("DataType", {DataType::U8}),
+                               framework::dataset::make("DataType", {DataType::F32}));
+const auto f32_to_s32 = combine(framework::dataset::make("DataType", {DataType::F32}),
+                                framework::dataset::make("DataType", {DataType::S32}));
+const auto s32_to_f32 = combine(framework::dataset::make("DataType", {DataType::S32}),
+                                framework::dataset::make("DataType", {DataType::F32}));
+const auto cast_types = concat(u8_to_f32, f32_to_s32, s32_to_f32);
+const auto policies   = framework::dataset::make("ConvertPolicy", {ConvertPolicy::SATURATE});
+} // namespace
+
+using NECastFixture = CastFixture<Tensor, NECast, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(Cast)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall,
+                                NECastFixture,
+                                framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::SmallShapes(), cast_types, policies, datasets::NumThreads()));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge,
+                                NECastFixture,
+                                framework::DatasetMode::NIGHTLY,
+                                combine(datasets::LargeShapes(), cast_types, policies, datasets::NumThreads()));
+TEST_SUITE_END() // Cast
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
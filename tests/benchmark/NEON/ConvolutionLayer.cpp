@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/ConvolutionLayerFixture.h"
+#include "tests/datasets/DirectConvolutionLayerDataset.h"
+#include "tests/datasets/LargeConvolutionLayerDataset.h"
+#include "tests/datasets/NumThreadsDataset.h"
+#include "tests/datasets/SmallConvolutionLayerDataset.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types   = framework::dataset::make("DataType", {DataType::F32});
+const auto data_layouts = framework::dataset::make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC});
+} // namespace
+
+using NEConvolutionLayerFixture         = ConvolutionLayerFixture<Tensor, NEConvolutionLayer, Accessor>;
+using NEGEMMConvolutionLayerFixture     = ConvolutionLayerFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
+using NEDirectConvolutionLayerFixture   = ConvolutionLayerFixture<Tensor, NEDirectConvolutionLayer, Accessor>;
+using NEWinogradConvolutionLayerFixture = ConvolutionLayerFixture<Tensor, NEWinogradConvolutionLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunSmall,
+    NEConvolutionLayerFixture,
+    framework::DatasetMode::PRECOMMIT,
+    combine(datasets::SmallConvolutionLayerReducedDataset(), data_types, data_layouts, datasets::NumThreads()));
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunLarge,
+    NEConvolutionLayerFixture,
+    framework::DatasetMode::NIGHTLY,
+    combine(datasets::LargeConvolutionLayerDataset(), data_types, data_layouts, datasets::NumThreads()));
+
+TEST_SUITE(GEMM)
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunSmall,
+    NEGEMMConvolutionLayerFixture,
+    framework::DatasetMode::PRECOMMIT,
+    combine(datasets::SmallConvolutionLayerReducedDataset(), data_types, data_layouts, datasets::NumThreads()));
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunLarge,
+    NEGEMMConvolutionLayerFixture,
+    framework::DatasetMode::NIGHTLY,
+    combine(datasets::LargeConvolutionLayerDataset(), data_types, data_layouts, datasets::NumThreads()));
+TEST_SUITE_END() // GEMM
+
+TEST_SUITE(Direct)
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunSmall,
+    NEDirectConvolutionLayerFixture,
+    framework::DatasetMode::PRECOMMIT,
+    combine(datasets::DirectConvolutionLayerDataset(), data_types, data_layouts, datasets::NumThreads()));
+TEST_SUITE_END() // Direct
+
+TEST_SUITE(Winograd)
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunSmall,
+    NEWinogradConvolutionLayerFixture,
+    framework::DatasetMode::PRECOMMIT,
+    combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(), data_types, data_layouts, datasets::NumThreads()));
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunLarge,
+    NEWinogradConvolutionLayerFixture,
+    framework::DatasetMode::NIGHTLY,
+    combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(), data_types, data_layouts, datasets::NumThreads()));
+TEST_SUITE_END() // Winograd
+TEST_SUITE_END() // ConvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
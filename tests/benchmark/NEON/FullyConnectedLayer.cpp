@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NECopy.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/CopyFixture.h"
+#include "tests/benchmark/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/datasets/NumThreadsDataset.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types = framework::dataset::make("DataType", {DataType::F32});
+
+/** Batch 1 layers whose weights do not fit in the last level cache, so every run streams them from memory */
+const auto streamed_weights_shapes =
+    zip(framework::dataset::make("SrcShape", {TensorShape(4096U), TensorShape(8192U), TensorShape(1024U)}),
+        framework::dataset::make("WeightsShape",
+                                 {TensorShape(4096U, 4096U), TensorShape(8192U, 2048U), TensorShape(1024U, 32768U)}),
+        framework::dataset::make("BiasesShape", {TensorShape(4096U), TensorShape(2048U), TensorShape(32768U)}),
+        framework::dataset::make("DstShape", {TensorShape(4096U), TensorShape(2048U), TensorShape(32768U)}));
+
+/** Bytes of weights prefetched ahead of their use, 0 to disable the prefetching */
+const auto weights_prefetch_distances =
+    framework::dataset::make("WeightsPrefetchDistance", {0U, 32U * 1024U, 128U * 1024U});
+
+/** Tensors of the size of the weights above, to measure the copy bandwidth of the memory */
+const auto stream_copy_shapes = framework::dataset::make(
+    "Shape", {TensorShape(4096U, 4096U), TensorShape(8192U, 2048U), TensorShape(1024U, 32768U)});
+} // namespace
+
+using NEFullyConnectedLayerFixture = FullyConnectedLayerFixture<Tensor, NEFullyConnectedLayer, Accessor>;
+using NEStreamCopyFixture          = CopyFixture<Tensor, NECopy, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(FullyConnectedLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(
+    RunStreamedWeights,
+    NEFullyConnectedLayerFixture,
+    framework::DatasetMode::NIGHTLY,
+    combine(streamed_weights_shapes, data_types, weights_prefetch_distances, datasets::NumThreads()));
+// Reference bandwidth for RunStreamedWeights
+REGISTER_FIXTURE_DATA_TEST_CASE(StreamCopy,
+                                NEStreamCopyFixture,
+                                framework::DatasetMode::NIGHTLY,
+                                combine(stream_copy_shapes, data_types, datasets::NumThreads()));
+TEST_SUITE_END() // FullyConnectedLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPermute.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/PermuteFixture.h"
+#include "tests/datasets/NumThreadsDataset.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+// NCHW <-> NHWC and a full transpose of the last two dimensions
+const auto permutations = framework::dataset::make(
+    "PermutationVector",
+    {PermutationVector(2U, 0U, 1U), PermutationVector(1U, 2U, 0U), PermutationVector(0U, 1U, 3U, 2U)});
+const auto data_types = framework::dataset::make("DataType", {DataType::F32, DataType::F16, DataType::QASYMM8});
+} // namespace
+
+using NEPermuteFixture = PermuteFixture<Tensor, NEPermute, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(Permute)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall,
+                                NEPermuteFixture,
+                                framework::DatasetMode::PRECOMMIT,
+                                combine(datasets::Small4DShapes(), permutations, data_types, datasets::NumThreads()));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge,
+                                NEPermuteFixture,
+                                framework::DatasetMode::NIGHTLY,
+                                combine(datasets::Large4DShapes(), permutations, data_types, datasets::NumThreads()));
+TEST_SUITE_END() // Permute
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_BENCHMARKFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_BENCHMARKFIXTURE_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/framework/instruments/Instruments.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Common helpers for the operator benchmark fixtures.
+ *
+ * Fixtures run with the number of threads given by the dataset and declare the work done by one run
+ * so that the throughput instrument can report GFLOP/s and GB/s.
+ */
+class BenchmarkFixture : public framework::Fixture
+{
+protected:
+    /** Run the benchmark on @p num_threads threads, until @ref restore_num_threads is called */
+    void set_num_threads(int num_threads)
+    {
+        _prev_num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(static_cast<unsigned int>(num_threads));
+    }
+
+    /** Restore the number of threads in use before @ref set_num_threads */
+    void restore_num_threads()
+    {
+        if (_prev_num_threads != 0)
+        {
+            Scheduler::get().set_num_threads(_prev_num_threads);
+            _prev_num_threads = 0;
+        }
+    }
+
+    /** Declare the arithmetic operations and the bytes moved by one run of the function */
+    void set_workload(uint64_t flops, uint64_t bytes)
+    {
+        framework::set_test_workload(flops, bytes);
+    }
+
+    /** Quantization info used for the tensors of quantized data type */
+    static QuantizationInfo quantization_info(DataType data_type)
+    {
+        return is_data_type_quantized(data_type) ? QuantizationInfo(0.5f, 10) : QuantizationInfo();
+    }
+
+    /** Data type of the biases of a convolution computing in @p data_type */
+    static DataType bias_data_type(DataType data_type)
+    {
+        return is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
+    }
+
+    /** Size in bytes of the valid data of a tensor, excluding padding */
+    template <typename TensorType>
+    static uint64_t bytes_of(const TensorType &tensor)
+    {
+        return static_cast<uint64_t>(tensor.info()->tensor_shape().total_size()) * tensor.info()->element_size();
+    }
+
+private:
+    unsigned int _prev_num_threads{0};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_BENCHMARKFIXTURE_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture for the 2D convolution functions
+ *
+ * The shapes of the dataset are given in NCHW and permuted for NHWC. Dilated convolutions are not benchmarked.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class ConvolutionLayerFixture : public BenchmarkFixture
+{
+public:
+    void setup(TensorShape   src_shape,
+               TensorShape   weights_shape,
+               TensorShape   biases_shape,
+               TensorShape   dst_shape,
+               PadStrideInfo info,
+               Size2D        dilation,
+               DataType      data_type,
+               DataLayout    data_layout,
+               int           num_threads)
+    {
+        ARM_COMPUTE_UNUSED(dilation);
+        set_num_threads(num_threads);
+
+        // Each output element accumulates over the kernel window of all input channels
+        const uint64_t macs_per_output =
+            static_cast<uint64_t>(weights_shape.x()) * weights_shape.y() * weights_shape.z();
+
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        const QuantizationInfo qinfo     = quantization_info(data_type);
+        const DataType         bias_type = bias_data_type(data_type);
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, qinfo, data_layout);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1, qinfo, data_layout);
+        biases  = create_tensor<TensorType>(biases_shape, bias_type, 1, QuantizationInfo(), data_layout);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo, data_layout);
+
+        // Create and configure function
+        conv_layer.configure(&src, &weights, &biases, &dst, info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(biases), 2);
+
+        // Keep the transformation of the constant weights out of the measurements
+        conv_layer.prepare();
+
+        set_workload(2 * macs_per_output * dst_shape.total_size(),
+                     bytes_of(src) + bytes_of(weights) + bytes_of(biases) + bytes_of(dst));
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+    Function   conv_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_ELEMENTWISEOPERATIONSFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_ELEMENTWISEOPERATIONSFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor>
+class ElementwiseOperationsFixture : public BenchmarkFixture
+{
+public:
+    void setup(const TensorShape &shape0, const TensorShape &shape1, DataType data_type, int num_threads)
+    {
+        set_num_threads(num_threads);
+
+        const TensorShape      dst_shape = TensorShape::broadcast_shape(shape0, shape1);
+        const QuantizationInfo qinfo     = quantization_info(data_type);
+
+        // Create tensors
+        src1 = create_tensor<TensorType>(shape0, data_type, 1, qinfo);
+        src2 = create_tensor<TensorType>(shape1, data_type, 1, qinfo);
+        dst  = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo);
+
+        // Create and configure function
+        elementwise_func.configure(&src1, &src2, &dst);
+
+        // Allocate tensors
+        src1.allocator()->allocate();
+        src2.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src1), 0);
+        library->fill_tensor_uniform(Accessor(src2), 1);
+
+        // One operation per output element
+        set_workload(dst_shape.total_size(), bytes_of(src1) + bytes_of(src2) + bytes_of(dst));
+    }
+
+    void run()
+    {
+        elementwise_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src1.allocator()->free();
+        src2.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType src1{};
+    TensorType src2{};
+    TensorType dst{};
+    Function   elementwise_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_ELEMENTWISEOPERATIONSFIXTURE_H
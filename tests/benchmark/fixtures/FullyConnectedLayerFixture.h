@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_FULLYCONNECTEDLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_FULLYCONNECTEDLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/FullyConnectedLayerInfo.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor>
+class FullyConnectedLayerFixture : public BenchmarkFixture
+{
+public:
+    void setup(TensorShape  src_shape,
+               TensorShape  weights_shape,
+               TensorShape  biases_shape,
+               TensorShape  dst_shape,
+               DataType     data_type,
+               unsigned int weights_prefetch_distance,
+               int          num_threads)
+    {
+        set_num_threads(num_threads);
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type);
+        weights = create_tensor<TensorType>(weights_shape, data_type);
+        biases  = create_tensor<TensorType>(biases_shape, data_type);
+        dst     = create_tensor<TensorType>(dst_shape, data_type);
+
+        // Create and configure function
+        FullyConnectedLayerInfo fc_info{};
+        fc_info.weights_prefetch_distance = weights_prefetch_distance;
+        fc_layer.configure(&src, &weights, &biases, &dst, fc_info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(biases), 2);
+
+        // Keep the reshape of the weights out of the measurements
+        fc_layer.prepare();
+
+        // Each output element is a dot product over the input features, and every run streams all the weights
+        const uint64_t k = weights_shape.x();
+        set_workload(2 * k * dst_shape.total_size(),
+                     bytes_of(src) + bytes_of(weights) + bytes_of(biases) + bytes_of(dst));
+    }
+
+    void run()
+    {
+        fc_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+    Function   fc_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_FULLYCONNECTEDLAYERFIXTURE_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GATHERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GATHERFIXTURE_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor>
+class GatherFixture : public BenchmarkFixture
+{
+public:
+    void setup(TensorShape input_shape, TensorShape indices_shape, int axis, DataType data_type, int num_threads)
+    {
+        set_num_threads(num_threads);
+
+        const uint32_t actual_axis = wrap_around(axis, static_cast<int>(input_shape.num_dimensions()));
+
+        // Create tensors, the destination is initialized by the function
+        src     = create_tensor<TensorType>(input_shape, data_type);
+        indices = create_tensor<TensorType>(indices_shape, DataType::U32);
+
+        // Create and configure function
+        gather_func.configure(&src, &indices, &dst, axis);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        indices.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(indices), 1, static_cast<uint32_t>(0),
+                                     static_cast<uint32_t>(input_shape[actual_axis] - 1));
+
+        // Only the gathered elements are read from the source
+        set_workload(0, 2 * bytes_of(dst) + bytes_of(indices));
+    }
+
+    void run()
+    {
+        gather_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        indices.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType src{};
+    TensorType indices{};
+    TensorType dst{};
+    Function   gather_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GATHERFIXTURE_H
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_MATMULFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_MATMULFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/MatMulInfo.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor, typename Settings>
+class MatMulFixture : public BenchmarkFixture
+{
+public:
+    void setup(TensorShape shape_lhs, TensorShape shape_rhs, TensorShape shape_dst, DataType data_type, int num_threads)
+    {
+        set_num_threads(num_threads);
+
+        // Create tensors
+        lhs = create_tensor<TensorType>(shape_lhs, data_type);
+        rhs = create_tensor<TensorType>(shape_rhs, data_type);
+        dst = create_tensor<TensorType>(shape_dst, data_type);
+
+        // Create and configure function
+        matmul.configure(&lhs, &rhs, &dst, MatMulInfo(), Settings());
+
+        // Allocate tensors
+        lhs.allocator()->allocate();
+        rhs.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(lhs), 0);
+        library->fill_tensor_uniform(Accessor(rhs), 1);
+
+        const uint64_t k = shape_lhs.x();
+        set_workload(2 * k * shape_dst.total_size(), bytes_of(lhs) + bytes_of(rhs) + bytes_of(dst));
+    }
+
+    void run()
+    {
+        matmul.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        lhs.allocator()->free();
+        rhs.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType lhs{};
+    TensorType rhs{};
+    TensorType dst{};
+    Function   matmul{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_MATMULFIXTURE_H
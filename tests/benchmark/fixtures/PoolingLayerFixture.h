@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_POOLINGLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_POOLINGLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture for the 2D pooling functions
+ *
+ * The input shape of the dataset is given in NCHW and permuted for NHWC.
+ */
+template <typename TensorType, typename Function, typename Accessor>
+class PoolingLayerFixture : public BenchmarkFixture
+{
+public:
+    void setup(TensorShape   src_shape,
+               PoolingType   pool_type,
+               Size2D        pool_size,
+               PadStrideInfo pad_stride_info,
+               DataType      data_type,
+               DataLayout    data_layout,
+               int           num_threads)
+    {
+        set_num_threads(num_threads);
+
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        const QuantizationInfo qinfo = quantization_info(data_type);
+
+        // Create tensors, the destination is initialized by the function
+        src = create_tensor<TensorType>(src_shape, data_type, 1, qinfo, data_layout);
+
+        // Create and configure function
+        pool_layer.configure(&src, &dst, PoolingLayerInfo(pool_type, pool_size, data_layout, pad_stride_info, true));
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+
+        set_workload(static_cast<uint64_t>(pool_size.area()) * dst.info()->tensor_shape().total_size(),
+                     bytes_of(src) + bytes_of(dst));
+    }
+
+    void run()
+    {
+        pool_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType src{};
+    TensorType dst{};
+    Function   pool_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_POOLINGLAYERFIXTURE_H
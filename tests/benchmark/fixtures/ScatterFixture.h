@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_SCATTERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_SCATTERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ScatterInfo.h"
+
+#include "tests/benchmark/fixtures/BenchmarkFixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor>
+class ScatterFixture : public BenchmarkFixture
+{
+public:
+    void setup(TensorShape     src_shape,
+               TensorShape     updates_shape,
+               TensorShape     indices_shape,
+               TensorShape     dst_shape,
+               DataType        data_type,
+               ScatterFunction function,
+               int             num_threads)
+    {
+        set_num_threads(num_threads);
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type);
+        updates = create_tensor<TensorType>(updates_shape, data_type);
+        indices = create_tensor<TensorType>(indices_shape, DataType::S32);
+        dst     = create_tensor<TensorType>(dst_shape, data_type);
+
+        // Create and configure function
+        scatter_func.configure(&src, &updates, &indices, &dst, ScatterInfo(function, false));
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        updates.allocator()->allocate();
+        indices.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(updates), 1);
+
+        // Keep every index in bounds whatever the dimension it addresses
+        size_t min_dim = dst_shape[0];
+        for (size_t d = 1; d < dst_shape.num_dimensions(); ++d)
+        {
+            min_dim = std::min(min_dim, dst_shape[d]);
+        }
+        library->fill_tensor_uniform(Accessor(indices), 2, static_cast<int32_t>(0), static_cast<int32_t>(min_dim - 1));
+
+        // The source is copied to the destination before the updates are applied
+        set_workload(updates_shape.total_size(),
+                     bytes_of(src) + bytes_of(dst) + 2 * bytes_of(updates) + bytes_of(indices));
+    }
+
+    void run()
+    {
+        scatter_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        updates.allocator()->free();
+        indices.allocator()->free();
+        dst.allocator()->free();
+        restore_num_threads();
+    }
+
+private:
+    TensorType src{};
+    TensorType updates{};
+    TensorType indices{};
+    TensorType dst{};
+    Function   scatter_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_SCATTERFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -163,14 +163,16 @@ int run_example(int argc, char **argv, std::unique_ptr<Example> example)
             }
 #endif /* ARM_COMPUTE_CL */
             p->print_entry("Iterations", support::cpp11::to_string(options.iterations->value()));
+            p->print_entry("Warmup", support::cpp11::to_string(options.warmup->value()));
         }
     }
 
     // Initialize framework
     framework::FrameworkConfig fconfig;
-    fconfig.instruments    = options.instruments->value();
-    fconfig.num_iterations = options.iterations->value();
-    fconfig.log_level      = options.log_level->value();
+    fconfig.instruments           = options.instruments->value();
+    fconfig.num_iterations        = options.iterations->value();
+    fconfig.num_warmup_iterations = options.warmup->value();
+    fconfig.log_level             = options.log_level->value();
     framework.init(fconfig);
 
     for (auto &p : printers)
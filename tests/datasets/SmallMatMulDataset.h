@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025 Arm Limited.
+ * Copyright (c) 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,6 +59,19 @@ public:
     }
 };
 
+class SmallMatMulDynamicQuantizedDataset final : public MatMulDataset
+{
+public:
+    // The dynamically quantized rhs must be 2D, the lhs batches share it
+    SmallMatMulDynamicQuantizedDataset()
+    {
+        add_config(TensorShape(9U, 6U), TensorShape(5U, 9U), TensorShape(5U, 6U));
+        add_config(TensorShape(31U, 1U), TensorShape(23U, 31U), TensorShape(23U, 1U));
+        add_config(TensorShape(8U, 4U, 2U), TensorShape(16U, 8U), TensorShape(16U, 4U, 2U));
+        add_config(TensorShape(32U, 3U, 2U, 2U), TensorShape(17U, 32U), TensorShape(17U, 3U, 2U, 2U));
+    }
+};
+
 class TinyMatMulDataset final : public MatMulDataset
 {
 public:
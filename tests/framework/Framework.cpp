@@ -88,6 +88,20 @@ Framework::Framework() : _test_filter(nullptr)
     _available_instruments.emplace(
         std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_TIMER, ScaleFactor::TIME_S),
         Instrument::make_instrument<SchedulerTimer, ScaleFactor::TIME_S>);
+    _available_instruments.emplace(
+        std::pair<InstrumentType, ScaleFactor>(InstrumentType::THROUGHPUT, ScaleFactor::NONE),
+        Instrument::make_instrument<Throughput, ScaleFactor::NONE>);
+    _available_instruments.emplace(
+        std::pair<InstrumentType, ScaleFactor>(InstrumentType::ALLOCATION_COUNTER, ScaleFactor::NONE),
+        Instrument::make_instrument<AllocationCounter, ScaleFactor::NONE>);
+#ifdef ARM_COMPUTE_GRAPH_ENABLED
+    _available_instruments.emplace(
+        std::pair<InstrumentType, ScaleFactor>(InstrumentType::GRAPH_NODE_TIMER, ScaleFactor::NONE),
+        Instrument::make_instrument<GraphNodeTimer, ScaleFactor::NONE>);
+    _available_instruments.emplace(
+        std::pair<InstrumentType, ScaleFactor>(InstrumentType::GRAPH_NODE_TIMER, ScaleFactor::TIME_MS),
+        Instrument::make_instrument<GraphNodeTimer, ScaleFactor::TIME_MS>);
+#endif /* ARM_COMPUTE_GRAPH_ENABLED */
 #ifdef PMU_ENABLED
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::NONE),
                                    Instrument::make_instrument<PMUCounter, ScaleFactor::NONE>);
@@ -176,13 +190,14 @@ Framework &Framework::get()
 void Framework::init(const FrameworkConfig &config)
 {
     _test_filter.reset(new TestFilter(config.mode, config.name_filter, config.id_filter));
-    _num_iterations   = config.num_iterations;
-    _log_level        = config.log_level;
-    _cooldown_sec     = config.cooldown_sec;
-    _configure_only   = config.configure_only;
-    _print_rerun_cmd  = config.print_rerun_cmd;
-    _seed             = config.seed;
-    _print_iterations = config.print_iterations;
+    _num_iterations        = config.num_iterations;
+    _num_warmup_iterations = config.num_warmup_iterations;
+    _log_level             = config.log_level;
+    _cooldown_sec          = config.cooldown_sec;
+    _configure_only        = config.configure_only;
+    _print_rerun_cmd       = config.print_rerun_cmd;
+    _seed                  = config.seed;
+    _print_iterations      = config.print_iterations;
     _instruments =
         std::set<framework::InstrumentsDescription>(std::begin(config.instruments), std::end(config.instruments));
 }
@@ -336,6 +351,16 @@ void Framework::set_num_iterations(int num_iterations)
     _num_iterations = num_iterations;
 }
 
+int Framework::num_warmup_iterations() const
+{
+    return _num_warmup_iterations;
+}
+
+void Framework::set_num_warmup_iterations(int num_warmup_iterations)
+{
+    _num_warmup_iterations = num_warmup_iterations;
+}
+
 void Framework::set_throw_errors(bool throw_errors)
 {
     _throw_errors = throw_errors;
@@ -400,15 +425,29 @@ TestResult::Status Framework::run_test(const TestInfo &info, TestCaseFactory &te
 
             test_case->do_setup();
 
+            // Explicit warm-up iterations are never measured
+            for (int i = 0; i < _num_warmup_iterations; ++i)
+            {
+                if (_prepare_function != nullptr)
+                {
+                    _prepare_function();
+                }
+                test_case->do_run();
+                test_case->do_sync();
+            }
+
+            // Without explicit warm-up the first iteration of a multi-iterations run acts as one
+            const bool skip_first_iteration = _num_warmup_iterations == 0 && _num_iterations > 1;
+
             for (int i = 0; i < _num_iterations; ++i)
             {
                 //Start the profiler if:
-                //- there is only one iteration
+                //- there is only one iteration or warm-up iterations were run
                 //- it's not the first iteration of a multi-iterations run.
                 //
                 //Reason: if the CLTuner is enabled then the first run will be really messy
                 //as each kernel will be executed several times, messing up the instruments like OpenCL timers.
-                if (_num_iterations == 1 || i != 0)
+                if (!skip_first_iteration || i != 0)
                 {
                     profiler.start();
                 }
@@ -418,7 +457,7 @@ TestResult::Status Framework::run_test(const TestInfo &info, TestCaseFactory &te
                 }
                 test_case->do_run();
                 test_case->do_sync();
-                if (_num_iterations == 1 || i != 0)
+                if (!skip_first_iteration || i != 0)
                 {
                     profiler.stop(_print_iterations ? i : -1);
                 }
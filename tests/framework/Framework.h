@@ -61,6 +61,7 @@ struct FrameworkConfig
     std::string id_filter{};   /**< String to match selected test ids. Only matching tests will be executed. */
     DatasetMode mode{DatasetMode::ALL};    /**< Dataset mode. */
     int         num_iterations{1};         /**< Number of iterations per test. */
+    int         num_warmup_iterations{0};  /**< Number of unmeasured iterations run before the measured ones. */
     float       cooldown_sec{-1.f};        /**< Delay between tests in seconds. */
     LogLevel    log_level{LogLevel::NONE}; /**< Verbosity of the output. */
     bool        configure_only{false};     /**< Only configure kernels */
@@ -245,6 +246,18 @@ public:
      */
     void set_num_iterations(int num_iterations);
 
+    /** Number of unmeasured warm-up iterations per test case.
+     *
+     * @return Number of warm-up iterations per test case.
+     */
+    int num_warmup_iterations() const;
+
+    /** Set number of unmeasured warm-up iterations per test case.
+     *
+     * @param[in] num_warmup_iterations Number of warm-up iterations per test case.
+     */
+    void set_num_warmup_iterations(int num_warmup_iterations);
+
     /** Should errors be caught or thrown by the framework.
      *
      * @return True if errors are thrown.
@@ -411,6 +424,7 @@ private:
     std::vector<std::unique_ptr<TestCaseFactory>> _test_factories{};
     std::map<TestInfo, TestResult>                _test_results{};
     int                                           _num_iterations{1};
+    int                                           _num_warmup_iterations{0};
     float                                         _cooldown_sec{-1.f};
     bool                                          _throw_errors{false};
     bool                                          _stop_on_error{false};
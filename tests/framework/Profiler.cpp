@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018,2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2018,2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -91,7 +91,12 @@ void Profiler::test_stop()
         {
             _measurements[instrument->id() + "/" + measurement.first].push_back(measurement.second);
         }
-        _header_data = instrument->instrument_header();
+        // Only one instrument provides a header: don't let the others overwrite it
+        const std::string header = instrument->instrument_header();
+        if (!header.empty())
+        {
+            _header_data = header;
+        }
     }
 }
 
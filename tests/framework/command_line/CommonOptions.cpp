@@ -41,6 +41,7 @@ CommonOptions::CommonOptions(CommandLineParser &parser)
     : help(parser.add_option<ToggleOption>("help")),
       instruments(),
       iterations(parser.add_option<SimpleOption<int>>("iterations", 1)),
+      warmup(parser.add_option<SimpleOption<int>>("warmup", 0)),
       log_format(),
       log_file(parser.add_option<SimpleOption<std::string>>("log-file")),
       log_level(),
@@ -88,6 +89,7 @@ CommonOptions::CommonOptions(CommandLineParser &parser)
     help->set_help("Show this help message");
     instruments->set_help("Set the profiling instruments to use");
     iterations->set_help("Number of iterations per test case");
+    warmup->set_help("Number of unmeasured iterations to run before the measured ones");
     log_format->set_help("Output format for measurements and failures (affects only log-file)");
     log_file->set_help("Write output to file instead of to the console (affected by log-format)");
     log_level->set_help("Verbosity of the output");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025 Arm Limited.
+ * Copyright (c) 2018, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,7 @@ public:
     arm_compute::utils::ToggleOption                           *help;           /**< Show help option */
     arm_compute::utils::EnumListOption<InstrumentsDescription> *instruments;    /**< Instruments option */
     arm_compute::utils::SimpleOption<int>                      *iterations;     /**< Number of iterations option */
+    arm_compute::utils::SimpleOption<int>                      *warmup;         /**< Warm-up iterations option */
     arm_compute::utils::EnumOption<LogFormat>                  *log_format;     /**< Log format option */
     arm_compute::utils::SimpleOption<std::string>              *log_file;       /**< Log file option */
     arm_compute::utils::EnumOption<LogLevel>                   *log_level;      /**< Logging level option */
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<uint64_t> num_allocations{0};
+std::atomic<uint64_t> num_bytes{0};
+
+void *counted_malloc(std::size_t size) noexcept
+{
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+    num_bytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+} // namespace
+
+// Replace the global allocation functions of the test binary to count the allocations
+void *operator new(std::size_t size)
+{
+    void *ptr = counted_malloc(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return counted_malloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return counted_malloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+AllocationScope::AllocationScope()
+    : _start_allocations(num_allocations.load(std::memory_order_relaxed)),
+      _start_bytes(num_bytes.load(std::memory_order_relaxed))
+{
+}
+
+uint64_t AllocationScope::allocations() const
+{
+    return num_allocations.load(std::memory_order_relaxed) - _start_allocations;
+}
+
+uint64_t AllocationScope::bytes() const
+{
+    return num_bytes.load(std::memory_order_relaxed) - _start_bytes;
+}
+
+AllocationCounter::AllocationCounter(ScaleFactor scale_factor)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(scale_factor != ScaleFactor::NONE, "Invalid scale");
+    ARM_COMPUTE_UNUSED(scale_factor);
+}
+
+std::string AllocationCounter::id() const
+{
+    return "AllocationCounter";
+}
+
+void AllocationCounter::start()
+{
+    _start_allocations = num_allocations.load(std::memory_order_relaxed);
+    _start_bytes       = num_bytes.load(std::memory_order_relaxed);
+}
+
+void AllocationCounter::stop()
+{
+    _allocations = num_allocations.load(std::memory_order_relaxed) - _start_allocations;
+    _bytes       = num_bytes.load(std::memory_order_relaxed) - _start_bytes;
+}
+
+Instrument::MeasurementsMap AllocationCounter::measurements() const
+{
+    MeasurementsMap measurements;
+    measurements.emplace("Allocations", Measurement(_allocations, ""));
+    measurements.emplace("Allocated bytes", Measurement(_bytes, "B"));
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_FRAMEWORK_INSTRUMENTS_ALLOCATIONCOUNTER_H
+#define ACL_TESTS_FRAMEWORK_INSTRUMENTS_ALLOCATIONCOUNTER_H
+
+#include "Instrument.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Counter of the heap allocations made by any thread of the test binary
+ *
+ * The global operator new of the test binary is replaced to count every allocation. Counting starts when the object
+ * is created.
+ */
+class AllocationScope
+{
+public:
+    /** Start counting */
+    AllocationScope();
+    /** Number of allocations made since the scope was created
+     *
+     * @return Number of allocations
+     */
+    uint64_t allocations() const;
+    /** Number of bytes allocated since the scope was created
+     *
+     * @return Number of bytes
+     */
+    uint64_t bytes() const;
+
+private:
+    uint64_t _start_allocations;
+    uint64_t _start_bytes;
+};
+
+/** Instrument reporting the heap allocations made during each run of a test.
+ *
+ * Functions are expected not to allocate any memory once they have run once, so any allocation reported after the
+ * warm-up iteration is a regression.
+ */
+class AllocationCounter : public Instrument
+{
+public:
+    /** Construct an allocation counter.
+     *
+     * @param[in] scale_factor Measurement scale factor.
+     */
+    AllocationCounter(ScaleFactor scale_factor);
+
+    std::string     id() const override;
+    void            start() override;
+    void            stop() override;
+    MeasurementsMap measurements() const override;
+
+private:
+    uint64_t _allocations{0};
+    uint64_t _bytes{0};
+    uint64_t _start_allocations{0};
+    uint64_t _start_bytes{0};
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_FRAMEWORK_INSTRUMENTS_ALLOCATIONCOUNTER_H
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GraphNodeTimer.h"
+
+#include "arm_compute/core/Error.h"
+#ifdef ARM_COMPUTE_GRAPH_ENABLED
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Tensor.h"
+#endif /* ARM_COMPUTE_GRAPH_ENABLED */
+
+#include "support/StringSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+using Microseconds = std::chrono::duration<double, std::micro>;
+} // namespace
+
+GraphNodeTimer::GraphNodeTimer(ScaleFactor scale_factor)
+{
+    switch (scale_factor)
+    {
+        case ScaleFactor::NONE:
+            _scale_factor = 1.f;
+            _unit         = "us";
+            break;
+        case ScaleFactor::TIME_MS:
+            _scale_factor = 1000.f;
+            _unit         = "ms";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Invalid scale");
+    }
+}
+
+std::string GraphNodeTimer::id() const
+{
+    return "Graph node timer";
+}
+
+#ifdef ARM_COMPUTE_GRAPH_ENABLED
+void GraphNodeTimer::record_task(graph::ExecutionTask &task)
+{
+    ARM_COMPUTE_ERROR_ON(task.node == nullptr);
+
+    // The first time a node is executed again marks the end of the first complete run of the graph
+    if (!_recorded_nodes.insert(task.node).second)
+    {
+        _recording = false;
+        return;
+    }
+
+    // Handles of the graph inputs, outputs and constants live for the whole execution: they are not transitions
+    if (_const_handles.empty() && task.node->graph() != nullptr)
+    {
+        for (const auto &node : task.node->graph()->nodes())
+        {
+            if (node == nullptr || (node->type() != graph::NodeType::Input && node->type() != graph::NodeType::Output &&
+                                    node->type() != graph::NodeType::Const))
+            {
+                continue;
+            }
+            for (unsigned int i = 0; i < node->num_inputs(); ++i)
+            {
+                if (node->input(i) != nullptr && node->input(i)->handle() != nullptr)
+                {
+                    _const_handles.insert(node->input(i)->handle()->parent_handle());
+                }
+            }
+            for (unsigned int i = 0; i < node->num_outputs(); ++i)
+            {
+                if (node->output(i) != nullptr && node->output(i)->handle() != nullptr)
+                {
+                    _const_handles.insert(node->output(i)->handle()->parent_handle());
+                }
+            }
+        }
+    }
+
+    // Sub-tensors are accounted for through the handle owning their memory
+    auto transition_handle = [&](graph::Tensor *tensor) -> graph::ITensorHandle *
+    {
+        if (tensor == nullptr || tensor->handle() == nullptr)
+        {
+            return nullptr;
+        }
+        graph::ITensorHandle *handle = tensor->handle()->parent_handle();
+        if (_const_handles.count(handle) != 0)
+        {
+            return nullptr;
+        }
+        _handle_sizes[handle] = handle->tensor().info()->total_size();
+        return handle;
+    };
+
+    TaskHandles handles;
+    for (unsigned int i = 0; i < task.node->num_inputs(); ++i)
+    {
+        if (auto handle = transition_handle(task.node->input(i)))
+        {
+            handles.inputs.push_back(handle);
+        }
+    }
+    for (unsigned int i = 0; i < task.node->num_outputs(); ++i)
+    {
+        if (auto handle = transition_handle(task.node->output(i)))
+        {
+            handles.outputs.push_back(handle);
+        }
+    }
+    _tasks.emplace_back(std::move(handles));
+}
+#endif /* ARM_COMPUTE_GRAPH_ENABLED */
+
+void GraphNodeTimer::test_start()
+{
+    _node_times.clear();
+    _tasks.clear();
+    _handle_sizes.clear();
+    _const_handles.clear();
+    _recorded_nodes.clear();
+    _recording    = true;
+    _prepare_time = 0.0;
+    _total_time   = 0.0;
+    _num_runs     = 0;
+
+#ifdef ARM_COMPUTE_GRAPH_ENABLED
+    _real_execute_function = graph::TaskExecutor::get().execute_function;
+    _real_prepare_function = graph::TaskExecutor::get().prepare_function;
+
+    graph::TaskExecutor::get().prepare_function = [this](graph::ExecutionTask &task)
+    {
+        const auto start = Clock::now();
+        _real_prepare_function(task);
+        _prepare_time += std::chrono::duration_cast<Microseconds>(Clock::now() - start).count();
+    };
+
+    graph::TaskExecutor::get().execute_function = [this](graph::ExecutionTask &task)
+    {
+        if (_recording)
+        {
+            record_task(task);
+        }
+
+        const auto start = Clock::now();
+        _real_execute_function(task);
+        const double elapsed = std::chrono::duration_cast<Microseconds>(Clock::now() - start).count();
+
+        std::string name = task.node->name();
+        if (name.empty())
+        {
+            name = "node #" + support::cpp11::to_string(task.node->id());
+        }
+        _node_times[name] += elapsed;
+    };
+#endif /* ARM_COMPUTE_GRAPH_ENABLED */
+}
+
+void GraphNodeTimer::start()
+{
+    _node_times.clear();
+    _start = Clock::now();
+}
+
+void GraphNodeTimer::stop()
+{
+    _stop = Clock::now();
+    _total_time += std::chrono::duration_cast<Microseconds>(_stop - _start).count();
+    ++_num_runs;
+}
+
+void GraphNodeTimer::test_stop()
+{
+    _recording = false;
+#ifdef ARM_COMPUTE_GRAPH_ENABLED
+    graph::TaskExecutor::get().execute_function = _real_execute_function;
+    graph::TaskExecutor::get().prepare_function = _real_prepare_function;
+    _real_execute_function                      = nullptr;
+    _real_prepare_function                      = nullptr;
+#endif /* ARM_COMPUTE_GRAPH_ENABLED */
+}
+
+Instrument::MeasurementsMap GraphNodeTimer::measurements() const
+{
+    MeasurementsMap measurements;
+
+    const double network_time = std::chrono::duration_cast<Microseconds>(_stop - _start).count();
+    measurements.emplace("Network time", Measurement(network_time / _scale_factor, _unit));
+
+    for (const auto &node : _node_times)
+    {
+        measurements.emplace("Node/" + node.first, Measurement(node.second / _scale_factor, _unit));
+    }
+    return measurements;
+}
+
+Instrument::MeasurementsMap GraphNodeTimer::test_measurements() const
+{
+    MeasurementsMap measurements;
+
+    measurements.emplace("Prepare time", Measurement(_prepare_time / _scale_factor, _unit));
+
+    if (_num_runs != 0 && _total_time > 0.0)
+    {
+        measurements.emplace("Throughput", Measurement(_num_runs * 1000000.0 / _total_time, "inferences/s"));
+    }
+
+    // Replay the recorded execution order: a transition is alive from the task producing it
+    // until the last task consuming it, the same lifetime the cross-layer memory manager uses.
+    std::map<const graph::ITensorHandle *, unsigned int> remaining_uses;
+    for (const auto &task : _tasks)
+    {
+        for (const auto handle : task.inputs)
+        {
+            ++remaining_uses[handle];
+        }
+    }
+
+    std::set<const graph::ITensorHandle *> in_flight;
+    uint64_t                               live_bytes = 0;
+    uint64_t                               peak_bytes = 0;
+    for (const auto &task : _tasks)
+    {
+        for (const auto handle : task.outputs)
+        {
+            if (in_flight.insert(handle).second)
+            {
+                live_bytes += _handle_sizes.at(handle);
+            }
+        }
+        peak_bytes = std::max(peak_bytes, live_bytes);
+
+        for (const auto handle : task.inputs)
+        {
+            if (--remaining_uses[handle] == 0 && in_flight.erase(handle) != 0)
+            {
+                live_bytes -= _handle_sizes.at(handle);
+            }
+        }
+    }
+    measurements.emplace("Peak transition memory", Measurement(peak_bytes, "bytes"));
+
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
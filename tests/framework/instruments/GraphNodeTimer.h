@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_FRAMEWORK_INSTRUMENTS_GRAPHNODETIMER_H
+#define ACL_TESTS_FRAMEWORK_INSTRUMENTS_GRAPHNODETIMER_H
+
+#include "arm_compute/graph/Workload.h"
+
+#include "Instrument.h"
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Instrument breaking down the execution of a whole graph per node.
+ *
+ * Intercepts the graph task executor to time the preparation and the execution of each node.
+ * Every measured run reports the time spent in each node next to the network time, while the test
+ * measurements summarise the one-off prepare time, the sustained throughput and the peak amount of
+ * transition memory (Tensors linking two nodes) alive at any point of the execution order.
+ */
+class GraphNodeTimer : public Instrument
+{
+public:
+    /** Construct a graph node timer.
+     *
+     * @param[in] scale_factor Measurement scale factor.
+     */
+    GraphNodeTimer(ScaleFactor scale_factor);
+    /** Prevent instances of this class from being copy constructed */
+    GraphNodeTimer(const GraphNodeTimer &) = delete;
+    /** Prevent instances of this class from being copied */
+    GraphNodeTimer &operator=(const GraphNodeTimer &) = delete;
+    /** Use the default move assignment operator */
+    GraphNodeTimer &operator=(GraphNodeTimer &&) = default;
+    /** Use the default move constructor */
+    GraphNodeTimer(GraphNodeTimer &&) = default;
+    /** Use the default destructor */
+    ~GraphNodeTimer() = default;
+
+    // Inherited overridden methods
+    std::string     id() const override;
+    void            test_start() override;
+    void            start() override;
+    void            stop() override;
+    void            test_stop() override;
+    MeasurementsMap measurements() const override;
+    MeasurementsMap test_measurements() const override;
+
+private:
+    /** Transition handles read and written by one task, in execution order */
+    struct TaskHandles
+    {
+        std::vector<const graph::ITensorHandle *> inputs{};  /**< Parent handles of the transition inputs */
+        std::vector<const graph::ITensorHandle *> outputs{}; /**< Parent handles of the transition outputs */
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+#ifdef ARM_COMPUTE_GRAPH_ENABLED
+    void record_task(graph::ExecutionTask &task);
+
+    std::function<decltype(graph::execute_task)> _real_execute_function{};
+    std::function<decltype(graph::prepare_task)> _real_prepare_function{};
+#endif /* ARM_COMPUTE_GRAPH_ENABLED */
+    std::map<std::string, double>                   _node_times{};
+    std::vector<TaskHandles>                        _tasks{};
+    std::map<const graph::ITensorHandle *, size_t>  _handle_sizes{};
+    std::set<const graph::ITensorHandle *>          _const_handles{};
+    std::set<const graph::INode *>                  _recorded_nodes{};
+    bool                                            _recording{false};
+    Clock::time_point                               _start{};
+    Clock::time_point                               _stop{};
+    double                                          _prepare_time{0.0};
+    double                                          _total_time{0.0};
+    unsigned int                                    _num_runs{0};
+    float                                           _scale_factor{1.f};
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_FRAMEWORK_INSTRUMENTS_GRAPHNODETIMER_H
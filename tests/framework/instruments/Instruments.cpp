@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018, 2025 Arm Limited.
+ * Copyright (c) 2017-2018, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,6 +62,13 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
          std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_TIMER, ScaleFactor::TIME_MS)},
         {"scheduler_timer_s",
          std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_TIMER, ScaleFactor::TIME_S)},
+        {"throughput", std::pair<InstrumentType, ScaleFactor>(InstrumentType::THROUGHPUT, ScaleFactor::NONE)},
+        {"allocation_counter",
+         std::pair<InstrumentType, ScaleFactor>(InstrumentType::ALLOCATION_COUNTER, ScaleFactor::NONE)},
+        {"graph_node_timer",
+         std::pair<InstrumentType, ScaleFactor>(InstrumentType::GRAPH_NODE_TIMER, ScaleFactor::NONE)},
+        {"graph_node_timer_ms",
+         std::pair<InstrumentType, ScaleFactor>(InstrumentType::GRAPH_NODE_TIMER, ScaleFactor::TIME_MS)},
         {"pmu", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::NONE)},
         {"pmu_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1K)},
         {"pmu_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M)},
@@ -100,6 +107,15 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
         throw std::invalid_argument(name);
     }
 }
+
+void set_test_workload(uint64_t flops, uint64_t bytes)
+{
+    if (instruments_info != nullptr)
+    {
+        instruments_info->_workload_flops = flops;
+        instruments_info->_workload_bytes = bytes;
+    }
+}
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
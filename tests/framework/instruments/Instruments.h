@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,8 +30,12 @@
 #include "OpenCLTimer.h"
 #include "PMUCounter.h"
 #endif /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+#include "AllocationCounter.h"
+#include "GraphNodeTimer.h"
 #include "SchedulerTimer.h"
+#include "Throughput.h"
 #include "WallClockTimer.h"
+#include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -57,14 +61,28 @@ enum class InstrumentType : unsigned int
     WALL_CLOCK_TIMESTAMPS   = 0x0700,
     OPENCL_TIMESTAMPS       = 0x0800,
     SCHEDULER_TIMESTAMPS    = 0x0900,
+    THROUGHPUT              = 0x0A00,
+    GRAPH_NODE_TIMER        = 0x0B00,
+    ALLOCATION_COUNTER      = 0x0C00,
 };
 
 struct InstrumentsInfo
 {
     std::vector<ISchedulerUser *> _scheduler_users{};
+    uint64_t                      _workload_flops{0}; /**< Arithmetic operations done by one run of the current test */
+    uint64_t                      _workload_bytes{0}; /**< Bytes read and written by one run of the current test */
 };
 extern std::unique_ptr<InstrumentsInfo> instruments_info;
 
+/** Declare the amount of work done by one run of the current test.
+ *
+ * Used by the throughput instrument to report GFLOP/s and GB/s.
+ *
+ * @param[in] flops Number of arithmetic operations, 0 if not meaningful for the test.
+ * @param[in] bytes Number of bytes read and written, 0 if not meaningful for the test.
+ */
+void set_test_workload(uint64_t flops, uint64_t bytes);
+
 using InstrumentsDescription = std::pair<InstrumentType, ScaleFactor>;
 
 InstrumentsDescription instrument_type_from_name(const std::string &name);
@@ -237,6 +255,25 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentsD
                     throw std::invalid_argument("Unsupported instrument scale");
             }
             break;
+        case InstrumentType::THROUGHPUT:
+            stream << "THROUGHPUT";
+            break;
+        case InstrumentType::GRAPH_NODE_TIMER:
+            switch (instrument.second)
+            {
+                case ScaleFactor::NONE:
+                    stream << "GRAPH_NODE_TIMER";
+                    break;
+                case ScaleFactor::TIME_MS:
+                    stream << "GRAPH_NODE_TIMER_MS";
+                    break;
+                default:
+                    throw std::invalid_argument("Unsupported instrument scale");
+            }
+            break;
+        case InstrumentType::ALLOCATION_COUNTER:
+            stream << "ALLOCATION_COUNTER";
+            break;
         case InstrumentType::ALL:
             stream << "ALL";
             break;
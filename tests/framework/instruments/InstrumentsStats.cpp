@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025 Arm Limited.
+ * Copyright (c) 2018, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,14 +35,20 @@ InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
     : _min(nullptr),
       _max(nullptr),
       _median(nullptr),
+      _p90(nullptr),
+      _p99(nullptr),
       _mean(measurements.begin()->value().is_floating_point),
       _stddev(0.0)
 {
     auto add_measurements = [](Measurement::Value a, const Measurement &b) { return a + b.value(); };
+    // Nearest rank: smallest measurement such that at least p percent of the measurements are lower or equal
+    auto percentile_index = [&](size_t p) { return std::max<size_t>((p * measurements.size() + 99) / 100, 1) - 1; };
 
-    //Calculate min, max & median values
+    //Calculate min, max, median & tail values
     auto indices = arm_compute::utility::sort_indices(measurements);
     _median      = &measurements[indices[measurements.size() / 2]];
+    _p90         = &measurements[indices[percentile_index(90)]];
+    _p99         = &measurements[indices[percentile_index(99)]];
     _min         = &measurements[indices[0]];
     _max         = &measurements[indices[measurements.size() - 1]];
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025 Arm Limited.
+ * Copyright (c) 2018, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,6 +61,18 @@ public:
     {
         return *_median;
     }
+    /** The 90th percentile measurement (Nearest rank)
+             */
+    const Measurement &p90() const
+    {
+        return *_p90;
+    }
+    /** The 99th percentile measurement (Nearest rank)
+             */
+    const Measurement &p99() const
+    {
+        return *_p99;
+    }
     /** The average of all the measurements
              */
     const Measurement::Value &mean() const
@@ -78,6 +90,8 @@ private:
     const Measurement *_min;
     const Measurement *_max;
     const Measurement *_median;
+    const Measurement *_p90;
+    const Measurement *_p99;
     Measurement::Value _mean;
     double             _stddev;
 };
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Throughput.h"
+
+#include "Instruments.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+Throughput::Throughput(ScaleFactor scale_factor)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(scale_factor != ScaleFactor::NONE, "Invalid scale");
+    ARM_COMPUTE_UNUSED(scale_factor);
+    _unit = "us";
+}
+
+std::string Throughput::id() const
+{
+    return "Throughput";
+}
+
+void Throughput::test_start()
+{
+    // Forget the workload of the previous test: tests that don't declare one only report the time
+    set_test_workload(0, 0);
+}
+
+void Throughput::start()
+{
+    // The workload is declared during the test setup, which happens before the first measurement
+    if (instruments_info != nullptr)
+    {
+        _flops = instruments_info->_workload_flops;
+        _bytes = instruments_info->_workload_bytes;
+    }
+    _start = std::chrono::steady_clock::now();
+}
+
+void Throughput::stop()
+{
+    _stop = std::chrono::steady_clock::now();
+}
+
+Instrument::MeasurementsMap Throughput::measurements() const
+{
+    MeasurementsMap measurements;
+
+    const double delta_us = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(_stop - _start).count();
+    measurements.emplace("Time", Measurement(delta_us, _unit));
+
+    if (delta_us > 0.0)
+    {
+        // Work per microsecond * 1e6 / 1e9 = work per nanosecond
+        if (_flops != 0)
+        {
+            measurements.emplace("GFLOP/s", Measurement(static_cast<double>(_flops) / (delta_us * 1000.0), "GFLOP/s"));
+        }
+        if (_bytes != 0)
+        {
+            measurements.emplace("GB/s", Measurement(static_cast<double>(_bytes) / (delta_us * 1000.0), "GB/s"));
+        }
+    }
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
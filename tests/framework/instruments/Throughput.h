@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_FRAMEWORK_INSTRUMENTS_THROUGHPUT_H
+#define ACL_TESTS_FRAMEWORK_INSTRUMENTS_THROUGHPUT_H
+
+#include "Instrument.h"
+#include <chrono>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Instrument reporting the arithmetic and memory throughput of a test.
+ *
+ * The amount of work done by one run is declared by the test through @ref set_test_workload.
+ * The instrument times each run and reports GFLOP/s and GB/s next to the elapsed time.
+ */
+class Throughput : public Instrument
+{
+public:
+    /** Construct a throughput instrument.
+     *
+     * @param[in] scale_factor Measurement scale factor.
+     */
+    Throughput(ScaleFactor scale_factor);
+
+    std::string     id() const override;
+    void            test_start() override;
+    void            start() override;
+    void            stop() override;
+    MeasurementsMap measurements() const override;
+
+private:
+    std::chrono::steady_clock::time_point _start{};
+    std::chrono::steady_clock::time_point _stop{};
+    uint64_t                              _flops{0};
+    uint64_t                              _bytes{0};
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_FRAMEWORK_INSTRUMENTS_THROUGHPUT_H
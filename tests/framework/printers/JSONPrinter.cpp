@@ -24,6 +24,7 @@
 #include "JSONPrinter.h"
 
 #include "../Framework.h"
+#include "../instruments/InstrumentsStats.h"
 #include "../instruments/Measurement.h"
 #include <algorithm>
 
@@ -214,6 +215,13 @@ void JSONPrinter::print_measurements(const Profiler::MeasurementsMap &measuremen
         };
         *_stream << R"("raw" : [)" << join(i_it->second.begin(), i_it->second.end(), ",", measurement_to_string)
                  << "],";
+
+        // Summary statistics so that runs can be compared without post-processing the raw values
+        const InstrumentsStats stats(i_it->second);
+        *_stream << R"("mean" : )" << stats.mean() << ",";
+        *_stream << R"("p50" : )" << stats.median().value() << ",";
+        *_stream << R"("p90" : )" << stats.p90().value() << ",";
+        *_stream << R"("p99" : )" << stats.p99().value() << ",";
         *_stream << R"("unit" : ")" << i_it->second.begin()->unit() << R"(")";
         *_stream << "}";
 
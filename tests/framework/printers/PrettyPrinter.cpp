@@ -142,6 +142,8 @@ void PrettyPrinter::print_measurements(const Profiler::MeasurementsMap &measurem
             *_stream << ", MIN=" << stats.min();
             *_stream << ", MAX=" << stats.max();
             *_stream << ", MEDIAN=" << stats.median().value() << " " << stats.median().unit();
+            *_stream << ", P90=" << stats.p90().value() << " " << stats.p90().unit();
+            *_stream << ", P99=" << stats.p99().value() << " " << stats.p99().unit();
         }
         *_stream << end_color() << "\n";
     }
@@ -270,6 +270,7 @@ int main(int argc, char **argv)
                     p->print_entry("CPU" + support::cpp11::to_string(j), cpuinfo::cpu_model_to_string(model));
                 }
                 p->print_entry("Iterations", support::cpp11::to_string(options.iterations->value()));
+                p->print_entry("Warmup", support::cpp11::to_string(options.warmup->value()));
                 p->print_entry("Threads", support::cpp11::to_string(threads->value()));
                 {
                     using support::cpp11::to_string;
@@ -285,17 +286,18 @@ int main(int argc, char **argv)
 
         // Initialize framework
         framework::FrameworkConfig fconfig;
-        fconfig.instruments      = options.instruments->value();
-        fconfig.name_filter      = filter->value();
-        fconfig.id_filter        = filter_id->value();
-        fconfig.num_iterations   = options.iterations->value();
-        fconfig.mode             = dataset_mode->value();
-        fconfig.log_level        = options.log_level->value();
-        fconfig.cooldown_sec     = cooldown_sec->value();
-        fconfig.configure_only   = configure_only->value();
-        fconfig.print_rerun_cmd  = print_rerun_command->value();
-        fconfig.seed             = seed_value;
-        fconfig.print_iterations = print_iterations_figures->value();
+        fconfig.instruments           = options.instruments->value();
+        fconfig.name_filter           = filter->value();
+        fconfig.id_filter             = filter_id->value();
+        fconfig.num_iterations        = options.iterations->value();
+        fconfig.num_warmup_iterations = options.warmup->value();
+        fconfig.mode                  = dataset_mode->value();
+        fconfig.log_level             = options.log_level->value();
+        fconfig.cooldown_sec          = cooldown_sec->value();
+        fconfig.configure_only        = configure_only->value();
+        fconfig.print_rerun_cmd       = print_rerun_command->value();
+        fconfig.seed                  = seed_value;
+        fconfig.print_iterations      = print_iterations_figures->value();
         framework.init(fconfig);
 
         for (auto &p : printers)
@@ -36,6 +36,9 @@
 #include "tests/validation/fixtures/DirectConvolution3DFixture.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -128,6 +131,46 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 // clang-format on
 // *INDENT-ON*
 
+TEST_CASE(SourceBufferChange, framework::DatasetMode::ALL)
+{
+    // The indirect GEMM keeps pointers into the source, so moving the source between runs must not change the output
+    const TensorShape src_shape(4U, 6U, 5U, 4U, 2U);
+    const TensorShape weights_shape(3U, 4U, 3U, 3U, 3U);
+    const Conv3dInfo  conv3d_info(Size3D(1U, 2U, 1U), Padding3D(1U, 1U, 1U), ActivationLayerInfo(), Size3D(1U, 1U, 1U),
+                                  DimensionRoundingType::FLOOR, false);
+
+    Tensor src     = create_tensor<Tensor>(src_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+    Tensor weights = create_tensor<Tensor>(weights_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+    Tensor biases  = create_tensor<Tensor>(TensorShape(3U), DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(TensorShape(), DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+
+    NEConv3D conv;
+    conv.configure(&src, &weights, &biases, &dst, conv3d_info);
+
+    std::vector<float> buffer0(src_shape.total_size());
+    std::vector<float> buffer1(src_shape.total_size());
+    ARM_COMPUTE_ASSERT(bool(src.allocator()->import_memory(buffer0.data())));
+    weights.allocator()->allocate();
+    biases.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(weights), 1, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(biases), 2, -1.f, 1.f);
+
+    conv.run();
+    const auto        *dst_ptr = reinterpret_cast<const float *>(dst.buffer());
+    const size_t       dst_num = dst.info()->tensor_shape().total_size();
+    std::vector<float> expected(dst_ptr, dst_ptr + dst_num);
+
+    // Move the source to a new buffer and clear the old one
+    buffer1 = buffer0;
+    std::fill(buffer0.begin(), buffer0.end(), 0.f);
+    ARM_COMPUTE_ASSERT(bool(src.allocator()->import_memory(buffer1.data())));
+
+    conv.run();
+    ARM_COMPUTE_EXPECT(std::equal(expected.begin(), expected.end(), dst_ptr), framework::LogLevel::ERRORS);
+}
+
 template <typename T>
 using NEDirectConvolution3DFixture = DirectConvolution3DValidationFixture<Tensor, Accessor, NEConv3D, T>;
 
@@ -49,6 +49,8 @@ RelativeTolerance<float> tolerance_fp32(0.001f);
 
 template <typename T>
 using NECropResizeFixture = CropResizeFixture<Tensor, Accessor, NECropResize, T>;
+template <typename T>
+using NECropResizeUpdatedBoxesFixture = CropResizeUpdatedBoxesFixture<Tensor, Accessor, NECropResize, T>;
 
 // *INDENT-OFF*
 // clang-format off
@@ -59,6 +61,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                        TensorInfo(TensorShape(15U, 30U, 40U, 10U), 1, DataType::S32), // Invalid output data type.
                                                        TensorInfo(TensorShape(15U, 30U, 40U, 10U), 1, DataType::S32), // Invalid output shape.
                                                        TensorInfo(TensorShape(15U, 30U, 40U, 10U), 1, DataType::S32), // Invalid boxes shape.
+                                                       TensorInfo(TensorShape(15U, 30U, 40U, 10U), 1, DataType::S32), // Invalid box_ind data type.
                                                      }),
                make("BoxesInfo",{  TensorInfo(TensorShape(4, 20), 1, DataType::F32),
                                                        TensorInfo(TensorShape(4, 20), 1, DataType::F32),
@@ -66,6 +69,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                        TensorInfo(TensorShape(4, 20), 1, DataType::F32),
                                                        TensorInfo(TensorShape(4, 20), 1, DataType::F32),
                                                        TensorInfo(TensorShape(3, 20), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(4, 20), 1, DataType::F32),
                                                      }),
                make("BoxIndInfo",{ TensorInfo(TensorShape(20), 1, DataType::S32),
                                                        TensorInfo(TensorShape(10), 1, DataType::S32),
@@ -73,6 +77,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                        TensorInfo(TensorShape(20), 1, DataType::S32),
                                                        TensorInfo(TensorShape(20), 1, DataType::S32),
                                                        TensorInfo(TensorShape(20), 1, DataType::S32),
+                                                       TensorInfo(TensorShape(20), 1, DataType::F32),
                                                      }),
                make("OutputInfo",{ TensorInfo(TensorShape(15U, 5, 5, 20U), 1, DataType::F32),
                                                        TensorInfo(TensorShape(15U, 5, 5, 20U), 1, DataType::F32),
@@ -80,8 +85,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                        TensorInfo(TensorShape(15U, 5, 5, 20U), 1, DataType::S32),
                                                        TensorInfo(TensorShape(5U, 5, 5, 20U), 1, DataType::F32),
                                                        TensorInfo(TensorShape(15U, 5, 5, 20U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(15U, 5, 5, 20U), 1, DataType::F32),
                                                      }),
-               make("Expected", { true, false, false, false, false, false})
+               make("Expected", { true, false, false, false, false, false, false})
                ),
                input, boxes, box_ind, output, expected)
 {
@@ -129,6 +135,16 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32, 0.01);
 }
+FIXTURE_DATA_TEST_CASE(RunUpdatedBoxes,
+                       NECropResizeUpdatedBoxesFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallCropResizeDataset(),
+                               make("IsOutOfBounds", {true, false}),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32, 0.01);
+}
 TEST_SUITE_END() // F32
 TEST_SUITE_END() // Float
 
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/DepthwiseSeparableConvolutionLayerFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.001f);      /**< Tolerance for floating point tests */
+const AbsoluteTolerance<half>      tolerance_fp16(half(0.05f)); /**< Tolerance for 16-bit floating point tests */
+constexpr AbsoluteTolerance<float> tolerance_quant(1);          /**< Tolerance for quantized tests */
+
+/** Shapes, in NCHW, with tiles that do not divide the output width */
+const auto SmallConfigurations =
+    combine(make("InputShape", {TensorShape(17U, 11U, 8U), TensorShape(9U, 7U, 19U, 2U)}),
+            make("KernelSize", {Size2D(3U, 3U), Size2D(5U, 5U)}),
+            make("PadStrideInfo",
+                 {PadStrideInfo(1, 1, 1, 1), PadStrideInfo(2, 2, 2, 1, 2, 1, DimensionRoundingType::FLOOR)}),
+            make("Dilation", {Size2D(1U, 1U), Size2D(2U, 2U)}),
+            make("OutputChannels", {16U}));
+
+const auto ActivationFunctionsDataset =
+    combine(make("DepthwiseActivationInfo",
+                 {ActivationLayerInfo(),
+                  ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)}),
+            make("PointwiseActivationInfo",
+                 {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)}));
+
+const auto NoQuantizationDataset = combine(make("InputQuantizationInfo", {QuantizationInfo()}),
+                                           make("WeightsQuantizationInfo", {QuantizationInfo()}),
+                                           make("DepthwiseOutputQuantizationInfo", {QuantizationInfo()}),
+                                           make("OutputQuantizationInfo", {QuantizationInfo()}));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(DepthwiseSeparableConvolutionLayer)
+
+TEST_CASE(Validate, framework::DatasetMode::ALL)
+{
+    const DepthwiseSeparableConv2dInfo info(PadStrideInfo(1, 1, 1, 1), Size2D(1U, 1U), ActivationLayerInfo(),
+                                            ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    auto make_info = [](const TensorShape &shape, DataType data_type, DataLayout data_layout = DataLayout::NHWC)
+    {
+        TensorInfo tensor_info(shape, 1, data_type);
+        tensor_info.set_data_layout(data_layout);
+        return tensor_info;
+    };
+
+    const TensorInfo src        = make_info(TensorShape(8U, 9U, 7U), DataType::F32);
+    const TensorInfo dw_weights = make_info(TensorShape(8U, 3U, 3U), DataType::F32);
+    const TensorInfo dw_biases  = make_info(TensorShape(8U), DataType::F32);
+    const TensorInfo pw_weights = make_info(TensorShape(8U, 1U, 1U, 16U), DataType::F32);
+    const TensorInfo pw_biases  = make_info(TensorShape(16U), DataType::F32);
+    const TensorInfo dst        = make_info(TensorShape(16U, 9U, 7U), DataType::F32);
+
+    // Valid configuration, with and without biases
+    ARM_COMPUTE_EXPECT(bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights, &dw_biases, &pw_weights,
+                                                                           &pw_biases, &dst, info)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights, nullptr, &pw_weights,
+                                                                           nullptr, &dst, info)),
+                       framework::LogLevel::ERRORS);
+
+    // NCHW is not supported
+    const TensorInfo src_nchw = make_info(TensorShape(8U, 9U, 7U), DataType::F32, DataLayout::NCHW);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(&src_nchw, &dw_weights, &dw_biases,
+                                                                            &pw_weights, &pw_biases, &dst, info)),
+                       framework::LogLevel::ERRORS);
+
+    // Depth multiplier other than 1
+    const TensorInfo dw_weights_mult = make_info(TensorShape(16U, 3U, 3U), DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights_mult, &dw_biases,
+                                                                            &pw_weights, &pw_biases, &dst, info)),
+                       framework::LogLevel::ERRORS);
+
+    // Pointwise weights that are not 1x1
+    const TensorInfo pw_weights_3x3 = make_info(TensorShape(8U, 3U, 3U, 16U), DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights, &dw_biases,
+                                                                            &pw_weights_3x3, &pw_biases, &dst, info)),
+                       framework::LogLevel::ERRORS);
+
+    // Mismatching data types
+    const TensorInfo dw_weights_f16 = make_info(TensorShape(8U, 3U, 3U), DataType::F16);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights_f16, &dw_biases,
+                                                                            &pw_weights, &pw_biases, &dst, info)),
+                       framework::LogLevel::ERRORS);
+
+    // Wrong output shape
+    const TensorInfo dst_wrong = make_info(TensorShape(15U, 9U, 7U), DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights, &dw_biases,
+                                                                            &pw_weights, &pw_biases, &dst_wrong, info)),
+                       framework::LogLevel::ERRORS);
+
+    // Activation that is not a clamp
+    DepthwiseSeparableConv2dInfo tanh_info = info;
+    tanh_info.pw_act_info                  = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(&src, &dw_weights, &dw_biases,
+                                                                            &pw_weights, &pw_biases, &dst, tanh_info)),
+                       framework::LogLevel::ERRORS);
+
+    // Quantized without the quantization of the depthwise output
+    const TensorInfo src_q        = make_info(TensorShape(8U, 9U, 7U), DataType::QASYMM8);
+    const TensorInfo dw_weights_q = make_info(TensorShape(8U, 3U, 3U), DataType::QASYMM8);
+    const TensorInfo dw_biases_q  = make_info(TensorShape(8U), DataType::S32);
+    const TensorInfo pw_weights_q = make_info(TensorShape(8U, 1U, 1U, 16U), DataType::QASYMM8);
+    const TensorInfo pw_biases_q  = make_info(TensorShape(16U), DataType::S32);
+    const TensorInfo dst_q        = make_info(TensorShape(16U, 9U, 7U), DataType::QASYMM8);
+    ARM_COMPUTE_EXPECT(!bool(NEDepthwiseSeparableConvolutionLayer::validate(
+                           &src_q, &dw_weights_q, &dw_biases_q, &pw_weights_q, &pw_biases_q, &dst_q, info)),
+                       framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEDepthwiseSeparableConvolutionLayerFixture =
+    DepthwiseSeparableConvolutionLayerValidationFixture<Tensor, Accessor, NEDepthwiseSeparableConvolutionLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDepthwiseSeparableConvolutionLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallConfigurations,
+                               ActivationFunctionsDataset,
+                               make("DataType", DataType::F32),
+                               NoQuantizationDataset))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDepthwiseSeparableConvolutionLayerFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallConfigurations,
+                               ActivationFunctionsDataset,
+                               make("DataType", DataType::F16),
+                               NoQuantizationDataset))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate outputs
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDepthwiseSeparableConvolutionLayerFixture<uint8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallConfigurations,
+                               ActivationFunctionsDataset,
+                               make("DataType", DataType::QASYMM8),
+                               make("InputQuantizationInfo", {QuantizationInfo(0.02f, 128)}),
+                               make("WeightsQuantizationInfo", {QuantizationInfo(0.01f, 120)}),
+                               make("DepthwiseOutputQuantizationInfo", {QuantizationInfo(0.05f, 128)}),
+                               make("OutputQuantizationInfo", {QuantizationInfo(0.1f, 128)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDepthwiseSeparableConvolutionLayerFixture<int8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallConfigurations,
+                               ActivationFunctionsDataset,
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("InputQuantizationInfo", {QuantizationInfo(0.02f, -10)}),
+                               make("WeightsQuantizationInfo", {QuantizationInfo(0.01f, 5)}),
+                               make("DepthwiseOutputQuantizationInfo", {QuantizationInfo(0.05f, 0)}),
+                               make("OutputQuantizationInfo", {QuantizationInfo(0.1f, -5)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // DepthwiseSeparableConvolutionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
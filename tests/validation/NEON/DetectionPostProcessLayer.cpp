@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPP/functions/CPPDetectionPostProcessLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDetectionPostProcessLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -34,6 +35,11 @@
 #include "tests/PaddingCalculator.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -167,6 +173,136 @@ inline void base_test_case(DetectionPostProcessLayerInfo info,
     // Validate num detections
     validate(Accessor(num_detection), expected_num_detection, tolerance_others);
 }
+/** Encoded boxes, class predictions and anchors of a detection problem */
+struct DetectionInputs
+{
+    unsigned int       num_boxes;
+    unsigned int       num_classes;
+    std::vector<float> box_encodings;
+    std::vector<float> class_predictions;
+    std::vector<float> anchors;
+};
+
+/** Detections of a detection post process function */
+struct DetectionOutputs
+{
+    Tensor boxes{};
+    Tensor classes{};
+    Tensor scores{};
+    Tensor num_detection{};
+};
+
+/** Generates random encodings and class predictions for anchors overlapping each other in the unit square */
+DetectionInputs random_inputs(unsigned int num_boxes, unsigned int num_classes, std::mt19937::result_type seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_real_distribution<float> encoding(-1.f, 1.f);
+    std::uniform_real_distribution<float> centre(0.f, 1.f);
+    std::uniform_real_distribution<float> size(0.05f, 0.3f);
+    std::uniform_real_distribution<float> score(0.01f, 1.f);
+
+    DetectionInputs inputs{num_boxes, num_classes, {}, {}, {}};
+    for (unsigned int b = 0; b < num_boxes; ++b)
+    {
+        inputs.box_encodings.insert(inputs.box_encodings.end(),
+                                    {encoding(gen), encoding(gen), encoding(gen), encoding(gen)});
+        // Anchors are in center-size format [y, x, h, w]
+        inputs.anchors.insert(inputs.anchors.end(), {centre(gen), centre(gen), size(gen), size(gen)});
+        // The first class is the background one
+        for (unsigned int c = 0; c <= num_classes; ++c)
+        {
+            inputs.class_predictions.push_back(score(gen));
+        }
+    }
+    return inputs;
+}
+
+/** Repeats each box once for each of its best classes, keeping only the score of that class in each copy
+ *
+ * Fast NMS keeping one class per detection on the repeated boxes is expected to give the same detections as fast NMS
+ * keeping @p num_classes_per_box classes per detection on the original boxes.
+ */
+DetectionInputs repeat_best_classes(const DetectionInputs &inputs, unsigned int num_classes_per_box)
+{
+    const unsigned int num_scores = inputs.num_classes + 1;
+
+    DetectionInputs           repeated{inputs.num_boxes * num_classes_per_box, inputs.num_classes, {}, {}, {}};
+    std::vector<unsigned int> classes(inputs.num_classes);
+    for (unsigned int b = 0; b < inputs.num_boxes; ++b)
+    {
+        const float *scores = inputs.class_predictions.data() + b * num_scores + 1;
+        std::iota(classes.begin(), classes.end(), 0);
+        std::partial_sort(classes.data(), classes.data() + num_classes_per_box, classes.data() + inputs.num_classes,
+                          [&](unsigned int first, unsigned int second) { return scores[first] > scores[second]; });
+
+        for (unsigned int i = 0; i < num_classes_per_box; ++i)
+        {
+            repeated.box_encodings.insert(repeated.box_encodings.end(), inputs.box_encodings.begin() + 4 * b,
+                                          inputs.box_encodings.begin() + 4 * (b + 1));
+            repeated.anchors.insert(repeated.anchors.end(), inputs.anchors.begin() + 4 * b,
+                                    inputs.anchors.begin() + 4 * (b + 1));
+
+            std::vector<float> box_scores(num_scores, 0.f);
+            box_scores[classes[i] + 1] = scores[classes[i]];
+            repeated.class_predictions.insert(repeated.class_predictions.end(), box_scores.begin(), box_scores.end());
+        }
+    }
+    return repeated;
+}
+
+/** Runs a detection post process function on F32 inputs */
+template <typename FunctionType>
+void run_detection(const DetectionInputs &inputs, const DetectionPostProcessLayerInfo &info, DetectionOutputs &outputs)
+{
+    Tensor box_encoding = create_tensor<Tensor>(TensorShape(4U, inputs.num_boxes, 1U), DataType::F32);
+    Tensor class_prediction =
+        create_tensor<Tensor>(TensorShape(inputs.num_classes + 1, inputs.num_boxes, 1U), DataType::F32);
+    Tensor anchors = create_tensor<Tensor>(TensorShape(4U, inputs.num_boxes), DataType::F32);
+
+    FunctionType detection;
+    detection.configure(&box_encoding, &class_prediction, &anchors, &outputs.boxes, &outputs.classes, &outputs.scores,
+                        &outputs.num_detection, info);
+
+    box_encoding.allocator()->allocate();
+    class_prediction.allocator()->allocate();
+    anchors.allocator()->allocate();
+    outputs.boxes.allocator()->allocate();
+    outputs.classes.allocator()->allocate();
+    outputs.scores.allocator()->allocate();
+    outputs.num_detection.allocator()->allocate();
+
+    fill_tensor(Accessor(box_encoding), inputs.box_encodings);
+    fill_tensor(Accessor(class_prediction), inputs.class_predictions);
+    fill_tensor(Accessor(anchors), inputs.anchors);
+
+    detection.run();
+}
+
+/** Checks that the first elements of two tensors are the same */
+void validate_elements(const Tensor &tensor, const Tensor &reference, size_t num_elements)
+{
+    const auto tensor_ptr    = reinterpret_cast<const float *>(tensor.buffer());
+    const auto reference_ptr = reinterpret_cast<const float *>(reference.buffer());
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(tensor_ptr[i], reference_ptr[i], framework::LogLevel::ERRORS);
+    }
+}
+
+/** Checks that two functions kept the same detections, in the same order */
+void validate_detections(const DetectionOutputs &outputs,
+                         const DetectionOutputs &reference,
+                         unsigned int            max_detections)
+{
+    const float num_detection = *reinterpret_cast<const float *>(reference.num_detection.buffer());
+
+    // Make sure that the comparison is not trivial
+    ARM_COMPUTE_EXPECT(num_detection > 1.f, framework::LogLevel::ERRORS);
+    validate_elements(outputs.num_detection, reference.num_detection, 1);
+    validate_elements(outputs.boxes, reference.boxes, 4 * max_detections);
+    validate_elements(outputs.classes, reference.classes, max_detections);
+    validate_elements(outputs.scores, reference.scores, max_detections);
+}
 } // namespace
 
 TEST_SUITE(NEON)
@@ -390,6 +526,69 @@ TEST_CASE(Quantized_regular, framework::DatasetMode::ALL)
 
 TEST_SUITE_END() // QASYMM8
 
+// Hundreds of boxes over several classes, compared against CPPDetectionPostProcessLayer
+TEST_SUITE(Random)
+const auto random_dataset = combine(make("NumBoxes", {301U, 517U}), make("NumClasses", {3U, 7U}));
+
+DATA_TEST_CASE(Regular, framework::DatasetMode::ALL, random_dataset, num_boxes, num_classes)
+{
+    const DetectionPostProcessLayerInfo info(300 /*max_detections*/, 1 /*max_classes_per_detection*/,
+                                             0.3f /*nms_score_threshold*/, 0.3f /*nms_iou_threshold*/, num_classes,
+                                             {10.f, 10.f, 5.f, 5.f} /*scale*/, true /*use_regular_nms*/,
+                                             100 /*detections_per_class*/);
+    const DetectionInputs               inputs = random_inputs(num_boxes, num_classes, num_boxes + num_classes);
+
+    DetectionOutputs outputs;
+    DetectionOutputs reference;
+    run_detection<NEDetectionPostProcessLayer>(inputs, info, outputs);
+    run_detection<CPPDetectionPostProcessLayer>(inputs, info, reference);
+
+    validate_detections(outputs, reference, info.max_detections());
+}
+
+DATA_TEST_CASE(Fast, framework::DatasetMode::ALL, random_dataset, num_boxes, num_classes)
+{
+    const DetectionPostProcessLayerInfo info(300 /*max_detections*/, 1 /*max_classes_per_detection*/,
+                                             0.3f /*nms_score_threshold*/, 0.3f /*nms_iou_threshold*/, num_classes,
+                                             {10.f, 10.f, 5.f, 5.f} /*scale*/);
+    const DetectionInputs               inputs = random_inputs(num_boxes, num_classes, num_boxes + num_classes);
+
+    DetectionOutputs outputs;
+    DetectionOutputs reference;
+    run_detection<NEDetectionPostProcessLayer>(inputs, info, outputs);
+    run_detection<CPPDetectionPostProcessLayer>(inputs, info, reference);
+
+    validate_detections(outputs, reference, info.max_detections());
+}
+
+// Each candidate is suppressed against the box it was scored for, which CPPDetectionPostProcessLayer doesn't do
+// when more than one class is kept per detection. The reference keeps a single class per detection of the boxes
+// repeated for each of their best classes instead.
+DATA_TEST_CASE(FastMultipleClassesPerDetection,
+               framework::DatasetMode::ALL,
+               combine(random_dataset, make("MaxClassesPerDetection", {2U, 3U})),
+               num_boxes,
+               num_classes,
+               max_classes_per_detection)
+{
+    const DetectionPostProcessLayerInfo info(300 /*max_detections*/, max_classes_per_detection,
+                                             0.3f /*nms_score_threshold*/, 0.3f /*nms_iou_threshold*/, num_classes,
+                                             {10.f, 10.f, 5.f, 5.f} /*scale*/);
+    const DetectionPostProcessLayerInfo reference_info(300 /*max_detections*/, 1 /*max_classes_per_detection*/,
+                                                       0.3f /*nms_score_threshold*/, 0.3f /*nms_iou_threshold*/,
+                                                       num_classes, {10.f, 10.f, 5.f, 5.f} /*scale*/);
+    const DetectionInputs               inputs = random_inputs(num_boxes, num_classes, num_boxes + num_classes);
+
+    DetectionOutputs outputs;
+    DetectionOutputs reference;
+    run_detection<NEDetectionPostProcessLayer>(inputs, info, outputs);
+    run_detection<CPPDetectionPostProcessLayer>(repeat_best_classes(inputs, max_classes_per_detection), reference_info,
+                                                reference);
+
+    validate_detections(outputs, reference, info.max_detections());
+}
+TEST_SUITE_END() // Random
+
 TEST_SUITE_END() // DetectionPostProcessLayer
 TEST_SUITE_END() // Neon
 } // namespace validation
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEElementwiseFusion.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/ElementwiseFusionFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.001f);     /**< Tolerance for floating point tests */
+const AbsoluteTolerance<half>      tolerance_fp16(half(0.1f)); /**< Tolerance for 16-bit floating point tests */
+constexpr AbsoluteTolerance<float> tolerance_quant(1);         /**< Tolerance for quantized tests */
+constexpr AbsoluteTolerance<float> tolerance_cast(0.101f);     /**< Tolerance for cast tests, one quantization step */
+
+const auto ActivationFunctionsDataset =
+    make("ActivationInfo",
+         {ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::IDENTITY),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 3.f, -2.f),
+          ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC)});
+
+const auto NoQuantizationDataset = combine(make("QuantizationInfo", {QuantizationInfo()}),
+                                           make("OutputQuantizationInfo", {QuantizationInfo()}));
+
+/** Function to compute dst = relu(a + b) */
+ElementwiseFusionInfo add_relu_program()
+{
+    ElementwiseFusionInfo info(2);
+    const int sum = info.add_binary(ElementwiseFusionOp::ADD, info.input(0), info.input(1));
+    info.add_activation(sum, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    return info;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ElementwiseFusion)
+
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+        make("Input1Info", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),      // Mismatching data types
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),      // Shapes not broadcast compatible
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::S32),      // Unsupported data type
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::QASYMM8),  // Unsupported output data type
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),      // Wrong output shape
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),      // Unsupported quantized output
+                           }),
+        make("Input2Info", { TensorInfo(TensorShape(1U, 13U, 2U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F16),
+                             TensorInfo(TensorShape(26U, 13U, 2U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::S32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::QASYMM8),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                           }),
+        make("OutputInfo", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::QASYMM8),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::S32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::QASYMM8_SIGNED),
+                             TensorInfo(TensorShape(27U, 13U, 1U), 1, DataType::F32),
+                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::QASYMM16),
+                           }),
+        make("Expected", { true, false, false, false, false, false, false })),
+        input1_info, input2_info, output_info, expected)
+{
+    const Status status = NEElementwiseFusion::validate({&input1_info.clone()->set_is_resizable(false),
+                                                         &input2_info.clone()->set_is_resizable(false)},
+                                                        &output_info.clone()->set_is_resizable(false),
+                                                        add_relu_program());
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+
+TEST_CASE(InvalidProgram, framework::DatasetMode::ALL)
+{
+    const TensorInfo src(TensorShape(16U, 4U), 1, DataType::F32);
+    const TensorInfo dst(TensorShape(16U, 4U), 1, DataType::F32);
+
+    // Forward reference to a value that has not been computed yet
+    ElementwiseFusionInfo forward_ref(2);
+    forward_ref.add_binary(ElementwiseFusionOp::ADD, 0, 3);
+    forward_ref.add_unary(ElementwiseFusionOp::ABS, 2);
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseFusion::validate({&src, &src}, &dst, forward_ref)),
+                       framework::LogLevel::ERRORS);
+
+    // Number of sources not matching the program
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseFusion::validate({&src}, &dst, add_relu_program())),
+                       framework::LogLevel::ERRORS);
+
+    // Too many values
+    ElementwiseFusionInfo too_long(1);
+    int                   value = too_long.input(0);
+    for (unsigned int i = 0; i < ElementwiseFusionInfo::max_values; ++i)
+    {
+        value = too_long.add_unary(ElementwiseFusionOp::NEG, value);
+    }
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseFusion::validate({&src}, &dst, too_long)), framework::LogLevel::ERRORS);
+
+    // Conversion to an unsupported data type
+    ElementwiseFusionInfo bad_cast(1);
+    bad_cast.add_cast(bad_cast.input(0), DataType::S32);
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseFusion::validate({&src}, &dst, bad_cast)), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEElementwiseFusionFixture = ElementwiseFusionValidationFixture<Tensor, Accessor, NEElementwiseFusion, T, T>;
+template <typename T>
+using NEElementwiseFusionFloatOutputFixture =
+    ElementwiseFusionValidationFixture<Tensor, Accessor, NEElementwiseFusion, T, float>;
+using NEElementwiseFusionQuantizedOutputFixture =
+    ElementwiseFusionValidationFixture<Tensor, Accessor, NEElementwiseFusion, float, uint8_t>;
+using NEElementwiseFusionCastFixture = ElementwiseFusionCastValidationFixture<Tensor, Accessor, NEElementwiseFusion>;
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEElementwiseFusionFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("DataType", DataType::F32),
+                               make("OutputDataType", DataType::F32),
+                               ActivationFunctionsDataset,
+                               NoQuantizationDataset))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NEElementwiseFusionFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeShapes(),
+                               make("DataType", DataType::F32),
+                               make("OutputDataType", DataType::F32),
+                               ActivationFunctionsDataset,
+                               NoQuantizationDataset))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunSmallQuantizedOutput,
+                       NEElementwiseFusionQuantizedOutputFixture,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("DataType", DataType::F32),
+                               make("OutputDataType", DataType::QASYMM8),
+                               ActivationFunctionsDataset,
+                               make("QuantizationInfo", {QuantizationInfo()}),
+                               make("OutputQuantizationInfo", {QuantizationInfo(0.5f, 128)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+
+FIXTURE_DATA_TEST_CASE(RunSmall1D,
+                       NEElementwiseFusionFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::Small1DShapes(),
+                               make("DataType", DataType::F32),
+                               make("OutputDataType", DataType::F32),
+                               ActivationFunctionsDataset,
+                               NoQuantizationDataset))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunLarge1D,
+                       NEElementwiseFusionFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::Large1DShapes(),
+                               make("DataType", DataType::F32),
+                               make("OutputDataType", DataType::F32),
+                               ActivationFunctionsDataset,
+                               NoQuantizationDataset))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+FIXTURE_DATA_TEST_CASE(RunSmallCast,
+                       NEElementwiseFusionCastFixture,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("CastDataType", {DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16}),
+                               make("CastQuantizationInfo", {QuantizationInfo(0.1f, 10)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_cast);
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEElementwiseFusionFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("DataType", DataType::F16),
+                               make("OutputDataType", DataType::F16),
+                               ActivationFunctionsDataset,
+                               NoQuantizationDataset))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate outputs
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEElementwiseFusionFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("DataType", DataType::QASYMM8),
+                               make("OutputDataType", DataType::QASYMM8),
+                               ActivationFunctionsDataset,
+                               make("QuantizationInfo", {QuantizationInfo(0.05f, 128)}),
+                               make("OutputQuantizationInfo", {QuantizationInfo(0.75f, 128)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+
+FIXTURE_DATA_TEST_CASE(RunSmallFloatOutput,
+                       NEElementwiseFusionFloatOutputFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("DataType", DataType::QASYMM8),
+                               make("OutputDataType", DataType::F32),
+                               ActivationFunctionsDataset,
+                               make("QuantizationInfo", {QuantizationInfo(0.05f, 128)}),
+                               make("OutputQuantizationInfo", {QuantizationInfo()})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEElementwiseFusionFixture<int8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("OutputDataType", DataType::QASYMM8_SIGNED),
+                               ActivationFunctionsDataset,
+                               make("QuantizationInfo", {QuantizationInfo(0.05f, 0)}),
+                               make("OutputQuantizationInfo", {QuantizationInfo(0.75f, 0)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // ElementwiseFusion
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,12 +51,28 @@ const auto shapes_1d =
          {TensorShape(2U, 2U, 3U), TensorShape(3U, 2U, 3U), TensorShape(4U, 2U, 3U), TensorShape(5U, 2U, 3U),
           TensorShape(7U, 2U, 3U), TensorShape(8U, 2U, 3U), TensorShape(9U, 2U, 3U), TensorShape(25U, 2U, 3U),
           TensorShape(49U, 2U, 3U), TensorShape(64U, 2U, 3U), TensorShape(16U, 2U, 3U), TensorShape(32U, 2U, 3U),
-          TensorShape(96U, 2U, 2U)});
+          TensorShape(96U, 2U, 2U), TensorShape(11U, 2U, 3U), TensorShape(13U, 2U, 3U), TensorShape(22U, 2U, 3U),
+          TensorShape(97U, 2U, 2U)});
 
 const auto shapes_2d = make("TensorShape",
                             {TensorShape(2U, 2U, 3U), TensorShape(3U, 6U, 3U), TensorShape(4U, 5U, 3U),
                              TensorShape(5U, 7U, 3U), TensorShape(7U, 25U, 3U), TensorShape(8U, 2U, 3U),
-                             TensorShape(9U, 16U, 3U), TensorShape(25U, 32U, 3U), TensorShape(192U, 128U, 2U)});
+                             TensorShape(9U, 16U, 3U), TensorShape(25U, 32U, 3U), TensorShape(192U, 128U, 2U),
+                             TensorShape(13U, 11U, 3U), TensorShape(22U, 17U, 2U)});
+
+// Real signals of width 22 and 26 are packed into 11 and 13 complex values, transformed with Bluestein's algorithm
+const auto shapes_real_1d = make("TensorShape",
+                                 {TensorShape(2U, 2U, 3U), TensorShape(7U, 2U, 3U), TensorShape(16U, 2U, 3U),
+                                  TensorShape(22U, 2U, 3U), TensorShape(26U, 2U, 3U), TensorShape(96U, 2U, 2U)});
+
+const auto shapes_real_2d =
+    make("TensorShape", {TensorShape(2U, 2U, 3U), TensorShape(9U, 16U, 3U), TensorShape(16U, 25U, 3U),
+                         TensorShape(22U, 13U, 3U), TensorShape(26U, 7U, 2U)});
+
+const auto shapes_f16 = make("TensorShape", {TensorShape(8U, 4U, 3U), TensorShape(13U, 5U, 2U),
+                                             TensorShape(16U, 7U, 2U), TensorShape(22U, 6U, 2U)});
+
+const auto directions = make("Direction", {FFTDirection::Forward, FFTDirection::Inverse});
 
 const auto ActivationFunctionsSmallDataset =
     make("ActivationInfo",
@@ -64,6 +80,10 @@ const auto ActivationFunctionsSmallDataset =
 
 RelativeTolerance<float> tolerance_f32(0.1f);   /**< Relative tolerance value for FP32 */
 constexpr float          tolerance_num = 0.07f; /**< Tolerance number */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+RelativeTolerance<half> tolerance_f16(half(0.1f)); /**< Relative tolerance value for FP16 */
+constexpr float         tolerance_num_f16 = 0.15f; /**< Tolerance number for FP16 */
+#endif                                             /* ARM_COMPUTE_ENABLE_FP16 */
 
 } // namespace
 TEST_SUITE(NEON)
@@ -76,7 +96,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 3, DataType::F32), // Invalid channels
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Unsupported axis
-                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Arbitrary length
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
         }),
         make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F16),
@@ -87,7 +107,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
         }),
         make("Axis", { 0, 0, 0, 2, 0, 0 }),
-        make("Expected", { false, false, false, false, false, true })
+        make("Expected", { false, false, false, false, true, true })
         ),
         input_info, output_info, axis, expected)
 {
@@ -101,6 +121,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 
 template <typename T>
 using NEFFT1DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -112,7 +134,35 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunReal,
+                       NEFFT1DRealFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_real_1d, make("DataType", DataType::F32), directions))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEFFT1DFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_f16, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, tolerance_num_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunReal,
+                       NEFFT1DRealFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_f16, make("DataType", DataType::F16), directions))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, tolerance_num_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT1D
 
@@ -123,7 +173,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
         make("InputInfo", { TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching data types
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 3, DataType::F32), // Invalid channels
-                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Arbitrary length
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
         }),
         make("OutputInfo",{ TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F16),
@@ -132,7 +182,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
         }),
-        make("Expected", { false, false, false, false, true })
+        make("Expected", { false, false, false, true, true })
         ),
                input_info, output_info, expected)
 {
@@ -144,6 +194,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 
 template <typename T>
 using NEFFT2DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
+template <typename T>
+using NEFFT2DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -155,7 +207,35 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunReal,
+                       NEFFT2DRealFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_real_2d, make("DataType", DataType::F32), directions))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEFFT2DFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_f16, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, tolerance_num_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunReal,
+                       NEFFT2DRealFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_f16, make("DataType", DataType::F16), directions))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, tolerance_num_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT2D
 
@@ -59,6 +59,11 @@ const RelativeTolerance<half_float::half> rel_tolerance_f16(half_float::half(
 constexpr float                           tolerance_num_f16 = 0.07f; /**< Tolerance number for FP16 */
 #endif                                                               /* ARM_COMPUTE_ENABLE_FP16*/
 
+/** Tolerance for float operations whose input is quantized to int8 at run time */
+constexpr RelativeTolerance<float> rel_tolerance_dynamic_quantized(0.05f);
+constexpr AbsoluteTolerance<float> abs_tolerance_dynamic_quantized(0.1f);
+constexpr float                    tolerance_num_dynamic_quantized = 0.01f;
+
 /** Tolerance for quantized asymmetric operations */
 constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
 constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
@@ -261,6 +266,51 @@ TEST_CASE(Quant8_Signed_Mult_gt_1, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the weights prefetching of @ref NEFullyConnectedLayer
+ *
+ * Prefetching only changes how the columns of the weights are blocked, so the output must not change.
+ *
+ * Checks performed in order:
+ * - The output with prefetching matches bit for bit the output without it
+ */
+TEST_CASE(WeightsPrefetchMatchesDefault, framework::DatasetMode::ALL)
+{
+    const auto src_info    = TensorInfo(TensorShape(1024U), 1, DataType::F32);
+    const auto weight_info = TensorInfo(TensorShape(1024U, 301U), 1, DataType::F32);
+    const auto bias_info   = TensorInfo(TensorShape(301U), 1, DataType::F32);
+    const auto dst_info    = TensorInfo(TensorShape(301U), 1, DataType::F32);
+
+    auto src    = create_tensor<Tensor>(src_info);
+    auto weight = create_tensor<Tensor>(weight_info);
+    auto bias   = create_tensor<Tensor>(bias_info);
+    src.allocator()->allocate();
+    weight.allocator()->allocate();
+    bias.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(weight), 1, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(bias), 2, -1.f, 1.f);
+
+    auto run_fc = [&](unsigned int prefetch_distance)
+    {
+        FullyConnectedLayerInfo fc_info{};
+        fc_info.weights_prefetch_distance = prefetch_distance;
+
+        auto                  dst = create_tensor<Tensor>(dst_info);
+        NEFullyConnectedLayer fc{};
+        fc.configure(&src, &weight, &bias, &dst, fc_info);
+        dst.allocator()->allocate();
+        fc.run();
+        return dst;
+    };
+    auto reference = run_fc(0);
+    auto result    = run_fc(16 * 1024);
+    for (size_t i = 0; i < reference.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(((float *)reference.buffer())[i] == ((float *)result.buffer())[i],
+                           framework::LogLevel::ERRORS);
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
@@ -454,7 +504,45 @@ FIXTURE_DATA_TEST_CASE(RunDynamicWeights,
 {
 }
 TEST_SUITE_END()
-TEST_SUITE_END()
+
+template <typename T>
+using NEFullyConnectedLayerDynamicQuantizedFixture =
+    FullyConnectedLayerDynamicQuantizedFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+
+TEST_SUITE(DynamicallyQuantized)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+FIXTURE_DATA_TEST_CASE(RunSmallFP16,
+                       NEFullyConnectedLayerDynamicQuantizedFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallFCFCFullyConnectedLayerDataset(),
+                               make("DataType", DataType::F16),
+                               ActivationFunctionsQuantizedDataset))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num_f16, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+FIXTURE_DATA_TEST_CASE(RunSmallFP32,
+                       NEFullyConnectedLayerDynamicQuantizedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallFCFCFullyConnectedLayerDataset(),
+                               make("DataType", DataType::F32),
+                               concat(NoActivationFunctionDataset, ActivationFunctionsDataset)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_quantized, tolerance_num_dynamic_quantized,
+             abs_tolerance_dynamic_quantized);
+}
+TEST_SUITE_END() // DynamicallyQuantized
+TEST_SUITE_END() // Float
 
 template <typename T>
 using NEFullyConnectedLayerQuantizedFixture =
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGroupedGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/GroupedGemmFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.001f);     /**< Tolerance for floating point tests */
+const AbsoluteTolerance<half>      tolerance_fp16(half(0.1f)); /**< Tolerance for 16-bit floating point tests */
+
+/** 29 rows split with an empty group, a negative size, fewer rows than the left-hand side and more rows than it */
+const auto SmallConfigurations =
+    combine(make("AShape", {TensorShape(37U, 29U)}),
+            make("N", {16U, 45U}),
+            make("GroupSizes",
+                 {std::vector<int32_t>{7, 0, 13, 9}, std::vector<int32_t>{5, -3, 11}, std::vector<int32_t>{40, 3},
+                  std::vector<int32_t>{1, 1, 1, 1, 1, 1, 1, 1}}),
+            make("HasBiases", {true, false}));
+
+const auto ActivationFunctionsDataset =
+    make("ActivationInfo",
+         {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f)});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GroupedGEMM)
+
+TEST_CASE(Validate, framework::DatasetMode::ALL)
+{
+    const TensorInfo a(TensorShape(32U, 20U), 1, DataType::F32);
+    const TensorInfo b(TensorShape(24U, 32U, 4U), 1, DataType::F32);
+    const TensorInfo biases(TensorShape(24U, 4U), 1, DataType::F32);
+    const TensorInfo sizes(TensorShape(4U), 1, DataType::S32);
+    const TensorInfo d(TensorShape(24U, 20U), 1, DataType::F32);
+
+    // Valid configuration, with and without biases
+    ARM_COMPUTE_EXPECT(bool(NEGroupedGEMM::validate(&a, &b, &biases, &sizes, &d)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEGroupedGEMM::validate(&a, &b, nullptr, &sizes, &d)), framework::LogLevel::ERRORS);
+
+    // One size per group of weights
+    const TensorInfo sizes_wrong(TensorShape(3U), 1, DataType::S32);
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a, &b, &biases, &sizes_wrong, &d)),
+                       framework::LogLevel::ERRORS);
+
+    // Sizes must be S32
+    const TensorInfo sizes_u32(TensorShape(4U), 1, DataType::U32);
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a, &b, &biases, &sizes_u32, &d)), framework::LogLevel::ERRORS);
+
+    // Mismatching K
+    const TensorInfo b_wrong(TensorShape(24U, 31U, 4U), 1, DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a, &b_wrong, &biases, &sizes, &d)),
+                       framework::LogLevel::ERRORS);
+
+    // Biases of a different number of groups
+    const TensorInfo biases_wrong(TensorShape(24U, 3U), 1, DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a, &b, &biases_wrong, &sizes, &d)),
+                       framework::LogLevel::ERRORS);
+
+    // Wrong destination shape
+    const TensorInfo d_wrong(TensorShape(24U, 19U), 1, DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a, &b, &biases, &sizes, &d_wrong)),
+                       framework::LogLevel::ERRORS);
+
+    // Quantized types are not supported
+    const TensorInfo a_q(TensorShape(32U, 20U), 1, DataType::QASYMM8);
+    const TensorInfo b_q(TensorShape(24U, 32U, 4U), 1, DataType::QASYMM8);
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a_q, &b_q, nullptr, &sizes, &d)), framework::LogLevel::ERRORS);
+
+    // Activation that is not a clamp
+    const GroupedGemmInfo tanh_info(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH));
+    ARM_COMPUTE_EXPECT(!bool(NEGroupedGEMM::validate(&a, &b, &biases, &sizes, &d, tanh_info)),
+                       framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEGroupedGEMMFixture = GroupedGemmValidationFixture<Tensor, Accessor, NEGroupedGEMM, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGroupedGEMMFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallConfigurations, ActivationFunctionsDataset, make("DataType", DataType::F32)))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGroupedGEMMFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallConfigurations, ActivationFunctionsDataset, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate outputs
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // GroupedGEMM
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEImagePreprocess.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/ImagePreprocessFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_fp32(0.001f);      /**< Tolerance for floating point tests */
+const AbsoluteTolerance<half>      tolerance_fp16(half(0.01f)); /**< Tolerance for 16-bit floating point tests */
+constexpr AbsoluteTolerance<float> tolerance_quant(1);          /**< Tolerance for quantized tests */
+
+/** Downscaled and upscaled sizes, with widths that are not a multiple of the block of 4 columns */
+const auto SmallShapes = combine(make("SourceShape", {TensorShape(38U, 26U)}),
+                                 make("DestinationSize", {TensorShape(17U, 11U), TensorShape(53U, 31U)}));
+
+const auto AllFormats = make("Format", {Format::RGB888, Format::YUYV422, Format::NV12});
+
+const auto ResizeDataset = combine(make("InterpolationPolicy",
+                                        {InterpolationPolicy::NEAREST_NEIGHBOR, InterpolationPolicy::BILINEAR}),
+                                   make("SamplingPolicy", {SamplingPolicy::CENTER, SamplingPolicy::TOP_LEFT}),
+                                   make("BGR", {false, true}));
+
+const auto DataLayouts = make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ImagePreprocess)
+
+TEST_CASE(Validate, framework::DatasetMode::ALL)
+{
+    const ImagePreprocessInfo info(Format::RGB888, {{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}});
+    const ImagePreprocessInfo nv12_info(Format::NV12, {{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}});
+    auto make_info = [](const TensorShape &shape, DataType data_type, DataLayout data_layout = DataLayout::NCHW)
+    {
+        TensorInfo tensor_info(shape, 1, data_type);
+        tensor_info.set_data_layout(data_layout);
+        return tensor_info;
+    };
+
+    const TensorInfo rgb   = TensorInfo(TensorShape(32U, 24U), Format::RGB888);
+    const TensorInfo luma  = TensorInfo(TensorShape(32U, 24U), Format::U8);
+    const TensorInfo uv    = TensorInfo(TensorShape(16U, 12U), Format::UV88);
+    const TensorInfo dst   = make_info(TensorShape(16U, 8U, 3U), DataType::F32);
+    const TensorInfo dst_q = make_info(TensorShape(3U, 16U, 8U), DataType::QASYMM8, DataLayout::NHWC);
+
+    // Valid configurations
+    ARM_COMPUTE_EXPECT(bool(NEImagePreprocess::validate(&rgb, nullptr, &dst, info)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEImagePreprocess::validate(&luma, &uv, &dst, nv12_info)), framework::LogLevel::ERRORS);
+
+    // Unsupported source format
+    const ImagePreprocessInfo rgba_info(Format::RGBA8888, {{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}});
+    const TensorInfo          rgba = TensorInfo(TensorShape(32U, 24U), Format::RGBA8888);
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&rgba, nullptr, &dst, rgba_info)),
+                       framework::LogLevel::ERRORS);
+
+    // Source that does not match the format
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&luma, nullptr, &dst, info)), framework::LogLevel::ERRORS);
+
+    // NV12 without chroma plane, or with a chroma plane of the wrong size
+    const TensorInfo uv_wrong = TensorInfo(TensorShape(16U, 24U), Format::UV88);
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&luma, nullptr, &dst, nv12_info)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&luma, &uv_wrong, &dst, nv12_info)),
+                       framework::LogLevel::ERRORS);
+
+    // Quantized destination without quantization
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&rgb, nullptr, &dst_q, info)), framework::LogLevel::ERRORS);
+
+    // Destination that does not have 3 channels
+    const TensorInfo dst_4 = make_info(TensorShape(16U, 8U, 4U), DataType::F32);
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&rgb, nullptr, &dst_4, info)), framework::LogLevel::ERRORS);
+
+    // Zero standard deviation
+    const ImagePreprocessInfo zero_std_info(Format::RGB888, {{0.f, 0.f, 0.f}}, {{1.f, 0.f, 1.f}});
+    ARM_COMPUTE_EXPECT(!bool(NEImagePreprocess::validate(&rgb, nullptr, &dst, zero_std_info)),
+                       framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEImagePreprocessFixture = ImagePreprocessValidationFixture<Tensor, Accessor, NEImagePreprocess, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEImagePreprocessFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallShapes,
+                               AllFormats,
+                               ResizeDataset,
+                               DataLayouts,
+                               make("DataType", DataType::F32),
+                               make("QuantizationInfo", {QuantizationInfo()})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEImagePreprocessFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallShapes,
+                               AllFormats,
+                               ResizeDataset,
+                               DataLayouts,
+                               make("DataType", DataType::F16),
+                               make("QuantizationInfo", {QuantizationInfo()})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate outputs
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEImagePreprocessFixture<uint8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallShapes,
+                               AllFormats,
+                               ResizeDataset,
+                               make("DataLayout", DataLayout::NHWC),
+                               make("DataType", DataType::QASYMM8),
+                               make("QuantizationInfo", {QuantizationInfo(0.02f, 110)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEImagePreprocessFixture<int8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallShapes,
+                               AllFormats,
+                               ResizeDataset,
+                               make("DataLayout", DataLayout::NHWC),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("QuantizationInfo", {QuantizationInfo(0.02f, -18)})))
+{
+    // Validate outputs
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // ImagePreprocess
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -47,6 +47,13 @@ TEST_SUITE(MatMul)
 constexpr AbsoluteTolerance<float> tolerance_fp32(
     0.001f); /**< Tolerance value for comparing reference's output against implementation's output for FP32 data types */
 const AbsoluteTolerance<half> tolerance_fp16(half(0.1f));
+// Tolerances for a float lhs multiplied with a dynamically quantized rhs, the lhs being quantized per row to int8
+constexpr RelativeTolerance<float> rel_tolerance_dynamic_quantized(0.05f);
+constexpr AbsoluteTolerance<float> abs_tolerance_dynamic_quantized(0.1f);
+constexpr float                    tolerance_num_dynamic_quantized = 0.01f;
+const RelativeTolerance<half>      rel_tolerance_dynamic_quantized_fp16(half(0.2f));
+constexpr AbsoluteTolerance<float> abs_tolerance_dynamic_quantized_fp16(0.3f);
+constexpr float                    tolerance_num_dynamic_quantized_fp16 = 0.07f;
 #ifdef __aarch64__
 constexpr AbsoluteTolerance<int32_t> tolerance_qasymm8(1);
 constexpr AbsoluteTolerance<int32_t> tolerance_qasymm8_signed(1);
@@ -69,6 +76,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED), // Mismatching data type
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Dynamically quantized rhs
+            TensorInfo(TensorShape(9U, 6U, 12U), 1, DataType::F32),
+            TensorInfo(TensorShape(9U, 6U, 2U), 1, DataType::F32),        // Batched dynamically quantized rhs not supported
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Wrong number of rhs scales
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Mismatching dst data type
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Tensors are not dynamic
         }),
         make("InputBInfo", {
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8),
@@ -81,6 +94,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8, QuantizationInfo(0.5f)),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(5U, 0.5f))),
+            TensorInfo(TensorShape(5U, 9U, 2U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(5U, 0.5f))),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(3U, 0.5f))),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8, QuantizationInfo(0.5f)),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8, QuantizationInfo(0.5f)),
         }),
         make("OutputInfo", {
             TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
@@ -93,9 +112,15 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 12U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F16),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
         }),
-        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false}),
-        make("Expected", { false, false, false, false, true, true, false, true, true, false })
+        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false, false, false, false, false, false, true}),
+        make("Expected", { false, false, false, false, true, true, false, true, true, false, true, true, false, false, false, false })
         ),
     a_info, b_info, output_info, are_tensors_const, expected)
 {
@@ -124,6 +149,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED), // Mismatching data type
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Dynamically quantized rhs
+            TensorInfo(TensorShape(9U, 6U, 12U), 1, DataType::F32),
+            TensorInfo(TensorShape(9U, 6U, 2U), 1, DataType::F32),        // Batched dynamically quantized rhs not supported
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Wrong number of rhs scales
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Mismatching dst data type
+            TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),            // Tensors are not dynamic
         }),
         make("InputBInfo", {
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8),
@@ -136,6 +167,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8), // MatMul of Qauntized Datatypes Not supported on armv7a
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8, QuantizationInfo(0.5f)),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(5U, 0.5f))),
+            TensorInfo(TensorShape(5U, 9U, 2U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(5U, 0.5f))),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(3U, 0.5f))),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8, QuantizationInfo(0.5f)),
+            TensorInfo(TensorShape(5U, 9U), 1, DataType::QSYMM8, QuantizationInfo(0.5f)),
         }),
         make("OutputInfo", {
             TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
@@ -148,9 +185,15 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 12U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F16),
+            TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
         }),
-        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false}),
-        make("Expected", { false, false, false, false, true, true, false, false, false, false })
+        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false, false, false, false, false, false, true}),
+        make("Expected", { false, false, false, false, true, true, false, false, false, false, true, true, false, false, false, false })
         ),
     a_info, b_info, output_info, are_tensors_const, expected)
 {
@@ -187,6 +230,10 @@ using NEMatMulDynamicTensorsFixture =
 template <typename T>
 using NEQuantizedMatMulFixture = QuantizedMatMulValidationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings, T>;
 
+template <typename T>
+using NEMatMulDynamicQuantizedFixture =
+    MatMulDynamicQuantizedValidationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings, T>;
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall,
@@ -386,6 +433,50 @@ FIXTURE_DATA_TEST_CASE(RunStressDynamicTensors,
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 
+TEST_SUITE(DynamicallyQuantized)
+#ifdef ARM_COMPUTE_ENABLE_FP16
+FIXTURE_DATA_TEST_CASE(RunSmallFP16,
+                       NEMatMulDynamicQuantizedFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallMatMulDynamicQuantizedDataset(),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F16),
+                               make("RhsDataType", {DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL}),
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_dynamic_quantized_fp16,
+                 tolerance_num_dynamic_quantized_fp16, abs_tolerance_dynamic_quantized_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+FIXTURE_DATA_TEST_CASE(RunSmallFP32,
+                       NEMatMulDynamicQuantizedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallMatMulDynamicQuantizedDataset(),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F32),
+                               make("RhsDataType", {DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL}),
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH)})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_quantized, tolerance_num_dynamic_quantized,
+             abs_tolerance_dynamic_quantized);
+}
+TEST_SUITE_END() // DynamicallyQuantized
+
 TEST_SUITE_END() // Float
 
 #ifdef __aarch64__ // All the GeMM CPU assembly kernels for integer datatypes require aarch64
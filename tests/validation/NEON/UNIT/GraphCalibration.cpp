@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/GraphAccessors.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr float max_error_ratio  = 0.08f; /**< Largest error of the quantized graph, relative to the output range */
+constexpr float mean_error_ratio = 0.02f; /**< Mean error of the quantized graph, relative to the output range */
+
+const std::string ranges_file = "test_calibration_ranges.txt";
+
+graph::ITensorAccessorUPtr uniform_accessor(std::random_device::result_type seed, float lower, float upper)
+{
+    return std::make_unique<UniformGraphAccessor>(seed, lower, upper);
+}
+
+/** Builds a MobileNet-like network, with the same weights in every copy
+ *
+ * @param[in]  graph      Stream to build the network in
+ * @param[in]  input_seed Seed of the first input
+ * @param[in]  num_inputs Number of inputs streamed through the network
+ * @param[out] outputs    Outputs of the network
+ *
+ * @return ID of the last convolution node
+ */
+graph::NodeID build_network(Stream                           &graph,
+                            std::random_device::result_type   input_seed,
+                            unsigned int                      num_inputs,
+                            std::vector<SimpleTensor<float>> &outputs)
+{
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(8U, 16U, 16U), DataType::F32).set_layout(DataLayout::NHWC),
+                        std::make_unique<UniformGraphAccessor>(input_seed, -1.f, 1.f, num_inputs))
+          << ConvolutionLayer(3U, 3U, 16U, uniform_accessor(0, -0.3f, 0.3f), uniform_accessor(1, -0.1f, 0.1f),
+                              PadStrideInfo(1, 1, 1, 1))
+          << BatchNormalizationLayer(uniform_accessor(2, -0.1f, 0.1f), uniform_accessor(3, 0.5f, 1.5f),
+                                     uniform_accessor(4, 0.5f, 1.5f), uniform_accessor(5, -0.1f, 0.1f))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+          << DepthwiseConvolutionLayer(3U, 3U, uniform_accessor(6, -0.3f, 0.3f), uniform_accessor(7, -0.1f, 0.1f),
+                                       PadStrideInfo(1, 1, 1, 1))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f))
+          << ConvolutionLayer(1U, 1U, 8U, uniform_accessor(8, -0.3f, 0.3f), uniform_accessor(9, -0.1f, 0.1f),
+                              PadStrideInfo(1, 1, 0, 0));
+    const graph::NodeID last_conv = graph.tail_node();
+
+    graph << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)))
+          << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+
+    return last_conv;
+}
+
+/** Expected quantization of a calibrated range: asymmetric over the range extended to zero */
+void expected_qinfo(float min, float max, float &scale, int &offset)
+{
+    min    = std::min(min, 0.f);
+    max    = std::max(max, 0.f);
+    scale  = (max - min) / 255.f;
+    offset = std::max(-128, std::min(127, static_cast<int>(std::round(-128.f - min / scale))));
+}
+
+/** Checks that a quantized tensor uses the calibrated range of the tensor with the given ID */
+void validate_calibrated_qinfo(const graph::Tensor &tensor, const graph::CalibrationData &ranges, graph::TensorID tid)
+{
+    float min = 0.f;
+    float max = 0.f;
+    ARM_COMPUTE_ASSERT(ranges.range(tid, min, max));
+
+    float scale  = 0.f;
+    int   offset = 0;
+    expected_qinfo(min, max, scale, offset);
+
+    const UniformQuantizationInfo qinfo = tensor.desc().quant_info.uniform();
+    ARM_COMPUTE_EXPECT(tensor.desc().data_type == DataType::QASYMM8_SIGNED, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::abs(qinfo.scale - scale) <= 1e-6f * scale, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(qinfo.offset == offset, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphCalibration)
+
+/** Validate that a graph quantized with calibrated ranges uses them and stays close to the F32 graph */
+TEST_CASE(QuantizedMatchesF32, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_calibration_inputs = 8;
+    constexpr unsigned int num_inputs             = 4;
+
+    // Calibrate on a first set of inputs
+    std::vector<SimpleTensor<float>> calibration_outputs;
+    Stream                           calibration_graph(0, "calibration_network");
+    build_network(calibration_graph, 100, num_calibration_inputs, calibration_outputs);
+
+    graph::GraphCalibrator calibrator;
+    calibrator.calibrate(calibration_graph.graph(), Target::NEON);
+    ARM_COMPUTE_EXPECT(calibrator.data().size() != 0, framework::LogLevel::ERRORS);
+    calibrator.data().save(ranges_file);
+
+    graph::CalibrationData ranges;
+    ranges.load(ranges_file);
+    ARM_COMPUTE_EXPECT(ranges.size() == calibrator.data().size(), framework::LogLevel::ERRORS);
+
+    // Run the F32 and quantized graphs on another set of inputs
+    std::vector<SimpleTensor<float>> reference;
+    Stream                           f32_graph(1, "f32_network");
+    build_network(f32_graph, 200, num_inputs, reference);
+    f32_graph.finalize(Target::NEON, GraphConfig());
+    f32_graph.run();
+
+    std::vector<SimpleTensor<float>> outputs;
+    Stream                           quantized_graph(2, "quantized_network");
+    const graph::NodeID              last_conv        = build_network(quantized_graph, 200, num_inputs, outputs);
+    const graph::TensorID            last_conv_output = quantized_graph.graph().node(last_conv)->output_id(0);
+
+    GraphConfig config;
+    config.calibration_file = ranges_file;
+    quantized_graph.finalize(Target::NEON, config);
+
+    // The input is quantized, and the last convolution produces, with the calibrated ranges
+    graph::Graph &g = quantized_graph.graph();
+    validate_calibrated_qinfo(*g.tensor(last_conv_output), ranges, last_conv_output);
+
+    const std::vector<graph::NodeID> &inputs = g.nodes(graph::NodeType::Input);
+    ARM_COMPUTE_ASSERT(inputs.size() == 1);
+    const graph::TensorID input_tensor    = g.node(inputs[0])->output_id(0);
+    bool                  input_quantized = false;
+    for (const auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == graph::NodeType::QuantizationLayer &&
+            node->input_id(0) == input_tensor)
+        {
+            validate_calibrated_qinfo(*node->output(0), ranges, input_tensor);
+            input_quantized = true;
+        }
+    }
+    ARM_COMPUTE_EXPECT(input_quantized, framework::LogLevel::ERRORS);
+
+    quantized_graph.run();
+
+    // The dequantized outputs stay within a fraction of the output range of the F32 outputs
+    ARM_COMPUTE_ASSERT(outputs.size() == num_inputs && reference.size() == num_inputs);
+    for (unsigned int i = 0; i < num_inputs; ++i)
+    {
+        ARM_COMPUTE_ASSERT(outputs[i].num_elements() == reference[i].num_elements());
+
+        const float *ref    = reference[i].data();
+        const auto   minmax = std::minmax_element(ref, ref + reference[i].num_elements());
+        const float  range  = *minmax.second - *minmax.first;
+
+        float max_error = 0.f;
+        float sum_error = 0.f;
+        for (int j = 0; j < reference[i].num_elements(); ++j)
+        {
+            const float error = std::abs(outputs[i][j] - reference[i][j]);
+            max_error         = std::max(max_error, error);
+            sum_error += error;
+        }
+        ARM_COMPUTE_EXPECT(range > 0.f, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(max_error <= max_error_ratio * range, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(sum_error / reference[i].num_elements() <= mean_error_ratio * range,
+                           framework::LogLevel::ERRORS);
+    }
+
+    std::remove(ranges_file.c_str());
+}
+
+TEST_SUITE_END() // GraphCalibration
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
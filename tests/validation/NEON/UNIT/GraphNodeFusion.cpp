@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/GraphAccessors.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/Validation.h"
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance between fused and unfused graphs */
+
+/** Adds the layers of a network to a stream, capturing its output in the given tensors */
+using NetworkBuilder = std::function<void(Stream &, std::vector<SimpleTensor<float>> &)>;
+
+graph::ITensorAccessorUPtr
+uniform_accessor(std::random_device::result_type seed, float lower = -0.5f, float upper = 0.5f)
+{
+    return std::make_unique<UniformGraphAccessor>(seed, lower, upper);
+}
+
+InputLayer input_layer(DataLayout data_layout)
+{
+    const TensorShape shape = data_layout == DataLayout::NCHW ? TensorShape(12U, 10U, 8U) : TensorShape(8U, 12U, 10U);
+    return InputLayer(TensorDescriptor(shape, DataType::F32).set_layout(data_layout),
+                      std::make_unique<UniformGraphAccessor>(0, -1.f, 1.f));
+}
+
+ConvolutionLayer conv(unsigned int size, unsigned int ofm, std::random_device::result_type seed)
+{
+    return ConvolutionLayer(size, size, ofm, uniform_accessor(seed), uniform_accessor(seed + 1),
+                            PadStrideInfo(1, 1, size / 2, size / 2));
+}
+
+BatchNormalizationLayer batch_norm(std::random_device::result_type seed)
+{
+    return BatchNormalizationLayer(uniform_accessor(seed), uniform_accessor(seed + 1, 0.5f, 1.5f),
+                                   uniform_accessor(seed + 2, 0.5f, 1.5f), uniform_accessor(seed + 3));
+}
+
+/** Returns a graph configuration with the residual additions fused into the convolutions */
+GraphConfig residual_config()
+{
+    GraphConfig config;
+    config.fuse_residual_additions = true;
+    return config;
+}
+
+/** Checks whether a node of a given type is left in a graph */
+bool has_node(const graph::Graph &g, graph::NodeType type)
+{
+    for (const auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == type)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Runs a network once, with the default passes
+ *
+ * @param[in]  build      Builder of the network
+ * @param[out] fused      Set to true if no node of type @p fused_type is left once the graph is finalized
+ * @param[in]  fused_type Type of the nodes expected to be fused away
+ * @param[in]  config     Configuration of the graph
+ *
+ * @return The output of the network
+ */
+SimpleTensor<float>
+run_fused(const NetworkBuilder &build, bool &fused, graph::NodeType fused_type, const GraphConfig &config)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "fused_network");
+    build(graph, outputs);
+    graph.finalize(Target::NEON, config);
+    fused = !has_node(graph.graph(), fused_type);
+    graph.run();
+
+    ARM_COMPUTE_ASSERT(outputs.size() == 1);
+    return outputs[0];
+}
+
+/** Runs a network once, with the default passes except the node fusions
+ *
+ * @param[in] build Builder of the network
+ *
+ * @return The output of the network
+ */
+SimpleTensor<float> run_unfused(const NetworkBuilder &build)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "unfused_network");
+    build(graph, outputs);
+
+    graph::PassManager pm;
+    pm.append(std::make_unique<graph::GroupedConvolutionMutator>());
+    pm.append(std::make_unique<graph::InPlaceOperationMutator>());
+    pm.append(std::make_unique<graph::DepthConcatSubTensorMutator>());
+    pm.append(std::make_unique<graph::SplitLayerSubTensorMutator>());
+    pm.append(std::make_unique<graph::SliceLayerSubTensorMutator>());
+    pm.append(std::make_unique<graph::NodeExecutionMethodMutator>());
+
+    graph::GraphContext ctx;
+    ctx.set_config(GraphConfig());
+    graph::GraphManager manager;
+    manager.finalize_graph(graph.graph(), ctx, pm, Target::NEON);
+    manager.execute_graph(graph.graph());
+
+    ARM_COMPUTE_ASSERT(outputs.size() == 1);
+    return outputs[0];
+}
+
+/** Checks that a network gets fused and that its output matches the one of the unfused network */
+void validate_fusion(const NetworkBuilder &build, graph::NodeType fused_type, const GraphConfig &config = GraphConfig())
+{
+    bool                      fused     = false;
+    SimpleTensor<float>       output    = run_fused(build, fused, fused_type, config);
+    const SimpleTensor<float> reference = run_unfused(build);
+
+    ARM_COMPUTE_EXPECT(fused, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphNodeFusion)
+
+// An element-wise operation between two poolings absorbs the activation that follows it
+DATA_TEST_CASE(EltwiseActivation,
+               framework::DatasetMode::ALL,
+               make("Activation", {ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH)}),
+               act_info)
+{
+    for (const EltwiseOperation op :
+         {EltwiseOperation::Add, EltwiseOperation::Sub, EltwiseOperation::Mul, EltwiseOperation::Max})
+    {
+        const NetworkBuilder build = [&](Stream &graph, std::vector<SimpleTensor<float>> &outputs)
+        {
+            graph << Target::NEON << input_layer(DataLayout::NCHW);
+
+            SubStream avg(graph);
+            avg << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, 3, DataLayout::NCHW, PadStrideInfo(1, 1, 1, 1)));
+            SubStream max(graph);
+            max << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NCHW, PadStrideInfo(1, 1, 1, 1)));
+
+            graph << EltwiseLayer(std::move(avg), std::move(max), op) << ActivationLayer(act_info)
+                  << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+        };
+
+        validate_fusion(build, graph::NodeType::ActivationLayer);
+    }
+}
+
+// ResNet basic block: the second convolution and its batch normalization absorb the identity shortcut and the ReLU,
+// only when requested
+DATA_TEST_CASE(ResidualBlock,
+               framework::DatasetMode::ALL,
+               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC}),
+               data_layout)
+{
+    const NetworkBuilder build = [&](Stream &graph, std::vector<SimpleTensor<float>> &outputs)
+    {
+        graph << Target::NEON << input_layer(data_layout);
+
+        SubStream branch(graph);
+        branch << conv(3U, 8U, 10) << batch_norm(20)
+               << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+               << conv(3U, 8U, 30) << batch_norm(40);
+        SubStream shortcut(graph);
+
+        graph << EltwiseLayer(std::move(branch), std::move(shortcut), EltwiseOperation::Add)
+              << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+              << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+    };
+
+    validate_fusion(build, graph::NodeType::EltwiseLayer, residual_config());
+
+    // The fusion is off by default
+    bool fused = false;
+    run_fused(build, fused, graph::NodeType::EltwiseLayer, GraphConfig());
+    ARM_COMPUTE_EXPECT(!fused, framework::LogLevel::ERRORS);
+}
+
+// MobileNetV2 inverted residual block: the projection absorbs the identity shortcut, with no activation after it
+DATA_TEST_CASE(InvertedResidualBlock,
+               framework::DatasetMode::ALL,
+               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC}),
+               data_layout)
+{
+    const NetworkBuilder build = [&](Stream &graph, std::vector<SimpleTensor<float>> &outputs)
+    {
+        const ActivationLayerInfo relu6(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+
+        graph << Target::NEON << input_layer(data_layout);
+
+        SubStream branch(graph);
+        branch << conv(1U, 24U, 10) << batch_norm(20) << ActivationLayer(relu6)
+               << DepthwiseConvolutionLayer(3U, 3U, uniform_accessor(30), uniform_accessor(31),
+                                            PadStrideInfo(1, 1, 1, 1))
+               << batch_norm(40) << ActivationLayer(relu6) << conv(1U, 8U, 50) << batch_norm(60);
+        SubStream shortcut(graph);
+
+        graph << EltwiseLayer(std::move(branch), std::move(shortcut), EltwiseOperation::Add)
+              << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+    };
+
+    validate_fusion(build, graph::NodeType::EltwiseLayer, residual_config());
+}
+
+// A convolution keeps running its own activation before the residual addition fused into it
+TEST_CASE(ConvolutionActivationResidual, framework::DatasetMode::ALL)
+{
+    const NetworkBuilder build = [](Stream &graph, std::vector<SimpleTensor<float>> &outputs)
+    {
+        graph << Target::NEON << input_layer(DataLayout::NCHW);
+
+        SubStream branch(graph);
+        branch << conv(3U, 8U, 10)
+               << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+        SubStream shortcut(graph);
+        shortcut << conv(1U, 8U, 20);
+
+        graph << EltwiseLayer(std::move(branch), std::move(shortcut), EltwiseOperation::Add)
+              << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH))
+              << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+    };
+
+    validate_fusion(build, graph::NodeType::EltwiseLayer, residual_config());
+}
+
+// Depthwise separable block: the depthwise convolution and the pointwise convolution following it run as a single
+// node, only when requested
+TEST_CASE(DepthwiseSeparableBlock, framework::DatasetMode::ALL)
+{
+    const NetworkBuilder build = [](Stream &graph, std::vector<SimpleTensor<float>> &outputs)
+    {
+        const ActivationLayerInfo relu6(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+
+        graph << Target::NEON << input_layer(DataLayout::NHWC)
+              << DepthwiseConvolutionLayer(3U, 3U, uniform_accessor(10), uniform_accessor(11),
+                                           PadStrideInfo(1, 1, 1, 1))
+              << ActivationLayer(relu6) << conv(1U, 16U, 20) << ActivationLayer(relu6)
+              << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+    };
+
+    GraphConfig config;
+    config.fuse_depthwise_separable = true;
+    validate_fusion(build, graph::NodeType::DepthwiseConvolutionLayer, config);
+
+    // The fusion is off by default
+    bool fused = false;
+    run_fused(build, fused, graph::NodeType::DepthwiseConvolutionLayer, GraphConfig());
+    ARM_COMPUTE_EXPECT(!fused, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // GraphNodeFusion
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/GraphAccessors.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance between pipelined and sequential runs */
+constexpr unsigned int             num_inputs = 7;        /**< Number of inputs streamed through the graphs */
+
+graph::ITensorAccessorUPtr weights_accessor(std::random_device::result_type seed)
+{
+    return std::make_unique<UniformGraphAccessor>(seed, -0.5f, 0.5f);
+}
+
+ConvolutionLayer conv(unsigned int size, unsigned int ofm, std::random_device::result_type seed)
+{
+    return ConvolutionLayer(size, size, ofm, weights_accessor(seed), weights_accessor(seed + 1),
+                            PadStrideInfo(1, 1, size / 2, size / 2));
+}
+
+/** Streams the inputs through a residual network, whose shortcut crosses all the stages when pipelined
+ *
+ * @param[in] pipeline_stages Number of pipeline stages
+ * @param[in] max_outputs     Number of outputs after which the output accessor stops the graph. 0 to never stop it.
+ *
+ * @return The outputs of the network
+ */
+std::vector<SimpleTensor<float>> run_residual_network(unsigned int pipeline_stages, unsigned int max_outputs = 0)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "pipelined_residual_network");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(12U, 10U, 8U), DataType::F32),
+                        std::make_unique<UniformGraphAccessor>(100, -1.f, 1.f, num_inputs));
+
+    SubStream branch(graph);
+    branch << conv(3U, 8U, 0) << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << conv(3U, 8U, 2) << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+           << conv(3U, 8U, 4);
+    SubStream shortcut(graph);
+    shortcut << conv(1U, 8U, 6);
+
+    graph << EltwiseLayer(std::move(branch), std::move(shortcut), EltwiseOperation::Add)
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)) << conv(3U, 4U, 8)
+          << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs, max_outputs));
+
+    GraphConfig config;
+    config.pipeline_stages = pipeline_stages;
+    graph.finalize(Target::NEON, config);
+    graph.run();
+
+    return outputs;
+}
+
+/** Streams the inputs through a pooling followed by an activation, which can't be cut if run in place */
+std::vector<SimpleTensor<float>> run_pooling_activation(unsigned int pipeline_stages)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream graph(0, "pipelined_pooling_activation");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(12U, 10U, 8U), DataType::F32),
+                        std::make_unique<UniformGraphAccessor>(200, -1.f, 1.f, num_inputs))
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, DataLayout::NCHW, PadStrideInfo(2, 2, 0, 0)))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+          << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+
+    GraphConfig config;
+    config.pipeline_stages = pipeline_stages;
+    graph.finalize(Target::NEON, config);
+    graph.run();
+
+    return outputs;
+}
+
+void validate_outputs(std::vector<SimpleTensor<float>> &outputs, const std::vector<SimpleTensor<float>> &reference)
+{
+    ARM_COMPUTE_ASSERT(outputs.size() == reference.size());
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        validate(SimpleTensorAccessor<float>(outputs[i]), reference[i], tolerance_f32);
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphPipeline)
+
+TEST_CASE(CoreGroups, framework::DatasetMode::ALL)
+{
+    const unsigned int num_cpus = std::max(CPUInfo::get().get_cpu_num(), 1U);
+    for (unsigned int num_stages = 1; num_stages <= num_cpus + 1; ++num_stages)
+    {
+        const auto groups = graph::GraphPipeline::make_core_groups(num_stages);
+        ARM_COMPUTE_EXPECT(groups.size() == std::min(num_stages, num_cpus), framework::LogLevel::ERRORS);
+
+        // Every core is used by exactly one group
+        std::vector<unsigned int> uses(num_cpus, 0);
+        for (const auto &group : groups)
+        {
+            ARM_COMPUTE_EXPECT(!group.empty(), framework::LogLevel::ERRORS);
+            for (const unsigned int cpu : group)
+            {
+                ARM_COMPUTE_ASSERT(cpu < num_cpus);
+                ++uses[cpu];
+            }
+        }
+        ARM_COMPUTE_EXPECT(std::all_of(uses.begin(), uses.end(), [](unsigned int u) { return u == 1; }),
+                           framework::LogLevel::ERRORS);
+    }
+}
+
+// Every input streamed in is drained out of the pipeline, in order, through the rotating boundary buffers
+DATA_TEST_CASE(MatchesSequential, framework::DatasetMode::ALL, make("PipelineStages", {2U, 3U, 4U}), pipeline_stages)
+{
+    const std::vector<SimpleTensor<float>> reference = run_residual_network(1);
+    std::vector<SimpleTensor<float>>       outputs   = run_residual_network(pipeline_stages);
+
+    ARM_COMPUTE_EXPECT(reference.size() == num_inputs, framework::LogLevel::ERRORS);
+    validate_outputs(outputs, reference);
+}
+
+// Requesting more stages than the graph can be cut into merges the stages that can't be cut apart
+DATA_TEST_CASE(MergesStagesWithoutCut, framework::DatasetMode::ALL, make("PipelineStages", {2U, 16U}), pipeline_stages)
+{
+    const std::vector<SimpleTensor<float>> reference = run_pooling_activation(1);
+    std::vector<SimpleTensor<float>>       outputs   = run_pooling_activation(pipeline_stages);
+
+    ARM_COMPUTE_EXPECT(reference.size() == num_inputs, framework::LogLevel::ERRORS);
+    validate_outputs(outputs, reference);
+}
+
+// The inputs still in flight are dropped when an output accessor stops the graph
+TEST_CASE(StopFromOutput, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int max_outputs = 3;
+
+    const std::vector<SimpleTensor<float>> reference = run_residual_network(1, max_outputs);
+    std::vector<SimpleTensor<float>>       outputs   = run_residual_network(3, max_outputs);
+
+    ARM_COMPUTE_EXPECT(reference.size() == max_outputs, framework::LogLevel::ERRORS);
+    validate_outputs(outputs, reference);
+}
+
+TEST_SUITE_END() // GraphPipeline
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphPlan.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/GraphAccessors.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/Validation.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance between runs with the same weights */
+
+const std::string plan_file = "test_graph_plan.bin";
+
+/** Number of weights filled through their accessor by the last run_network() call */
+unsigned int num_weights_fills = 0;
+
+/** Graph accessor counting the fills of another accessor, optionally hiding the identifier of its data */
+class CountingGraphAccessor final : public graph::ITensorAccessor
+{
+public:
+    CountingGraphAccessor(std::random_device::result_type seed, bool identified)
+        : _accessor(seed, -0.5f, 0.5f), _identified(identified)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        ++num_weights_fills;
+        return _accessor.access_tensor(tensor);
+    }
+
+    std::string data_id() const override
+    {
+        return _identified ? _accessor.data_id() : "";
+    }
+
+private:
+    UniformGraphAccessor _accessor;
+    bool                 _identified;
+};
+
+graph::ITensorAccessorUPtr weights_accessor(std::random_device::result_type seed, bool identified)
+{
+    return std::make_unique<CountingGraphAccessor>(seed, identified);
+}
+
+/** Runs a small network once
+ *
+ * @param[in] plan       Plan file to load or save. Empty to not use a plan
+ * @param[in] seed       Seed of the weights filled by the accessors
+ * @param[in] num_ofms   (Optional) Number of output feature maps of the network
+ * @param[in] identified (Optional) Whether the weights accessors identify their data
+ *
+ * @return The output of the network
+ */
+SimpleTensor<float> run_network(const std::string              &plan,
+                                std::random_device::result_type seed,
+                                unsigned int                    num_ofms   = 4U,
+                                bool                            identified = true)
+{
+    std::vector<SimpleTensor<float>> outputs;
+    num_weights_fills = 0;
+
+    Stream graph(0, "planned_network");
+    graph << Target::NEON
+          << InputLayer(TensorDescriptor(TensorShape(12U, 10U, 8U), DataType::F32),
+                        std::make_unique<UniformGraphAccessor>(0, -1.f, 1.f))
+          << ConvolutionLayer(3U, 3U, 8U, weights_accessor(seed, identified), weights_accessor(seed + 1, identified),
+                              PadStrideInfo(1, 1, 1, 1))
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+          << ConvolutionLayer(1U, 1U, num_ofms, weights_accessor(seed + 2, identified),
+                              weights_accessor(seed + 3, identified), PadStrideInfo(1, 1, 0, 0))
+          << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+
+    GraphConfig config;
+    config.plan_file = plan;
+    graph.finalize(Target::NEON, config);
+    graph.run();
+
+    ARM_COMPUTE_ASSERT(outputs.size() == 1);
+    return outputs[0];
+}
+
+/** Checks whether two outputs differ by more than the tolerance */
+bool differ(const SimpleTensor<float> &a, const SimpleTensor<float> &b)
+{
+    for (int i = 0; i < a.num_elements(); ++i)
+    {
+        if (std::abs(a[i] - b[i]) > static_cast<float>(tolerance_f32))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<char> read_file(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string &filename, const std::vector<char> &data)
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    fs.write(data.data(), data.size());
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphPlan)
+
+/** Validate that a saved plan loads back and saves to the same file */
+TEST_CASE(RoundTrip, framework::DatasetMode::ALL)
+{
+    const std::string copy_file = "test_graph_plan_copy.bin";
+    std::remove(plan_file.c_str());
+
+    run_network(plan_file, 0);
+
+    graph::GraphPlan plan;
+    ARM_COMPUTE_EXPECT(plan.load(plan_file), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(plan.save(copy_file), framework::LogLevel::ERRORS);
+
+    const std::vector<char> saved = read_file(plan_file);
+    ARM_COMPUTE_EXPECT(!saved.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(saved == read_file(copy_file), framework::LogLevel::ERRORS);
+
+    std::remove(plan_file.c_str());
+    std::remove(copy_file.c_str());
+}
+
+/** Validate that a graph restored from a plan gives the same output as a fresh run, without calling the weights
+ * accessors
+ */
+TEST_CASE(SameOutputAsFreshRun, framework::DatasetMode::ALL)
+{
+    std::remove(plan_file.c_str());
+
+    const SimpleTensor<float> reference = run_network("", 0);
+    SimpleTensor<float>       recorded  = run_network(plan_file, 0);
+    ARM_COMPUTE_EXPECT(num_weights_fills == 4U, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(recorded), reference, tolerance_f32);
+
+    SimpleTensor<float> restored = run_network(plan_file, 0);
+    ARM_COMPUTE_EXPECT(num_weights_fills == 0U, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(restored), reference, tolerance_f32);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Validate that a plan recorded with other weights is rejected and replaced */
+TEST_CASE(RejectsPlanOfOtherWeights, framework::DatasetMode::ALL)
+{
+    std::remove(plan_file.c_str());
+
+    const SimpleTensor<float> stale = run_network(plan_file, 0);
+
+    const SimpleTensor<float> reference = run_network("", 100);
+    ARM_COMPUTE_EXPECT(differ(reference, stale), framework::LogLevel::ERRORS);
+    SimpleTensor<float> output = run_network(plan_file, 100);
+    ARM_COMPUTE_EXPECT(num_weights_fills == 4U, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+
+    SimpleTensor<float> restored = run_network(plan_file, 100);
+    ARM_COMPUTE_EXPECT(num_weights_fills == 0U, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(restored), reference, tolerance_f32);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Validate that constant tensors whose accessor doesn't identify its data are never restored from a plan */
+TEST_CASE(CallsUnidentifiedAccessors, framework::DatasetMode::ALL)
+{
+    std::remove(plan_file.c_str());
+
+    const SimpleTensor<float> reference = run_network("", 100, 4U, false);
+    run_network(plan_file, 0, 4U, false);
+    SimpleTensor<float> output = run_network(plan_file, 100, 4U, false);
+    ARM_COMPUTE_EXPECT(num_weights_fills == 4U, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Validate that a plan of another graph is ignored and replaced by a plan of the graph being finalized */
+TEST_CASE(RejectsMismatchingPlan, framework::DatasetMode::ALL)
+{
+    std::remove(plan_file.c_str());
+
+    run_network(plan_file, 0, 4U);
+
+    const SimpleTensor<float> reference = run_network("", 100, 6U);
+    SimpleTensor<float>       output    = run_network(plan_file, 100, 6U);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+
+    SimpleTensor<float> restored = run_network(plan_file, 200, 6U);
+    validate(SimpleTensorAccessor<float>(restored), reference, tolerance_f32);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Validate that stale, corrupted and truncated plans are rejected */
+TEST_CASE(RejectsInvalidPlan, framework::DatasetMode::ALL)
+{
+    std::remove(plan_file.c_str());
+
+    graph::GraphPlan plan;
+    ARM_COMPUTE_EXPECT(!plan.load(plan_file), framework::LogLevel::ERRORS);
+
+    run_network(plan_file, 0);
+    const std::vector<char> valid = read_file(plan_file);
+    ARM_COMPUTE_ASSERT(valid.size() > 40U);
+
+    // Magic, version and truncated blobs
+    for (const size_t corrupted_byte : {0U, 8U})
+    {
+        std::vector<char> corrupted = valid;
+        corrupted[corrupted_byte] ^= 0x5a;
+        write_file(plan_file, corrupted);
+        ARM_COMPUTE_EXPECT(!plan.load(plan_file), framework::LogLevel::ERRORS);
+    }
+    write_file(plan_file, std::vector<char>(valid.begin(), valid.end() - 1));
+    ARM_COMPUTE_EXPECT(!plan.load(plan_file), framework::LogLevel::ERRORS);
+
+    // Number of blobs and size of the first blob beyond the end of the file
+    for (const size_t corrupted_byte : {27U, 39U})
+    {
+        std::vector<char> corrupted = valid;
+        corrupted[corrupted_byte] ^= 0x5a;
+        write_file(plan_file, corrupted);
+        ARM_COMPUTE_EXPECT(!plan.load(plan_file), framework::LogLevel::ERRORS);
+    }
+
+    // A stale plan loads, but doesn't match the graph so the weights accessors are called
+    std::vector<char> stale = valid;
+    stale[12] ^= 0x5a;
+    write_file(plan_file, stale);
+    ARM_COMPUTE_EXPECT(plan.load(plan_file), framework::LogLevel::ERRORS);
+
+    const SimpleTensor<float> reference = run_network("", 100);
+    SimpleTensor<float>       output    = run_network(plan_file, 100);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Validate that a plan that can't be saved doesn't prevent the graph from running */
+TEST_CASE(UnwritablePlan, framework::DatasetMode::ALL)
+{
+    const std::string unwritable_file = "missing_directory/test_graph_plan.bin";
+
+    graph::GraphPlan plan;
+    ARM_COMPUTE_EXPECT(!plan.save(unwritable_file), framework::LogLevel::ERRORS);
+
+    const SimpleTensor<float> reference = run_network("", 0);
+    SimpleTensor<float>       output    = run_network(unwritable_file, 0);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+}
+
+TEST_SUITE_END() // GraphPlan
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/GraphAccessors.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/Validation.h"
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance between the view and copy paths */
+
+/** Adds the layers of a network to a stream, capturing its output in the given tensors
+ *
+ * @return ID of the concatenation or slice node of the network
+ */
+using NetworkBuilder = std::function<graph::NodeID(Stream &, std::vector<SimpleTensor<float>> &)>;
+
+InputLayer input_layer(DataLayout data_layout)
+{
+    const TensorShape shape = data_layout == DataLayout::NCHW ? TensorShape(12U, 10U, 8U) : TensorShape(8U, 12U, 10U);
+    return InputLayer(TensorDescriptor(shape, DataType::F32).set_layout(data_layout),
+                      std::make_unique<UniformGraphAccessor>(0, -1.f, 1.f));
+}
+
+ConvolutionLayer conv(unsigned int size, unsigned int ofm, std::random_device::result_type seed)
+{
+    return ConvolutionLayer(size, size, ofm, std::make_unique<UniformGraphAccessor>(seed, -0.5f, 0.5f),
+                            std::make_unique<UniformGraphAccessor>(seed + 1, -0.5f, 0.5f),
+                            PadStrideInfo(1, 1, size / 2, size / 2));
+}
+
+/** Checks whether the copying function of a concatenation or slice node was replaced by sub-tensors */
+bool uses_views(graph::INode &node)
+{
+    switch (node.type())
+    {
+        case graph::NodeType::ConcatenateLayer:
+            return !arm_compute::utils::cast::polymorphic_downcast<graph::ConcatenateLayerNode *>(&node)->is_enabled();
+        case graph::NodeType::SliceLayer:
+            return !arm_compute::utils::cast::polymorphic_downcast<graph::SliceLayerNode *>(&node)->is_enabled();
+        case graph::NodeType::StridedSliceLayer:
+            return !arm_compute::utils::cast::polymorphic_downcast<graph::StridedSliceLayerNode *>(&node)
+                        ->is_enabled();
+        default:
+            return false;
+    }
+}
+
+/** Runs a network once, with the default passes
+ *
+ * @param[in]  build     Builder of the network
+ * @param[in]  use_views Whether to run the sub-tensor passes of concatenations and slices
+ * @param[out] is_view   Set to true if the concatenation or slice of the network was replaced by sub-tensors
+ *
+ * @return The output of the network
+ */
+SimpleTensor<float> run_network(const NetworkBuilder &build, bool use_views, bool &is_view)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    Stream              graph(0, "sub_tensor_network");
+    const graph::NodeID nid = build(graph, outputs);
+
+    graph::PassManager pm;
+    pm.append(std::make_unique<graph::NodeFusionMutator>());
+    pm.append(std::make_unique<graph::GroupedConvolutionMutator>());
+    pm.append(std::make_unique<graph::InPlaceOperationMutator>());
+    if (use_views)
+    {
+        pm.append(std::make_unique<graph::DepthConcatSubTensorMutator>());
+    }
+    pm.append(std::make_unique<graph::SplitLayerSubTensorMutator>());
+    if (use_views)
+    {
+        pm.append(std::make_unique<graph::SliceLayerSubTensorMutator>());
+    }
+    pm.append(std::make_unique<graph::NodeExecutionMethodMutator>());
+
+    graph::GraphContext ctx;
+    ctx.set_config(GraphConfig());
+    graph::GraphManager manager;
+    manager.finalize_graph(graph.graph(), ctx, pm, Target::NEON);
+    is_view = uses_views(*graph.graph().node(nid));
+    manager.execute_graph(graph.graph());
+
+    ARM_COMPUTE_ASSERT(outputs.size() == 1);
+    return outputs[0];
+}
+
+/** Checks that a network uses views only where expected, and that its output matches the one of the copying path */
+void validate_views(const NetworkBuilder &build, bool expect_view)
+{
+    bool                      is_view   = true;
+    const SimpleTensor<float> reference = run_network(build, false, is_view);
+    ARM_COMPUTE_EXPECT(!is_view, framework::LogLevel::ERRORS);
+
+    SimpleTensor<float> output = run_network(build, true, is_view);
+    ARM_COMPUTE_EXPECT(is_view == expect_view, framework::LogLevel::ERRORS);
+    validate(SimpleTensorAccessor<float>(output), reference, tolerance_f32);
+}
+
+/** Builds a network slicing the output of a convolution, read by a 1x1 convolution
+ *
+ * @param[in] data_layout Data layout of the network
+ * @param[in] starts      Starting coordinates of the slice
+ * @param[in] ends        Ending coordinates of the slice
+ * @param[in] strides     Steps of the slice
+ */
+NetworkBuilder slice_network(DataLayout data_layout, Coordinates starts, Coordinates ends, BiStrides strides)
+{
+    return [=](Stream &graph, std::vector<SimpleTensor<float>> &outputs) mutable
+    {
+        graph << Target::NEON << input_layer(data_layout) << conv(3U, 8U, 10)
+              << StridedSliceLayer(starts, ends, strides, StridedSliceLayerInfo());
+        const graph::NodeID slice = graph.tail_node();
+        graph << conv(1U, 4U, 20) << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+        return slice;
+    };
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphSubTensorViews)
+
+// Convolutions written into the views of a concatenation, which is read by a 1x1 convolution. Views are only used if
+// the rows of dimensions 1 and 2 stay evenly spaced, so not for a concatenation along dimension 1.
+DATA_TEST_CASE(Concatenate, framework::DatasetMode::ALL, make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC}),
+               data_layout)
+{
+    for (const DataLayoutDimension axis :
+         {DataLayoutDimension::WIDTH, DataLayoutDimension::HEIGHT, DataLayoutDimension::CHANNEL})
+    {
+        const NetworkBuilder build = [&](Stream &graph, std::vector<SimpleTensor<float>> &outputs)
+        {
+            graph << Target::NEON << input_layer(data_layout);
+
+            SubStream first(graph);
+            first << conv(1U, 6U, 10);
+            SubStream second(graph);
+            second << conv(3U, 6U, 20);
+
+            graph << ConcatLayer(graph::descriptors::ConcatLayerDescriptor(axis), std::move(first), std::move(second));
+            const graph::NodeID concat = graph.tail_node();
+            graph << conv(1U, 4U, 30) << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+            return concat;
+        };
+
+        validate_views(build, graph::get_dimension_idx(data_layout, axis) != 1);
+    }
+}
+
+// NHWC slices read by a 1x1 convolution, whose GEMM reinterprets the rows of dimensions 1 and 2 as a single matrix
+TEST_CASE(SliceChannels, framework::DatasetMode::ALL)
+{
+    validate_views(slice_network(DataLayout::NHWC, Coordinates(2, 0, 0), Coordinates(6, 12, 10), BiStrides(1, 1, 1)),
+                   true);
+}
+
+TEST_CASE(SliceHeight, framework::DatasetMode::ALL)
+{
+    validate_views(slice_network(DataLayout::NHWC, Coordinates(0, 0, 1), Coordinates(8, 12, 9), BiStrides(1, 1, 1)),
+                   true);
+}
+
+TEST_CASE(SliceWidth, framework::DatasetMode::ALL)
+{
+    validate_views(slice_network(DataLayout::NHWC, Coordinates(0, 2, 0), Coordinates(8, 10, 10), BiStrides(1, 1, 1)),
+                   false);
+}
+
+TEST_CASE(StridedSliceWidth, framework::DatasetMode::ALL)
+{
+    validate_views(slice_network(DataLayout::NHWC, Coordinates(0, 0, 0), Coordinates(8, 12, 10), BiStrides(1, 2, 1)),
+                   true);
+}
+
+TEST_CASE(StridedSliceHeight, framework::DatasetMode::ALL)
+{
+    validate_views(slice_network(DataLayout::NHWC, Coordinates(0, 0, 0), Coordinates(8, 12, 10), BiStrides(1, 1, 2)),
+                   false);
+}
+
+TEST_SUITE_END() // GraphSubTensorViews
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KernelTelemetry.h"
+
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Disables the telemetry when going out of scope, so a failing test does not leave it enabled */
+class ResetTelemetry
+{
+public:
+    ~ResetTelemetry()
+    {
+        KernelTelemetry::get().set_callback(nullptr);
+        KernelTelemetry::get().set_ring_buffer_capacity(0);
+    }
+};
+
+KernelTelemetryRecord make_record(const char *name)
+{
+    KernelTelemetryRecord record;
+    record.kernel_name = name;
+    return record;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(KernelTelemetry)
+
+TEST_CASE(RingBufferKeepsMostRecent, framework::DatasetMode::ALL)
+{
+    ResetTelemetry   reset{};
+    KernelTelemetry &telemetry = KernelTelemetry::get();
+    ARM_COMPUTE_ASSERT(!telemetry.is_enabled());
+
+    telemetry.set_ring_buffer_capacity(2);
+    ARM_COMPUTE_EXPECT(telemetry.is_enabled(), framework::LogLevel::ERRORS);
+    telemetry.record(make_record("first"));
+    telemetry.record(make_record("second"));
+    telemetry.record(make_record("third"));
+
+    const std::vector<KernelTelemetryRecord> records = telemetry.drain();
+    ARM_COMPUTE_ASSERT(records.size() == 2);
+    ARM_COMPUTE_EXPECT(records[0].kernel_name == "second", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(records[1].kernel_name == "third", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(telemetry.num_dropped() == 1, framework::LogLevel::ERRORS);
+
+    // Draining empties the buffer
+    ARM_COMPUTE_EXPECT(telemetry.drain().empty(), framework::LogLevel::ERRORS);
+    telemetry.record(make_record("fourth"));
+    ARM_COMPUTE_EXPECT(telemetry.drain().size() == 1, framework::LogLevel::ERRORS);
+
+    telemetry.set_ring_buffer_capacity(0);
+    ARM_COMPUTE_EXPECT(!telemetry.is_enabled(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RecordsScheduledKernels, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int m = 33;
+    constexpr unsigned int n = 47;
+    constexpr unsigned int k = 64;
+
+    Tensor a   = create_tensor<Tensor>(TensorShape(k, m), DataType::F32);
+    Tensor b   = create_tensor<Tensor>(TensorShape(n, k), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(n, m), DataType::F32);
+
+    NEGEMM            gemm{};
+    NEActivationLayer act{};
+    gemm.configure(&a, &b, nullptr, &dst, 1.f, 0.f);
+    act.configure(&dst, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(b), 1, -1.f, 1.f);
+
+    // Nothing is recorded while the telemetry is disabled
+    gemm.run();
+
+    ResetTelemetry                     reset{};
+    std::vector<KernelTelemetryRecord> records;
+    KernelTelemetry::get().set_callback([&](const KernelTelemetryRecord &record) { records.push_back(record); });
+    act.run();
+    ARM_COMPUTE_ASSERT(records.size() == 1);
+    ARM_COMPUTE_EXPECT(!records[0].kernel_name.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(records[0].window_size != 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(records[0].num_threads != 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(records[0].bytes >= 2 * dst.info()->total_size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(records[0].flops == 0, framework::LogLevel::ERRORS);
+
+    // The assembly GEMM kernels estimate their arithmetic operations
+    records.clear();
+    gemm.run();
+    ARM_COMPUTE_EXPECT(!records.empty(), framework::LogLevel::ERRORS);
+    const bool has_gemm_flops = std::any_of(records.begin(), records.end(),
+                                            [&](const KernelTelemetryRecord &record)
+                                            { return record.flops == 2ULL * m * n * k; });
+    ARM_COMPUTE_EXPECT(has_gemm_flops, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // KernelTelemetry
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
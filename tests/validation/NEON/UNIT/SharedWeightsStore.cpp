@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SharedWeightsStore.h"
+
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/NEON/GraphAccessors.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/Utils.h"
+#include "tests/validation/Validation.h"
+
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph::frontend;
+
+namespace
+{
+/** Configures a GEMM computing dst = a * b, allocates its tensors and fills a with the given seed */
+std::unique_ptr<NEGEMM> configure_gemm(Tensor &a, const Tensor &b, Tensor &dst, std::random_device::result_type seed)
+{
+    a   = create_tensor<Tensor>(TensorShape(64U, 33U), DataType::F32);
+    dst = create_tensor<Tensor>(TensorShape(47U, 33U), DataType::F32);
+
+    auto gemm = std::make_unique<NEGEMM>();
+    gemm->configure(&a, &b, nullptr, &dst, 1.f, 0.f);
+
+    a.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), seed, -1.f, 1.f);
+    return gemm;
+}
+
+/** Whether two tensors of the same shape hold the same values, ignoring their padding */
+bool same_content(const Tensor &lhs, const Tensor &rhs)
+{
+    const size_t row_size = lhs.info()->dimension(0) * lhs.info()->element_size();
+    for (size_t y = 0; y < lhs.info()->tensor_shape().total_size_upper(1); ++y)
+    {
+        const Coordinates id(0, static_cast<int>(y));
+        if (std::memcmp(lhs.ptr_to_element(id), rhs.ptr_to_element(id), row_size) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Builds a network made of a fully connected layer, whose weights are the same for all the networks */
+std::unique_ptr<Stream> fully_connected_network(std::vector<SimpleTensor<float>> &outputs)
+{
+    auto graph = std::make_unique<Stream>(0, "shared_weights_network");
+    *graph << Target::NEON
+           << InputLayer(TensorDescriptor(TensorShape(64U, 33U), DataType::F32),
+                         std::make_unique<UniformGraphAccessor>(0, -1.f, 1.f))
+           << FullyConnectedLayer(47U, std::make_unique<UniformGraphAccessor>(1, -1.f, 1.f),
+                                  std::make_unique<UniformGraphAccessor>(2, -1.f, 1.f))
+           << OutputLayer(std::make_unique<CaptureGraphAccessor>(outputs));
+    return graph;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(SharedWeightsStore)
+
+TEST_CASE(AcquireSharesEntries, framework::DatasetMode::ALL)
+{
+    SharedWeightsStore &store = SharedWeightsStore::get();
+    ARM_COMPUTE_ASSERT(store.num_entries() == 0);
+
+    int                                num_produced = 0;
+    const SharedWeightsStore::Key      key{42, 128, {}, "test_transform"};
+    const SharedWeightsStore::Producer producer = [&](void *buffer)
+    {
+        std::memset(buffer, 7, 128);
+        ++num_produced;
+    };
+    {
+        auto first  = store.acquire(key, 256, 64, producer);
+        auto second = store.acquire(key, 256, 64, producer);
+        ARM_COMPUTE_EXPECT(first == second, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(num_produced == 1, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(static_cast<uint8_t *>(first->buffer())[127] == 7, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(first->buffer()) % 64 == 0, framework::LogLevel::ERRORS);
+
+        // The same weights prepared by another transformation are a different entry
+        auto other = store.acquire(SharedWeightsStore::Key{42, 128, {}, "other_transform"}, 128, 64, producer);
+        ARM_COMPUTE_EXPECT(other != first, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(num_produced == 2, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(store.num_entries() == 2, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(store.total_size() == 384, framework::LogLevel::ERRORS);
+    }
+
+    // Entries are released with their last user
+    ARM_COMPUTE_EXPECT(store.num_entries() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(store.total_size() == 0, framework::LogLevel::ERRORS);
+    auto again = store.acquire(key, 256, 64, producer);
+    ARM_COMPUTE_EXPECT(num_produced == 3, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(AcquireChecksSourceOnHashHit, framework::DatasetMode::ALL)
+{
+    SharedWeightsStore &store = SharedWeightsStore::get();
+
+    int                                num_produced = 0;
+    const SharedWeightsStore::Producer producer     = [&](void *) { ++num_produced; };
+
+    const SharedWeightsStore::Key key{42, 128, {1, 2, 3, 4}, "test_transform"};
+    const SharedWeightsStore::Key other_size{42, 256, {1, 2, 3, 4}, "test_transform"};
+    const SharedWeightsStore::Key other_sample{42, 128, {1, 2, 3, 5}, "test_transform"};
+
+    // Weights whose hash collides with the one of weights of a different size or content get their own entry
+    auto entry = store.acquire(key, 64, 64, producer);
+    ARM_COMPUTE_EXPECT(store.acquire(other_size, 64, 64, producer) != entry, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(store.acquire(other_sample, 64, 64, producer) != entry, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(num_produced == 3, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ScopeOnlyEnablesCallingThread, framework::DatasetMode::ALL)
+{
+    SharedWeightsStore &store = SharedWeightsStore::get();
+    ARM_COMPUTE_ASSERT(!store.is_enabled());
+    {
+        const SharedWeightsStore::Scope disabled(false);
+        ARM_COMPUTE_EXPECT(!store.is_enabled(), framework::LogLevel::ERRORS);
+
+        const SharedWeightsStore::Scope enabled{};
+        ARM_COMPUTE_EXPECT(store.is_enabled(), framework::LogLevel::ERRORS);
+
+        bool        enabled_in_other_thread = true;
+        std::thread other([&]() { enabled_in_other_thread = store.is_enabled(); });
+        other.join();
+        ARM_COMPUTE_EXPECT(!enabled_in_other_thread, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(!store.is_enabled(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(HashIgnoresPadding, framework::DatasetMode::ALL)
+{
+    Tensor packed = create_tensor<Tensor>(TensorShape(13U, 7U), DataType::F32);
+    Tensor padded = create_tensor<Tensor>(TensorShape(13U, 7U), DataType::F32);
+    padded.info()->extend_padding(PaddingSize(1U, 3U, 2U, 1U));
+    packed.allocator()->allocate();
+    padded.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(packed), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(padded), 0, -1.f, 1.f);
+
+    ARM_COMPUTE_EXPECT(SharedWeightsStore::hash(packed) == SharedWeightsStore::hash(padded),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(SharedWeightsStore::sample(packed) == SharedWeightsStore::sample(padded),
+                       framework::LogLevel::ERRORS);
+
+    // Any change of the content changes the hash
+    *reinterpret_cast<float *>(padded.ptr_to_element(Coordinates(12, 6))) += 1.f;
+    ARM_COMPUTE_EXPECT(SharedWeightsStore::hash(packed) != SharedWeightsStore::hash(padded),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(GEMMSharesPretransposedWeights, framework::DatasetMode::ALL)
+{
+    Tensor b = create_tensor<Tensor>(TensorShape(47U, 64U), DataType::F32);
+    b.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(b), 1, -1.f, 1.f);
+
+    // Reference computed with private prepared weights
+    Tensor a_ref{};
+    Tensor dst_ref{};
+    auto   gemm_ref = configure_gemm(a_ref, b, dst_ref, 2);
+    gemm_ref->run();
+    ARM_COMPUTE_ASSERT(SharedWeightsStore::get().num_entries() == 0);
+
+    {
+        const SharedWeightsStore::Scope share_weights{};
+        Tensor                          a0{};
+        Tensor                          a1{};
+        Tensor                          dst0{};
+        Tensor                          dst1{};
+        auto                            gemm0 = configure_gemm(a0, b, dst0, 2);
+        auto                            gemm1 = configure_gemm(a1, b, dst1, 2);
+
+        gemm0->run();
+        const size_t shared_size = SharedWeightsStore::get().total_size();
+        gemm1->run();
+
+        // The F32 assembly kernels which don't use a fixed weights format all pretranspose B
+        ARM_COMPUTE_EXPECT(SharedWeightsStore::get().num_entries() == 1, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(shared_size > 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(SharedWeightsStore::get().total_size() == shared_size, framework::LogLevel::ERRORS);
+
+        // The shared weights are the ones the function would have prepared on its own
+        ARM_COMPUTE_EXPECT(same_content(dst0, dst_ref), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(same_content(dst1, dst_ref), framework::LogLevel::ERRORS);
+
+        gemm0.reset();
+        ARM_COMPUTE_EXPECT(SharedWeightsStore::get().total_size() == shared_size, framework::LogLevel::ERRORS);
+        gemm1.reset();
+    }
+    ARM_COMPUTE_EXPECT(SharedWeightsStore::get().num_entries() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(GraphSharesWeights, framework::DatasetMode::ALL)
+{
+    std::vector<SimpleTensor<float>> outputs;
+
+    // Reference computed with private prepared weights
+    auto reference = fully_connected_network(outputs);
+    reference->finalize(Target::NEON, GraphConfig());
+    reference->run();
+    ARM_COMPUTE_ASSERT(SharedWeightsStore::get().num_entries() == 0);
+
+    GraphConfig config;
+    config.share_weights = true;
+    auto graph0          = fully_connected_network(outputs);
+    auto graph1          = fully_connected_network(outputs);
+    graph0->finalize(Target::NEON, config);
+    graph1->finalize(Target::NEON, config);
+
+    // The sharing only applies to the functions of the graphs
+    ARM_COMPUTE_EXPECT(!SharedWeightsStore::get().is_enabled(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(SharedWeightsStore::get().num_entries() == 1, framework::LogLevel::ERRORS);
+
+    graph0->run();
+    graph1->run();
+    ARM_COMPUTE_ASSERT(outputs.size() == 3);
+    validate(SimpleTensorAccessor<float>(outputs[1]), outputs[0], AbsoluteTolerance<float>(0.f));
+    validate(SimpleTensorAccessor<float>(outputs[2]), outputs[0], AbsoluteTolerance<float>(0.f));
+
+    graph0.reset();
+    graph1.reset();
+    ARM_COMPUTE_EXPECT(SharedWeightsStore::get().num_entries() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // SharedWeightsStore
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
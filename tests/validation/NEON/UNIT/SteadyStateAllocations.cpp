@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NESoftmaxLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/instruments/AllocationCounter.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Allocates and fills the given tensors */
+void allocate_and_fill(const std::vector<Tensor *> &tensors)
+{
+    std::random_device::result_type seed = 0;
+    for (Tensor *tensor : tensors)
+    {
+        tensor->allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(*tensor), seed++, -1.f, 1.f);
+    }
+}
+
+/** Runs a function once to warm it up, then returns the number of allocations made by a second run */
+template <typename F>
+uint64_t steady_state_allocations(F &func)
+{
+    func.run();
+
+    framework::AllocationScope scope;
+    func.run();
+    return scope.allocations();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(SteadyStateAllocations)
+
+TEST_CASE(ImportMemory, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+    auto             data0 = std::make_unique<float[]>(info.tensor_shape().total_size());
+    auto             data1 = std::make_unique<float[]>(info.tensor_shape().total_size());
+
+    Tensor tensor;
+    tensor.allocator()->init(info);
+    {
+        framework::AllocationScope scope;
+        ARM_COMPUTE_ASSERT(bool(tensor.allocator()->import_memory(data0.get())));
+        ARM_COMPUTE_ASSERT(bool(tensor.allocator()->import_memory(data1.get())));
+        ARM_COMPUTE_EXPECT(scope.allocations() == 0, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(tensor.buffer() == reinterpret_cast<uint8_t *>(data1.get()), framework::LogLevel::ERRORS);
+
+    // The imported memory follows the allocator when it is moved
+    Tensor moved(std::move(tensor));
+    ARM_COMPUTE_EXPECT(moved.buffer() == reinterpret_cast<uint8_t *>(data1.get()), framework::LogLevel::ERRORS);
+    Tensor assigned;
+    assigned = std::move(moved);
+    ARM_COMPUTE_EXPECT(assigned.buffer() == reinterpret_cast<uint8_t *>(data1.get()), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TensorPack, framework::DatasetMode::ALL)
+{
+    const size_t        num_tensors = ITensorPack::inline_capacity + 4;
+    std::vector<Tensor> tensors(num_tensors);
+
+    framework::AllocationScope scope;
+    ITensorPack                small_pack{{TensorType::ACL_SRC, &tensors[0]}, {TensorType::ACL_DST, &tensors[1]}};
+    small_pack.add_tensor(TensorType::ACL_DST, &tensors[2]);
+    small_pack.remove_tensor(TensorType::ACL_SRC);
+    ARM_COMPUTE_EXPECT(scope.allocations() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(small_pack.size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(small_pack.get_tensor(TensorType::ACL_DST) == &tensors[2], framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(small_pack.get_tensor(TensorType::ACL_SRC) == nullptr, framework::LogLevel::ERRORS);
+
+    // Packs larger than the inline capacity keep working
+    ITensorPack large_pack;
+    for (size_t i = 0; i < num_tensors; ++i)
+    {
+        large_pack.add_const_tensor(static_cast<int>(i), &tensors[i]);
+    }
+    large_pack.remove_tensor(0);
+    ARM_COMPUTE_EXPECT(large_pack.size() == num_tensors - 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(large_pack.get_const_tensor(0) == nullptr, framework::LogLevel::ERRORS);
+    for (size_t i = 1; i < num_tensors; ++i)
+    {
+        ARM_COMPUTE_EXPECT(large_pack.get_const_tensor(static_cast<int>(i)) == &tensors[i],
+                           framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(large_pack.get_tensor(static_cast<int>(i)) == nullptr, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(ActivationLayer, framework::DatasetMode::ALL)
+{
+    Tensor src = create_tensor<Tensor>(TensorShape(27U, 13U, 2U), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(27U, 13U, 2U), DataType::F32);
+
+    NEActivationLayer act;
+    act.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    allocate_and_fill({&src, &dst});
+
+    ARM_COMPUTE_EXPECT(steady_state_allocations(act) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SoftmaxLayer, framework::DatasetMode::ALL)
+{
+    Tensor src = create_tensor<Tensor>(TensorShape(128U, 13U), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(128U, 13U), DataType::F32);
+
+    NESoftmaxLayer softmax;
+    softmax.configure(&src, &dst);
+    allocate_and_fill({&src, &dst});
+
+    ARM_COMPUTE_EXPECT(steady_state_allocations(softmax) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(GEMM, framework::DatasetMode::ALL)
+{
+    Tensor a   = create_tensor<Tensor>(TensorShape(64U, 33U), DataType::F32);
+    Tensor b   = create_tensor<Tensor>(TensorShape(47U, 64U), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(47U, 33U), DataType::F32);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, nullptr, &dst, 1.f, 0.f);
+    allocate_and_fill({&a, &b, &dst});
+
+    ARM_COMPUTE_EXPECT(steady_state_allocations(gemm) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ConvolutionLayer, framework::DatasetMode::ALL)
+{
+    Tensor src     = create_tensor<Tensor>(TensorShape(16U, 17U, 15U), DataType::F32, 1, QuantizationInfo(),
+                                           DataLayout::NHWC);
+    Tensor weights = create_tensor<Tensor>(TensorShape(16U, 3U, 3U, 8U), DataType::F32, 1, QuantizationInfo(),
+                                           DataLayout::NHWC);
+    Tensor biases  = create_tensor<Tensor>(TensorShape(8U), DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(TensorShape(8U, 17U, 15U), DataType::F32, 1, QuantizationInfo(),
+                                           DataLayout::NHWC);
+
+    NEConvolutionLayer conv;
+    conv.configure(&src, &weights, &biases, &dst, PadStrideInfo(1, 1, 1, 1));
+    allocate_and_fill({&src, &weights, &biases, &dst});
+
+    ARM_COMPUTE_EXPECT(steady_state_allocations(conv) == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // SteadyStateAllocations
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <atomic>
 #include <stdexcept>
 
 using namespace arm_compute;
@@ -64,6 +65,58 @@ public:
         throw TestException();
     }
 };
+
+/** Kernel counting the elements of its window it ran on */
+class CountingKernel : public ICPPKernel
+{
+public:
+    explicit CountingKernel(std::atomic<int> &count) : _count(count)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 8));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "CountingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        _count += window.num_iterations(0);
+    }
+
+private:
+    std::atomic<int> &_count;
+};
+
+/** Kernel scheduling another kernel from each of its workloads */
+class NestingKernel : public ICPPKernel
+{
+public:
+    NestingKernel(IScheduler &inner_scheduler, ICPPKernel &inner_kernel)
+        : _inner_scheduler(inner_scheduler), _inner_kernel(inner_kernel)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 2));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "NestingKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        _inner_scheduler.schedule(&_inner_kernel, IScheduler::Hints(0));
+    }
+
+private:
+    IScheduler &_inner_scheduler;
+    ICPPKernel &_inner_kernel;
+};
 } // namespace
 
 TEST_SUITE(UNIT)
@@ -86,6 +139,22 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(NestedSchedule, framework::DatasetMode::ALL)
+{
+    // Both schedulers run a workload on the calling thread, so the inner launches are nested in the outer one
+    CPPScheduler outer_scheduler;
+    CPPScheduler inner_scheduler;
+    outer_scheduler.set_num_threads(2);
+    inner_scheduler.set_num_threads(2);
+
+    std::atomic<int> count{0};
+    CountingKernel   inner_kernel(count);
+    NestingKernel    outer_kernel(inner_scheduler, inner_kernel);
+
+    outer_scheduler.schedule(&outer_kernel, CPPScheduler::Hints(0));
+    ARM_COMPUTE_EXPECT(count == 16, framework::LogLevel::ERRORS);
+}
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
 TEST_SUITE_END()
 TEST_SUITE_END()
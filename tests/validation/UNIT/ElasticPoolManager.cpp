@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/BlobMemoryPool.h"
+#include "arm_compute/runtime/ElasticPoolManager.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr size_t pool_size = 64U;
+
+std::unique_ptr<IMemoryPool> create_pool(Allocator &allocator)
+{
+    return std::make_unique<BlobMemoryPool>(&allocator, std::vector<BlobInfo>{BlobInfo(pool_size)});
+}
+
+/** Clock that only moves when the test advances it */
+class ManualClock
+{
+public:
+    /** Returns a function reading the current time of this clock */
+    ElasticPoolManager::ClockFunction function()
+    {
+        return [this]() { return ElasticPoolManager::Clock::time_point(std::chrono::milliseconds(_now_ms.load())); };
+    }
+    /** Moves the clock forward by @p duration */
+    void advance(std::chrono::milliseconds duration)
+    {
+        _now_ms += duration.count();
+    }
+
+private:
+    std::atomic<std::chrono::milliseconds::rep> _now_ms{0};
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(ElasticPoolManager)
+
+/** Validate that pools are created when all of them are occupied */
+TEST_CASE(GrowOnDemand, framework::DatasetMode::ALL)
+{
+    Allocator          allocator{};
+    ElasticPoolManager pool_mgr{};
+    pool_mgr.register_pool(create_pool(allocator));
+
+    IMemoryPool *pool0 = pool_mgr.lock_pool();
+    IMemoryPool *pool1 = pool_mgr.lock_pool();
+    IMemoryPool *pool2 = pool_mgr.lock_pool();
+
+    ARM_COMPUTE_EXPECT(pool0 != pool1 && pool1 != pool2 && pool0 != pool2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 3, framework::LogLevel::ERRORS);
+
+    pool_mgr.unlock_pool(pool1);
+    ARM_COMPUTE_EXPECT(pool_mgr.lock_pool() == pool1, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool0);
+    pool_mgr.unlock_pool(pool1);
+    pool_mgr.unlock_pool(pool2);
+
+    const ElasticPoolManagerStats stats = pool_mgr.stats();
+    ARM_COMPUTE_EXPECT(stats.num_pools == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_pools_created == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_pools_high_water_mark == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.memory_size == 3 * pool_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_locks == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_waits == 0, framework::LogLevel::ERRORS);
+}
+
+/** Validate that pools can be registered while others are occupied */
+TEST_CASE(RegisterWhileOccupied, framework::DatasetMode::ALL)
+{
+    Allocator          allocator{};
+    ElasticPoolManager pool_mgr{pool_size};
+    pool_mgr.register_pool(create_pool(allocator));
+
+    IMemoryPool *pool0 = pool_mgr.lock_pool();
+    pool_mgr.register_pool(create_pool(allocator));
+    IMemoryPool *pool1 = pool_mgr.lock_pool();
+
+    ARM_COMPUTE_EXPECT(pool0 != pool1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.stats().num_pools_created == 0, framework::LogLevel::ERRORS);
+
+    pool_mgr.unlock_pool(pool1);
+    pool_mgr.unlock_pool(pool0);
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.stats().memory_size == pool_size, framework::LogLevel::ERRORS);
+}
+
+/** Validate that idle pools are trimmed but the last one is kept */
+TEST_CASE(TrimIdlePools, framework::DatasetMode::ALL)
+{
+    Allocator          allocator{};
+    ManualClock        clock{};
+    ElasticPoolManager pool_mgr{0, std::chrono::milliseconds(10), clock.function()};
+    pool_mgr.register_pool(create_pool(allocator));
+
+    IMemoryPool *pool0 = pool_mgr.lock_pool();
+    IMemoryPool *pool1 = pool_mgr.lock_pool();
+    IMemoryPool *pool2 = pool_mgr.lock_pool();
+    pool_mgr.unlock_pool(pool0);
+    clock.advance(std::chrono::milliseconds(5));
+    pool_mgr.unlock_pool(pool1);
+    pool_mgr.unlock_pool(pool2);
+
+    // No pool has been idle for longer than the timeout yet
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.trim_idle_pools() == 0, framework::LogLevel::ERRORS);
+
+    // pool0 has been idle for 11ms and the others for 6ms
+    clock.advance(std::chrono::milliseconds(6));
+    ARM_COMPUTE_EXPECT(pool_mgr.trim_idle_pools() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 2, framework::LogLevel::ERRORS);
+
+    // Unlocking also trims: pool1 has been idle for 15ms while the most recently used pool2 is locked and unlocked
+    clock.advance(std::chrono::milliseconds(9));
+    IMemoryPool *pool3 = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(pool3 == pool2, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool3);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 1, framework::LogLevel::ERRORS);
+
+    // The last pool is never trimmed
+    clock.advance(std::chrono::hours(1));
+    ARM_COMPUTE_EXPECT(pool_mgr.trim_idle_pools() == 0, framework::LogLevel::ERRORS);
+
+    const ElasticPoolManagerStats stats = pool_mgr.stats();
+    ARM_COMPUTE_EXPECT(stats.num_pools == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_pools_trimmed == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.memory_size == pool_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.memory_high_water_mark == 3 * pool_size, framework::LogLevel::ERRORS);
+
+    // The remaining pool is still usable as a prototype
+    IMemoryPool *pool4 = pool_mgr.lock_pool();
+    IMemoryPool *pool5 = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(pool4 != pool5, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool4);
+    pool_mgr.unlock_pool(pool5);
+}
+
+#ifndef NO_MULTI_THREADING
+/** Validate that lock_pool() waits for a free pool once the memory budget is exhausted */
+TEST_CASE(MemoryBudget, framework::DatasetMode::ALL)
+{
+    Allocator          allocator{};
+    ManualClock        clock{};
+    ElasticPoolManager pool_mgr{2 * pool_size, std::chrono::milliseconds(0), clock.function()};
+    pool_mgr.register_pool(create_pool(allocator));
+
+    IMemoryPool *pool0 = pool_mgr.lock_pool();
+    IMemoryPool *pool1 = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 2, framework::LogLevel::ERRORS);
+
+    IMemoryPool *pool2 = nullptr;
+    std::thread  waiter([&]() { pool2 = pool_mgr.lock_pool(); });
+
+    // lock_pool() holds the mutex from counting the lock until it waits,
+    // so the waiter is blocked once its lock has been counted
+    while (pool_mgr.stats().num_locks < 3)
+    {
+        std::this_thread::yield();
+    }
+    clock.advance(std::chrono::milliseconds(3));
+    pool_mgr.unlock_pool(pool1);
+    waiter.join();
+
+    ARM_COMPUTE_EXPECT(pool2 == pool1, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool0);
+    pool_mgr.unlock_pool(pool2);
+
+    const ElasticPoolManagerStats stats = pool_mgr.stats();
+    ARM_COMPUTE_EXPECT(stats.num_pools == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.memory_high_water_mark == 2 * pool_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_waits == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.total_wait_time == std::chrono::milliseconds(3), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.max_wait_time == std::chrono::milliseconds(3), framework::LogLevel::ERRORS);
+}
+#endif /* NO_MULTI_THREADING */
+
+/** Validate that the memory manager can be populated with a single pool */
+TEST_CASE(MemoryManagerPopulate, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lft_mgr  = std::make_shared<BlobLifetimeManager>();
+    auto      pool_mgr = std::make_shared<ElasticPoolManager>();
+    auto      mm       = std::make_shared<MemoryManagerOnDemand>(lft_mgr, pool_mgr);
+
+    mm->populate(allocator, 1);
+    ARM_COMPUTE_EXPECT(pool_mgr->num_pools() == 1, framework::LogLevel::ERRORS);
+
+    IMemoryPool *pool0 = pool_mgr->lock_pool();
+    IMemoryPool *pool1 = pool_mgr->lock_pool();
+    ARM_COMPUTE_EXPECT(pool_mgr->num_pools() == 2, framework::LogLevel::ERRORS);
+    pool_mgr->unlock_pool(pool0);
+    pool_mgr->unlock_pool(pool1);
+
+    mm->clear();
+    ARM_COMPUTE_EXPECT(pool_mgr->num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ElasticPoolManager
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
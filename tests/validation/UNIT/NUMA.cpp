@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NUMAAllocator.h"
+#include "arm_compute/runtime/PoolManager.h"
+
+#include "src/common/cpuinfo/CpuInfo.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Scheduler recording the cores its threads would be bound to instead of pinning them */
+class MockScheduler final : public IScheduler
+{
+public:
+    void set_num_threads(unsigned int num_threads) override
+    {
+        _num_threads = num_threads;
+    }
+    void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override
+    {
+        _num_threads = num_threads;
+        _bound_cores.clear();
+        for (unsigned int i = 0; i < num_threads; ++i)
+        {
+            _bound_cores.push_back(func(i, num_threads));
+        }
+    }
+    unsigned int num_threads() const override
+    {
+        return _num_threads;
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ARM_COMPUTE_UNUSED(kernel, hints);
+    }
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override
+    {
+        ARM_COMPUTE_UNUSED(kernel, hints, window, tensors);
+    }
+    const std::vector<int> &bound_cores() const
+    {
+        return _bound_cores;
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ARM_COMPUTE_UNUSED(workloads);
+    }
+
+private:
+    unsigned int     _num_threads{1};
+    std::vector<int> _bound_cores{};
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(NUMA)
+
+TEST_CASE(ParseCpuList, framework::DatasetMode::ALL)
+{
+    const std::vector<uint32_t> expected{0, 1, 2, 3, 8, 10, 11};
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cpu_list("0-3,8,10-11") == expected, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cpu_list(" 0-3, 8,10-11 ") == expected, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cpu_list("").empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Topology, framework::DatasetMode::ALL)
+{
+    const CPUInfo &cpu_info = CPUInfo::get();
+    ARM_COMPUTE_EXPECT(cpu_info.get_numa_node_count() >= 1, framework::LogLevel::ERRORS);
+
+    // Every CPU reported by a node must map back to that node
+    for (unsigned int node = 0; node < cpu_info.get_numa_node_count(); ++node)
+    {
+        for (const auto cpu : cpu_info.get_numa_node_cpus(node))
+        {
+            ARM_COMPUTE_EXPECT(cpu_info.get_numa_node_of_cpu(cpu) == static_cast<int>(node),
+                               framework::LogLevel::ERRORS);
+        }
+    }
+    ARM_COMPUTE_EXPECT(cpu_info.get_numa_node_cpus(cpu_info.get_numa_node_count()).empty(),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Allocator, framework::DatasetMode::ALL)
+{
+    NUMAAllocator allocator(0);
+
+    // Raw allocation
+    constexpr size_t size = 3 * 4096 + 17;
+    auto            *ptr  = static_cast<uint8_t *>(allocator.allocate(size, 64));
+    ARM_COMPUTE_EXPECT(ptr != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(ptr) % 64 == 0, framework::LogLevel::ERRORS);
+    std::memset(ptr, 0xA5, size);
+    allocator.free(ptr);
+
+    // Memory regions
+    auto region = allocator.make_region(size, 64);
+    ARM_COMPUTE_EXPECT(region->buffer() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(region->size() == size, framework::LogLevel::ERRORS);
+    auto subregion = region->extract_subregion(64, 128);
+    ARM_COMPUTE_EXPECT(subregion != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(static_cast<uint8_t *>(subregion->buffer()) == static_cast<uint8_t *>(region->buffer()) + 64,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(region->extract_subregion(size, 1) == nullptr, framework::LogLevel::ERRORS);
+
+    // Mappings cannot be aligned beyond a page
+    ARM_COMPUTE_EXPECT_THROW(allocator.allocate(size, 1024 * 1024), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(MemoryManagerPopulate, framework::DatasetMode::ALL)
+{
+    auto          lft_mgr  = std::make_shared<BlobLifetimeManager>();
+    auto          pool_mgr = std::make_shared<PoolManager>();
+    auto          mm       = std::make_shared<MemoryManagerOnDemand>(lft_mgr, pool_mgr);
+    NUMAAllocator allocator(0);
+
+    mm->populate(allocator, 2);
+    ARM_COMPUTE_EXPECT(pool_mgr->num_pools() == 2, framework::LogLevel::ERRORS);
+    mm->clear();
+}
+
+TEST_CASE(SchedulerBinding, framework::DatasetMode::ALL)
+{
+    MockScheduler scheduler;
+    ARM_COMPUTE_EXPECT(scheduler.numa_node() == -1, framework::LogLevel::ERRORS);
+
+    const std::vector<unsigned int> cpus = CPUInfo::get().get_numa_node_cpus(0);
+    scheduler.set_num_threads_on_numa_node(0, 0);
+    ARM_COMPUTE_EXPECT(scheduler.numa_node() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.bound_cores().size() == cpus.size(), framework::LogLevel::ERRORS);
+
+    // Threads beyond the number of cores of the node wrap around the node's cores
+    scheduler.set_num_threads_on_numa_node(2 * cpus.size() + 1, 0);
+    ARM_COMPUTE_EXPECT(scheduler.bound_cores().size() == 2 * cpus.size() + 1, framework::LogLevel::ERRORS);
+    for (const auto core : scheduler.bound_cores())
+    {
+        ARM_COMPUTE_EXPECT(std::find(cpus.begin(), cpus.end(), static_cast<unsigned int>(core)) != cpus.end(),
+                           framework::LogLevel::ERRORS);
+    }
+
+    // Binding to a node without CPUs is an error and keeps the previous binding
+    ARM_COMPUTE_EXPECT_THROW(scheduler.set_num_threads_on_numa_node(1, CPUInfo::get().get_numa_node_count()),
+                             framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.numa_node() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // NUMA
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+#if defined(ACL_PROFILE_ENABLE) && (ACL_PROFILE_BACKEND == PERFETTO) && defined(ARM_COMPUTE_CPP_SCHEDULER) && \
+    !defined(BARE_METAL)
+namespace
+{
+/** Track event decoded from a trace */
+struct TraceEvent
+{
+    std::string           category;             /**< Category of the event */
+    std::string           name;                 /**< Name of the event, empty for the end of slices and counters */
+    std::set<std::string> track_names;          /**< Names given to the track of the event */
+    int64_t               counter_value;        /**< Value of counter events */
+    std::vector<uint64_t> flow_ids;             /**< Flows started by the event */
+    std::vector<uint64_t> terminating_flow_ids; /**< Flows terminated by the event */
+};
+
+/** Tracing session recording the ACL track events of some categories only, next to the session of the library */
+class TraceSession
+{
+public:
+    /** Starts the session
+     *
+     * @param[in] categories Categories to record
+     */
+    explicit TraceSession(const std::vector<std::string> &categories)
+    {
+        perfetto::protos::gen::TrackEventConfig track_event_cfg;
+        track_event_cfg.add_disabled_categories("*");
+        for (const auto &category : categories)
+        {
+            track_event_cfg.add_enabled_categories(category);
+        }
+
+        perfetto::TraceConfig cfg;
+        cfg.add_buffers()->set_size_kb(4096);
+        auto *ds_cfg = cfg.add_data_sources()->mutable_config();
+        ds_cfg->set_name("track_event");
+        ds_cfg->set_track_event_config_raw(track_event_cfg.SerializeAsString());
+
+        _session = perfetto::Tracing::NewTrace();
+        _session->Setup(cfg);
+        _session->StartBlocking();
+    }
+
+    /** Stops the session
+     *
+     * @return The track events of the trace, in the order they were written on each thread
+     */
+    std::vector<TraceEvent> stop()
+    {
+        perfetto::TrackEvent::Flush();
+        _session->StopBlocking();
+        const std::vector<char> trace = _session->ReadTraceBlocking();
+        return decode(trace);
+    }
+
+private:
+    /** State of a sequence of packets, which is written by one thread */
+    struct SequenceState
+    {
+        std::map<uint64_t, std::string> event_names{};
+        std::map<uint64_t, std::string> event_categories{};
+        uint64_t                        default_track{0};
+    };
+
+    static std::vector<TraceEvent> decode(const std::vector<char> &trace)
+    {
+        std::map<uint32_t, SequenceState>            sequences;
+        std::map<uint64_t, std::set<std::string>>    track_names;
+        std::vector<std::pair<uint64_t, TraceEvent>> events;
+
+        // A trace is a sequence of TracePacket messages, all in field 1
+        protozero::ProtoDecoder decoder(trace.data(), trace.size());
+        for (auto field = decoder.ReadField(); field.valid(); field = decoder.ReadField())
+        {
+            if (field.id() != 1)
+            {
+                continue;
+            }
+            perfetto::protos::pbzero::TracePacket::Decoder packet(field.data(), field.size());
+            SequenceState &state = sequences[packet.trusted_packet_sequence_id()];
+
+            if (packet.has_interned_data())
+            {
+                perfetto::protos::pbzero::InternedData::Decoder interned_data(packet.interned_data());
+                for (auto it = interned_data.event_names(); it; ++it)
+                {
+                    perfetto::protos::pbzero::EventName::Decoder entry(*it);
+                    state.event_names[entry.iid()] = entry.name().ToStdString();
+                }
+                for (auto it = interned_data.event_categories(); it; ++it)
+                {
+                    perfetto::protos::pbzero::EventCategory::Decoder entry(*it);
+                    state.event_categories[entry.iid()] = entry.name().ToStdString();
+                }
+            }
+            if (packet.has_trace_packet_defaults())
+            {
+                perfetto::protos::pbzero::TracePacketDefaults::Decoder defaults(packet.trace_packet_defaults());
+                if (defaults.has_track_event_defaults())
+                {
+                    perfetto::protos::pbzero::TrackEventDefaults::Decoder track_event_defaults(
+                        defaults.track_event_defaults());
+                    state.default_track = track_event_defaults.track_uuid();
+                }
+            }
+            if (packet.has_track_descriptor())
+            {
+                // A track can be described several times, by the library and by Perfetto, so all its names are kept
+                perfetto::protos::pbzero::TrackDescriptor::Decoder track_descriptor(packet.track_descriptor());
+                std::set<std::string> &names = track_names[track_descriptor.uuid()];
+                if (track_descriptor.has_name())
+                {
+                    names.insert(track_descriptor.name().ToStdString());
+                }
+                if (track_descriptor.has_static_name())
+                {
+                    names.insert(track_descriptor.static_name().ToStdString());
+                }
+                if (track_descriptor.has_thread())
+                {
+                    perfetto::protos::pbzero::ThreadDescriptor::Decoder thread(track_descriptor.thread());
+                    names.insert(thread.thread_name().ToStdString());
+                }
+            }
+            if (packet.has_track_event())
+            {
+                perfetto::protos::pbzero::TrackEvent::Decoder track_event(packet.track_event());
+
+                TraceEvent event{};
+                if (auto iid_it = track_event.category_iids())
+                {
+                    event.category = state.event_categories[*iid_it];
+                }
+                else if (auto cat_it = track_event.categories())
+                {
+                    event.category = cat_it->ToStdString();
+                }
+                if (track_event.name_iid() != 0)
+                {
+                    event.name = state.event_names[track_event.name_iid()];
+                }
+                else if (track_event.has_name())
+                {
+                    event.name = track_event.name().ToStdString();
+                }
+                event.counter_value = track_event.counter_value();
+                for (auto it = track_event.flow_ids(); it; ++it)
+                {
+                    event.flow_ids.push_back(*it);
+                }
+                for (auto it = track_event.terminating_flow_ids(); it; ++it)
+                {
+                    event.terminating_flow_ids.push_back(*it);
+                }
+                const uint64_t track = track_event.has_track_uuid() ? track_event.track_uuid() : state.default_track;
+                events.emplace_back(track, event);
+            }
+        }
+
+        // Tracks can be described after their first event, so they are named once the whole trace is read
+        std::vector<TraceEvent> result;
+        for (auto &event : events)
+        {
+            event.second.track_names = track_names[event.first];
+            result.push_back(event.second);
+        }
+        return result;
+    }
+
+    std::unique_ptr<perfetto::TracingSession> _session{};
+};
+
+/** Kernel emitting a trace event under the CPU category from each of its workloads */
+class TracedKernel : public ICPPKernel
+{
+public:
+    TracedKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 16));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "TracedKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "TracedKernel::run");
+    }
+};
+
+/** Runs a kernel on four threads */
+void run_traced_kernel()
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+    TracedKernel kernel;
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+}
+
+size_t count_events(const std::vector<TraceEvent> &events, const std::string &name)
+{
+    return std::count_if(events.begin(), events.end(), [&](const TraceEvent &event) { return event.name == name; });
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Profiling)
+
+// A session only gets the events of the categories it enables
+TEST_CASE(CategoryFiltering, framework::DatasetMode::ALL)
+{
+    for (const std::string category : {ARM_COMPUTE_PROF_CAT_SCHEDULER, ARM_COMPUTE_PROF_CAT_CPU})
+    {
+        TraceSession session({category});
+        run_traced_kernel();
+        const std::vector<TraceEvent> events = session.stop();
+
+        const bool scheduler_only = category == ARM_COMPUTE_PROF_CAT_SCHEDULER;
+        ARM_COMPUTE_EXPECT((count_events(events, "CPPScheduler::run_workloads") != 0) == scheduler_only,
+                           framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT((count_events(events, "TracedKernel::run") != 0) == !scheduler_only,
+                           framework::LogLevel::ERRORS);
+        for (const auto &event : events)
+        {
+            ARM_COMPUTE_EXPECT(event.category.empty() || event.category == category, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+// Every workload is linked by a flow to the launch of the workloads, and runs on a named scheduler thread
+TEST_CASE(SchedulerFlows, framework::DatasetMode::ALL)
+{
+    TraceSession session({ARM_COMPUTE_PROF_CAT_SCHEDULER});
+    run_traced_kernel();
+    const std::vector<TraceEvent> events = session.stop();
+
+    std::set<uint64_t> started;
+    for (const auto &event : events)
+    {
+        if (event.name == "CPPScheduler::run_workloads")
+        {
+            ARM_COMPUTE_EXPECT(started.empty(), framework::LogLevel::ERRORS);
+            started.insert(event.flow_ids.begin(), event.flow_ids.end());
+        }
+    }
+    ARM_COMPUTE_EXPECT(started.size() > 1, framework::LogLevel::ERRORS);
+
+    std::multiset<uint64_t> terminated;
+    bool                    ran_on_worker = false;
+    for (const auto &event : events)
+    {
+        if (event.name == "CPPScheduler::workload")
+        {
+            ARM_COMPUTE_EXPECT(event.terminating_flow_ids.size() == 1, framework::LogLevel::ERRORS);
+            terminated.insert(event.terminating_flow_ids.begin(), event.terminating_flow_ids.end());
+            ran_on_worker |= event.track_names.count("CPPScheduler worker") != 0;
+        }
+    }
+    // Each workload terminates its own flow, and the workloads past the first one are run by the worker threads
+    ARM_COMPUTE_EXPECT(terminated == std::multiset<uint64_t>(started.begin(), started.end()),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(ran_on_worker, framework::LogLevel::ERRORS);
+}
+
+// The memory counters go up by the size of a pool while it is alive
+TEST_CASE(MemoryCounters, framework::DatasetMode::ALL)
+{
+    constexpr size_t pool_size = 1024;
+
+    TraceSession session({ARM_COMPUTE_PROF_CAT_MEMORY});
+    {
+        Allocator        allocator;
+        OffsetMemoryPool pool(&allocator, BlobInfo(pool_size));
+    }
+    const std::vector<TraceEvent> events = session.stop();
+
+    std::vector<int64_t> values;
+    for (const auto &event : events)
+    {
+        if (event.track_names.count("Memory pools bytes") != 0)
+        {
+            values.push_back(event.counter_value);
+        }
+    }
+    ARM_COMPUTE_ASSERT(values.size() == 2);
+    ARM_COMPUTE_EXPECT(values[0] - values[1] == static_cast<int64_t>(pool_size), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // Profiling
+TEST_SUITE_END() // UNIT
+#endif // defined(ACL_PROFILE_ENABLE) && (ACL_PROFILE_BACKEND == PERFETTO) && defined(ARM_COMPUTE_CPP_SCHEDULER)
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/frontend/RequestBatcher.h"
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph::frontend;
+
+#if !defined(BARE_METAL)
+namespace
+{
+constexpr size_t sample_size = 3U; /**< Number of elements per sample */
+
+/** Creates a batched tensor of @p batch_size samples, with or without padding */
+void init_batch_tensor(Tensor &tensor, size_t batch_size, bool padded = false)
+{
+    TensorInfo info(TensorShape(sample_size, batch_size), 1, DataType::F32);
+    if (padded)
+    {
+        info.extend_padding(PaddingSize(1U, 2U, 1U, 2U));
+    }
+    tensor.allocator()->init(info);
+    tensor.allocator()->allocate();
+}
+
+float &element(Tensor &tensor, size_t sample, size_t i)
+{
+    return *reinterpret_cast<float *>(tensor.ptr_to_element(Coordinates(i, sample)));
+}
+
+/** Stands in for the graph: writes, for every sample of the input, the sample times 10 to the output */
+void run_batch(Tensor &input, Tensor &output)
+{
+    const size_t batch_size = input.info()->dimension(1);
+    for (size_t sample = 0; sample < batch_size; ++sample)
+    {
+        for (size_t i = 0; i < sample_size; ++i)
+        {
+            element(output, sample, i) = element(input, sample, i) * 10.f;
+        }
+    }
+}
+
+/** Requests whose input samples hold their index */
+struct Requests
+{
+    explicit Requests(size_t num_requests) : inputs(num_requests), outputs(num_requests), futures(num_requests)
+    {
+        for (size_t r = 0; r < num_requests; ++r)
+        {
+            inputs[r]  = std::vector<float>(sample_size, static_cast<float>(r + 1));
+            outputs[r] = std::vector<float>(sample_size, 0.f);
+        }
+    }
+
+    void submit(RequestBatcher &batcher, size_t r)
+    {
+        futures[r] = batcher.submit(inputs[r].data(), outputs[r].data());
+    }
+
+    bool is_done(size_t r) const
+    {
+        return futures[r].wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    std::vector<std::vector<float>> inputs;
+    std::vector<std::vector<float>> outputs;
+    std::vector<std::future<void>>  futures;
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(RequestBatcher)
+/** Validate that a batch holds at most the maximum batch size and is dispatched as soon as it is full */
+TEST_CASE(MaxBatchSize, framework::DatasetMode::ALL)
+{
+    RequestBatcherInfo info;
+    info.max_batch_size  = 4U;
+    info.max_queue_delay = std::chrono::seconds(10);
+
+    RequestBatcher batcher(info);
+    auto           input_accessor  = batcher.input_accessor();
+    auto           output_accessor = batcher.output_accessor();
+
+    Tensor input, output;
+    init_batch_tensor(input, info.max_batch_size);
+    init_batch_tensor(output, info.max_batch_size);
+
+    Requests requests(6U);
+    for (size_t r = 0; r < 6U; ++r)
+    {
+        requests.submit(batcher, r);
+    }
+
+    // The first batch is full so it doesn't wait for the queue delay
+    const auto start = std::chrono::steady_clock::now();
+    ARM_COMPUTE_EXPECT(input_accessor->access_tensor(input), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::chrono::steady_clock::now() - start < std::chrono::seconds(5), framework::LogLevel::ERRORS);
+    for (size_t sample = 0; sample < info.max_batch_size; ++sample)
+    {
+        ARM_COMPUTE_EXPECT(element(input, sample, 0) == static_cast<float>(sample + 1), framework::LogLevel::ERRORS);
+    }
+
+    run_batch(input, output);
+    ARM_COMPUTE_EXPECT(output_accessor->access_tensor(output), framework::LogLevel::ERRORS);
+    for (size_t r = 0; r < 6U; ++r)
+    {
+        ARM_COMPUTE_EXPECT(requests.is_done(r) == (r < info.max_batch_size), framework::LogLevel::ERRORS);
+    }
+
+    // A full batch is also dispatched as soon as it fills up while the input accessor is waiting
+    info.max_batch_size = 2U;
+    RequestBatcher waiting_batcher(info);
+    Tensor         small_input;
+    init_batch_tensor(small_input, info.max_batch_size);
+
+    Requests   waiting_requests(2U);
+    const auto waiting_start = std::chrono::steady_clock::now();
+    auto       gathered      = std::async(std::launch::async, [&]()
+                                          { return waiting_batcher.input_accessor()->access_tensor(small_input); });
+    waiting_requests.submit(waiting_batcher, 0);
+    waiting_requests.submit(waiting_batcher, 1);
+    ARM_COMPUTE_EXPECT(gathered.get(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::chrono::steady_clock::now() - waiting_start < std::chrono::seconds(5),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(element(small_input, 1, 0) == 2.f, framework::LogLevel::ERRORS);
+}
+
+/** Validate that a partial batch waits for the queue delay, takes in the requests arriving meanwhile and zeroes the
+ * unused entries
+ */
+TEST_CASE(BatchingWindow, framework::DatasetMode::ALL)
+{
+    RequestBatcherInfo info;
+    info.max_batch_size  = 4U;
+    info.max_queue_delay = std::chrono::milliseconds(200);
+
+    RequestBatcher batcher(info);
+    Tensor         input;
+    init_batch_tensor(input, info.max_batch_size);
+    std::fill_n(reinterpret_cast<float *>(input.buffer()), input.info()->tensor_shape().total_size(), -1.f);
+
+    Requests   requests(2U);
+    const auto start = std::chrono::steady_clock::now();
+    requests.submit(batcher, 0);
+    auto gathered =
+        std::async(std::launch::async, [&]() { return batcher.input_accessor()->access_tensor(input); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    requests.submit(batcher, 1);
+
+    ARM_COMPUTE_EXPECT(gathered.get(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::chrono::steady_clock::now() - start >= info.max_queue_delay, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(element(input, 0, 0) == 1.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(element(input, 1, 0) == 2.f, framework::LogLevel::ERRORS);
+    for (size_t sample = 2; sample < info.max_batch_size; ++sample)
+    {
+        for (size_t i = 0; i < sample_size; ++i)
+        {
+            ARM_COMPUTE_EXPECT(element(input, sample, i) == 0.f, framework::LogLevel::ERRORS);
+        }
+    }
+
+    const RequestBatcherStats stats = batcher.stats();
+    ARM_COMPUTE_EXPECT(stats.max_queueing_delay >= info.max_queue_delay, framework::LogLevel::ERRORS);
+}
+
+/** Validate that every request gets its own sample of the batched output, with padded and unpadded tensors */
+TEST_CASE(ResultSplit, framework::DatasetMode::ALL)
+{
+    for (const bool padded : {false, true})
+    {
+        RequestBatcherInfo info;
+        info.max_batch_size  = 3U;
+        info.max_queue_delay = std::chrono::seconds(10);
+
+        RequestBatcher batcher(info);
+        Tensor         input, output;
+        init_batch_tensor(input, info.max_batch_size, padded);
+        init_batch_tensor(output, info.max_batch_size, padded);
+
+        Requests requests(3U);
+        for (size_t r = 0; r < 3U; ++r)
+        {
+            requests.submit(batcher, r);
+        }
+
+        ARM_COMPUTE_EXPECT(batcher.input_accessor()->access_tensor(input), framework::LogLevel::ERRORS);
+        run_batch(input, output);
+        ARM_COMPUTE_EXPECT(batcher.output_accessor()->access_tensor(output), framework::LogLevel::ERRORS);
+
+        for (size_t r = 0; r < 3U; ++r)
+        {
+            ARM_COMPUTE_EXPECT(requests.is_done(r), framework::LogLevel::ERRORS);
+            for (size_t i = 0; i < sample_size; ++i)
+            {
+                ARM_COMPUTE_EXPECT(requests.outputs[r][i] == static_cast<float>(r + 1) * 10.f,
+                                   framework::LogLevel::ERRORS);
+            }
+        }
+
+        const RequestBatcherStats stats = batcher.stats();
+        ARM_COMPUTE_EXPECT(stats.num_requests == 3U, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(stats.num_batches == 1U, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(stats.batch_fill_ratio == 1.f, framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validate that stopping serves the queued requests without waiting for the queue delay, then ends the execution */
+TEST_CASE(Shutdown, framework::DatasetMode::ALL)
+{
+    RequestBatcherInfo info;
+    info.max_batch_size  = 4U;
+    info.max_queue_delay = std::chrono::seconds(10);
+
+    RequestBatcher batcher(info);
+    auto           input_accessor  = batcher.input_accessor();
+    auto           output_accessor = batcher.output_accessor();
+
+    Tensor input, output;
+    init_batch_tensor(input, info.max_batch_size);
+    init_batch_tensor(output, info.max_batch_size);
+
+    // The queued requests are drained
+    Requests requests(2U);
+    requests.submit(batcher, 0);
+    requests.submit(batcher, 1);
+    batcher.stop();
+
+    const auto start = std::chrono::steady_clock::now();
+    ARM_COMPUTE_EXPECT(input_accessor->access_tensor(input), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::chrono::steady_clock::now() - start < std::chrono::seconds(5), framework::LogLevel::ERRORS);
+    run_batch(input, output);
+    ARM_COMPUTE_EXPECT(output_accessor->access_tensor(output), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(requests.is_done(0) && requests.is_done(1), framework::LogLevel::ERRORS);
+
+    // Then the execution ends
+    ARM_COMPUTE_EXPECT(!input_accessor->access_tensor(input), framework::LogLevel::ERRORS);
+
+    const RequestBatcherStats stats = batcher.stats();
+    ARM_COMPUTE_EXPECT(stats.num_requests == 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.batch_fill_ratio == 0.5f, framework::LogLevel::ERRORS);
+
+    // An input accessor waiting for requests is released by the stop
+    RequestBatcher idle_batcher(info);
+    auto idle = std::async(std::launch::async, [&]() { return idle_batcher.input_accessor()->access_tensor(input); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    idle_batcher.stop();
+    ARM_COMPUTE_EXPECT(!idle.get(), framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // RequestBatcher
+TEST_SUITE_END() // UNIT
+#endif // !defined(BARE_METAL)
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, 2025 Arm Limited.
+ * Copyright (c) 2020-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -113,6 +113,39 @@ TEST_CASE(SubTensorPaddingExpansion, framework::DatasetMode::ALL)
     }
 }
 
+/** Validate strided sub-tensor views
+ *
+ * Tests performed:
+ *  - Negative testing on a view whose steps go out of the parent
+ *  - Negative testing on non-positive steps
+ *  - Strides and offsets are the parent ones scaled by the steps
+ */
+TEST_CASE(StridedSubTensor, framework::DatasetMode::ALL)
+{
+    TensorInfo tensor_info(TensorShape(23U, 17U, 3U), 1, DataType::F32);
+
+    // Negative testing
+    ARM_COMPUTE_EXPECT_THROW(SubTensorInfo(&tensor_info, TensorShape(23U, 6U, 2U), Coordinates(0, 1, 0),
+                                           Coordinates(1, 4, 2)),
+                             framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_THROW(SubTensorInfo(&tensor_info, TensorShape(23U, 6U, 2U), Coordinates(0, 1, 0),
+                                           Coordinates(1, 0, 2)),
+                             framework::LogLevel::ERRORS);
+
+    // Every third row of every other plane
+    SubTensorInfo sub_tensor_info(&tensor_info, TensorShape(23U, 6U, 2U), Coordinates(0, 1, 0), Coordinates(1, 3, 2));
+    const Strides &strides = sub_tensor_info.strides_in_bytes();
+    ARM_COMPUTE_EXPECT(strides[0] == tensor_info.strides_in_bytes()[0], framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(strides[1] == 3 * tensor_info.strides_in_bytes()[1], framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(strides[2] == 2 * tensor_info.strides_in_bytes()[2], framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(sub_tensor_info.offset_first_element_in_bytes() ==
+                           static_cast<size_t>(tensor_info.offset_element_in_bytes(Coordinates(0, 1, 0))),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(sub_tensor_info.offset_element_in_bytes(Coordinates(1, 1, 1)) ==
+                           tensor_info.offset_element_in_bytes(Coordinates(1, 4, 2)),
+                       framework::LogLevel::ERRORS);
+}
+
 TEST_CASE(DynamicShapesNotSupported, framework::DatasetMode::ALL)
 {
     // Static shape at init time
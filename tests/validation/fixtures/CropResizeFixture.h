@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,7 +85,8 @@ protected:
                               InterpolationPolicy  method,
                               float                extrapolation_value,
                               bool                 is_outside_bounds,
-                              DataType             data_type)
+                              DataType             data_type,
+                              int                  updated_boxes_seed = -1)
     {
         TensorShape dst_shape(src_shape[0], crop_size.x, crop_size.y, boxes_shape[1]);
 
@@ -120,6 +121,14 @@ protected:
 
         // Compute function
         crop.run();
+
+        // Run again with new boxes, without reconfiguring
+        if (updated_boxes_seed >= 0)
+        {
+            fill(AccessorType(boxes), updated_boxes_seed, is_outside_bounds ? 0.0f - out_of_bounds_reach : 0.0f,
+                 is_outside_bounds ? 1.0f + out_of_bounds_reach : 1.0f);
+            crop.run();
+        }
         return dst;
     }
 
@@ -129,7 +138,8 @@ protected:
                                           InterpolationPolicy  method,
                                           float                extrapolation_value,
                                           bool                 is_outside_bounds,
-                                          DataType             data_type)
+                                          DataType             data_type,
+                                          int                  boxes_seed = 1)
     {
         // Create reference
         SimpleTensor<T>       src{src_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC};
@@ -138,7 +148,7 @@ protected:
 
         // Fill reference
         fill(src, 0);
-        fill(boxes, 1, is_outside_bounds ? 0.0f - out_of_bounds_reach : 0.0f,
+        fill(boxes, boxes_seed, is_outside_bounds ? 0.0f - out_of_bounds_reach : 0.0f,
              is_outside_bounds ? 1.0f + out_of_bounds_reach : 1.0f);
         fill(boxes_ind, 2, 0, static_cast<int32_t>(src.shape()[3] - 1));
 
@@ -154,6 +164,28 @@ protected:
     TensorType          _target{};
     SimpleTensor<float> _reference{};
 };
+
+/** Fixture updating the boxes after a first run and running the function again, without reconfiguring it */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class CropResizeUpdatedBoxesFixture : public CropResizeFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape         src_shape,
+               TensorShape         boxes_shape,
+               Coordinates2D       crop_size,
+               InterpolationPolicy method,
+               float               extrapolation_value,
+               bool                is_outside_bounds,
+               DataType            data_type)
+    {
+        constexpr int updated_boxes_seed = 3;
+
+        this->_target    = this->compute_target(src_shape, boxes_shape, crop_size, method, extrapolation_value,
+                                                is_outside_bounds, data_type, updated_boxes_seed);
+        this->_reference = this->compute_reference(src_shape, boxes_shape, crop_size, method, extrapolation_value,
+                                                   is_outside_bounds, data_type, updated_boxes_seed);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
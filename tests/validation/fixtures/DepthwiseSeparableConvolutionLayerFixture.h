@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture running a depthwise convolution followed by a 1x1 pointwise convolution in NHWC
+ *
+ * The reference runs the two convolutions and their activations one after the other, in NCHW.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionLayerValidationFixture : public framework::Fixture
+{
+public:
+    using TBias = typename std::conditional<std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                                            int32_t,
+                                            T>::type;
+
+    void setup(TensorShape         input_shape,
+               Size2D              kernel_size,
+               PadStrideInfo       pad_stride_info,
+               Size2D              dilation,
+               unsigned int        out_channels,
+               ActivationLayerInfo dw_act_info,
+               ActivationLayerInfo pw_act_info,
+               DataType            data_type,
+               QuantizationInfo    input_qinfo,
+               QuantizationInfo    weights_qinfo,
+               QuantizationInfo    dw_output_qinfo,
+               QuantizationInfo    output_qinfo)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _data_type     = data_type;
+        _bias_type     = is_data_type_quantized(data_type) ? DataType::S32 : data_type;
+        _input_qinfo   = input_qinfo;
+        _weights_qinfo = weights_qinfo;
+        _output_qinfo  = output_qinfo;
+        _info = DepthwiseSeparableConv2dInfo(pad_stride_info, dilation, dw_act_info, pw_act_info, dw_output_qinfo);
+
+        const unsigned int channels = input_shape[2];
+        const TensorShape  dw_weights_shape(kernel_size.width, kernel_size.height, channels);
+        const TensorShape  dw_biases_shape(channels);
+        const TensorShape  pw_weights_shape(1U, 1U, channels, out_channels);
+        const TensorShape  pw_biases_shape(out_channels);
+
+        const ConvolutionInfo dw_conv_info{pad_stride_info, 1, dw_act_info, dilation};
+        const TensorShape     dw_output_shape = misc::shape_calculator::compute_depthwise_convolution_shape(
+            TensorInfo(input_shape, 1, data_type), TensorInfo(dw_weights_shape, 1, data_type), dw_conv_info);
+        TensorShape output_shape = dw_output_shape;
+        output_shape.set(2, out_channels);
+
+        _target    = compute_target(input_shape, dw_weights_shape, dw_biases_shape, pw_weights_shape, pw_biases_shape,
+                                    output_shape);
+        _reference = compute_reference(input_shape, dw_weights_shape, dw_biases_shape, pw_weights_shape,
+                                       pw_biases_shape, dw_output_shape, output_shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F32:
+            case DataType::F16:
+                library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+                break;
+            case DataType::S32:
+                library->fill_tensor_uniform(tensor, i, -100, 100);
+                break;
+            default:
+                library->fill_tensor_uniform(tensor, i);
+                break;
+        }
+    }
+
+    TensorType compute_target(TensorShape input_shape,
+                              TensorShape dw_weights_shape,
+                              TensorShape dw_biases_shape,
+                              TensorShape pw_weights_shape,
+                              TensorShape pw_biases_shape,
+                              TensorShape output_shape)
+    {
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+        permute(dw_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(pw_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(output_shape, PermutationVector(2U, 0U, 1U));
+
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(input_shape, _data_type, 1, _input_qinfo, DataLayout::NHWC);
+        TensorType dw_weights =
+            create_tensor<TensorType>(dw_weights_shape, _data_type, 1, _weights_qinfo, DataLayout::NHWC);
+        TensorType dw_biases = create_tensor<TensorType>(dw_biases_shape, _bias_type, 1, QuantizationInfo(),
+                                                         DataLayout::NHWC);
+        TensorType pw_weights =
+            create_tensor<TensorType>(pw_weights_shape, _data_type, 1, _weights_qinfo, DataLayout::NHWC);
+        TensorType pw_biases = create_tensor<TensorType>(pw_biases_shape, _bias_type, 1, QuantizationInfo(),
+                                                         DataLayout::NHWC);
+        TensorType dst = create_tensor<TensorType>(output_shape, _data_type, 1, _output_qinfo, DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType conv;
+        ARM_COMPUTE_ERROR_THROW_ON(conv.validate(src.info(), dw_weights.info(), dw_biases.info(), pw_weights.info(),
+                                                 pw_biases.info(), dst.info(), _info));
+        conv.configure(&src, &dw_weights, &dw_biases, &pw_weights, &pw_biases, &dst, _info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dw_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dw_biases.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(pw_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(pw_biases.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dw_weights.allocator()->allocate();
+        dw_biases.allocator()->allocate();
+        pw_weights.allocator()->allocate();
+        pw_biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(dw_weights), 1);
+        fill(AccessorType(dw_biases), 2);
+        fill(AccessorType(pw_weights), 3);
+        fill(AccessorType(pw_biases), 4);
+
+        // Compute function
+        conv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape,
+                                      const TensorShape &dw_weights_shape,
+                                      const TensorShape &dw_biases_shape,
+                                      const TensorShape &pw_weights_shape,
+                                      const TensorShape &pw_biases_shape,
+                                      const TensorShape &dw_output_shape,
+                                      const TensorShape &output_shape)
+    {
+        // Create reference
+        SimpleTensor<T>     src{input_shape, _data_type, 1, _input_qinfo};
+        SimpleTensor<T>     dw_weights{dw_weights_shape, _data_type, 1, _weights_qinfo};
+        SimpleTensor<TBias> dw_biases{dw_biases_shape, _bias_type};
+        SimpleTensor<T>     pw_weights{pw_weights_shape, _data_type, 1, _weights_qinfo};
+        SimpleTensor<TBias> pw_biases{pw_biases_shape, _bias_type};
+
+        // Fill reference
+        fill(src, 0);
+        fill(dw_weights, 1);
+        fill(dw_biases, 2);
+        fill(pw_weights, 3);
+        fill(pw_biases, 4);
+
+        SimpleTensor<T> dw_dst =
+            reference::depthwise_convolution(src, dw_weights, dw_biases, dw_output_shape, _info.dw_conv_info, 1,
+                                             _info.dw_dilation, _info.dw_output_qinfo);
+        if (_info.dw_act_info.enabled())
+        {
+            dw_dst = reference::activation_layer<T>(dw_dst, _info.dw_act_info);
+        }
+
+        SimpleTensor<T> dst = reference::convolution_layer<T, T, TBias, T>(
+            dw_dst, pw_weights, pw_biases, output_shape, PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), 1, _output_qinfo);
+        if (_info.pw_act_info.enabled())
+        {
+            dst = reference::activation_layer<T>(dst, _info.pw_act_info);
+        }
+        return dst;
+    }
+
+    TensorType                   _target{};
+    SimpleTensor<T>              _reference{};
+    DepthwiseSeparableConv2dInfo _info{};
+    DataType                     _data_type{};
+    DataType                     _bias_type{};
+    QuantizationInfo             _input_qinfo{};
+    QuantizationInfo             _weights_qinfo{};
+    QuantizationInfo             _output_qinfo{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_DEPTHWISESEPARABLECONVOLUTIONLAYERFIXTURE_H
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEFUSIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEFUSIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseFusionInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/DequantizationLayer.h"
+#include "tests/validation/reference/PixelWiseMultiplication.h"
+#include "tests/validation/reference/QuantizationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture running the program dst = act((a + b) * c) - a
+ *
+ * b is broadcast along the first dimension and c is a 1D tensor broadcast along all the other dimensions,
+ * so that both broadcast paths of the engine are covered.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename TIn, typename TOut>
+class ElementwiseFusionValidationFixture : public framework::Fixture
+{
+public:
+    void setup(const TensorShape  &shape,
+               DataType            data_type,
+               DataType            output_data_type,
+               ActivationLayerInfo act_info,
+               QuantizationInfo    qinfo,
+               QuantizationInfo    output_qinfo)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _info = ElementwiseFusionInfo(3);
+        const int sum  = _info.add_binary(ElementwiseFusionOp::ADD, _info.input(0), _info.input(1));
+        const int prod = _info.add_binary(ElementwiseFusionOp::MUL, sum, _info.input(2));
+        const int act  = _info.add_activation(prod, act_info);
+        _info.add_binary(ElementwiseFusionOp::SUB, act, _info.input(0));
+
+        TensorShape b_shape = shape;
+        b_shape.set(0, 1);
+        const TensorShape c_shape(shape.x());
+
+        _target    = compute_target(shape, b_shape, c_shape, data_type, output_data_type, qinfo, output_qinfo);
+        _reference = compute_reference(shape, b_shape, c_shape, data_type, output_data_type, act_info, qinfo,
+                                       output_qinfo);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F32:
+                library->fill_tensor_uniform(tensor, i, -5.f, 5.f);
+                break;
+            case DataType::F16:
+                library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+                break;
+            default:
+                library->fill_tensor_uniform(tensor, i);
+                break;
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape,
+                              const TensorShape &b_shape,
+                              const TensorShape &c_shape,
+                              DataType           data_type,
+                              DataType           output_data_type,
+                              QuantizationInfo   qinfo,
+                              QuantizationInfo   output_qinfo)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape, data_type, 1, qinfo);
+        TensorType b   = create_tensor<TensorType>(b_shape, data_type, 1, qinfo);
+        TensorType c   = create_tensor<TensorType>(c_shape, data_type, 1, qinfo);
+        TensorType dst = create_tensor<TensorType>(shape, output_data_type, 1, output_qinfo);
+
+        // Create and configure function
+        FunctionType fusion;
+        ARM_COMPUTE_ERROR_THROW_ON(fusion.validate({a.info(), b.info(), c.info()}, dst.info(), _info));
+        fusion.configure({&a, &b, &c}, &dst, _info);
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(c.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        c.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        fill(AccessorType(c), 2);
+
+        // Compute function
+        fusion.run();
+
+        return dst;
+    }
+
+    SimpleTensor<TOut> compute_reference(const TensorShape  &shape,
+                                         const TensorShape  &b_shape,
+                                         const TensorShape  &c_shape,
+                                         DataType            data_type,
+                                         DataType            output_data_type,
+                                         ActivationLayerInfo act_info,
+                                         QuantizationInfo    qinfo,
+                                         QuantizationInfo    output_qinfo)
+    {
+        // Create reference
+        SimpleTensor<TIn> a{shape, data_type, 1, qinfo};
+        SimpleTensor<TIn> b{b_shape, data_type, 1, qinfo};
+        SimpleTensor<TIn> c{c_shape, data_type, 1, qinfo};
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+        fill(c, 2);
+
+        // The engine computes every intermediate value in F32
+        const SimpleTensor<float> a_f32 = to_float(a);
+        const SimpleTensor<float> b_f32 = to_float(b);
+        const SimpleTensor<float> c_f32 = to_float(c);
+
+        SimpleTensor<float> sum{shape, DataType::F32};
+        reference::arithmetic_operation<float>(reference::ArithmeticOperation::ADD, a_f32, b_f32, sum,
+                                               ConvertPolicy::WRAP);
+        SimpleTensor<float> prod = reference::pixel_wise_multiplication<float, float, float>(
+            sum, c_f32, 1.f, ConvertPolicy::WRAP, RoundingPolicy::TO_ZERO, DataType::F32);
+        SimpleTensor<float> act = reference::activation_layer<float>(prod, act_info);
+        SimpleTensor<float> res{shape, DataType::F32};
+        reference::arithmetic_operation<float>(reference::ArithmeticOperation::SUB, act, a_f32, res,
+                                               ConvertPolicy::WRAP);
+
+        SimpleTensor<TOut> dst{shape, output_data_type, 1, output_qinfo};
+        from_float(res, dst);
+        return dst;
+    }
+
+    TensorType            _target{};
+    SimpleTensor<TOut>    _reference{};
+    ElementwiseFusionInfo _info{};
+
+private:
+    template <typename U>
+    static SimpleTensor<float> to_float(const SimpleTensor<U> &src)
+    {
+        SimpleTensor<float> dst{src.shape(), DataType::F32};
+        for (int i = 0; i < src.num_elements(); ++i)
+        {
+            dst[i] = static_cast<float>(src[i]);
+        }
+        return dst;
+    }
+    static SimpleTensor<float> to_float(const SimpleTensor<uint8_t> &src)
+    {
+        return reference::dequantization_layer<float>(src);
+    }
+    static SimpleTensor<float> to_float(const SimpleTensor<int8_t> &src)
+    {
+        return reference::dequantization_layer<float>(src);
+    }
+
+    template <typename U>
+    static void from_float(const SimpleTensor<float> &src, SimpleTensor<U> &dst)
+    {
+        for (int i = 0; i < src.num_elements(); ++i)
+        {
+            dst[i] = static_cast<U>(src[i]);
+        }
+    }
+    static void from_float(const SimpleTensor<float> &src, SimpleTensor<uint8_t> &dst)
+    {
+        dst = reference::quantization_layer<float, uint8_t>(src, dst.data_type(), dst.quantization_info());
+    }
+    static void from_float(const SimpleTensor<float> &src, SimpleTensor<int8_t> &dst)
+    {
+        dst = reference::quantization_layer<float, int8_t>(src, dst.data_type(), dst.quantization_info());
+    }
+};
+/** Fixture running the program dst = cast(a + b) - a on F32 tensors */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class ElementwiseFusionCastValidationFixture : public framework::Fixture
+{
+public:
+    void setup(const TensorShape &shape, DataType cast_data_type, QuantizationInfo cast_qinfo)
+    {
+        _info          = ElementwiseFusionInfo(2);
+        const int sum  = _info.add_binary(ElementwiseFusionOp::ADD, _info.input(0), _info.input(1));
+        const int cast = _info.add_cast(sum, cast_data_type, cast_qinfo);
+        _info.add_binary(ElementwiseFusionOp::SUB, cast, _info.input(0));
+
+        _target    = compute_target(shape);
+        _reference = compute_reference(shape, cast_data_type, cast_qinfo);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -5.f, 5.f);
+    }
+
+    TensorType compute_target(const TensorShape &shape)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape, DataType::F32);
+        TensorType b   = create_tensor<TensorType>(shape, DataType::F32);
+        TensorType dst = create_tensor<TensorType>(shape, DataType::F32);
+
+        // Create and configure function
+        FunctionType fusion;
+        ARM_COMPUTE_ERROR_THROW_ON(fusion.validate({a.info(), b.info()}, dst.info(), _info));
+        fusion.configure({&a, &b}, &dst, _info);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+
+        // Compute function
+        fusion.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &shape,
+                                          DataType           cast_data_type,
+                                          QuantizationInfo   cast_qinfo)
+    {
+        // Create reference
+        SimpleTensor<float> a{shape, DataType::F32};
+        SimpleTensor<float> b{shape, DataType::F32};
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+
+        SimpleTensor<float> sum{shape, DataType::F32};
+        reference::arithmetic_operation<float>(reference::ArithmeticOperation::ADD, a, b, sum, ConvertPolicy::WRAP);
+
+        SimpleTensor<float> cast{shape, DataType::F32};
+        switch (cast_data_type)
+        {
+            case DataType::QASYMM8:
+                cast = reference::dequantization_layer<float>(
+                    reference::quantization_layer<float, uint8_t>(sum, cast_data_type, cast_qinfo));
+                break;
+            case DataType::QASYMM8_SIGNED:
+                cast = reference::dequantization_layer<float>(
+                    reference::quantization_layer<float, int8_t>(sum, cast_data_type, cast_qinfo));
+                break;
+            case DataType::F16:
+                for (int i = 0; i < sum.num_elements(); ++i)
+                {
+                    cast[i] = static_cast<float>(half(sum[i]));
+                }
+                break;
+            default:
+                cast = sum;
+                break;
+        }
+
+        SimpleTensor<float> dst{shape, DataType::F32};
+        reference::arithmetic_operation<float>(reference::ArithmeticOperation::SUB, cast, a, dst, ConvertPolicy::WRAP);
+        return dst;
+    }
+
+    TensorType            _target{};
+    SimpleTensor<float>   _reference{};
+    ElementwiseFusionInfo _info{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEFUSIONFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, 2025 Arm Limited.
+ * Copyright (c) 2019-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -130,6 +130,97 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+/** Validates the transforms of real signals: the forward FFT of a real input and the inverse FFT to a real output */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTRealValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type, FFTDirection direction)
+    {
+        // Real signal and its spectrum
+        SimpleTensor<T> signal{shape, data_type, 1};
+        fill(signal);
+        SimpleTensor<T> complex_signal{shape, data_type, 2};
+        for (int i = 0; i < signal.num_elements(); ++i)
+        {
+            complex_signal[2 * i]     = signal[i];
+            complex_signal[2 * i + 1] = T(0);
+        }
+        SimpleTensor<T> spectrum = std::is_same<InfoType, FFT1DInfo>::value
+                                       ? reference::dft_1d(complex_signal, reference::FFTDirection::Forward)
+                                       : reference::dft_2d(complex_signal, reference::FFTDirection::Forward);
+
+        const bool is_inverse = direction == FFTDirection::Inverse;
+        _target               = compute_target(is_inverse ? spectrum : signal, is_inverse ? 1 : 2, direction);
+        _reference            = is_inverse ? signal : spectrum;
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-5.0f, 5.0f};
+                library->fill(tensor, distribution, 0);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-5.0f, 5.0f);
+                library->fill(tensor, distribution, 0);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, 0);
+        }
+    }
+
+    TensorType compute_target(const SimpleTensor<T> &input, int output_channels, FFTDirection direction)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(input.shape(), input.data_type(), input.num_channels());
+        TensorType dst = create_tensor<TensorType>(input.shape(), input.data_type(), output_channels);
+
+        // Create and configure function
+        InfoType info{};
+        info.direction = direction;
+        FunctionType fft;
+        fft.configure(&src, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({&src, &dst});
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Copy the input
+        AccessorType src_accessor(src);
+        for (int i = 0; i < input.num_elements(); ++i)
+        {
+            const Coordinates coord = index2coord(input.shape(), i);
+            std::copy_n(static_cast<const RawTensor::value_type *>(input(coord)), input.element_size(),
+                        static_cast<RawTensor::value_type *>(src_accessor(coord)));
+        }
+
+        // Compute function
+        fft.run();
+
+        return dst;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FFTConvolutionValidationGenericFixture : public framework::Fixture
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -733,6 +733,132 @@ public:
             src_shape, weights_shape, bias_shape, dst_shape, data_type, activation_info, true, false, false, false);
     }
 };
+
+/** Fixture for F16/F32 fully connected layers with int8 per-channel weights, whose input is quantized at run time */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedLayerDynamicQuantizedFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         input_shape,
+               TensorShape         weights_shape,
+               TensorShape         bias_shape,
+               TensorShape         output_shape,
+               DataType            data_type,
+               ActivationLayerInfo activation_info)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _data_type       = data_type;
+        _activation_info = activation_info;
+        _hash            = weights_shape[0] + weights_shape[1] + output_shape[0] + output_shape[1];
+
+        // One scale per output channel
+        std::mt19937                          generator(library->seed() + _hash);
+        std::uniform_real_distribution<float> distribution_scale(0.5f / 127.f, 2.f / 127.f);
+        std::vector<float>                    scales(weights_shape[1]);
+        for (auto &scale : scales)
+        {
+            scale = distribution_scale(generator);
+        }
+        _weights_q_info = QuantizationInfo(scales);
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        if (tensor.data_type() == DataType::QSYMM8_PER_CHANNEL)
+        {
+            std::uniform_int_distribution<int32_t> distribution(-127, 127);
+            library->fill(tensor, distribution, i);
+        }
+        else if (tensor.data_type() == DataType::F16)
+        {
+            arm_compute::utils::uniform_real_distribution_16bit<half> distribution(-1.0f, 1.0f);
+            library->fill(tensor, distribution, i);
+        }
+        else
+        {
+            std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+            library->fill(tensor, distribution, i);
+        }
+    }
+
+    TensorType compute_target(const TensorShape &input_shape,
+                              const TensorShape &weights_shape,
+                              const TensorShape &bias_shape,
+                              const TensorShape &output_shape)
+    {
+        TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1);
+        TensorType weights = create_tensor<TensorType>(weights_shape, DataType::QSYMM8_PER_CHANNEL, 1, _weights_q_info);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, _data_type, 1);
+        TensorType dst     = create_tensor<TensorType>(output_shape, _data_type, 1);
+
+        FullyConnectedLayerInfo fc_info;
+        fc_info.activation_info = _activation_info;
+
+        FunctionType fc;
+        fc.configure(&src, &weights, &bias, &dst, fc_info);
+
+        add_padding_x({&src, &bias, &dst});
+
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        fill(AccessorType(src), 0 + _hash);
+        fill(AccessorType(weights), 1 + _hash);
+        fill(AccessorType(bias), 2 + _hash);
+
+        // Run twice to check that the prepared weights are reused correctly
+        fc.run();
+        fc.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape,
+                                      const TensorShape &weights_shape,
+                                      const TensorShape &bias_shape,
+                                      const TensorShape &output_shape)
+    {
+        SimpleTensor<T>      src{input_shape, _data_type, 1};
+        SimpleTensor<int8_t> weights_q{weights_shape, DataType::QSYMM8_PER_CHANNEL, 1, _weights_q_info};
+        SimpleTensor<T>      weights{weights_shape, _data_type, 1};
+        SimpleTensor<T>      bias{bias_shape, _data_type, 1};
+
+        fill(src, 0 + _hash);
+        fill(weights_q, 1 + _hash);
+        fill(bias, 2 + _hash);
+
+        // The reference runs in float with the dequantized weights
+        const std::vector<float> &scales = _weights_q_info.scale();
+        for (int i = 0; i < weights.num_elements(); ++i)
+        {
+            const Coordinates coord = index2coord(weights_shape, i);
+            weights[i]              = static_cast<T>(weights_q[i] * scales[coord.y()]);
+        }
+
+        return reference::activation_layer(
+            reference::fully_connected_layer<T>(src, weights, bias, output_shape, QuantizationInfo()),
+            _activation_info);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<T>     _reference{};
+    DataType            _data_type{};
+    QuantizationInfo    _weights_q_info{};
+    ActivationLayerInfo _activation_info{};
+    int                 _hash{0};
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
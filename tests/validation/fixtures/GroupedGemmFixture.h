@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_GROUPEDGEMMFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_GROUPEDGEMMFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/GroupedGemm.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture running a grouped GEMM
+ *
+ * The function is first run with every row routed to the last group, then run again with @p group_sizes, to check
+ * that the sizes are read on every run rather than at configure time.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GroupedGemmValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape          a_shape,
+               unsigned int         n,
+               std::vector<int32_t> group_sizes,
+               bool                 has_biases,
+               ActivationLayerInfo  act_info,
+               DataType             data_type)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _data_type  = data_type;
+        _has_biases = has_biases;
+        _info       = GroupedGemmInfo(act_info);
+
+        const unsigned int num_groups = group_sizes.size();
+        const TensorShape  b_shape(n, a_shape[0], num_groups);
+        const TensorShape  biases_shape(n, num_groups);
+
+        _target    = compute_target(a_shape, b_shape, biases_shape, group_sizes);
+        _reference = compute_reference(a_shape, b_shape, biases_shape, group_sizes);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+    }
+
+    TensorType compute_target(const TensorShape          &a_shape,
+                              const TensorShape          &b_shape,
+                              const TensorShape          &biases_shape,
+                              const std::vector<int32_t> &group_sizes)
+    {
+        // Create tensors
+        TensorType a           = create_tensor<TensorType>(a_shape, _data_type);
+        TensorType b           = create_tensor<TensorType>(b_shape, _data_type);
+        TensorType biases      = create_tensor<TensorType>(biases_shape, _data_type);
+        TensorType sizes       = create_tensor<TensorType>(TensorShape(group_sizes.size()), DataType::S32);
+        TensorType d           = create_tensor<TensorType>(TensorShape(b_shape[0], a_shape[1]), _data_type);
+        TensorType *biases_ptr = _has_biases ? &biases : nullptr;
+
+        // Create and configure function
+        FunctionType gemm;
+        ARM_COMPUTE_ERROR_THROW_ON(gemm.validate(a.info(), b.info(), _has_biases ? biases.info() : nullptr,
+                                                 sizes.info(), d.info(), _info));
+        gemm.configure(&a, &b, biases_ptr, &sizes, &d, _info);
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(sizes.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(d.info()->is_resizable());
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        biases.allocator()->allocate();
+        sizes.allocator()->allocate();
+        d.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        fill(AccessorType(biases), 2);
+
+        // Route every row to the last group first
+        std::vector<int32_t> last_group(group_sizes.size(), 0);
+        last_group.back() = static_cast<int32_t>(a_shape[1]);
+        library->fill_static_values(AccessorType(sizes), last_group);
+        gemm.run();
+
+        // Rows outside of every group are left untouched, so clear them before the run under test
+        library->fill_tensor_value(AccessorType(d), T(0));
+        library->fill_static_values(AccessorType(sizes), group_sizes);
+        gemm.run();
+
+        return d;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape          &a_shape,
+                                      const TensorShape          &b_shape,
+                                      const TensorShape          &biases_shape,
+                                      const std::vector<int32_t> &group_sizes)
+    {
+        // Create reference
+        SimpleTensor<T> a{a_shape, _data_type};
+        SimpleTensor<T> b{b_shape, _data_type};
+        SimpleTensor<T> biases{biases_shape, _data_type};
+
+        // Fill reference. Missing biases are zero.
+        fill(a, 0);
+        fill(b, 1);
+        if (_has_biases)
+        {
+            fill(biases, 2);
+        }
+        else
+        {
+            library->fill_tensor_value(biases, T(0));
+        }
+
+        return reference::grouped_gemm<T>(a, b, biases, group_sizes, _info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    GroupedGemmInfo _info{};
+    DataType        _data_type{};
+    bool            _has_biases{false};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_GROUPEDGEMMFIXTURE_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_IMAGEPREPROCESSFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_IMAGEPREPROCESSFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ImagePreprocess.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture converting, resizing and normalizing an image
+ *
+ * The mean and standard deviation are the ImageNet ones, in the [0, 255] range.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ImagePreprocessValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         src_shape,
+               TensorShape         dst_size,
+               Format              format,
+               InterpolationPolicy interpolation,
+               SamplingPolicy      sampling_policy,
+               bool                bgr,
+               DataLayout          data_layout,
+               DataType            data_type,
+               QuantizationInfo    dst_qinfo)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _info      = ImagePreprocessInfo(format, {{123.675f, 116.28f, 103.53f}}, {{58.395f, 57.12f, 57.375f}},
+                                         interpolation, sampling_policy, bgr);
+        _dst_qinfo = dst_qinfo;
+
+        const TensorShape dst_shape(dst_size[0], dst_size[1], 3U);
+        _target    = compute_target(src_shape, dst_shape, data_layout, data_type);
+        _reference = compute_reference(src_shape, dst_shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i);
+    }
+
+    TensorType
+    compute_target(const TensorShape &src_shape, TensorShape dst_shape, DataLayout data_layout, DataType data_type)
+    {
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        const bool is_nv12 = _info.format == Format::NV12;
+        TensorType src     = create_tensor<TensorType>(src_shape, is_nv12 ? Format::U8 : _info.format);
+        TensorType src_uv;
+        if (is_nv12)
+        {
+            src_uv = create_tensor<TensorType>(TensorShape(src_shape[0] / 2, src_shape[1] / 2), Format::UV88);
+        }
+        TensorType dst = create_tensor<TensorType>(dst_shape, data_type, 1, _dst_qinfo, data_layout);
+
+        // Create and configure function
+        FunctionType preprocess;
+        ARM_COMPUTE_ERROR_THROW_ON(
+            preprocess.validate(src.info(), is_nv12 ? src_uv.info() : nullptr, dst.info(), _info));
+        preprocess.configure(&src, is_nv12 ? &src_uv : nullptr, &dst, _info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        fill(AccessorType(src), 0);
+        if (is_nv12)
+        {
+            src_uv.allocator()->allocate();
+            fill(AccessorType(src_uv), 1);
+        }
+
+        // Compute function
+        preprocess.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, const TensorShape &dst_shape)
+    {
+        // Create reference
+        const bool            is_nv12 = _info.format == Format::NV12;
+        SimpleTensor<uint8_t> src{src_shape, is_nv12 ? Format::U8 : _info.format};
+        SimpleTensor<uint8_t> src_uv{};
+        fill(src, 0);
+        if (is_nv12)
+        {
+            src_uv = SimpleTensor<uint8_t>(TensorShape(src_shape[0] / 2, src_shape[1] / 2), Format::UV88);
+            fill(src_uv, 1);
+        }
+
+        return reference::image_preprocess<T>(src, src_uv, dst_shape, _dst_qinfo, _info);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<T>     _reference{};
+    ImagePreprocessInfo _info{};
+    QuantizationInfo    _dst_qinfo{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_IMAGEPREPROCESSFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -612,6 +612,167 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename Settings, typename T>
+class MatMulDynamicQuantizedValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         shape_a,
+               TensorShape         shape_b,
+               TensorShape         output_shape,
+               bool                transpose_b,
+               DataType            data_type,
+               DataType            rhs_data_type,
+               ActivationLayerInfo act_info)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _data_type   = data_type;
+        _transpose_b = transpose_b;
+        _act_info    = act_info;
+        _hash        = shape_a[0] + shape_a[1] + shape_b[0] + shape_b[1];
+
+        // One scale per output channel for QSYMM8_PER_CHANNEL, a single one for QSYMM8
+        const size_t num_scales = rhs_data_type == DataType::QSYMM8_PER_CHANNEL ? output_shape[0] : 1;
+
+        std::mt19937                          generator(library->seed() + _hash);
+        std::uniform_real_distribution<float> distribution_scale(0.5f / 127.f, 2.f / 127.f);
+        std::vector<float>                    scales(num_scales);
+        for (auto &scale : scales)
+        {
+            scale = distribution_scale(generator);
+        }
+        _rhs_q_info = QuantizationInfo(scales);
+
+        // For brevity, the rhs shape is assumed to be not-transposed
+        if (transpose_b)
+        {
+            permute(shape_b, PermutationVector(1U, 0U));
+        }
+
+        _target    = compute_target(shape_a, shape_b, output_shape, rhs_data_type);
+        _reference = compute_reference(shape_a, shape_b, output_shape, rhs_data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::QSYMM8:
+            case DataType::QSYMM8_PER_CHANNEL:
+            {
+                std::uniform_int_distribution<int32_t> distribution(-127, 127);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-1.0f, 1.0f};
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape_a,
+                              const TensorShape &shape_b,
+                              const TensorShape &output_shape,
+                              DataType           rhs_data_type)
+    {
+        TensorType a   = create_tensor<TensorType>(shape_a, _data_type, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, rhs_data_type, 1, _rhs_q_info);
+        TensorType dst = create_tensor<TensorType>(output_shape, _data_type, 1);
+
+        MatMulInfo mm_info;
+        mm_info.adj_rhs(_transpose_b);
+
+        // Ensure values are dynamic
+        a.info()->set_are_values_constant(false);
+        b.info()->set_are_values_constant(false);
+
+        FunctionType matmul;
+        matmul.configure(&a, &b, &dst, mm_info, Settings(), _act_info);
+
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // The rhs is quantized again on every run, so run once with other values before the final run
+        fill(AccessorType(a), 100 + _hash);
+        fill(AccessorType(b), 101 + _hash);
+        matmul.run();
+
+        fill(AccessorType(a), 0 + _hash);
+        fill(AccessorType(b), 1 + _hash);
+        matmul.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a,
+                                      const TensorShape &shape_b,
+                                      const TensorShape &output_shape,
+                                      DataType           rhs_data_type)
+    {
+        // The batches of the lhs share the 2D rhs, so they are collapsed onto dimension 2
+        const TensorShape output_shape_collapsed = output_shape.collapsed_from(Window::DimZ);
+
+        SimpleTensor<T>      a{shape_a.collapsed_from(Window::DimZ), _data_type, 1};
+        SimpleTensor<int8_t> b_q{shape_b, rhs_data_type, 1, _rhs_q_info};
+        SimpleTensor<T>      b{shape_b, _data_type, 1};
+        SimpleTensor<T>      c{output_shape_collapsed, _data_type, 1};
+
+        fill(a, 0 + _hash);
+        fill(b_q, 1 + _hash);
+
+        // The reference runs in float with the dequantized rhs
+        const std::vector<float> &scales = _rhs_q_info.scale();
+        for (int i = 0; i < b.num_elements(); ++i)
+        {
+            const Coordinates coord   = index2coord(shape_b, i);
+            const size_t      channel = _transpose_b ? coord.y() : coord.x();
+            b[i]                      = static_cast<T>(b_q[i] * scales[scales.size() == 1 ? 0 : channel]);
+        }
+        if (_transpose_b)
+        {
+            b = reference::permute<T>(b, PermutationVector(1U, 0U));
+        }
+
+        auto result = reference::activation_layer<T>(reference::gemm<T>(a, b, c, 1.0f, 0.f), _act_info);
+
+        // We reshape the gemm output back if the tensor is high dimensional
+        if (output_shape_collapsed != output_shape)
+        {
+            result = reference::reshape_layer(result, output_shape);
+        }
+
+        return result;
+    }
+
+    TensorType          _target{};
+    SimpleTensor<T>     _reference{};
+    DataType            _data_type{};
+    bool                _transpose_b{false};
+    QuantizationInfo    _rhs_q_info{};
+    ActivationLayerInfo _act_info{};
+    int                 _hash{0};
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GroupedGemm.h"
+
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> grouped_gemm(const SimpleTensor<T>      &a,
+                             const SimpleTensor<T>      &b,
+                             const SimpleTensor<T>      &biases,
+                             const std::vector<int32_t> &group_sizes,
+                             const GroupedGemmInfo      &info)
+{
+    const int K    = a.shape()[0];
+    const int rows = a.shape()[1];
+    const int N    = b.shape()[0];
+
+    SimpleTensor<T> dst{TensorShape(N, rows), a.data_type()};
+    std::fill_n(dst.data(), dst.num_elements(), T(0));
+
+    int first_row = 0;
+    for (size_t g = 0; g < group_sizes.size(); ++g)
+    {
+        const int last_row = std::min(rows, first_row + std::max(group_sizes[g], 0));
+        for (int row = first_row; row < last_row; ++row)
+        {
+            for (int col = 0; col < N; ++col)
+            {
+                float acc = static_cast<float>(biases[g * N + col]);
+                for (int k = 0; k < K; ++k)
+                {
+                    acc += static_cast<float>(a[row * K + k]) * static_cast<float>(b[(g * K + k) * N + col]);
+                }
+                if (info.act_info.enabled())
+                {
+                    acc = activate_float<float>(acc, info.act_info.a(), info.act_info.b(), info.act_info.activation());
+                }
+                dst[row * N + col] = static_cast<T>(acc);
+            }
+        }
+        first_row = last_row;
+    }
+    return dst;
+}
+
+template SimpleTensor<float> grouped_gemm(const SimpleTensor<float>  &a,
+                                          const SimpleTensor<float>  &b,
+                                          const SimpleTensor<float>  &biases,
+                                          const std::vector<int32_t> &group_sizes,
+                                          const GroupedGemmInfo      &info);
+template SimpleTensor<half> grouped_gemm(const SimpleTensor<half>   &a,
+                                         const SimpleTensor<half>   &b,
+                                         const SimpleTensor<half>   &biases,
+                                         const std::vector<int32_t> &group_sizes,
+                                         const GroupedGemmInfo      &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
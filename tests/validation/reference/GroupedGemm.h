@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_GROUPEDGEMM_H
+#define ACL_TESTS_VALIDATION_REFERENCE_GROUPEDGEMM_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/SimpleTensor.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Multiplies every group of rows of @p a by the weights of its group
+ *
+ * Rows that do not belong to any group are set to zero.
+ *
+ * @param[in] a           Left-hand side [K, rows]
+ * @param[in] b           Weights [N, K, groups]
+ * @param[in] biases      Biases [N, groups]
+ * @param[in] group_sizes Number of rows of every group. Negative sizes count as empty groups.
+ * @param[in] info        Grouped GEMM descriptor
+ *
+ * @return The destination [N, rows]
+ */
+template <typename T>
+SimpleTensor<T> grouped_gemm(const SimpleTensor<T>      &a,
+                             const SimpleTensor<T>      &b,
+                             const SimpleTensor<T>      &biases,
+                             const std::vector<int32_t> &group_sizes,
+                             const GroupedGemmInfo      &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_GROUPEDGEMM_H
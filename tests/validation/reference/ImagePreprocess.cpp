@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ImagePreprocess.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Reads a source pixel and converts it to RGB with the BT.709 coefficients */
+std::array<float, 3>
+read_rgb(const SimpleTensor<uint8_t> &src, const SimpleTensor<uint8_t> &src_uv, Format format, int x, int y)
+{
+    const int width = src.shape()[0];
+
+    float yy = 0.f;
+    float u  = 0.f;
+    float v  = 0.f;
+    switch (format)
+    {
+        case Format::RGB888:
+        {
+            const uint8_t *px = src.data() + 3 * (y * width + x);
+            return {{static_cast<float>(px[0]), static_cast<float>(px[1]), static_cast<float>(px[2])}};
+        }
+        case Format::YUYV422:
+        {
+            const uint8_t *row = src.data() + 2 * y * width;
+            yy                 = row[2 * x];
+            u                  = row[4 * (x / 2) + 1];
+            v                  = row[4 * (x / 2) + 3];
+            break;
+        }
+        case Format::NV12:
+        {
+            const uint8_t *uv = src_uv.data() + 2 * ((y / 2) * (width / 2) + x / 2);
+            yy                = src.data()[y * width + x];
+            u                 = uv[0];
+            v                 = uv[1];
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported source format");
+    }
+
+    const float r = yy + 1.5748f * (v - 128.f);
+    const float g = yy - 0.1873f * (u - 128.f) - 0.4681f * (v - 128.f);
+    const float b = yy + 1.8556f * (u - 128.f);
+    return {{utility::clamp<float>(r, 0.f, 255.f), utility::clamp<float>(g, 0.f, 255.f),
+             utility::clamp<float>(b, 0.f, 255.f)}};
+}
+
+/** Source coordinate of a destination coordinate */
+float source_coordinate(int dst, float scale, SamplingPolicy sampling_policy)
+{
+    return sampling_policy == SamplingPolicy::CENTER ? (dst + 0.5f) * scale - 0.5f : dst * scale;
+}
+
+template <typename T>
+T convert_value(float value, const QuantizationInfo &qinfo);
+
+template <>
+float convert_value(float value, const QuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return value;
+}
+
+template <>
+half convert_value(float value, const QuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return half(value);
+}
+
+template <>
+uint8_t convert_value(float value, const QuantizationInfo &qinfo)
+{
+    return quantize_qasymm8(value, qinfo);
+}
+
+template <>
+int8_t convert_value(float value, const QuantizationInfo &qinfo)
+{
+    return quantize_qasymm8_signed(value, qinfo);
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> image_preprocess(const SimpleTensor<uint8_t> &src,
+                                 const SimpleTensor<uint8_t> &src_uv,
+                                 const TensorShape           &dst_shape,
+                                 const QuantizationInfo      &dst_qinfo,
+                                 const ImagePreprocessInfo   &info)
+{
+    const DataType  dst_type = std::is_same<T, float>::value     ? DataType::F32
+                               : std::is_same<T, half>::value    ? DataType::F16
+                               : std::is_same<T, uint8_t>::value ? DataType::QASYMM8
+                                                                 : DataType::QASYMM8_SIGNED;
+    SimpleTensor<T> dst{dst_shape, dst_type, 1, dst_qinfo};
+
+    const int   src_w   = src.shape()[0];
+    const int   src_h   = src.shape()[1];
+    const int   dst_w   = dst_shape[0];
+    const int   dst_h   = dst_shape[1];
+    const float scale_x = static_cast<float>(src_w) / dst_w;
+    const float scale_y = static_cast<float>(src_h) / dst_h;
+
+    for (int y = 0; y < dst_h; ++y)
+    {
+        for (int x = 0; x < dst_w; ++x)
+        {
+            std::array<float, 3> rgb{};
+            if (info.interpolation == InterpolationPolicy::BILINEAR)
+            {
+                float sx = source_coordinate(x, scale_x, info.sampling_policy);
+                float sy = source_coordinate(y, scale_y, info.sampling_policy);
+                sx       = std::max(sx, 0.f);
+                sy       = std::max(sy, 0.f);
+
+                const int   x0 = std::min(static_cast<int>(std::floor(sx)), src_w - 1);
+                const int   y0 = std::min(static_cast<int>(std::floor(sy)), src_h - 1);
+                const int   x1 = std::min(x0 + 1, src_w - 1);
+                const int   y1 = std::min(y0 + 1, src_h - 1);
+                const float dx = sx - std::floor(sx);
+                const float dy = sy - std::floor(sy);
+
+                const std::array<float, 3> tl = read_rgb(src, src_uv, info.format, x0, y0);
+                const std::array<float, 3> tr = read_rgb(src, src_uv, info.format, x1, y0);
+                const std::array<float, 3> bl = read_rgb(src, src_uv, info.format, x0, y1);
+                const std::array<float, 3> br = read_rgb(src, src_uv, info.format, x1, y1);
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const float top    = tl[c] + (tr[c] - tl[c]) * dx;
+                    const float bottom = bl[c] + (br[c] - bl[c]) * dx;
+                    rgb[c]             = top + (bottom - top) * dy;
+                }
+            }
+            else
+            {
+                const float offset = info.sampling_policy == SamplingPolicy::CENTER ? 0.5f : 0.f;
+                const int   sx     = std::min(static_cast<int>(std::floor((x + offset) * scale_x)), src_w - 1);
+                const int   sy     = std::min(static_cast<int>(std::floor((y + offset) * scale_y)), src_h - 1);
+                rgb                = read_rgb(src, src_uv, info.format, sx, sy);
+            }
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                const float value = (rgb[info.bgr ? 2 - c : c] - info.mean[c]) / info.std_dev[c];
+                dst[(c * dst_h + y) * dst_w + x] = convert_value<T>(value, dst_qinfo);
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> image_preprocess(const SimpleTensor<uint8_t> &src,
+                                              const SimpleTensor<uint8_t> &src_uv,
+                                              const TensorShape           &dst_shape,
+                                              const QuantizationInfo      &dst_qinfo,
+                                              const ImagePreprocessInfo   &info);
+template SimpleTensor<half> image_preprocess(const SimpleTensor<uint8_t> &src,
+                                             const SimpleTensor<uint8_t> &src_uv,
+                                             const TensorShape           &dst_shape,
+                                             const QuantizationInfo      &dst_qinfo,
+                                             const ImagePreprocessInfo   &info);
+template SimpleTensor<uint8_t> image_preprocess(const SimpleTensor<uint8_t> &src,
+                                                const SimpleTensor<uint8_t> &src_uv,
+                                                const TensorShape           &dst_shape,
+                                                const QuantizationInfo      &dst_qinfo,
+                                                const ImagePreprocessInfo   &info);
+template SimpleTensor<int8_t> image_preprocess(const SimpleTensor<uint8_t> &src,
+                                               const SimpleTensor<uint8_t> &src_uv,
+                                               const TensorShape           &dst_shape,
+                                               const QuantizationInfo      &dst_qinfo,
+                                               const ImagePreprocessInfo   &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_IMAGEPREPROCESS_H
+#define ACL_TESTS_VALIDATION_REFERENCE_IMAGEPREPROCESS_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/SimpleTensor.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Converts an image to RGB, resizes it and normalizes it
+ *
+ * @param[in] src       Source image, or luma plane for NV12
+ * @param[in] src_uv    Interleaved chroma plane for NV12, unused otherwise
+ * @param[in] dst_shape Shape of the destination in NCHW: [width, height, 3]
+ * @param[in] dst_qinfo Quantization of the destination, only used by quantized types
+ * @param[in] info      Preprocessing descriptor
+ *
+ * @return The destination in NCHW
+ */
+template <typename T>
+SimpleTensor<T> image_preprocess(const SimpleTensor<uint8_t> &src,
+                                 const SimpleTensor<uint8_t> &src_uv,
+                                 const TensorShape           &dst_shape,
+                                 const QuantizationInfo      &dst_qinfo,
+                                 const ImagePreprocessInfo   &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_IMAGEPREPROCESS_H
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/ExecutionPlan.h"
+
+#include "arm_compute/runtime/experimental/operators/CpuActivation.h"
+#include "arm_compute/runtime/experimental/operators/CpuGemm.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(OPERATORS)
+TEST_SUITE(ExecutionPlan)
+
+/** Test case for @ref arm_compute::experimental::ExecutionPlan
+ *
+ * Runs gemm -> relu -> bounded relu -> relu where all the intermediate tensors are provided by the plan.
+ *
+ * Checks performed in order:
+ * - The arena is smaller than the separately allocated buffers, as the first and last intermediate tensors can
+ *   share their memory.
+ * - Two runs compute the expected output
+ */
+TEST_CASE(GemmActivationChain, framework::DatasetMode::ALL)
+{
+    const auto lhs_info = TensorInfo(TensorShape(3U, 8U), 1, DataType::F32);
+    const auto rhs_info = TensorInfo(TensorShape(16U, 3U), 1, DataType::F32);
+    auto       dst_info = TensorInfo(TensorShape(16U, 8U), 1, DataType::F32);
+
+    experimental::op::CpuGemm       gemm;
+    experimental::op::CpuActivation act0;
+    experimental::op::CpuActivation act1;
+    experimental::op::CpuActivation act2;
+
+    auto tmp_info = dst_info;
+    gemm.configure(&lhs_info, &rhs_info, nullptr, &tmp_info, 1.f, 0.f, GEMMInfo());
+    act0.configure(&tmp_info, &tmp_info, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    act1.configure(&tmp_info, &tmp_info,
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 5.f));
+    act2.configure(&tmp_info, &dst_info, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+
+    Tensor lhs  = create_tensor<Tensor>(lhs_info);
+    Tensor rhs  = create_tensor<Tensor>(rhs_info);
+    Tensor dst  = create_tensor<Tensor>(dst_info);
+    Tensor tmp0 = create_tensor<Tensor>(tmp_info);
+    Tensor tmp1 = create_tensor<Tensor>(tmp_info);
+    Tensor tmp2 = create_tensor<Tensor>(tmp_info);
+
+    experimental::ExecutionPlan plan;
+    plan.manage(&tmp0);
+    plan.add_operator(&gemm,
+                      {{TensorType::ACL_SRC_0, &lhs}, {TensorType::ACL_SRC_1, &rhs}, {TensorType::ACL_DST, &tmp0}});
+    plan.manage(&tmp1);
+    plan.add_operator(&act0, {{TensorType::ACL_SRC, &tmp0}, {TensorType::ACL_DST, &tmp1}});
+    tmp0.allocator()->allocate();
+    plan.manage(&tmp2);
+    plan.add_operator(&act1, {{TensorType::ACL_SRC, &tmp1}, {TensorType::ACL_DST, &tmp2}});
+    tmp1.allocator()->allocate();
+    plan.add_operator(&act2, {{TensorType::ACL_SRC, &tmp2}, {TensorType::ACL_DST, &dst}});
+    tmp2.allocator()->allocate();
+    plan.finalize();
+
+    const experimental::ExecutionPlanMemoryStats stats = plan.memory_stats();
+    ARM_COMPUTE_EXPECT(stats.arena_size > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.arena_size < stats.naive_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.naive_size >= 3 * tmp_info.total_size(), framework::LogLevel::ERRORS);
+
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_value(Accessor(lhs), 1.f);
+    library->fill_tensor_value(Accessor(rhs), 2.f);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        library->fill_tensor_value(Accessor(dst), 0.f);
+        plan.run();
+
+        // 3 * (1 * 2) = 6, bounded to 5
+        for (size_t j = 0; j < dst_info.tensor_shape().total_size(); ++j)
+        {
+            ARM_COMPUTE_EXPECT(reinterpret_cast<float *>(dst.buffer())[j] == 5.f, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_SUITE_END() // ExecutionPlan
+TEST_SUITE_END() // OPERATORS
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,6 +88,22 @@ namespace utils
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
     os << "MLGO file : " << common_params.mlgo_file << std::endl;
+    if (!common_params.plan_file.empty())
+    {
+        os << "Plan file : " << common_params.plan_file << std::endl;
+    }
+    if (common_params.pipeline_stages > 1)
+    {
+        os << "Pipeline stages : " << common_params.pipeline_stages << std::endl;
+    }
+    if (common_params.depthwise_fusion)
+    {
+        os << "Depthwise separable fusion enabled? : " << true_str << std::endl;
+    }
+    if (common_params.residual_fusion)
+    {
+        os << "Residual fusion enabled? : " << true_str << std::endl;
+    }
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str)
        << std::endl;
     if (!common_params.data_path.empty())
@@ -134,7 +150,11 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
       tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
-      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file"))
+      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file")),
+      plan_file(parser.add_option<SimpleOption<std::string>>("plan-file")),
+      pipeline_stages(parser.add_option<SimpleOption<unsigned int>>("pipeline-stages", 1)),
+      depthwise_fusion(parser.add_option<ToggleOption>("fuse-depthwise-separable", false)),
+      residual_fusion(parser.add_option<ToggleOption>("fuse-residual", false))
 {
     std::set<arm_compute::graph::Target> supported_targets{
         Target::NEON,
@@ -182,6 +202,11 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
     mlgo_file->set_help("File to load MLGO heuristics");
+    plan_file->set_help("File to load/save the finalized graph plan");
+    pipeline_stages->set_help("Number of pipeline stages to split the graph into (NEON only)");
+    depthwise_fusion->set_help("Fuse depthwise convolutions with the pointwise convolutions following them "
+                               "(NEON and NHWC only)");
+    residual_fusion->set_help("Fuse residual additions into the convolutions producing their inputs (NEON only)");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -215,6 +240,10 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
     common_params.mlgo_file              = options.mlgo_file->value();
+    common_params.plan_file              = options.plan_file->value();
+    common_params.pipeline_stages        = options.pipeline_stages->value();
+    common_params.depthwise_fusion       = options.depthwise_fusion->value();
+    common_params.residual_fusion        = options.residual_fusion->value();
 
     return common_params;
 }
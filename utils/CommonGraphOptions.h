@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,6 +109,10 @@ struct CommonGraphParams
     std::string                      validation_path{};
     std::string                      tuner_file{};
     std::string                      mlgo_file{};
+    std::string                      plan_file{};
+    unsigned int                     pipeline_stages{1};
+    bool                             depthwise_fusion{false};
+    bool                             residual_fusion{false};
     unsigned int                     validation_range_start{0};
     unsigned int                     validation_range_end{std::numeric_limits<unsigned int>::max()};
 };
@@ -168,6 +172,10 @@ public:
     SimpleOption<std::string>              *validation_range; /**< Validation range */
     SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
     SimpleOption<std::string>              *mlgo_file;        /**< File to load the MLGO heuristics from */
+    SimpleOption<std::string>              *plan_file;        /**< File to load/store the finalized graph plan from */
+    SimpleOption<unsigned int>             *pipeline_stages;  /**< Number of pipeline stages */
+    ToggleOption                           *depthwise_fusion; /**< Fuse depthwise separable convolutions */
+    ToggleOption                           *residual_fusion;  /**< Fuse residual additions into convolutions */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,10 @@
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
+#include <sstream>
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <sys/stat.h>
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 
 using namespace arm_compute::graph_utils;
 
@@ -782,6 +786,13 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
     return true;
 }
 
+std::string RandomAccessor::data_id() const
+{
+    std::stringstream ss;
+    ss << "random:" << _lower.get<uint64_t>() << ":" << _upper.get<uint64_t>() << ":" << _seed;
+    return ss.str();
+}
+
 NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
     : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
 {
@@ -799,3 +810,21 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+std::string NumPyBinLoader::data_id() const
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    // Identify the file contents by the file metadata, which is much cheaper than reading the file
+    struct stat file_stat;
+    if (stat(_filename.c_str(), &file_stat) != 0)
+    {
+        return "";
+    }
+    std::stringstream ss;
+    ss << "npy:" << _filename << ":" << static_cast<int>(_file_layout) << ":" << file_stat.st_size << ":"
+       << file_stat.st_mtime;
+    return ss.str();
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    return "";
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}